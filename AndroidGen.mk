@@ -45,6 +45,7 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/framework/vulkan/vkObjUtil.cpp \
 	external/vulkancts/framework/vulkan/vkPipelineConstructionUtil.cpp \
 	external/vulkancts/framework/vulkan/vkPlatform.cpp \
+	external/vulkancts/framework/vulkan/vkProfilingDriver.cpp \
 	external/vulkancts/framework/vulkan/vkPrograms.cpp \
 	external/vulkancts/framework/vulkan/vkQueryUtil.cpp \
 	external/vulkancts/framework/vulkan/vkRayTracingUtil.cpp \
@@ -250,6 +251,14 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/modules/vulkan/multiview/vktMultiViewRenderUtil.cpp \
 	external/vulkancts/modules/vulkan/multiview/vktMultiViewTests.cpp \
 	external/vulkancts/modules/vulkan/pch.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceApiCallProfileTests.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceBandwidthTests.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceDescriptorTests.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceDrawCallTests.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceMemoryAllocationTests.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceSynchronizationTests.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceTests.cpp \
+	external/vulkancts/modules/vulkan/performance/vktPerformanceUtil.cpp \
 	external/vulkancts/modules/vulkan/pipeline/vktPipelineAttachmentFeedbackLoopLayoutTests.cpp \
 	external/vulkancts/modules/vulkan/pipeline/vktPipelineBindPointTests.cpp \
 	external/vulkancts/modules/vulkan/pipeline/vktPipelineBlendOperationAdvancedTests.cpp \
@@ -352,6 +361,7 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/modules/vulkan/ray_query/vktRayQueryNonUniformArgsTests.cpp \
 	external/vulkancts/modules/vulkan/ray_query/vktRayQueryOpacityMicromapTests.cpp \
 	external/vulkancts/modules/vulkan/ray_query/vktRayQueryProceduralGeometryTests.cpp \
+	external/vulkancts/modules/vulkan/ray_query/vktRayQueryReferenceTracerTests.cpp \
 	external/vulkancts/modules/vulkan/ray_query/vktRayQueryTests.cpp \
 	external/vulkancts/modules/vulkan/ray_query/vktRayQueryTraversalControlTests.cpp \
 	external/vulkancts/modules/vulkan/ray_query/vktRayQueryWatertightnessTests.cpp \
@@ -550,6 +560,7 @@ LOCAL_SRC_FILES := \
 	external/vulkancts/modules/vulkan/tessellation/vktTessellationMiscDrawTests.cpp \
 	external/vulkancts/modules/vulkan/tessellation/vktTessellationPrimitiveDiscardTests.cpp \
 	external/vulkancts/modules/vulkan/tessellation/vktTessellationShaderInputOutputTests.cpp \
+	external/vulkancts/modules/vulkan/tessellation/vktTessellationSpatialHash.cpp \
 	external/vulkancts/modules/vulkan/tessellation/vktTessellationTests.cpp \
 	external/vulkancts/modules/vulkan/tessellation/vktTessellationUserDefinedIO.cpp \
 	external/vulkancts/modules/vulkan/tessellation/vktTessellationUtil.cpp \
@@ -636,12 +647,15 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuFloatFormat.cpp \
 	framework/common/tcuFunctionLibrary.cpp \
 	framework/common/tcuFuzzyImageCompare.cpp \
+	framework/common/tcuHarnessProfile.cpp \
 	framework/common/tcuImageCompare.cpp \
 	framework/common/tcuImageIO.cpp \
 	framework/common/tcuInterval.cpp \
 	framework/common/tcuLibDrm.cpp \
 	framework/common/tcuMatrix.cpp \
 	framework/common/tcuMaybe.cpp \
+	framework/common/tcuPackArchive.cpp \
+	framework/common/tcuPerfMeasurement.cpp \
 	framework/common/tcuPlatform.cpp \
 	framework/common/tcuRGBA.cpp \
 	framework/common/tcuRandomValueIterator.cpp \
@@ -670,6 +684,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/debase/deDefs.c \
 	framework/delibs/debase/deFloat16.c \
 	framework/delibs/debase/deFloat16Test.c \
+	framework/delibs/debase/deHash128.c \
 	framework/delibs/debase/deInt32.c \
 	framework/delibs/debase/deInt32Test.c \
 	framework/delibs/debase/deMath.c \
@@ -687,6 +702,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/decpp/deDirectoryIterator.cpp \
 	framework/delibs/decpp/deDynamicLibrary.cpp \
 	framework/delibs/decpp/deFilePath.cpp \
+	framework/delibs/decpp/deHash128.cpp \
 	framework/delibs/decpp/deMemPool.cpp \
 	framework/delibs/decpp/deMeta.cpp \
 	framework/delibs/decpp/deMutex.cpp \
@@ -1270,6 +1286,7 @@ LOCAL_SRC_FILES := \
 	modules/glshared/glsFboUtil.cpp \
 	modules/glshared/glsFragOpInteractionCase.cpp \
 	modules/glshared/glsFragmentOpUtil.cpp \
+	modules/glshared/glsGpuTimer.cpp \
 	modules/glshared/glsInteractionTestUtil.cpp \
 	modules/glshared/glsLifetimeTests.cpp \
 	modules/glshared/glsLongStressCase.cpp \
@@ -1337,6 +1354,7 @@ LOCAL_C_INCLUDES := \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/modifiers \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/multiview \
 	$(deqp_dir)/external/vulkancts/modules/vulkan \
+	$(deqp_dir)/external/vulkancts/modules/vulkan/performance \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/pipeline \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/postmortem \
 	$(deqp_dir)/external/vulkancts/modules/vulkan/protected_memory \
@@ -55,7 +55,8 @@ enum OutputMode
 namespace opt
 {
 
-DE_DECLARE_COMMAND_LINE_OPT(OutMode, OutputMode);
+DE_DECLARE_COMMAND_LINE_OPT(OutMode,		OutputMode);
+DE_DECLARE_COMMAND_LINE_OPT(ImageStore,	std::string);
 
 void registerOptions (de::cmdline::Parser& parser)
 {
@@ -68,7 +69,8 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "separate",	OUTPUTMODE_SEPARATE	}
 	};
 
-	parser << Option<OutMode>("m", "mode", "Output mode", s_modes, "single");
+	parser << Option<OutMode>("m", "mode", "Output mode", s_modes, "single")
+		   << Option<ImageStore>(DE_NULL, "image-store", "Resolve stored images (--deqp-log-image-store) from given directory", "");
 }
 
 } // opt
@@ -82,6 +84,7 @@ struct CommandLine
 
 	std::string		batchResultFile;
 	std::string		outputPath;
+	std::string		imageStoreDir;
 	OutputMode		outputMode;
 };
 
@@ -101,6 +104,7 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 	}
 
 	cmdLine.outputMode		= opts.getOption<opt::OutMode>();
+	cmdLine.imageStoreDir	= opts.getOption<opt::ImageStore>();
 	cmdLine.batchResultFile	= opts.getArgs()[0];
 	cmdLine.outputPath		= opts.getArgs()[1];
 
@@ -141,10 +145,11 @@ struct BatchResultTotals
 class ResultToSingleXmlLogHandler : public xe::TestLogHandler
 {
 public:
-	ResultToSingleXmlLogHandler (xe::xml::Writer& writer, BatchResultTotals& totals)
+	ResultToSingleXmlLogHandler (xe::xml::Writer& writer, BatchResultTotals& totals, const std::string& imageStoreDir)
 		: m_writer	(writer)
 		, m_totals	(totals)
 	{
+		m_resultParser.setImageStore(imageStoreDir);
 	}
 
 	void setSessionInfo (const xe::SessionInfo&)
@@ -198,12 +203,12 @@ static void writeTotals (xe::xml::Writer& writer, const BatchResultTotals& total
 		   << Writer::EndElement;
 }
 
-static void batchResultToSingleXmlFile (const char* batchResultFilename, const char* dstFileName)
+static void batchResultToSingleXmlFile (const char* batchResultFilename, const char* dstFileName, const std::string& imageStoreDir)
 {
 	std::ofstream				out			(dstFileName, std::ios_base::binary);
 	xe::xml::Writer				writer		(out);
 	BatchResultTotals			totals;
-	ResultToSingleXmlLogHandler	handler		(writer, totals);
+	ResultToSingleXmlLogHandler	handler		(writer, totals, imageStoreDir);
 	xe::TestLogParser			parser		(&handler);
 
 	XE_CHECK(out.good());
@@ -229,10 +234,11 @@ static void batchResultToSingleXmlFile (const char* batchResultFilename, const c
 class ResultToXmlFilesLogHandler : public xe::TestLogHandler
 {
 public:
-	ResultToXmlFilesLogHandler (vector<xe::TestCaseResultHeader>& resultHeaders, const char* dstPath)
+	ResultToXmlFilesLogHandler (vector<xe::TestCaseResultHeader>& resultHeaders, const char* dstPath, const std::string& imageStoreDir)
 		: m_resultHeaders	(resultHeaders)
 		, m_dstPath			(dstPath)
 	{
+		m_resultParser.setImageStore(imageStoreDir);
 	}
 
 	void setSessionInfo (const xe::SessionInfo&)
@@ -331,7 +337,7 @@ static void writeTestCaseList (const xe::TestRoot& root, const ShortTestResultMa
 	dst << Writer::EndElement;
 }
 
-static void batchResultToSeparateXmlFiles (const char* batchResultFilename, const char* dstPath)
+static void batchResultToSeparateXmlFiles (const char* batchResultFilename, const char* dstPath, const std::string& imageStoreDir)
 {
 	xe::TestRoot						testRoot;
 	vector<xe::TestCaseResultHeader>	shortResults;
@@ -345,7 +351,7 @@ static void batchResultToSeparateXmlFiles (const char* batchResultFilename, cons
 
 	// Parse batch result and write out test cases.
 	{
-		ResultToXmlFilesLogHandler	handler		(shortResults, dstPath);
+		ResultToXmlFilesLogHandler	handler		(shortResults, dstPath, imageStoreDir);
 		xe::TestLogParser			parser		(&handler);
 
 		parseBatchResult(parser, batchResultFilename);
@@ -386,9 +392,9 @@ int main (int argc, const char* const* argv)
 			return -1;
 
 		if (cmdLine.outputMode == OUTPUTMODE_SINGLE)
-			batchResultToSingleXmlFile(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str());
+			batchResultToSingleXmlFile(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str(), cmdLine.imageStoreDir);
 		else
-			batchResultToSeparateXmlFiles(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str());
+			batchResultToSeparateXmlFiles(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str(), cmdLine.imageStoreDir);
 	}
 	catch (const std::exception& e)
 	{
@@ -68,6 +68,7 @@ DE_DECLARE_COMMAND_LINE_OPT(ExcludeSet,		vector<string>);
 DE_DECLARE_COMMAND_LINE_OPT(ContinueFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(TestLogFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(InfoLogFile,	string);
+DE_DECLARE_COMMAND_LINE_OPT(SpillFile,		string);
 DE_DECLARE_COMMAND_LINE_OPT(Summary,		bool);
 
 // TargetConfiguration
@@ -104,6 +105,7 @@ void registerOptions (de::cmdline::Parser& parser)
 		   << Option<ContinueFile>	(DE_NULL,	"continue",		"Continue execution by initializing results from existing test log.")
 		   << Option<TestLogFile>	("o",		"out",			"Output test log filename.",											"TestLog.qpa")
 		   << Option<InfoLogFile>	("i",		"info",			"Output info log filename.",											"InfoLog.txt")
+		   << Option<SpillFile>		(DE_NULL,	"spill",		"Keep completed test case logs in this temporary file instead of memory.",	"")
 		   << Option<Summary>		(DE_NULL,	"summary",		"Print summary after running tests.",									s_yesNo, "yes")
 		   << Option<BinaryName>	("b",		"binaryname",	"Test binary path. Relative to working directory.",						"<Unused>")
 		   << Option<WorkingDir>	("wd",		"workdir",		"Working directory for the test execution.",							".")
@@ -136,6 +138,7 @@ struct CommandLine
 	string					inFile;
 	string					outFile;
 	string					infoFile;
+	string					spillFile;
 	bool					summary;
 };
 
@@ -200,6 +203,7 @@ bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
 	cmdLine.exclude					= opts.getOption<opt::ExcludeSet>();
 	cmdLine.outFile					= opts.getOption<opt::TestLogFile>();
 	cmdLine.infoFile				= opts.getOption<opt::InfoLogFile>();
+	cmdLine.spillFile				= opts.getOption<opt::SpillFile>();
 	cmdLine.summary					= opts.getOption<opt::Summary>();
 	cmdLine.targetCfg.binaryName	= opts.getOption<opt::BinaryName>();
 	cmdLine.targetCfg.workingDir	= opts.getOption<opt::WorkingDir>();
@@ -376,8 +380,9 @@ public:
 	{
 	}
 
-	void testCaseResultComplete (const xe::TestCaseResultPtr&)
+	void testCaseResultComplete (const xe::TestCaseResultPtr& result)
 	{
+		m_batchResult->flushTestCaseResult(result);
 	}
 
 private:
@@ -450,6 +455,10 @@ void printBatchResultSummary (const xe::TestNode* root, const xe::TestSet& testS
 
 void writeInfoLog (const xe::InfoLog& log, const char* filename)
 {
+	// Already written as it arrived.
+	if (log.isStreamed())
+		return;
+
 	std::ofstream out(filename, std::ios_base::binary);
 	XE_CHECK(out.good());
 	out.write((const char*)log.getBytes(), log.getSize());
@@ -600,6 +609,15 @@ void runExecutor (const CommandLine& cmdLine)
 	xe::BatchResult	batchResult;
 	xe::InfoLog		infoLog;
 
+	// With spill file, case logs are moved to disk as they complete and info log is written as it arrives.
+	if (!cmdLine.spillFile.empty())
+	{
+		batchResult.setDataStoreFile(cmdLine.spillFile.c_str());
+
+		if (!cmdLine.infoFile.empty())
+			infoLog.streamToFile(cmdLine.infoFile.c_str());
+	}
+
 	// Read existing results from input file (if supplied).
 	if (!cmdLine.inFile.empty())
 		readLogFile(&batchResult, cmdLine.inFile.c_str());
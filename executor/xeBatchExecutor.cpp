@@ -152,6 +152,8 @@ void BatchExecutorLogHandler::testCaseResultComplete (const TestCaseResultPtr& r
 {
 	// \todo [2012-11-01 pyry] Remove from execute set here instead of updating it between sessions.
 	printf("%s\n", result->getTestCasePath());
+
+	m_batchResult->flushTestCaseResult(result);
 }
 
 BatchExecutor::BatchExecutor (const TargetConfiguration& config, CommLink* commLink, const TestNode* root, const TestSet& testSet, BatchResult* batchResult, InfoLog* infoLog)
@@ -24,6 +24,8 @@
 #include "xeBatchResult.hpp"
 #include "deMemory.h"
 
+#include <cstring>
+
 using std::vector;
 using std::string;
 using std::map;
@@ -33,16 +35,132 @@ namespace xe
 
 // InfoLog
 
+namespace
+{
+
+void writeToFile (deFile* file, const void* data, size_t size)
+{
+	deInt64 numWritten = 0;
+
+	if (size == 0)
+		return;
+
+	if (deFile_write(file, data, (deInt64)size, &numWritten) != DE_FILERESULT_SUCCESS || numWritten != (deInt64)size)
+		throw Error("Failed to write to file");
+}
+
+void writeUint32LE (deUint8* dst, deUint32 value)
+{
+	dst[0] = (deUint8)(value & 0xff);
+	dst[1] = (deUint8)((value >> 8) & 0xff);
+	dst[2] = (deUint8)((value >> 16) & 0xff);
+	dst[3] = (deUint8)((value >> 24) & 0xff);
+}
+
+} // anonymous
+
+// InfoLog
+
 InfoLog::InfoLog (void)
+	: m_size	(0)
+	, m_file	(DE_NULL)
 {
 }
 
+InfoLog::~InfoLog (void)
+{
+	if (m_file)
+		deFile_destroy(m_file);
+}
+
 void InfoLog::append (const deUint8* bytes, size_t numBytes)
 {
 	DE_ASSERT(numBytes > 0);
-	const size_t oldSize = m_data.size();
-	m_data.resize(oldSize+numBytes);
-	deMemcpy(&m_data[oldSize], bytes, numBytes);
+
+	if (m_file)
+		writeToFile(m_file, bytes, numBytes);
+	else
+	{
+		const size_t oldSize = m_data.size();
+		m_data.resize(oldSize+numBytes);
+		deMemcpy(&m_data[oldSize], bytes, numBytes);
+	}
+
+	m_size += numBytes;
+}
+
+void InfoLog::streamToFile (const char* filename)
+{
+	DE_ASSERT(!m_file);
+
+	m_file = deFile_create(filename, DE_FILEMODE_CREATE|DE_FILEMODE_OPEN|DE_FILEMODE_WRITE|DE_FILEMODE_TRUNCATE);
+	if (!m_file)
+		throw Error(string("Failed to open ") + filename);
+
+	writeToFile(m_file, getBytes(), m_data.size());
+	vector<deUint8>().swap(m_data);
+}
+
+// CaseDataStore
+
+CaseDataStore::CaseDataStore (const char* filename)
+	: m_filename	(filename)
+	, m_file		(deFile_create(filename, DE_FILEMODE_CREATE|DE_FILEMODE_OPEN|DE_FILEMODE_READ|DE_FILEMODE_WRITE|DE_FILEMODE_TRUNCATE))
+	, m_size		(0)
+{
+	if (!m_file)
+		throw Error(string("Failed to create case data store ") + filename);
+}
+
+CaseDataStore::~CaseDataStore (void)
+{
+	deFile_destroy(m_file);
+	deDeleteFile(m_filename.c_str());
+}
+
+void CaseDataStore::write (const void* data, size_t size)
+{
+	writeToFile(m_file, data, size);
+	m_size += (deInt64)size;
+}
+
+deInt64 CaseDataStore::append (const char* casePath, const deUint8* data, size_t size)
+{
+	const size_t	pathLen		= strlen(casePath);
+	deUint8			pathLenBytes[4];
+	deUint8			sizeBytes[4];
+
+	writeUint32LE(pathLenBytes, (deUint32)pathLen);
+	writeUint32LE(sizeBytes, (deUint32)size);
+
+	// \note Reads move file position, always seek to end first.
+	if (!deFile_seek(m_file, DE_FILEPOSITION_BEGIN, m_size))
+		throw Error("Failed to seek in case data store");
+
+	write(pathLenBytes, sizeof(pathLenBytes));
+	write(casePath, pathLen);
+	write(sizeBytes, sizeof(sizeBytes));
+
+	{
+		const deInt64 dataOffset = m_size;
+		write(data, size);
+		return dataOffset;
+	}
+}
+
+void CaseDataStore::read (deInt64 offset, deUint8* dst, size_t size) const
+{
+	deInt64 numRead = 0;
+
+	DE_ASSERT(offset + (deInt64)size <= m_size);
+
+	if (size == 0)
+		return;
+
+	if (!deFile_seek(m_file, DE_FILEPOSITION_BEGIN, offset) ||
+		deFile_read(m_file, dst, (deInt64)size, &numRead) != DE_FILERESULT_SUCCESS ||
+		numRead != (deInt64)size)
+		throw Error("Failed to read from case data store");
 }
 
 // TestCaseResultData
@@ -50,6 +168,9 @@ void InfoLog::append (const deUint8* bytes, size_t numBytes)
 TestCaseResultData::TestCaseResultData (const char* casePath)
 	: m_casePath	(casePath)
 	, m_statusCode	(TESTSTATUSCODE_LAST)
+	, m_store		(DE_NULL)
+	, m_storeOffset	(0)
+	, m_storeSize	(0)
 {
 }
 
@@ -63,22 +184,81 @@ void TestCaseResultData::setTestResult (TestStatusCode statusCode, const char* s
 	m_statusDetails	= statusDetails;
 }
 
+void TestCaseResultData::setDataSize (int size)
+{
+	// Data is reset by parser when case is restarted, no need to fetch it.
+	if (size == 0)
+		m_store = DE_NULL;
+	else
+		unspill();
+
+	m_data.resize(size);
+}
+
+const deUint8* TestCaseResultData::getData (void) const
+{
+	DE_ASSERT(!isSpilled());
+	return !m_data.empty() ? &m_data[0] : DE_NULL;
+}
+
+deUint8* TestCaseResultData::getData (void)
+{
+	unspill();
+	return !m_data.empty() ? &m_data[0] : DE_NULL;
+}
+
+void TestCaseResultData::readData (vector<deUint8>& dst) const
+{
+	if (isSpilled())
+	{
+		dst.resize(m_storeSize);
+		m_store->read(m_storeOffset, dst.empty() ? DE_NULL : &dst[0], dst.size());
+	}
+	else
+		dst = m_data;
+}
+
+void TestCaseResultData::spill (CaseDataStore& store)
+{
+	if (isSpilled())
+		return;
+
+	m_storeOffset	= store.append(m_casePath.c_str(), getData(), m_data.size());
+	m_storeSize		= (int)m_data.size();
+	m_store			= &store;
+
+	vector<deUint8>().swap(m_data);
+}
+
+void TestCaseResultData::unspill (void)
+{
+	if (!isSpilled())
+		return;
+
+	m_data.resize(m_storeSize);
+	m_store->read(m_storeOffset, m_data.empty() ? DE_NULL : &m_data[0], m_data.size());
+	m_store = DE_NULL;
+}
+
 void TestCaseResultData::clear (void)
 {
 	m_statusCode = TESTSTATUSCODE_LAST;
 	m_statusDetails.clear();
 	m_casePath.clear();
 	m_data.clear();
+	m_store = DE_NULL;
 }
 
 // BatchResult
 
 BatchResult::BatchResult (void)
+	: m_dataStore(DE_NULL)
 {
 }
 
 BatchResult::~BatchResult (void)
 {
+	delete m_dataStore;
 }
 
 bool BatchResult::hasTestCaseResult (const char* casePath) const
@@ -113,4 +293,20 @@ TestCaseResultPtr BatchResult::createTestCaseResult (const char* casePath)
 	return caseResult;
 }
 
+void BatchResult::setDataStoreFile (const char* filename)
+{
+	DE_ASSERT(!m_dataStore);
+	m_dataStore = new CaseDataStore(filename);
+
+	// Move results read so far, for example from a log being continued.
+	for (vector<TestCaseResultPtr>::const_iterator iter = m_testCaseResults.begin(); iter != m_testCaseResults.end(); ++iter)
+		(*iter)->spill(*m_dataStore);
+}
+
+void BatchResult::flushTestCaseResult (const TestCaseResultPtr& result)
+{
+	if (m_dataStore)
+		result->spill(*m_dataStore);
+}
+
 } // xe
@@ -27,6 +27,7 @@
 #include "xeTestCase.hpp"
 #include "xeTestCaseResult.hpp"
 #include "deSharedPtr.hpp"
+#include "deFile.h"
 
 #include <string>
 #include <vector>
@@ -55,17 +56,57 @@ class InfoLog
 {
 public:
 							InfoLog			(void);
+							~InfoLog		(void);
 
-	size_t					getSize			(void) const { return m_data.size();							}
-	const deUint8*			getBytes		(void) const { return !m_data.empty() ? &m_data[0] : DE_NULL;	}
+	size_t					getSize			(void) const { return m_size;														}
+	const deUint8*			getBytes		(void) const { return !m_data.empty() ? &m_data[0] : DE_NULL;						}
 
 	void					append			(const deUint8* bytes, size_t numBytes);
 
+	//! Write log to file as it arrives instead of buffering. Already buffered data is written first and getBytes() returns null afterwards.
+	void					streamToFile	(const char* filename);
+	bool					isStreamed		(void) const { return m_file != DE_NULL;											}
+
 private:
 							InfoLog			(const InfoLog& other);
 	InfoLog&				operator=		(const InfoLog& other);
 
 	std::vector<deUint8>	m_data;
+	size_t					m_size;
+	deFile*					m_file;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Append-only file holding test case log data
+ *
+ * Each record is stored as deUint32 path length, case path, deUint32 data
+ * size and data, all integers little-endian, so that the file can be
+ * recovered without the in-memory index if the executor dies. The index
+ * itself (data offset and size) is kept by TestCaseResultData.
+ *
+ * The file is created on construction and deleted on destruction.
+ *//*--------------------------------------------------------------------*/
+class CaseDataStore
+{
+public:
+	explicit				CaseDataStore	(const char* filename);
+							~CaseDataStore	(void);
+
+	//! Append record, returns offset of data in file.
+	deInt64					append			(const char* casePath, const deUint8* data, size_t size);
+	void					read			(deInt64 offset, deUint8* dst, size_t size) const;
+
+	deInt64					getSize			(void) const { return m_size; }
+
+private:
+							CaseDataStore	(const CaseDataStore& other);
+	CaseDataStore&			operator=		(const CaseDataStore& other);
+
+	void					write			(const void* data, size_t size);
+
+	std::string				m_filename;
+	deFile*					m_file;
+	deInt64					m_size;
 };
 
 class TestCaseResultData
@@ -81,20 +122,35 @@ public:
 	TestStatusCode				getStatusCode					(void) const	{ return m_statusCode;				}
 	const char*					getStatusDetails				(void) const	{ return m_statusDetails.c_str();	}
 
-	int							getDataSize						(void) const	{ return (int)m_data.size();		}
-	void						setDataSize						(int size)		{ m_data.resize(size);				}
+	int							getDataSize						(void) const	{ return isSpilled() ? m_storeSize : (int)m_data.size();	}
+	void						setDataSize						(int size);
+
+	//! Direct access to data. Not available for const data once spilled, use readData() instead.
+	const deUint8*				getData							(void) const;
+	deUint8*					getData							(void);
 
-	const deUint8*				getData							(void) const	{ return !m_data.empty() ? &m_data[0] : DE_NULL;	}
-	deUint8*					getData							(void)			{ return !m_data.empty() ? &m_data[0] : DE_NULL;	}
+	//! Copy data to dst, fetching it from the store if spilled.
+	void						readData						(std::vector<deUint8>& dst) const;
+
+	//! Move data to store and release memory. Data is fetched back on modification.
+	void						spill							(CaseDataStore& store);
+	bool						isSpilled						(void) const	{ return m_store != DE_NULL;		}
 
 	void						clear							(void);
 
 private:
+	void						unspill							(void);
+
 	// \note statusCode and statusDetails are either set by BatchExecutor or later parsed from data.
 	std::string					m_casePath;
 	TestStatusCode				m_statusCode;
 	std::string					m_statusDetails;
 	std::vector<deUint8>		m_data;
+
+	// Location in CaseDataStore when spilled. Store must outlive data.
+	const CaseDataStore*		m_store;
+	deInt64						m_storeOffset;
+	int							m_storeSize;
 };
 
 typedef de::SharedPtr<TestCaseResultData>			TestCaseResultPtr;
@@ -119,6 +175,13 @@ public:
 
 	TestCaseResultPtr					createTestCaseResult	(const char* casePath);
 
+	//! Spill completed case data to given file. Only the index is kept in memory afterwards.
+	void								setDataStoreFile		(const char* filename);
+	bool								hasDataStore			(void) const	{ return m_dataStore != DE_NULL;								}
+
+	//! Called once case data is complete. Moves data to store if enabled.
+	void								flushTestCaseResult		(const TestCaseResultPtr& result);
+
 private:
 										BatchResult				(const BatchResult& other);
 	BatchResult&						operator=				(const BatchResult& other);
@@ -126,6 +189,7 @@ private:
 	SessionInfo							m_sessionInfo;
 	std::vector<TestCaseResultPtr>		m_testCaseResults;
 	std::map<std::string, int>			m_resultMap;
+	CaseDataStore*						m_dataStore;
 };
 
 } // xe
@@ -270,6 +270,7 @@ public:
 	Format					format;
 	Compression				compression;
 	std::vector<deUint8>	data;
+	std::string				storeHash;		//!< Content-addressed image store key; data is empty unless resolved.
 };
 
 class ImageSet : public Item
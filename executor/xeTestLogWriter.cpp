@@ -84,15 +84,17 @@ static void writeSessionInfo (const SessionInfo& info, std::ostream& stream)
 		stream << "#sessionInfo timestamp " << info.timestamp << "\n";
 }
 
-static void writeTestCase (const TestCaseResultData& caseData, std::ostream& stream)
+static void writeTestCase (const TestCaseResultData& caseData, std::ostream& stream, std::vector<deUint8>& dataBuf)
 {
 	stream << "\n#beginTestCaseResult " << caseData.getTestCasePath() << "\n";
 
 	if (caseData.getDataSize() > 0)
 	{
-		stream.write((const char*)caseData.getData(), caseData.getDataSize());
+		// \note Data may live in BatchResult's data store, fetch one case at a time.
+		caseData.readData(dataBuf);
+		stream.write((const char*)&dataBuf[0], (std::streamsize)dataBuf.size());
 
-		deUint8 lastCh = caseData.getData()[caseData.getDataSize()-1];
+		deUint8 lastCh = dataBuf.back();
 		if (lastCh != '\n' && lastCh != '\r')
 			stream << "\n";
 	}
@@ -112,10 +114,14 @@ void writeTestLog (const BatchResult& result, std::ostream& stream)
 
 	stream << "#beginSession\n";
 
-	for (int ndx = 0; ndx < result.getNumTestCaseResults(); ndx++)
 	{
-		ConstTestCaseResultPtr caseData = result.getTestCaseResult(ndx);
-		writeTestCase(*caseData, stream);
+		std::vector<deUint8> dataBuf;
+
+		for (int ndx = 0; ndx < result.getNumTestCaseResults(); ndx++)
+		{
+			ConstTestCaseResultPtr caseData = result.getTestCaseResult(ndx);
+			writeTestCase(*caseData, stream, dataBuf);
+		}
 	}
 
 	stream << "\n#endSession\n";
@@ -267,9 +273,15 @@ static void writeResultItem (const ri::Item& item, xml::Writer& dst)
 				<< Writer::Attribute("Width",			de::toString(image.width))
 				<< Writer::Attribute("Height",			de::toString(image.height))
 				<< Writer::Attribute("Format",			getImageFormatName(image.format))
-				<< Writer::Attribute("CompressionMode",	getImageCompressionName(image.compression))
-				<< toBase64(&image.data[0], (int)image.data.size())
-				<< Writer::EndElement;
+				<< Writer::Attribute("CompressionMode",	getImageCompressionName(image.compression));
+
+			if (!image.storeHash.empty())
+				dst << Writer::Attribute("StoreHash",	image.storeHash);
+
+			if (!image.data.empty())
+				dst << toBase64(&image.data[0], (int)image.data.size());
+
+			dst << Writer::EndElement;
 			break;
 		}
 
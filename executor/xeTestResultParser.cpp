@@ -26,8 +26,11 @@
 #include "xeBatchResult.hpp"
 #include "deString.h"
 #include "deInt32.h"
+#include "deFilePath.hpp"
 
 #include <sstream>
+#include <fstream>
+#include <iterator>
 #include <stdlib.h>
 
 using std::string;
@@ -548,6 +551,10 @@ void TestResultParser::handleElementStart (void)
 				image->height		= toInt(getAttribute("Height"));
 				image->format		= getImageFormat(getAttribute("Format"));
 				image->compression	= getImageCompression(getAttribute("CompressionMode"));
+
+				if (m_xmlParser.hasAttribute("StoreHash"))
+					image->storeHash = m_xmlParser.getAttribute("StoreHash");
+
 				item = image;
 				break;
 			}
@@ -778,11 +785,35 @@ void TestResultParser::handleElementEnd (void)
 			value->value = getNumericValue(m_curNumValue);
 			m_curNumValue.clear();
 		}
+		else if (itemType == ri::TYPE_IMAGE)
+		{
+			ri::Image* image = static_cast<ri::Image*>(curItem);
+
+			if (!image->storeHash.empty() && !m_imageStoreDir.empty())
+				resolveStoredImage(image);
+		}
 
 		popItem();
 	}
 }
 
+void TestResultParser::resolveStoredImage (ri::Image* image) const
+{
+	// \note Unresolved images keep their hash so that it is preserved when the log is written out.
+	const de::FilePath	path	= de::FilePath::join(m_imageStoreDir, image->storeHash + ".png");
+	std::ifstream		in		(path.getPath(), std::ios_base::binary);
+
+	if (!in.good())
+		return;
+
+	image->data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+	if (in.bad())
+		image->data.clear();
+	else
+		image->storeHash.clear();
+}
+
 void TestResultParser::handleData (void)
 {
 	ri::Item*	curItem		= getCurrentItem();
@@ -896,9 +927,12 @@ void parseTestCaseResultFromData (TestResultParser* parser, TestCaseResult* resu
 
 	if (data.getDataSize() > 0)
 	{
+		std::vector<deUint8> dataBuf;
+
 		parser->init(result);
+		data.readData(dataBuf);
 
-		const TestResultParser::ParseResult parseResult = parser->parse(data.getData(), data.getDataSize());
+		const TestResultParser::ParseResult parseResult = parser->parse(&dataBuf[0], (int)dataBuf.size());
 
 		if (result->statusCode == TESTSTATUSCODE_LAST)
 		{
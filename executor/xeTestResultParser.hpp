@@ -69,6 +69,9 @@ public:
 	void					init						(TestCaseResult* dstResult);
 	ParseResult				parse						(const deUint8* bytes, int numBytes);
 
+	//! Resolve stored images (StoreHash attribute) from given directory; empty path disables resolving.
+	void					setImageStore				(const std::string& dirName) { m_imageStoreDir = dirName; }
+
 private:
 							TestResultParser			(const TestResultParser& other);
 	TestResultParser&		operator=					(const TestResultParser& other);
@@ -79,6 +82,8 @@ private:
 	void					handleElementEnd			(void);
 	void					handleData					(void);
 
+	void					resolveStoredImage			(ri::Image* image) const;
+
 	const char*				getAttribute				(const char* name);
 
 	ri::Item*				getCurrentItem				(void);
@@ -109,6 +114,8 @@ private:
 	int						m_base64DecodeOffset;
 
 	std::string				m_curNumValue;
+
+	std::string				m_imageStoreDir;
 };
 
 // Helpers exposed to other parsers.
@@ -6148,6 +6148,9 @@ BufferTestBase::bufferCollection::~bufferCollection()
 	}
 }
 
+/* Constants used by NegativeTestBase */
+const GLuint NegativeTestBase::m_prebuild_batch_size = 32;
+
 /** Constructor
  *
  * @param context          Test context
@@ -6155,8 +6158,187 @@ BufferTestBase::bufferCollection::~bufferCollection()
  * @param test_description Description of test
  **/
 NegativeTestBase::NegativeTestBase(deqp::Context& context, const GLchar* test_name, const GLchar* test_description)
-	: TestBase(context, test_name, test_description)
+	: TestBase(context, test_name, test_description), m_prebuilt_first_index(0)
+{
+}
+
+/** Release programs built ahead of their test cases
+ *
+ **/
+void NegativeTestBase::deinit(void)
+{
+	m_prebuilt_programs.clear();
+	m_prebuilt_first_index = 0;
+
+	TestBase::deinit();
+}
+
+/** Get program built ahead for test case. Programs of the following test cases are submitted
+ * together, so that drivers may compile them in parallel.
+ *
+ * @param test_case_index Id of test case
+ *
+ * @return Program or DE_NULL if test case has to be built on its own
+ **/
+const glu::ShaderProgram* NegativeTestBase::getPrebuiltProgram(GLuint test_case_index)
+{
+	if ((test_case_index < m_prebuilt_first_index) ||
+		(test_case_index >= m_prebuilt_first_index + (GLuint)m_prebuilt_programs.size()))
+	{
+		prebuildPrograms(test_case_index);
+	}
+
+	return m_prebuilt_programs[test_case_index - m_prebuilt_first_index].get();
+}
+
+/** Compile and link programs of consecutive test cases as one batch
+ *
+ * @param first_test_case_index Id of first test case in batch
+ **/
+void NegativeTestBase::prebuildPrograms(GLuint first_test_case_index)
+{
+	const GLuint			n_test_cases = de::min(getTestCaseNumber() - first_test_case_index, m_prebuild_batch_size);
+	glu::ShaderProgramBatch batch(m_context.getRenderContext());
+	std::vector<int>		batch_indices(n_test_cases, -1);
+
+	m_prebuilt_programs.clear();
+	m_prebuilt_first_index = first_test_case_index;
+
+	for (GLuint i = 0; i < n_test_cases; ++i)
+	{
+		const GLuint		test_case_index = first_test_case_index + i;
+		glu::ProgramSources sources;
+
+		/* Separable cases build each stage on its own, leave them to testCase */
+		if ((false == isComputeRelevant(test_case_index)) && (true == isSeparable(test_case_index)))
+		{
+			continue;
+		}
+
+		try
+		{
+			if (true == isComputeRelevant(test_case_index))
+			{
+				const std::string& source = getShaderSource(test_case_index, Utils::Shader::COMPUTE);
+
+				if (false == source.empty())
+				{
+					sources << glu::ComputeSource(source);
+				}
+			}
+			else
+			{
+				static const Utils::Shader::STAGES stages[] = { Utils::Shader::VERTEX, Utils::Shader::TESS_CTRL,
+																Utils::Shader::TESS_EVAL, Utils::Shader::GEOMETRY,
+																Utils::Shader::FRAGMENT };
+				static const glu::ShaderType shader_types[] = { glu::SHADERTYPE_VERTEX,
+																glu::SHADERTYPE_TESSELLATION_CONTROL,
+																glu::SHADERTYPE_TESSELLATION_EVALUATION,
+																glu::SHADERTYPE_GEOMETRY, glu::SHADERTYPE_FRAGMENT };
+
+				for (GLuint stage = 0; stage < DE_LENGTH_OF_ARRAY(stages); ++stage)
+				{
+					const std::string& source = getShaderSource(test_case_index, stages[stage]);
+
+					/* No source == no shader */
+					if (false == source.empty())
+					{
+						sources << glu::ShaderSource(shader_types[stage], source);
+					}
+				}
+			}
+		}
+		catch (const tcu::Exception&)
+		{
+			/* Source generation problems are reported when testCase reaches this case */
+			continue;
+		}
+
+		/* Programs without any shader are left to testCase as well */
+		bool has_shaders = false;
+
+		for (int stage = 0; stage < glu::SHADERTYPE_LAST; ++stage)
+		{
+			has_shaders = has_shaders || (false == sources.sources[stage].empty());
+		}
+
+		if (false == has_shaders)
+		{
+			continue;
+		}
+
+		batch_indices[i] = batch.add(sources);
+	}
+
+	batch.build();
+
+	m_prebuilt_programs.resize(n_test_cases);
+
+	for (GLuint i = 0; i < n_test_cases; ++i)
+	{
+		if (-1 != batch_indices[i])
+		{
+			m_prebuilt_programs[i] = ProgramSp(batch.release(batch_indices[i]));
+		}
+	}
+}
+
+/** Verify that build status of program matches expectation of test case
+ *
+ * @param test_case_index Id of test case
+ * @param program         Program built for test case
+ *
+ * @return true if build result is as expected, false otherwise
+ **/
+bool NegativeTestBase::verifyProgram(GLuint test_case_index, const glu::ShaderProgram& program)
 {
+	const bool is_failure_expected = isFailureExpected(test_case_index);
+	const bool is_build_error	  = !program.isOk();
+	bool	   is_compile_error	= false;
+
+	for (int stage = 0; stage < glu::SHADERTYPE_LAST; ++stage)
+	{
+		for (int i = 0; i < program.getNumShaders((glu::ShaderType)stage); ++i)
+		{
+			if (false == program.getShaderInfo((glu::ShaderType)stage, i).compileOk)
+			{
+				is_compile_error = true;
+			}
+		}
+	}
+
+	if ((true == is_build_error) && (false == is_failure_expected))
+	{
+		m_context.getTestContext().getLog()
+			<< tcu::TestLog::Message
+			<< (is_compile_error ? "Unexpected error in shader compilation: " : "Unexpected error in program linking: ")
+			<< tcu::TestLog::EndMessage << program;
+	}
+
+#if DEBUG_NEG_LOG_ERROR
+
+	else if (true == is_build_error)
+	{
+		m_context.getTestContext().getLog()
+			<< tcu::TestLog::Message
+			<< (is_compile_error ? "Error in shader compilation was expected, logged for verification: " :
+								   "Error in program linking was expected, logged for verification: ")
+			<< tcu::TestLog::EndMessage << program;
+	}
+
+#endif /* DEBUG_NEG_LOG_ERROR */
+
+	if (is_build_error != is_failure_expected)
+	{
+		if (!is_build_error)
+		{
+			m_context.getTestContext().getLog()
+				<< tcu::TestLog::Message << "Unexpected success: " << tcu::TestLog::EndMessage << program;
+		}
+		return false;
+	}
+
+	return true;
 }
 
 /** Selects if "compute" stage is relevant for test
@@ -6202,6 +6384,16 @@ bool NegativeTestBase::testCase(GLuint test_case_index)
 {
 	bool test_case_result = true;
 
+	/* Programs built together with neighbouring test cases */
+	{
+		const glu::ShaderProgram* program = getPrebuiltProgram(test_case_index);
+
+		if (DE_NULL != program)
+		{
+			return verifyProgram(test_case_index, *program);
+		}
+	}
+
 	/* Compute */
 	if (true == isComputeRelevant(test_case_index))
 	{
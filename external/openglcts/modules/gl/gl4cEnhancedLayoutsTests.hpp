@@ -29,7 +29,9 @@
  */ /*-------------------------------------------------------------------*/
 
 #include "glcTestCase.hpp"
+#include "gluShaderProgram.hpp"
 #include "glwDefs.hpp"
+#include "deSharedPtr.hpp"
 
 namespace tcu
 {
@@ -1119,6 +1121,9 @@ public:
 	{
 	}
 
+	/* Public methods inherited from TestCase */
+	virtual void deinit(void);
+
 protected:
 	/* Methods to be implemented by child class */
 	virtual std::string getShaderSource(glw::GLuint test_case_index, Utils::Shader::STAGES stage) = 0;
@@ -1126,6 +1131,22 @@ protected:
 	virtual bool isFailureExpected(glw::GLuint test_case_index);
 	virtual bool isSeparable(const glw::GLuint test_case_index);
 	virtual bool testCase(glw::GLuint test_case_index);
+
+private:
+	/* Private types */
+	typedef de::SharedPtr<glu::ShaderProgram> ProgramSp;
+
+	/* Private methods */
+	const glu::ShaderProgram* getPrebuiltProgram(glw::GLuint test_case_index);
+	void prebuildPrograms(glw::GLuint first_test_case_index);
+	bool verifyProgram(glw::GLuint test_case_index, const glu::ShaderProgram& program);
+
+	/* Private fields */
+	glw::GLuint			   m_prebuilt_first_index;
+	std::vector<ProgramSp> m_prebuilt_programs;
+
+	/* Private constants */
+	static const glw::GLuint m_prebuild_batch_size;
 };
 
 /** Base class for test doing Texture algorithm **/
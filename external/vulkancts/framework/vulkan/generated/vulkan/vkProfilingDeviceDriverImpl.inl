@@ -0,0 +1,3040 @@
+/* Profiling forwarders for DeviceInterface.
+ * Not generated: derived by hand from vkConcreteDeviceInterface.inl in this
+ * directory. Update it when that file changes; s_deviceFunctionNames must
+ * stay in the same order as the forwarders.
+ */
+
+static const char* const s_deviceFunctionNames[] =
+{
+	"vkGetDeviceProcAddr",
+	"vkDestroyDevice",
+	"vkGetDeviceQueue",
+	"vkQueueSubmit",
+	"vkQueueWaitIdle",
+	"vkDeviceWaitIdle",
+	"vkAllocateMemory",
+	"vkFreeMemory",
+	"vkMapMemory",
+	"vkUnmapMemory",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkGetBufferMemoryRequirements",
+	"vkBindBufferMemory",
+	"vkGetImageMemoryRequirements",
+	"vkBindImageMemory",
+	"vkGetImageSparseMemoryRequirements",
+	"vkQueueBindSparse",
+	"vkCreateFence",
+	"vkDestroyFence",
+	"vkResetFences",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkDestroyQueryPool",
+	"vkGetQueryPoolResults",
+	"vkResetQueryPool",
+	"vkCreateBuffer",
+	"vkDestroyBuffer",
+	"vkCreateBufferView",
+	"vkDestroyBufferView",
+	"vkCreateImage",
+	"vkDestroyImage",
+	"vkGetImageSubresourceLayout",
+	"vkCreateImageView",
+	"vkDestroyImageView",
+	"vkCreateShaderModule",
+	"vkDestroyShaderModule",
+	"vkCreatePipelineCache",
+	"vkDestroyPipelineCache",
+	"vkGetPipelineCacheData",
+	"vkMergePipelineCaches",
+	"vkCreateGraphicsPipelines",
+	"vkCreateComputePipelines",
+	"vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+	"vkDestroyPipeline",
+	"vkCreatePipelineLayout",
+	"vkDestroyPipelineLayout",
+	"vkCreateSampler",
+	"vkDestroySampler",
+	"vkCreateDescriptorSetLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorPool",
+	"vkDestroyDescriptorPool",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkCreateCommandPool",
+	"vkDestroyCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawMultiEXT",
+	"vkCmdDrawMultiIndexedEXT",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdSubpassShadingHUAWEI",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdBeginConditionalRenderingEXT",
+	"vkCmdEndConditionalRenderingEXT",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+	"vkCreateSharedSwapchainsKHR",
+	"vkCreateSwapchainKHR",
+	"vkDestroySwapchainKHR",
+	"vkGetSwapchainImagesKHR",
+	"vkAcquireNextImageKHR",
+	"vkQueuePresentKHR",
+	"vkDebugMarkerSetObjectNameEXT",
+	"vkDebugMarkerSetObjectTagEXT",
+	"vkCmdDebugMarkerBeginEXT",
+	"vkCmdDebugMarkerEndEXT",
+	"vkCmdDebugMarkerInsertEXT",
+	"vkGetMemoryWin32HandleNV",
+	"vkCmdExecuteGeneratedCommandsNV",
+	"vkCmdPreprocessGeneratedCommandsNV",
+	"vkCmdBindPipelineShaderGroupNV",
+	"vkGetGeneratedCommandsMemoryRequirementsNV",
+	"vkCreateIndirectCommandsLayoutNV",
+	"vkDestroyIndirectCommandsLayoutNV",
+	"vkCmdPushDescriptorSetKHR",
+	"vkTrimCommandPool",
+	"vkGetMemoryWin32HandleKHR",
+	"vkGetMemoryWin32HandlePropertiesKHR",
+	"vkGetMemoryFdKHR",
+	"vkGetMemoryFdPropertiesKHR",
+	"vkGetMemoryZirconHandleFUCHSIA",
+	"vkGetMemoryZirconHandlePropertiesFUCHSIA",
+	"vkGetMemoryRemoteAddressNV",
+	"vkGetSemaphoreWin32HandleKHR",
+	"vkImportSemaphoreWin32HandleKHR",
+	"vkGetSemaphoreFdKHR",
+	"vkImportSemaphoreFdKHR",
+	"vkGetSemaphoreZirconHandleFUCHSIA",
+	"vkImportSemaphoreZirconHandleFUCHSIA",
+	"vkGetFenceWin32HandleKHR",
+	"vkImportFenceWin32HandleKHR",
+	"vkGetFenceFdKHR",
+	"vkImportFenceFdKHR",
+	"vkDisplayPowerControlEXT",
+	"vkRegisterDeviceEventEXT",
+	"vkRegisterDisplayEventEXT",
+	"vkGetSwapchainCounterEXT",
+	"vkGetDeviceGroupPeerMemoryFeatures",
+	"vkBindBufferMemory2",
+	"vkBindImageMemory2",
+	"vkCmdSetDeviceMask",
+	"vkGetDeviceGroupPresentCapabilitiesKHR",
+	"vkGetDeviceGroupSurfacePresentModesKHR",
+	"vkAcquireNextImage2KHR",
+	"vkCmdDispatchBase",
+	"vkCreateDescriptorUpdateTemplate",
+	"vkDestroyDescriptorUpdateTemplate",
+	"vkUpdateDescriptorSetWithTemplate",
+	"vkCmdPushDescriptorSetWithTemplateKHR",
+	"vkSetHdrMetadataEXT",
+	"vkGetSwapchainStatusKHR",
+	"vkGetRefreshCycleDurationGOOGLE",
+	"vkGetPastPresentationTimingGOOGLE",
+	"vkCmdSetViewportWScalingNV",
+	"vkCmdSetDiscardRectangleEXT",
+	"vkCmdSetSampleLocationsEXT",
+	"vkGetBufferMemoryRequirements2",
+	"vkGetImageMemoryRequirements2",
+	"vkGetImageSparseMemoryRequirements2",
+	"vkGetDeviceBufferMemoryRequirements",
+	"vkGetDeviceImageMemoryRequirements",
+	"vkGetDeviceImageSparseMemoryRequirements",
+	"vkCreateSamplerYcbcrConversion",
+	"vkDestroySamplerYcbcrConversion",
+	"vkGetDeviceQueue2",
+	"vkCreateValidationCacheEXT",
+	"vkDestroyValidationCacheEXT",
+	"vkGetValidationCacheDataEXT",
+	"vkMergeValidationCachesEXT",
+	"vkGetDescriptorSetLayoutSupport",
+	"vkGetShaderInfoAMD",
+	"vkSetLocalDimmingAMD",
+	"vkGetCalibratedTimestampsEXT",
+	"vkSetDebugUtilsObjectNameEXT",
+	"vkSetDebugUtilsObjectTagEXT",
+	"vkQueueBeginDebugUtilsLabelEXT",
+	"vkQueueEndDebugUtilsLabelEXT",
+	"vkQueueInsertDebugUtilsLabelEXT",
+	"vkCmdBeginDebugUtilsLabelEXT",
+	"vkCmdEndDebugUtilsLabelEXT",
+	"vkCmdInsertDebugUtilsLabelEXT",
+	"vkGetMemoryHostPointerPropertiesEXT",
+	"vkCmdWriteBufferMarkerAMD",
+	"vkCreateRenderPass2",
+	"vkCmdBeginRenderPass2",
+	"vkCmdNextSubpass2",
+	"vkCmdEndRenderPass2",
+	"vkGetSemaphoreCounterValue",
+	"vkWaitSemaphores",
+	"vkSignalSemaphore",
+	"vkGetAndroidHardwareBufferPropertiesANDROID",
+	"vkGetMemoryAndroidHardwareBufferANDROID",
+	"vkCmdDrawIndirectCount",
+	"vkCmdDrawIndexedIndirectCount",
+	"vkCmdSetCheckpointNV",
+	"vkGetQueueCheckpointDataNV",
+	"vkCmdBindTransformFeedbackBuffersEXT",
+	"vkCmdBeginTransformFeedbackEXT",
+	"vkCmdEndTransformFeedbackEXT",
+	"vkCmdBeginQueryIndexedEXT",
+	"vkCmdEndQueryIndexedEXT",
+	"vkCmdDrawIndirectByteCountEXT",
+	"vkCmdSetExclusiveScissorNV",
+	"vkCmdBindShadingRateImageNV",
+	"vkCmdSetViewportShadingRatePaletteNV",
+	"vkCmdSetCoarseSampleOrderNV",
+	"vkCmdDrawMeshTasksNV",
+	"vkCmdDrawMeshTasksIndirectNV",
+	"vkCmdDrawMeshTasksIndirectCountNV",
+	"vkCmdDrawMeshTasksEXT",
+	"vkCmdDrawMeshTasksIndirectEXT",
+	"vkCmdDrawMeshTasksIndirectCountEXT",
+	"vkCompileDeferredNV",
+	"vkCreateAccelerationStructureNV",
+	"vkCmdBindInvocationMaskHUAWEI",
+	"vkDestroyAccelerationStructureKHR",
+	"vkDestroyAccelerationStructureNV",
+	"vkGetAccelerationStructureMemoryRequirementsNV",
+	"vkBindAccelerationStructureMemoryNV",
+	"vkCmdCopyAccelerationStructureNV",
+	"vkCmdCopyAccelerationStructureKHR",
+	"vkCopyAccelerationStructureKHR",
+	"vkCmdCopyAccelerationStructureToMemoryKHR",
+	"vkCopyAccelerationStructureToMemoryKHR",
+	"vkCmdCopyMemoryToAccelerationStructureKHR",
+	"vkCopyMemoryToAccelerationStructureKHR",
+	"vkCmdWriteAccelerationStructuresPropertiesKHR",
+	"vkCmdWriteAccelerationStructuresPropertiesNV",
+	"vkCmdBuildAccelerationStructureNV",
+	"vkWriteAccelerationStructuresPropertiesKHR",
+	"vkCmdTraceRaysKHR",
+	"vkCmdTraceRaysNV",
+	"vkGetRayTracingShaderGroupHandlesKHR",
+	"vkGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+	"vkGetAccelerationStructureHandleNV",
+	"vkCreateRayTracingPipelinesNV",
+	"vkCreateRayTracingPipelinesKHR",
+	"vkCmdTraceRaysIndirectKHR",
+	"vkCmdTraceRaysIndirect2KHR",
+	"vkGetDeviceAccelerationStructureCompatibilityKHR",
+	"vkGetRayTracingShaderGroupStackSizeKHR",
+	"vkCmdSetRayTracingPipelineStackSizeKHR",
+	"vkGetImageViewHandleNVX",
+	"vkGetImageViewAddressNVX",
+	"vkGetDeviceGroupSurfacePresentModes2EXT",
+	"vkAcquireFullScreenExclusiveModeEXT",
+	"vkReleaseFullScreenExclusiveModeEXT",
+	"vkAcquireProfilingLockKHR",
+	"vkReleaseProfilingLockKHR",
+	"vkGetImageDrmFormatModifierPropertiesEXT",
+	"vkGetBufferOpaqueCaptureAddress",
+	"vkGetBufferDeviceAddress",
+	"vkInitializePerformanceApiINTEL",
+	"vkUninitializePerformanceApiINTEL",
+	"vkCmdSetPerformanceMarkerINTEL",
+	"vkCmdSetPerformanceStreamMarkerINTEL",
+	"vkCmdSetPerformanceOverrideINTEL",
+	"vkAcquirePerformanceConfigurationINTEL",
+	"vkReleasePerformanceConfigurationINTEL",
+	"vkQueueSetPerformanceConfigurationINTEL",
+	"vkGetPerformanceParameterINTEL",
+	"vkGetDeviceMemoryOpaqueCaptureAddress",
+	"vkGetPipelineExecutablePropertiesKHR",
+	"vkGetPipelineExecutableStatisticsKHR",
+	"vkGetPipelineExecutableInternalRepresentationsKHR",
+	"vkCmdSetLineStippleEXT",
+	"vkCreateAccelerationStructureKHR",
+	"vkCmdBuildAccelerationStructuresKHR",
+	"vkCmdBuildAccelerationStructuresIndirectKHR",
+	"vkBuildAccelerationStructuresKHR",
+	"vkGetAccelerationStructureDeviceAddressKHR",
+	"vkCreateDeferredOperationKHR",
+	"vkDestroyDeferredOperationKHR",
+	"vkGetDeferredOperationMaxConcurrencyKHR",
+	"vkGetDeferredOperationResultKHR",
+	"vkDeferredOperationJoinKHR",
+	"vkCmdSetCullMode",
+	"vkCmdSetFrontFace",
+	"vkCmdSetPrimitiveTopology",
+	"vkCmdSetViewportWithCount",
+	"vkCmdSetScissorWithCount",
+	"vkCmdBindVertexBuffers2",
+	"vkCmdSetDepthTestEnable",
+	"vkCmdSetDepthWriteEnable",
+	"vkCmdSetDepthCompareOp",
+	"vkCmdSetDepthBoundsTestEnable",
+	"vkCmdSetStencilTestEnable",
+	"vkCmdSetStencilOp",
+	"vkCmdSetPatchControlPointsEXT",
+	"vkCmdSetRasterizerDiscardEnable",
+	"vkCmdSetDepthBiasEnable",
+	"vkCmdSetLogicOpEXT",
+	"vkCmdSetPrimitiveRestartEnable",
+	"vkCreatePrivateDataSlot",
+	"vkCmdSetTessellationDomainOriginEXT",
+	"vkCmdSetDepthClampEnableEXT",
+	"vkCmdSetPolygonModeEXT",
+	"vkCmdSetRasterizationSamplesEXT",
+	"vkCmdSetSampleMaskEXT",
+	"vkCmdSetAlphaToCoverageEnableEXT",
+	"vkCmdSetAlphaToOneEnableEXT",
+	"vkCmdSetLogicOpEnableEXT",
+	"vkCmdSetColorBlendEnableEXT",
+	"vkCmdSetColorBlendEquationEXT",
+	"vkCmdSetColorWriteMaskEXT",
+	"vkCmdSetRasterizationStreamEXT",
+	"vkCmdSetConservativeRasterizationModeEXT",
+	"vkCmdSetExtraPrimitiveOverestimationSizeEXT",
+	"vkCmdSetDepthClipEnableEXT",
+	"vkCmdSetSampleLocationsEnableEXT",
+	"vkCmdSetColorBlendAdvancedEXT",
+	"vkCmdSetProvokingVertexModeEXT",
+	"vkCmdSetLineRasterizationModeEXT",
+	"vkCmdSetLineStippleEnableEXT",
+	"vkCmdSetDepthClipNegativeOneToOneEXT",
+	"vkCmdSetViewportWScalingEnableNV",
+	"vkCmdSetViewportSwizzleNV",
+	"vkCmdSetCoverageToColorEnableNV",
+	"vkCmdSetCoverageToColorLocationNV",
+	"vkCmdSetCoverageModulationModeNV",
+	"vkCmdSetCoverageModulationTableEnableNV",
+	"vkCmdSetCoverageModulationTableNV",
+	"vkCmdSetShadingRateImageEnableNV",
+	"vkCmdSetCoverageReductionModeNV",
+	"vkCmdSetRepresentativeFragmentTestEnableNV",
+	"vkDestroyPrivateDataSlot",
+	"vkSetPrivateData",
+	"vkGetPrivateData",
+	"vkCmdCopyBuffer2",
+	"vkCmdCopyImage2",
+	"vkCmdBlitImage2",
+	"vkCmdCopyBufferToImage2",
+	"vkCmdCopyImageToBuffer2",
+	"vkCmdResolveImage2",
+	"vkCmdSetFragmentShadingRateKHR",
+	"vkCmdSetFragmentShadingRateEnumNV",
+	"vkGetAccelerationStructureBuildSizesKHR",
+	"vkCmdSetVertexInputEXT",
+	"vkCmdSetColorWriteEnableEXT",
+	"vkCmdSetEvent2",
+	"vkCmdResetEvent2",
+	"vkCmdWaitEvents2",
+	"vkCmdPipelineBarrier2",
+	"vkQueueSubmit2",
+	"vkCmdWriteTimestamp2",
+	"vkCmdWriteBufferMarker2AMD",
+	"vkGetQueueCheckpointData2NV",
+	"vkCreateVideoSessionKHR",
+	"vkDestroyVideoSessionKHR",
+	"vkCreateVideoSessionParametersKHR",
+	"vkUpdateVideoSessionParametersKHR",
+	"vkDestroyVideoSessionParametersKHR",
+	"vkGetVideoSessionMemoryRequirementsKHR",
+	"vkBindVideoSessionMemoryKHR",
+	"vkCmdDecodeVideoKHR",
+	"vkCmdBeginVideoCodingKHR",
+	"vkCmdControlVideoCodingKHR",
+	"vkCmdEndVideoCodingKHR",
+	"vkCmdEncodeVideoKHR",
+	"vkCreateCuModuleNVX",
+	"vkCreateCuFunctionNVX",
+	"vkDestroyCuModuleNVX",
+	"vkDestroyCuFunctionNVX",
+	"vkCmdCuLaunchKernelNVX",
+	"vkSetDeviceMemoryPriorityEXT",
+	"vkWaitForPresentKHR",
+	"vkCreateBufferCollectionFUCHSIA",
+	"vkSetBufferCollectionBufferConstraintsFUCHSIA",
+	"vkSetBufferCollectionImageConstraintsFUCHSIA",
+	"vkDestroyBufferCollectionFUCHSIA",
+	"vkGetBufferCollectionPropertiesFUCHSIA",
+	"vkCmdBeginRendering",
+	"vkCmdEndRendering",
+	"vkGetDescriptorSetLayoutHostMappingInfoVALVE",
+	"vkGetDescriptorSetHostMappingVALVE",
+	"vkCreateMicromapEXT",
+	"vkCmdBuildMicromapsEXT",
+	"vkBuildMicromapsEXT",
+	"vkDestroyMicromapEXT",
+	"vkCmdCopyMicromapEXT",
+	"vkCopyMicromapEXT",
+	"vkCmdCopyMicromapToMemoryEXT",
+	"vkCopyMicromapToMemoryEXT",
+	"vkCmdCopyMemoryToMicromapEXT",
+	"vkCopyMemoryToMicromapEXT",
+	"vkCmdWriteMicromapsPropertiesEXT",
+	"vkWriteMicromapsPropertiesEXT",
+	"vkGetDeviceMicromapCompatibilityEXT",
+	"vkGetMicromapBuildSizesEXT",
+	"vkGetShaderModuleIdentifierEXT",
+	"vkGetShaderModuleCreateInfoIdentifierEXT",
+	"vkGetImageSubresourceLayout2EXT",
+	"vkGetPipelinePropertiesEXT",
+	"vkExportMetalObjectsEXT",
+	"vkGetFramebufferTilePropertiesQCOM",
+	"vkGetDynamicRenderingTilePropertiesQCOM",
+	"vkCreateOpticalFlowSessionNV",
+	"vkDestroyOpticalFlowSessionNV",
+	"vkBindOpticalFlowSessionImageNV",
+	"vkCmdOpticalFlowExecuteNV",
+	"vkGetDeviceFaultInfoEXT",
+};
+
+PFN_vkVoidFunction ProfilingDeviceDriver::getDeviceProcAddr (VkDevice device, const char* pName) const
+{
+	const ApiCallTimer timer (m_counters[0]);
+	return m_vk.getDeviceProcAddr(device, pName);
+}
+
+void ProfilingDeviceDriver::destroyDevice (VkDevice device, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[1]);
+	m_vk.destroyDevice(device, pAllocator);
+}
+
+void ProfilingDeviceDriver::getDeviceQueue (VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) const
+{
+	const ApiCallTimer timer (m_counters[2]);
+	m_vk.getDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+}
+
+VkResult ProfilingDeviceDriver::queueSubmit (VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const
+{
+	const ApiCallTimer timer (m_counters[3]);
+	return m_vk.queueSubmit(queue, submitCount, pSubmits, fence);
+}
+
+VkResult ProfilingDeviceDriver::queueWaitIdle (VkQueue queue) const
+{
+	const ApiCallTimer timer (m_counters[4]);
+	return m_vk.queueWaitIdle(queue);
+}
+
+VkResult ProfilingDeviceDriver::deviceWaitIdle (VkDevice device) const
+{
+	const ApiCallTimer timer (m_counters[5]);
+	return m_vk.deviceWaitIdle(device);
+}
+
+VkResult ProfilingDeviceDriver::allocateMemory (VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) const
+{
+	const ApiCallTimer timer (m_counters[6]);
+	return m_vk.allocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+}
+
+void ProfilingDeviceDriver::freeMemory (VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[7]);
+	m_vk.freeMemory(device, memory, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::mapMemory (VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) const
+{
+	const ApiCallTimer timer (m_counters[8]);
+	return m_vk.mapMemory(device, memory, offset, size, flags, ppData);
+}
+
+void ProfilingDeviceDriver::unmapMemory (VkDevice device, VkDeviceMemory memory) const
+{
+	const ApiCallTimer timer (m_counters[9]);
+	m_vk.unmapMemory(device, memory);
+}
+
+VkResult ProfilingDeviceDriver::flushMappedMemoryRanges (VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const
+{
+	const ApiCallTimer timer (m_counters[10]);
+	return m_vk.flushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+VkResult ProfilingDeviceDriver::invalidateMappedMemoryRanges (VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const
+{
+	const ApiCallTimer timer (m_counters[11]);
+	return m_vk.invalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+void ProfilingDeviceDriver::getDeviceMemoryCommitment (VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) const
+{
+	const ApiCallTimer timer (m_counters[12]);
+	m_vk.getDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+}
+
+void ProfilingDeviceDriver::getBufferMemoryRequirements (VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[13]);
+	m_vk.getBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+}
+
+VkResult ProfilingDeviceDriver::bindBufferMemory (VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
+{
+	const ApiCallTimer timer (m_counters[14]);
+	return m_vk.bindBufferMemory(device, buffer, memory, memoryOffset);
+}
+
+void ProfilingDeviceDriver::getImageMemoryRequirements (VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[15]);
+	m_vk.getImageMemoryRequirements(device, image, pMemoryRequirements);
+}
+
+VkResult ProfilingDeviceDriver::bindImageMemory (VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
+{
+	const ApiCallTimer timer (m_counters[16]);
+	return m_vk.bindImageMemory(device, image, memory, memoryOffset);
+}
+
+void ProfilingDeviceDriver::getImageSparseMemoryRequirements (VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[17]);
+	m_vk.getImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+VkResult ProfilingDeviceDriver::queueBindSparse (VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) const
+{
+	const ApiCallTimer timer (m_counters[18]);
+	return m_vk.queueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+}
+
+VkResult ProfilingDeviceDriver::createFence (VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const
+{
+	const ApiCallTimer timer (m_counters[19]);
+	return m_vk.createFence(device, pCreateInfo, pAllocator, pFence);
+}
+
+void ProfilingDeviceDriver::destroyFence (VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[20]);
+	m_vk.destroyFence(device, fence, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::resetFences (VkDevice device, uint32_t fenceCount, const VkFence* pFences) const
+{
+	const ApiCallTimer timer (m_counters[21]);
+	return m_vk.resetFences(device, fenceCount, pFences);
+}
+
+VkResult ProfilingDeviceDriver::getFenceStatus (VkDevice device, VkFence fence) const
+{
+	const ApiCallTimer timer (m_counters[22]);
+	return m_vk.getFenceStatus(device, fence);
+}
+
+VkResult ProfilingDeviceDriver::waitForFences (VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) const
+{
+	const ApiCallTimer timer (m_counters[23]);
+	return m_vk.waitForFences(device, fenceCount, pFences, waitAll, timeout);
+}
+
+VkResult ProfilingDeviceDriver::createSemaphore (VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) const
+{
+	const ApiCallTimer timer (m_counters[24]);
+	return m_vk.createSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+}
+
+void ProfilingDeviceDriver::destroySemaphore (VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[25]);
+	m_vk.destroySemaphore(device, semaphore, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createEvent (VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) const
+{
+	const ApiCallTimer timer (m_counters[26]);
+	return m_vk.createEvent(device, pCreateInfo, pAllocator, pEvent);
+}
+
+void ProfilingDeviceDriver::destroyEvent (VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[27]);
+	m_vk.destroyEvent(device, event, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::getEventStatus (VkDevice device, VkEvent event) const
+{
+	const ApiCallTimer timer (m_counters[28]);
+	return m_vk.getEventStatus(device, event);
+}
+
+VkResult ProfilingDeviceDriver::setEvent (VkDevice device, VkEvent event) const
+{
+	const ApiCallTimer timer (m_counters[29]);
+	return m_vk.setEvent(device, event);
+}
+
+VkResult ProfilingDeviceDriver::resetEvent (VkDevice device, VkEvent event) const
+{
+	const ApiCallTimer timer (m_counters[30]);
+	return m_vk.resetEvent(device, event);
+}
+
+VkResult ProfilingDeviceDriver::createQueryPool (VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) const
+{
+	const ApiCallTimer timer (m_counters[31]);
+	return m_vk.createQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+}
+
+void ProfilingDeviceDriver::destroyQueryPool (VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[32]);
+	m_vk.destroyQueryPool(device, queryPool, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::getQueryPoolResults (VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[33]);
+	return m_vk.getQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+
+void ProfilingDeviceDriver::resetQueryPool (VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const
+{
+	const ApiCallTimer timer (m_counters[34]);
+	m_vk.resetQueryPool(device, queryPool, firstQuery, queryCount);
+}
+
+VkResult ProfilingDeviceDriver::createBuffer (VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) const
+{
+	const ApiCallTimer timer (m_counters[35]);
+	return m_vk.createBuffer(device, pCreateInfo, pAllocator, pBuffer);
+}
+
+void ProfilingDeviceDriver::destroyBuffer (VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[36]);
+	m_vk.destroyBuffer(device, buffer, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createBufferView (VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) const
+{
+	const ApiCallTimer timer (m_counters[37]);
+	return m_vk.createBufferView(device, pCreateInfo, pAllocator, pView);
+}
+
+void ProfilingDeviceDriver::destroyBufferView (VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[38]);
+	m_vk.destroyBufferView(device, bufferView, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createImage (VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) const
+{
+	const ApiCallTimer timer (m_counters[39]);
+	return m_vk.createImage(device, pCreateInfo, pAllocator, pImage);
+}
+
+void ProfilingDeviceDriver::destroyImage (VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[40]);
+	m_vk.destroyImage(device, image, pAllocator);
+}
+
+void ProfilingDeviceDriver::getImageSubresourceLayout (VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) const
+{
+	const ApiCallTimer timer (m_counters[41]);
+	m_vk.getImageSubresourceLayout(device, image, pSubresource, pLayout);
+}
+
+VkResult ProfilingDeviceDriver::createImageView (VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) const
+{
+	const ApiCallTimer timer (m_counters[42]);
+	return m_vk.createImageView(device, pCreateInfo, pAllocator, pView);
+}
+
+void ProfilingDeviceDriver::destroyImageView (VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[43]);
+	m_vk.destroyImageView(device, imageView, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createShaderModule (VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const
+{
+	const ApiCallTimer timer (m_counters[44]);
+	return m_vk.createShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+}
+
+void ProfilingDeviceDriver::destroyShaderModule (VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[45]);
+	m_vk.destroyShaderModule(device, shaderModule, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createPipelineCache (VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) const
+{
+	const ApiCallTimer timer (m_counters[46]);
+	return m_vk.createPipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+
+void ProfilingDeviceDriver::destroyPipelineCache (VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[47]);
+	m_vk.destroyPipelineCache(device, pipelineCache, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::getPipelineCacheData (VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) const
+{
+	const ApiCallTimer timer (m_counters[48]);
+	return m_vk.getPipelineCacheData(device, pipelineCache, pDataSize, pData);
+}
+
+VkResult ProfilingDeviceDriver::mergePipelineCaches (VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache* pSrcCaches) const
+{
+	const ApiCallTimer timer (m_counters[49]);
+	return m_vk.mergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+}
+
+VkResult ProfilingDeviceDriver::createGraphicsPipelines (VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	const ApiCallTimer timer (m_counters[50]);
+	return m_vk.createGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+VkResult ProfilingDeviceDriver::createComputePipelines (VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	const ApiCallTimer timer (m_counters[51]);
+	return m_vk.createComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+VkResult ProfilingDeviceDriver::getDeviceSubpassShadingMaxWorkgroupSizeHUAWEI (VkDevice device, VkRenderPass renderpass, VkExtent2D* pMaxWorkgroupSize) const
+{
+	const ApiCallTimer timer (m_counters[52]);
+	return m_vk.getDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(device, renderpass, pMaxWorkgroupSize);
+}
+
+void ProfilingDeviceDriver::destroyPipeline (VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[53]);
+	m_vk.destroyPipeline(device, pipeline, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createPipelineLayout (VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) const
+{
+	const ApiCallTimer timer (m_counters[54]);
+	return m_vk.createPipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+
+void ProfilingDeviceDriver::destroyPipelineLayout (VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[55]);
+	m_vk.destroyPipelineLayout(device, pipelineLayout, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createSampler (VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) const
+{
+	const ApiCallTimer timer (m_counters[56]);
+	return m_vk.createSampler(device, pCreateInfo, pAllocator, pSampler);
+}
+
+void ProfilingDeviceDriver::destroySampler (VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[57]);
+	m_vk.destroySampler(device, sampler, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createDescriptorSetLayout (VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) const
+{
+	const ApiCallTimer timer (m_counters[58]);
+	return m_vk.createDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+}
+
+void ProfilingDeviceDriver::destroyDescriptorSetLayout (VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[59]);
+	m_vk.destroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createDescriptorPool (VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) const
+{
+	const ApiCallTimer timer (m_counters[60]);
+	return m_vk.createDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+
+void ProfilingDeviceDriver::destroyDescriptorPool (VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[61]);
+	m_vk.destroyDescriptorPool(device, descriptorPool, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::resetDescriptorPool (VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[62]);
+	return m_vk.resetDescriptorPool(device, descriptorPool, flags);
+}
+
+VkResult ProfilingDeviceDriver::allocateDescriptorSets (VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) const
+{
+	const ApiCallTimer timer (m_counters[63]);
+	return m_vk.allocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+}
+
+VkResult ProfilingDeviceDriver::freeDescriptorSets (VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) const
+{
+	const ApiCallTimer timer (m_counters[64]);
+	return m_vk.freeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+
+void ProfilingDeviceDriver::updateDescriptorSets (VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) const
+{
+	const ApiCallTimer timer (m_counters[65]);
+	m_vk.updateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+}
+
+VkResult ProfilingDeviceDriver::createFramebuffer (VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) const
+{
+	const ApiCallTimer timer (m_counters[66]);
+	return m_vk.createFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+
+void ProfilingDeviceDriver::destroyFramebuffer (VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[67]);
+	m_vk.destroyFramebuffer(device, framebuffer, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createRenderPass (VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const
+{
+	const ApiCallTimer timer (m_counters[68]);
+	return m_vk.createRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+void ProfilingDeviceDriver::destroyRenderPass (VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[69]);
+	m_vk.destroyRenderPass(device, renderPass, pAllocator);
+}
+
+void ProfilingDeviceDriver::getRenderAreaGranularity (VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) const
+{
+	const ApiCallTimer timer (m_counters[70]);
+	m_vk.getRenderAreaGranularity(device, renderPass, pGranularity);
+}
+
+VkResult ProfilingDeviceDriver::createCommandPool (VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const
+{
+	const ApiCallTimer timer (m_counters[71]);
+	return m_vk.createCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+}
+
+void ProfilingDeviceDriver::destroyCommandPool (VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[72]);
+	m_vk.destroyCommandPool(device, commandPool, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::resetCommandPool (VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[73]);
+	return m_vk.resetCommandPool(device, commandPool, flags);
+}
+
+VkResult ProfilingDeviceDriver::allocateCommandBuffers (VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) const
+{
+	const ApiCallTimer timer (m_counters[74]);
+	return m_vk.allocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+}
+
+void ProfilingDeviceDriver::freeCommandBuffers (VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) const
+{
+	const ApiCallTimer timer (m_counters[75]);
+	m_vk.freeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+VkResult ProfilingDeviceDriver::beginCommandBuffer (VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) const
+{
+	const ApiCallTimer timer (m_counters[76]);
+	return m_vk.beginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+VkResult ProfilingDeviceDriver::endCommandBuffer (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[77]);
+	return m_vk.endCommandBuffer(commandBuffer);
+}
+
+VkResult ProfilingDeviceDriver::resetCommandBuffer (VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[78]);
+	return m_vk.resetCommandBuffer(commandBuffer, flags);
+}
+
+void ProfilingDeviceDriver::cmdBindPipeline (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const
+{
+	const ApiCallTimer timer (m_counters[79]);
+	m_vk.cmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+
+void ProfilingDeviceDriver::cmdSetViewport (VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) const
+{
+	const ApiCallTimer timer (m_counters[80]);
+	m_vk.cmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+
+void ProfilingDeviceDriver::cmdSetScissor (VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) const
+{
+	const ApiCallTimer timer (m_counters[81]);
+	m_vk.cmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+
+void ProfilingDeviceDriver::cmdSetLineWidth (VkCommandBuffer commandBuffer, float lineWidth) const
+{
+	const ApiCallTimer timer (m_counters[82]);
+	m_vk.cmdSetLineWidth(commandBuffer, lineWidth);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthBias (VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) const
+{
+	const ApiCallTimer timer (m_counters[83]);
+	m_vk.cmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+
+void ProfilingDeviceDriver::cmdSetBlendConstants (VkCommandBuffer commandBuffer, const float blendConstants[4]) const
+{
+	const ApiCallTimer timer (m_counters[84]);
+	m_vk.cmdSetBlendConstants(commandBuffer, blendConstants);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthBounds (VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) const
+{
+	const ApiCallTimer timer (m_counters[85]);
+	m_vk.cmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilCompareMask (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) const
+{
+	const ApiCallTimer timer (m_counters[86]);
+	m_vk.cmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilWriteMask (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) const
+{
+	const ApiCallTimer timer (m_counters[87]);
+	m_vk.cmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilReference (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) const
+{
+	const ApiCallTimer timer (m_counters[88]);
+	m_vk.cmdSetStencilReference(commandBuffer, faceMask, reference);
+}
+
+void ProfilingDeviceDriver::cmdBindDescriptorSets (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) const
+{
+	const ApiCallTimer timer (m_counters[89]);
+	m_vk.cmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+
+void ProfilingDeviceDriver::cmdBindIndexBuffer (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) const
+{
+	const ApiCallTimer timer (m_counters[90]);
+	m_vk.cmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+
+void ProfilingDeviceDriver::cmdBindVertexBuffers (VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) const
+{
+	const ApiCallTimer timer (m_counters[91]);
+	m_vk.cmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+
+void ProfilingDeviceDriver::cmdDraw (VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+{
+	const ApiCallTimer timer (m_counters[92]);
+	m_vk.cmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndexed (VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const
+{
+	const ApiCallTimer timer (m_counters[93]);
+	m_vk.cmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+
+void ProfilingDeviceDriver::cmdDrawMultiEXT (VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT* pVertexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[94]);
+	m_vk.cmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+}
+
+void ProfilingDeviceDriver::cmdDrawMultiIndexedEXT (VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawIndexedInfoEXT* pIndexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride, const int32_t* pVertexOffset) const
+{
+	const ApiCallTimer timer (m_counters[95]);
+	m_vk.cmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[96]);
+	m_vk.cmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndexedIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[97]);
+	m_vk.cmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDispatch (VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const
+{
+	const ApiCallTimer timer (m_counters[98]);
+	m_vk.cmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+
+void ProfilingDeviceDriver::cmdDispatchIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) const
+{
+	const ApiCallTimer timer (m_counters[99]);
+	m_vk.cmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+void ProfilingDeviceDriver::cmdSubpassShadingHUAWEI (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[100]);
+	m_vk.cmdSubpassShadingHUAWEI(commandBuffer);
+}
+
+void ProfilingDeviceDriver::cmdCopyBuffer (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[101]);
+	m_vk.cmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdCopyImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[102]);
+	m_vk.cmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdBlitImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) const
+{
+	const ApiCallTimer timer (m_counters[103]);
+	m_vk.cmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+}
+
+void ProfilingDeviceDriver::cmdCopyBufferToImage (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[104]);
+	m_vk.cmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdCopyImageToBuffer (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[105]);
+	m_vk.cmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdUpdateBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) const
+{
+	const ApiCallTimer timer (m_counters[106]);
+	m_vk.cmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+
+void ProfilingDeviceDriver::cmdFillBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) const
+{
+	const ApiCallTimer timer (m_counters[107]);
+	m_vk.cmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+
+void ProfilingDeviceDriver::cmdClearColorImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) const
+{
+	const ApiCallTimer timer (m_counters[108]);
+	m_vk.cmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+
+void ProfilingDeviceDriver::cmdClearDepthStencilImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) const
+{
+	const ApiCallTimer timer (m_counters[109]);
+	m_vk.cmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+
+void ProfilingDeviceDriver::cmdClearAttachments (VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) const
+{
+	const ApiCallTimer timer (m_counters[110]);
+	m_vk.cmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+
+void ProfilingDeviceDriver::cmdResolveImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[111]);
+	m_vk.cmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdSetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const
+{
+	const ApiCallTimer timer (m_counters[112]);
+	m_vk.cmdSetEvent(commandBuffer, event, stageMask);
+}
+
+void ProfilingDeviceDriver::cmdResetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const
+{
+	const ApiCallTimer timer (m_counters[113]);
+	m_vk.cmdResetEvent(commandBuffer, event, stageMask);
+}
+
+void ProfilingDeviceDriver::cmdWaitEvents (VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const
+{
+	const ApiCallTimer timer (m_counters[114]);
+	m_vk.cmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+void ProfilingDeviceDriver::cmdPipelineBarrier (VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const
+{
+	const ApiCallTimer timer (m_counters[115]);
+	m_vk.cmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+void ProfilingDeviceDriver::cmdBeginQuery (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[116]);
+	m_vk.cmdBeginQuery(commandBuffer, queryPool, query, flags);
+}
+
+void ProfilingDeviceDriver::cmdEndQuery (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) const
+{
+	const ApiCallTimer timer (m_counters[117]);
+	m_vk.cmdEndQuery(commandBuffer, queryPool, query);
+}
+
+void ProfilingDeviceDriver::cmdBeginConditionalRenderingEXT (VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin) const
+{
+	const ApiCallTimer timer (m_counters[118]);
+	m_vk.cmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+}
+
+void ProfilingDeviceDriver::cmdEndConditionalRenderingEXT (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[119]);
+	m_vk.cmdEndConditionalRenderingEXT(commandBuffer);
+}
+
+void ProfilingDeviceDriver::cmdResetQueryPool (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const
+{
+	const ApiCallTimer timer (m_counters[120]);
+	m_vk.cmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+}
+
+void ProfilingDeviceDriver::cmdWriteTimestamp (VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) const
+{
+	const ApiCallTimer timer (m_counters[121]);
+	m_vk.cmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+}
+
+void ProfilingDeviceDriver::cmdCopyQueryPoolResults (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[122]);
+	m_vk.cmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+}
+
+void ProfilingDeviceDriver::cmdPushConstants (VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) const
+{
+	const ApiCallTimer timer (m_counters[123]);
+	m_vk.cmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+
+void ProfilingDeviceDriver::cmdBeginRenderPass (VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) const
+{
+	const ApiCallTimer timer (m_counters[124]);
+	m_vk.cmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+}
+
+void ProfilingDeviceDriver::cmdNextSubpass (VkCommandBuffer commandBuffer, VkSubpassContents contents) const
+{
+	const ApiCallTimer timer (m_counters[125]);
+	m_vk.cmdNextSubpass(commandBuffer, contents);
+}
+
+void ProfilingDeviceDriver::cmdEndRenderPass (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[126]);
+	m_vk.cmdEndRenderPass(commandBuffer);
+}
+
+void ProfilingDeviceDriver::cmdExecuteCommands (VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) const
+{
+	const ApiCallTimer timer (m_counters[127]);
+	m_vk.cmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
+
+VkResult ProfilingDeviceDriver::createSharedSwapchainsKHR (VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) const
+{
+	const ApiCallTimer timer (m_counters[128]);
+	return m_vk.createSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+}
+
+VkResult ProfilingDeviceDriver::createSwapchainKHR (VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) const
+{
+	const ApiCallTimer timer (m_counters[129]);
+	return m_vk.createSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+}
+
+void ProfilingDeviceDriver::destroySwapchainKHR (VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[130]);
+	m_vk.destroySwapchainKHR(device, swapchain, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::getSwapchainImagesKHR (VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const
+{
+	const ApiCallTimer timer (m_counters[131]);
+	return m_vk.getSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+
+VkResult ProfilingDeviceDriver::acquireNextImageKHR (VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) const
+{
+	const ApiCallTimer timer (m_counters[132]);
+	return m_vk.acquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+}
+
+VkResult ProfilingDeviceDriver::queuePresentKHR (VkQueue queue, const VkPresentInfoKHR* pPresentInfo) const
+{
+	const ApiCallTimer timer (m_counters[133]);
+	return m_vk.queuePresentKHR(queue, pPresentInfo);
+}
+
+VkResult ProfilingDeviceDriver::debugMarkerSetObjectNameEXT (VkDevice device, const VkDebugMarkerObjectNameInfoEXT* pNameInfo) const
+{
+	const ApiCallTimer timer (m_counters[134]);
+	return m_vk.debugMarkerSetObjectNameEXT(device, pNameInfo);
+}
+
+VkResult ProfilingDeviceDriver::debugMarkerSetObjectTagEXT (VkDevice device, const VkDebugMarkerObjectTagInfoEXT* pTagInfo) const
+{
+	const ApiCallTimer timer (m_counters[135]);
+	return m_vk.debugMarkerSetObjectTagEXT(device, pTagInfo);
+}
+
+void ProfilingDeviceDriver::cmdDebugMarkerBeginEXT (VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) const
+{
+	const ApiCallTimer timer (m_counters[136]);
+	m_vk.cmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+}
+
+void ProfilingDeviceDriver::cmdDebugMarkerEndEXT (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[137]);
+	m_vk.cmdDebugMarkerEndEXT(commandBuffer);
+}
+
+void ProfilingDeviceDriver::cmdDebugMarkerInsertEXT (VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT* pMarkerInfo) const
+{
+	const ApiCallTimer timer (m_counters[138]);
+	m_vk.cmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryWin32HandleNV (VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, pt::Win32Handle* pHandle) const
+{
+	const ApiCallTimer timer (m_counters[139]);
+	return m_vk.getMemoryWin32HandleNV(device, memory, handleType, pHandle);
+}
+
+void ProfilingDeviceDriver::cmdExecuteGeneratedCommandsNV (VkCommandBuffer commandBuffer, VkBool32 isPreprocessed, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) const
+{
+	const ApiCallTimer timer (m_counters[140]);
+	m_vk.cmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+}
+
+void ProfilingDeviceDriver::cmdPreprocessGeneratedCommandsNV (VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV* pGeneratedCommandsInfo) const
+{
+	const ApiCallTimer timer (m_counters[141]);
+	m_vk.cmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
+}
+
+void ProfilingDeviceDriver::cmdBindPipelineShaderGroupNV (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline, uint32_t groupIndex) const
+{
+	const ApiCallTimer timer (m_counters[142]);
+	m_vk.cmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+}
+
+void ProfilingDeviceDriver::getGeneratedCommandsMemoryRequirementsNV (VkDevice device, const VkGeneratedCommandsMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[143]);
+	m_vk.getGeneratedCommandsMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+}
+
+VkResult ProfilingDeviceDriver::createIndirectCommandsLayoutNV (VkDevice device, const VkIndirectCommandsLayoutCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) const
+{
+	const ApiCallTimer timer (m_counters[144]);
+	return m_vk.createIndirectCommandsLayoutNV(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+}
+
+void ProfilingDeviceDriver::destroyIndirectCommandsLayoutNV (VkDevice device, VkIndirectCommandsLayoutNV indirectCommandsLayout, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[145]);
+	m_vk.destroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
+}
+
+void ProfilingDeviceDriver::cmdPushDescriptorSetKHR (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites) const
+{
+	const ApiCallTimer timer (m_counters[146]);
+	m_vk.cmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+}
+
+void ProfilingDeviceDriver::trimCommandPool (VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[147]);
+	m_vk.trimCommandPool(device, commandPool, flags);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryWin32HandleKHR (VkDevice device, const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo, pt::Win32Handle* pHandle) const
+{
+	const ApiCallTimer timer (m_counters[148]);
+	return m_vk.getMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryWin32HandlePropertiesKHR (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, pt::Win32Handle handle, VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties) const
+{
+	const ApiCallTimer timer (m_counters[149]);
+	return m_vk.getMemoryWin32HandlePropertiesKHR(device, handleType, handle, pMemoryWin32HandleProperties);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryFdKHR (VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) const
+{
+	const ApiCallTimer timer (m_counters[150]);
+	return m_vk.getMemoryFdKHR(device, pGetFdInfo, pFd);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryFdPropertiesKHR (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) const
+{
+	const ApiCallTimer timer (m_counters[151]);
+	return m_vk.getMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryZirconHandleFUCHSIA (VkDevice device, const VkMemoryGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, pt::zx_handle_t* pZirconHandle) const
+{
+	const ApiCallTimer timer (m_counters[152]);
+	return m_vk.getMemoryZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryZirconHandlePropertiesFUCHSIA (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, pt::zx_handle_t zirconHandle, VkMemoryZirconHandlePropertiesFUCHSIA* pMemoryZirconHandleProperties) const
+{
+	const ApiCallTimer timer (m_counters[153]);
+	return m_vk.getMemoryZirconHandlePropertiesFUCHSIA(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryRemoteAddressNV (VkDevice device, const VkMemoryGetRemoteAddressInfoNV* pMemoryGetRemoteAddressInfo, VkRemoteAddressNV* pAddress) const
+{
+	const ApiCallTimer timer (m_counters[154]);
+	return m_vk.getMemoryRemoteAddressNV(device, pMemoryGetRemoteAddressInfo, pAddress);
+}
+
+VkResult ProfilingDeviceDriver::getSemaphoreWin32HandleKHR (VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo, pt::Win32Handle* pHandle) const
+{
+	const ApiCallTimer timer (m_counters[155]);
+	return m_vk.getSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+
+VkResult ProfilingDeviceDriver::importSemaphoreWin32HandleKHR (VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo) const
+{
+	const ApiCallTimer timer (m_counters[156]);
+	return m_vk.importSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
+}
+
+VkResult ProfilingDeviceDriver::getSemaphoreFdKHR (VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) const
+{
+	const ApiCallTimer timer (m_counters[157]);
+	return m_vk.getSemaphoreFdKHR(device, pGetFdInfo, pFd);
+}
+
+VkResult ProfilingDeviceDriver::importSemaphoreFdKHR (VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) const
+{
+	const ApiCallTimer timer (m_counters[158]);
+	return m_vk.importSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+}
+
+VkResult ProfilingDeviceDriver::getSemaphoreZirconHandleFUCHSIA (VkDevice device, const VkSemaphoreGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo, pt::zx_handle_t* pZirconHandle) const
+{
+	const ApiCallTimer timer (m_counters[159]);
+	return m_vk.getSemaphoreZirconHandleFUCHSIA(device, pGetZirconHandleInfo, pZirconHandle);
+}
+
+VkResult ProfilingDeviceDriver::importSemaphoreZirconHandleFUCHSIA (VkDevice device, const VkImportSemaphoreZirconHandleInfoFUCHSIA* pImportSemaphoreZirconHandleInfo) const
+{
+	const ApiCallTimer timer (m_counters[160]);
+	return m_vk.importSemaphoreZirconHandleFUCHSIA(device, pImportSemaphoreZirconHandleInfo);
+}
+
+VkResult ProfilingDeviceDriver::getFenceWin32HandleKHR (VkDevice device, const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo, pt::Win32Handle* pHandle) const
+{
+	const ApiCallTimer timer (m_counters[161]);
+	return m_vk.getFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+}
+
+VkResult ProfilingDeviceDriver::importFenceWin32HandleKHR (VkDevice device, const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo) const
+{
+	const ApiCallTimer timer (m_counters[162]);
+	return m_vk.importFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
+}
+
+VkResult ProfilingDeviceDriver::getFenceFdKHR (VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) const
+{
+	const ApiCallTimer timer (m_counters[163]);
+	return m_vk.getFenceFdKHR(device, pGetFdInfo, pFd);
+}
+
+VkResult ProfilingDeviceDriver::importFenceFdKHR (VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) const
+{
+	const ApiCallTimer timer (m_counters[164]);
+	return m_vk.importFenceFdKHR(device, pImportFenceFdInfo);
+}
+
+VkResult ProfilingDeviceDriver::displayPowerControlEXT (VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) const
+{
+	const ApiCallTimer timer (m_counters[165]);
+	return m_vk.displayPowerControlEXT(device, display, pDisplayPowerInfo);
+}
+
+VkResult ProfilingDeviceDriver::registerDeviceEventEXT (VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const
+{
+	const ApiCallTimer timer (m_counters[166]);
+	return m_vk.registerDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
+}
+
+VkResult ProfilingDeviceDriver::registerDisplayEventEXT (VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const
+{
+	const ApiCallTimer timer (m_counters[167]);
+	return m_vk.registerDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
+}
+
+VkResult ProfilingDeviceDriver::getSwapchainCounterEXT (VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) const
+{
+	const ApiCallTimer timer (m_counters[168]);
+	return m_vk.getSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
+}
+
+void ProfilingDeviceDriver::getDeviceGroupPeerMemoryFeatures (VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) const
+{
+	const ApiCallTimer timer (m_counters[169]);
+	m_vk.getDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+}
+
+VkResult ProfilingDeviceDriver::bindBufferMemory2 (VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos) const
+{
+	const ApiCallTimer timer (m_counters[170]);
+	return m_vk.bindBufferMemory2(device, bindInfoCount, pBindInfos);
+}
+
+VkResult ProfilingDeviceDriver::bindImageMemory2 (VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos) const
+{
+	const ApiCallTimer timer (m_counters[171]);
+	return m_vk.bindImageMemory2(device, bindInfoCount, pBindInfos);
+}
+
+void ProfilingDeviceDriver::cmdSetDeviceMask (VkCommandBuffer commandBuffer, uint32_t deviceMask) const
+{
+	const ApiCallTimer timer (m_counters[172]);
+	m_vk.cmdSetDeviceMask(commandBuffer, deviceMask);
+}
+
+VkResult ProfilingDeviceDriver::getDeviceGroupPresentCapabilitiesKHR (VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[173]);
+	return m_vk.getDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
+}
+
+VkResult ProfilingDeviceDriver::getDeviceGroupSurfacePresentModesKHR (VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes) const
+{
+	const ApiCallTimer timer (m_counters[174]);
+	return m_vk.getDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
+}
+
+VkResult ProfilingDeviceDriver::acquireNextImage2KHR (VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex) const
+{
+	const ApiCallTimer timer (m_counters[175]);
+	return m_vk.acquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+}
+
+void ProfilingDeviceDriver::cmdDispatchBase (VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const
+{
+	const ApiCallTimer timer (m_counters[176]);
+	m_vk.cmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+}
+
+VkResult ProfilingDeviceDriver::createDescriptorUpdateTemplate (VkDevice device, const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) const
+{
+	const ApiCallTimer timer (m_counters[177]);
+	return m_vk.createDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+}
+
+void ProfilingDeviceDriver::destroyDescriptorUpdateTemplate (VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[178]);
+	m_vk.destroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
+}
+
+void ProfilingDeviceDriver::updateDescriptorSetWithTemplate (VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void* pData) const
+{
+	const ApiCallTimer timer (m_counters[179]);
+	m_vk.updateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
+}
+
+void ProfilingDeviceDriver::cmdPushDescriptorSetWithTemplateKHR (VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void* pData) const
+{
+	const ApiCallTimer timer (m_counters[180]);
+	m_vk.cmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+}
+
+void ProfilingDeviceDriver::setHdrMetadataEXT (VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) const
+{
+	const ApiCallTimer timer (m_counters[181]);
+	m_vk.setHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+}
+
+VkResult ProfilingDeviceDriver::getSwapchainStatusKHR (VkDevice device, VkSwapchainKHR swapchain) const
+{
+	const ApiCallTimer timer (m_counters[182]);
+	return m_vk.getSwapchainStatusKHR(device, swapchain);
+}
+
+VkResult ProfilingDeviceDriver::getRefreshCycleDurationGOOGLE (VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties) const
+{
+	const ApiCallTimer timer (m_counters[183]);
+	return m_vk.getRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
+}
+
+VkResult ProfilingDeviceDriver::getPastPresentationTimingGOOGLE (VkDevice device, VkSwapchainKHR swapchain, uint32_t* pPresentationTimingCount, VkPastPresentationTimingGOOGLE* pPresentationTimings) const
+{
+	const ApiCallTimer timer (m_counters[184]);
+	return m_vk.getPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+}
+
+void ProfilingDeviceDriver::cmdSetViewportWScalingNV (VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV* pViewportWScalings) const
+{
+	const ApiCallTimer timer (m_counters[185]);
+	m_vk.cmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+}
+
+void ProfilingDeviceDriver::cmdSetDiscardRectangleEXT (VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) const
+{
+	const ApiCallTimer timer (m_counters[186]);
+	m_vk.cmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+}
+
+void ProfilingDeviceDriver::cmdSetSampleLocationsEXT (VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) const
+{
+	const ApiCallTimer timer (m_counters[187]);
+	m_vk.cmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+}
+
+void ProfilingDeviceDriver::getBufferMemoryRequirements2 (VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[188]);
+	m_vk.getBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+}
+
+void ProfilingDeviceDriver::getImageMemoryRequirements2 (VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[189]);
+	m_vk.getImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+}
+
+void ProfilingDeviceDriver::getImageSparseMemoryRequirements2 (VkDevice device, const VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[190]);
+	m_vk.getImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+void ProfilingDeviceDriver::getDeviceBufferMemoryRequirements (VkDevice device, const VkDeviceBufferMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[191]);
+	m_vk.getDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
+}
+
+void ProfilingDeviceDriver::getDeviceImageMemoryRequirements (VkDevice device, const VkDeviceImageMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[192]);
+	m_vk.getDeviceImageMemoryRequirements(device, pInfo, pMemoryRequirements);
+}
+
+void ProfilingDeviceDriver::getDeviceImageSparseMemoryRequirements (VkDevice device, const VkDeviceImageMemoryRequirements* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[193]);
+	m_vk.getDeviceImageSparseMemoryRequirements(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+VkResult ProfilingDeviceDriver::createSamplerYcbcrConversion (VkDevice device, const VkSamplerYcbcrConversionCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion) const
+{
+	const ApiCallTimer timer (m_counters[194]);
+	return m_vk.createSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+
+void ProfilingDeviceDriver::destroySamplerYcbcrConversion (VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[195]);
+	m_vk.destroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
+}
+
+void ProfilingDeviceDriver::getDeviceQueue2 (VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) const
+{
+	const ApiCallTimer timer (m_counters[196]);
+	m_vk.getDeviceQueue2(device, pQueueInfo, pQueue);
+}
+
+VkResult ProfilingDeviceDriver::createValidationCacheEXT (VkDevice device, const VkValidationCacheCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkValidationCacheEXT* pValidationCache) const
+{
+	const ApiCallTimer timer (m_counters[197]);
+	return m_vk.createValidationCacheEXT(device, pCreateInfo, pAllocator, pValidationCache);
+}
+
+void ProfilingDeviceDriver::destroyValidationCacheEXT (VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[198]);
+	m_vk.destroyValidationCacheEXT(device, validationCache, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::getValidationCacheDataEXT (VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize, void* pData) const
+{
+	const ApiCallTimer timer (m_counters[199]);
+	return m_vk.getValidationCacheDataEXT(device, validationCache, pDataSize, pData);
+}
+
+VkResult ProfilingDeviceDriver::mergeValidationCachesEXT (VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) const
+{
+	const ApiCallTimer timer (m_counters[200]);
+	return m_vk.mergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
+}
+
+void ProfilingDeviceDriver::getDescriptorSetLayoutSupport (VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport) const
+{
+	const ApiCallTimer timer (m_counters[201]);
+	m_vk.getDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+}
+
+VkResult ProfilingDeviceDriver::getShaderInfoAMD (VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t* pInfoSize, void* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[202]);
+	return m_vk.getShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+}
+
+void ProfilingDeviceDriver::setLocalDimmingAMD (VkDevice device, VkSwapchainKHR swapChain, VkBool32 localDimmingEnable) const
+{
+	const ApiCallTimer timer (m_counters[203]);
+	m_vk.setLocalDimmingAMD(device, swapChain, localDimmingEnable);
+}
+
+VkResult ProfilingDeviceDriver::getCalibratedTimestampsEXT (VkDevice device, uint32_t timestampCount, const VkCalibratedTimestampInfoEXT* pTimestampInfos, uint64_t* pTimestamps, uint64_t* pMaxDeviation) const
+{
+	const ApiCallTimer timer (m_counters[204]);
+	return m_vk.getCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+}
+
+VkResult ProfilingDeviceDriver::setDebugUtilsObjectNameEXT (VkDevice device, const VkDebugUtilsObjectNameInfoEXT* pNameInfo) const
+{
+	const ApiCallTimer timer (m_counters[205]);
+	return m_vk.setDebugUtilsObjectNameEXT(device, pNameInfo);
+}
+
+VkResult ProfilingDeviceDriver::setDebugUtilsObjectTagEXT (VkDevice device, const VkDebugUtilsObjectTagInfoEXT* pTagInfo) const
+{
+	const ApiCallTimer timer (m_counters[206]);
+	return m_vk.setDebugUtilsObjectTagEXT(device, pTagInfo);
+}
+
+void ProfilingDeviceDriver::queueBeginDebugUtilsLabelEXT (VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo) const
+{
+	const ApiCallTimer timer (m_counters[207]);
+	m_vk.queueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
+}
+
+void ProfilingDeviceDriver::queueEndDebugUtilsLabelEXT (VkQueue queue) const
+{
+	const ApiCallTimer timer (m_counters[208]);
+	m_vk.queueEndDebugUtilsLabelEXT(queue);
+}
+
+void ProfilingDeviceDriver::queueInsertDebugUtilsLabelEXT (VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo) const
+{
+	const ApiCallTimer timer (m_counters[209]);
+	m_vk.queueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
+}
+
+void ProfilingDeviceDriver::cmdBeginDebugUtilsLabelEXT (VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) const
+{
+	const ApiCallTimer timer (m_counters[210]);
+	m_vk.cmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+}
+
+void ProfilingDeviceDriver::cmdEndDebugUtilsLabelEXT (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[211]);
+	m_vk.cmdEndDebugUtilsLabelEXT(commandBuffer);
+}
+
+void ProfilingDeviceDriver::cmdInsertDebugUtilsLabelEXT (VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) const
+{
+	const ApiCallTimer timer (m_counters[212]);
+	m_vk.cmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryHostPointerPropertiesEXT (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) const
+{
+	const ApiCallTimer timer (m_counters[213]);
+	return m_vk.getMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+}
+
+void ProfilingDeviceDriver::cmdWriteBufferMarkerAMD (VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const
+{
+	const ApiCallTimer timer (m_counters[214]);
+	m_vk.cmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+}
+
+VkResult ProfilingDeviceDriver::createRenderPass2 (VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const
+{
+	const ApiCallTimer timer (m_counters[215]);
+	return m_vk.createRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+void ProfilingDeviceDriver::cmdBeginRenderPass2 (VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfo* pSubpassBeginInfo) const
+{
+	const ApiCallTimer timer (m_counters[216]);
+	m_vk.cmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+
+void ProfilingDeviceDriver::cmdNextSubpass2 (VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo, const VkSubpassEndInfo* pSubpassEndInfo) const
+{
+	const ApiCallTimer timer (m_counters[217]);
+	m_vk.cmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+}
+
+void ProfilingDeviceDriver::cmdEndRenderPass2 (VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) const
+{
+	const ApiCallTimer timer (m_counters[218]);
+	m_vk.cmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+}
+
+VkResult ProfilingDeviceDriver::getSemaphoreCounterValue (VkDevice device, VkSemaphore semaphore, uint64_t* pValue) const
+{
+	const ApiCallTimer timer (m_counters[219]);
+	return m_vk.getSemaphoreCounterValue(device, semaphore, pValue);
+}
+
+VkResult ProfilingDeviceDriver::waitSemaphores (VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) const
+{
+	const ApiCallTimer timer (m_counters[220]);
+	return m_vk.waitSemaphores(device, pWaitInfo, timeout);
+}
+
+VkResult ProfilingDeviceDriver::signalSemaphore (VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) const
+{
+	const ApiCallTimer timer (m_counters[221]);
+	return m_vk.signalSemaphore(device, pSignalInfo);
+}
+
+VkResult ProfilingDeviceDriver::getAndroidHardwareBufferPropertiesANDROID (VkDevice device, const struct pt::AndroidHardwareBufferPtr buffer, VkAndroidHardwareBufferPropertiesANDROID* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[222]);
+	return m_vk.getAndroidHardwareBufferPropertiesANDROID(device, buffer, pProperties);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryAndroidHardwareBufferANDROID (VkDevice device, const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo, struct pt::AndroidHardwareBufferPtr* pBuffer) const
+{
+	const ApiCallTimer timer (m_counters[223]);
+	return m_vk.getMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndirectCount (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[224]);
+	m_vk.cmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndexedIndirectCount (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[225]);
+	m_vk.cmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdSetCheckpointNV (VkCommandBuffer commandBuffer, const void* pCheckpointMarker) const
+{
+	const ApiCallTimer timer (m_counters[226]);
+	m_vk.cmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
+}
+
+void ProfilingDeviceDriver::getQueueCheckpointDataNV (VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointDataNV* pCheckpointData) const
+{
+	const ApiCallTimer timer (m_counters[227]);
+	m_vk.getQueueCheckpointDataNV(queue, pCheckpointDataCount, pCheckpointData);
+}
+
+void ProfilingDeviceDriver::cmdBindTransformFeedbackBuffersEXT (VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes) const
+{
+	const ApiCallTimer timer (m_counters[228]);
+	m_vk.cmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+}
+
+void ProfilingDeviceDriver::cmdBeginTransformFeedbackEXT (VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets) const
+{
+	const ApiCallTimer timer (m_counters[229]);
+	m_vk.cmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+}
+
+void ProfilingDeviceDriver::cmdEndTransformFeedbackEXT (VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer* pCounterBuffers, const VkDeviceSize* pCounterBufferOffsets) const
+{
+	const ApiCallTimer timer (m_counters[230]);
+	m_vk.cmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+}
+
+void ProfilingDeviceDriver::cmdBeginQueryIndexedEXT (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags, uint32_t index) const
+{
+	const ApiCallTimer timer (m_counters[231]);
+	m_vk.cmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
+}
+
+void ProfilingDeviceDriver::cmdEndQueryIndexedEXT (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, uint32_t index) const
+{
+	const ApiCallTimer timer (m_counters[232]);
+	m_vk.cmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndirectByteCountEXT (VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, VkBuffer counterBuffer, VkDeviceSize counterBufferOffset, uint32_t counterOffset, uint32_t vertexStride) const
+{
+	const ApiCallTimer timer (m_counters[233]);
+	m_vk.cmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
+}
+
+void ProfilingDeviceDriver::cmdSetExclusiveScissorNV (VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkRect2D* pExclusiveScissors) const
+{
+	const ApiCallTimer timer (m_counters[234]);
+	m_vk.cmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+}
+
+void ProfilingDeviceDriver::cmdBindShadingRateImageNV (VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) const
+{
+	const ApiCallTimer timer (m_counters[235]);
+	m_vk.cmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
+}
+
+void ProfilingDeviceDriver::cmdSetViewportShadingRatePaletteNV (VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkShadingRatePaletteNV* pShadingRatePalettes) const
+{
+	const ApiCallTimer timer (m_counters[236]);
+	m_vk.cmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+}
+
+void ProfilingDeviceDriver::cmdSetCoarseSampleOrderNV (VkCommandBuffer commandBuffer, VkCoarseSampleOrderTypeNV sampleOrderType, uint32_t customSampleOrderCount, const VkCoarseSampleOrderCustomNV* pCustomSampleOrders) const
+{
+	const ApiCallTimer timer (m_counters[237]);
+	m_vk.cmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+}
+
+void ProfilingDeviceDriver::cmdDrawMeshTasksNV (VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask) const
+{
+	const ApiCallTimer timer (m_counters[238]);
+	m_vk.cmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
+}
+
+void ProfilingDeviceDriver::cmdDrawMeshTasksIndirectNV (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[239]);
+	m_vk.cmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDrawMeshTasksIndirectCountNV (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[240]);
+	m_vk.cmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDrawMeshTasksEXT (VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const
+{
+	const ApiCallTimer timer (m_counters[241]);
+	m_vk.cmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+
+void ProfilingDeviceDriver::cmdDrawMeshTasksIndirectEXT (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[242]);
+	m_vk.cmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDrawMeshTasksIndirectCountEXT (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[243]);
+	m_vk.cmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+VkResult ProfilingDeviceDriver::compileDeferredNV (VkDevice device, VkPipeline pipeline, uint32_t shader) const
+{
+	const ApiCallTimer timer (m_counters[244]);
+	return m_vk.compileDeferredNV(device, pipeline, shader);
+}
+
+VkResult ProfilingDeviceDriver::createAccelerationStructureNV (VkDevice device, const VkAccelerationStructureCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureNV* pAccelerationStructure) const
+{
+	const ApiCallTimer timer (m_counters[245]);
+	return m_vk.createAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
+}
+
+void ProfilingDeviceDriver::cmdBindInvocationMaskHUAWEI (VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) const
+{
+	const ApiCallTimer timer (m_counters[246]);
+	m_vk.cmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
+}
+
+void ProfilingDeviceDriver::destroyAccelerationStructureKHR (VkDevice device, VkAccelerationStructureKHR accelerationStructure, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[247]);
+	m_vk.destroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
+}
+
+void ProfilingDeviceDriver::destroyAccelerationStructureNV (VkDevice device, VkAccelerationStructureNV accelerationStructure, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[248]);
+	m_vk.destroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
+}
+
+void ProfilingDeviceDriver::getAccelerationStructureMemoryRequirementsNV (VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2KHR* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[249]);
+	m_vk.getAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+}
+
+VkResult ProfilingDeviceDriver::bindAccelerationStructureMemoryNV (VkDevice device, uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) const
+{
+	const ApiCallTimer timer (m_counters[250]);
+	return m_vk.bindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+}
+
+void ProfilingDeviceDriver::cmdCopyAccelerationStructureNV (VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkCopyAccelerationStructureModeKHR mode) const
+{
+	const ApiCallTimer timer (m_counters[251]);
+	m_vk.cmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
+}
+
+void ProfilingDeviceDriver::cmdCopyAccelerationStructureKHR (VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[252]);
+	m_vk.cmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::copyAccelerationStructureKHR (VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[253]);
+	return m_vk.copyAccelerationStructureKHR(device, deferredOperation, pInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyAccelerationStructureToMemoryKHR (VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[254]);
+	m_vk.cmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::copyAccelerationStructureToMemoryKHR (VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[255]);
+	return m_vk.copyAccelerationStructureToMemoryKHR(device, deferredOperation, pInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyMemoryToAccelerationStructureKHR (VkCommandBuffer commandBuffer, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[256]);
+	m_vk.cmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::copyMemoryToAccelerationStructureKHR (VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[257]);
+	return m_vk.copyMemoryToAccelerationStructureKHR(device, deferredOperation, pInfo);
+}
+
+void ProfilingDeviceDriver::cmdWriteAccelerationStructuresPropertiesKHR (VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const
+{
+	const ApiCallTimer timer (m_counters[258]);
+	m_vk.cmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+}
+
+void ProfilingDeviceDriver::cmdWriteAccelerationStructuresPropertiesNV (VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureNV* pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const
+{
+	const ApiCallTimer timer (m_counters[259]);
+	m_vk.cmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+}
+
+void ProfilingDeviceDriver::cmdBuildAccelerationStructureNV (VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV* pInfo, VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch, VkDeviceSize scratchOffset) const
+{
+	const ApiCallTimer timer (m_counters[260]);
+	m_vk.cmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+}
+
+VkResult ProfilingDeviceDriver::writeAccelerationStructuresPropertiesKHR (VkDevice device, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR* pAccelerationStructures, VkQueryType queryType, size_t dataSize, void* pData, size_t stride) const
+{
+	const ApiCallTimer timer (m_counters[261]);
+	return m_vk.writeAccelerationStructuresPropertiesKHR(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
+}
+
+void ProfilingDeviceDriver::cmdTraceRaysKHR (VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, uint32_t width, uint32_t height, uint32_t depth) const
+{
+	const ApiCallTimer timer (m_counters[262]);
+	m_vk.cmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
+}
+
+void ProfilingDeviceDriver::cmdTraceRaysNV (VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset, VkBuffer missShaderBindingTableBuffer, VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride, VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset, VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer, VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height, uint32_t depth) const
+{
+	const ApiCallTimer timer (m_counters[263]);
+	m_vk.cmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
+}
+
+VkResult ProfilingDeviceDriver::getRayTracingShaderGroupHandlesKHR (VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const
+{
+	const ApiCallTimer timer (m_counters[264]);
+	return m_vk.getRayTracingShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+
+VkResult ProfilingDeviceDriver::getRayTracingCaptureReplayShaderGroupHandlesKHR (VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const
+{
+	const ApiCallTimer timer (m_counters[265]);
+	return m_vk.getRayTracingCaptureReplayShaderGroupHandlesKHR(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+
+VkResult ProfilingDeviceDriver::getAccelerationStructureHandleNV (VkDevice device, VkAccelerationStructureNV accelerationStructure, size_t dataSize, void* pData) const
+{
+	const ApiCallTimer timer (m_counters[266]);
+	return m_vk.getAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
+}
+
+VkResult ProfilingDeviceDriver::createRayTracingPipelinesNV (VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	const ApiCallTimer timer (m_counters[267]);
+	return m_vk.createRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+VkResult ProfilingDeviceDriver::createRayTracingPipelinesKHR (VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	const ApiCallTimer timer (m_counters[268]);
+	return m_vk.createRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+void ProfilingDeviceDriver::cmdTraceRaysIndirectKHR (VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR* pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR* pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress) const
+{
+	const ApiCallTimer timer (m_counters[269]);
+	m_vk.cmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+}
+
+void ProfilingDeviceDriver::cmdTraceRaysIndirect2KHR (VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress) const
+{
+	const ApiCallTimer timer (m_counters[270]);
+	m_vk.cmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
+}
+
+void ProfilingDeviceDriver::getDeviceAccelerationStructureCompatibilityKHR (VkDevice device, const VkAccelerationStructureVersionInfoKHR* pVersionInfo, VkAccelerationStructureCompatibilityKHR* pCompatibility) const
+{
+	const ApiCallTimer timer (m_counters[271]);
+	m_vk.getDeviceAccelerationStructureCompatibilityKHR(device, pVersionInfo, pCompatibility);
+}
+
+VkDeviceSize ProfilingDeviceDriver::getRayTracingShaderGroupStackSizeKHR (VkDevice device, VkPipeline pipeline, uint32_t group, VkShaderGroupShaderKHR groupShader) const
+{
+	const ApiCallTimer timer (m_counters[272]);
+	return m_vk.getRayTracingShaderGroupStackSizeKHR(device, pipeline, group, groupShader);
+}
+
+void ProfilingDeviceDriver::cmdSetRayTracingPipelineStackSizeKHR (VkCommandBuffer commandBuffer, uint32_t pipelineStackSize) const
+{
+	const ApiCallTimer timer (m_counters[273]);
+	m_vk.cmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
+}
+
+uint32_t ProfilingDeviceDriver::getImageViewHandleNVX (VkDevice device, const VkImageViewHandleInfoNVX* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[274]);
+	return m_vk.getImageViewHandleNVX(device, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::getImageViewAddressNVX (VkDevice device, VkImageView imageView, VkImageViewAddressPropertiesNVX* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[275]);
+	return m_vk.getImageViewAddressNVX(device, imageView, pProperties);
+}
+
+VkResult ProfilingDeviceDriver::getDeviceGroupSurfacePresentModes2EXT (VkDevice device, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkDeviceGroupPresentModeFlagsKHR* pModes) const
+{
+	const ApiCallTimer timer (m_counters[276]);
+	return m_vk.getDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
+}
+
+VkResult ProfilingDeviceDriver::acquireFullScreenExclusiveModeEXT (VkDevice device, VkSwapchainKHR swapchain) const
+{
+	const ApiCallTimer timer (m_counters[277]);
+	return m_vk.acquireFullScreenExclusiveModeEXT(device, swapchain);
+}
+
+VkResult ProfilingDeviceDriver::releaseFullScreenExclusiveModeEXT (VkDevice device, VkSwapchainKHR swapchain) const
+{
+	const ApiCallTimer timer (m_counters[278]);
+	return m_vk.releaseFullScreenExclusiveModeEXT(device, swapchain);
+}
+
+VkResult ProfilingDeviceDriver::acquireProfilingLockKHR (VkDevice device, const VkAcquireProfilingLockInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[279]);
+	return m_vk.acquireProfilingLockKHR(device, pInfo);
+}
+
+void ProfilingDeviceDriver::releaseProfilingLockKHR (VkDevice device) const
+{
+	const ApiCallTimer timer (m_counters[280]);
+	m_vk.releaseProfilingLockKHR(device);
+}
+
+VkResult ProfilingDeviceDriver::getImageDrmFormatModifierPropertiesEXT (VkDevice device, VkImage image, VkImageDrmFormatModifierPropertiesEXT* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[281]);
+	return m_vk.getImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
+}
+
+uint64_t ProfilingDeviceDriver::getBufferOpaqueCaptureAddress (VkDevice device, const VkBufferDeviceAddressInfo* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[282]);
+	return m_vk.getBufferOpaqueCaptureAddress(device, pInfo);
+}
+
+VkDeviceAddress ProfilingDeviceDriver::getBufferDeviceAddress (VkDevice device, const VkBufferDeviceAddressInfo* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[283]);
+	return m_vk.getBufferDeviceAddress(device, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::initializePerformanceApiINTEL (VkDevice device, const VkInitializePerformanceApiInfoINTEL* pInitializeInfo) const
+{
+	const ApiCallTimer timer (m_counters[284]);
+	return m_vk.initializePerformanceApiINTEL(device, pInitializeInfo);
+}
+
+void ProfilingDeviceDriver::uninitializePerformanceApiINTEL (VkDevice device) const
+{
+	const ApiCallTimer timer (m_counters[285]);
+	m_vk.uninitializePerformanceApiINTEL(device);
+}
+
+VkResult ProfilingDeviceDriver::cmdSetPerformanceMarkerINTEL (VkCommandBuffer commandBuffer, const VkPerformanceMarkerInfoINTEL* pMarkerInfo) const
+{
+	const ApiCallTimer timer (m_counters[286]);
+	return m_vk.cmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
+}
+
+VkResult ProfilingDeviceDriver::cmdSetPerformanceStreamMarkerINTEL (VkCommandBuffer commandBuffer, const VkPerformanceStreamMarkerInfoINTEL* pMarkerInfo) const
+{
+	const ApiCallTimer timer (m_counters[287]);
+	return m_vk.cmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
+}
+
+VkResult ProfilingDeviceDriver::cmdSetPerformanceOverrideINTEL (VkCommandBuffer commandBuffer, const VkPerformanceOverrideInfoINTEL* pOverrideInfo) const
+{
+	const ApiCallTimer timer (m_counters[288]);
+	return m_vk.cmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
+}
+
+VkResult ProfilingDeviceDriver::acquirePerformanceConfigurationINTEL (VkDevice device, const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo, VkPerformanceConfigurationINTEL* pConfiguration) const
+{
+	const ApiCallTimer timer (m_counters[289]);
+	return m_vk.acquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
+}
+
+VkResult ProfilingDeviceDriver::releasePerformanceConfigurationINTEL (VkDevice device, VkPerformanceConfigurationINTEL configuration) const
+{
+	const ApiCallTimer timer (m_counters[290]);
+	return m_vk.releasePerformanceConfigurationINTEL(device, configuration);
+}
+
+VkResult ProfilingDeviceDriver::queueSetPerformanceConfigurationINTEL (VkQueue queue, VkPerformanceConfigurationINTEL configuration) const
+{
+	const ApiCallTimer timer (m_counters[291]);
+	return m_vk.queueSetPerformanceConfigurationINTEL(queue, configuration);
+}
+
+VkResult ProfilingDeviceDriver::getPerformanceParameterINTEL (VkDevice device, VkPerformanceParameterTypeINTEL parameter, VkPerformanceValueINTEL* pValue) const
+{
+	const ApiCallTimer timer (m_counters[292]);
+	return m_vk.getPerformanceParameterINTEL(device, parameter, pValue);
+}
+
+uint64_t ProfilingDeviceDriver::getDeviceMemoryOpaqueCaptureAddress (VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[293]);
+	return m_vk.getDeviceMemoryOpaqueCaptureAddress(device, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::getPipelineExecutablePropertiesKHR (VkDevice device, const VkPipelineInfoKHR* pPipelineInfo, uint32_t* pExecutableCount, VkPipelineExecutablePropertiesKHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[294]);
+	return m_vk.getPipelineExecutablePropertiesKHR(device, pPipelineInfo, pExecutableCount, pProperties);
+}
+
+VkResult ProfilingDeviceDriver::getPipelineExecutableStatisticsKHR (VkDevice device, const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pStatisticCount, VkPipelineExecutableStatisticKHR* pStatistics) const
+{
+	const ApiCallTimer timer (m_counters[295]);
+	return m_vk.getPipelineExecutableStatisticsKHR(device, pExecutableInfo, pStatisticCount, pStatistics);
+}
+
+VkResult ProfilingDeviceDriver::getPipelineExecutableInternalRepresentationsKHR (VkDevice device, const VkPipelineExecutableInfoKHR* pExecutableInfo, uint32_t* pInternalRepresentationCount, VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) const
+{
+	const ApiCallTimer timer (m_counters[296]);
+	return m_vk.getPipelineExecutableInternalRepresentationsKHR(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
+}
+
+void ProfilingDeviceDriver::cmdSetLineStippleEXT (VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern) const
+{
+	const ApiCallTimer timer (m_counters[297]);
+	m_vk.cmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+
+VkResult ProfilingDeviceDriver::createAccelerationStructureKHR (VkDevice device, const VkAccelerationStructureCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkAccelerationStructureKHR* pAccelerationStructure) const
+{
+	const ApiCallTimer timer (m_counters[298]);
+	return m_vk.createAccelerationStructureKHR(device, pCreateInfo, pAllocator, pAccelerationStructure);
+}
+
+void ProfilingDeviceDriver::cmdBuildAccelerationStructuresKHR (VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) const
+{
+	const ApiCallTimer timer (m_counters[299]);
+	m_vk.cmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+}
+
+void ProfilingDeviceDriver::cmdBuildAccelerationStructuresIndirectKHR (VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkDeviceAddress* pIndirectDeviceAddresses, const uint32_t* pIndirectStrides, const uint32_t* const* ppMaxPrimitiveCounts) const
+{
+	const ApiCallTimer timer (m_counters[300]);
+	m_vk.cmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+}
+
+VkResult ProfilingDeviceDriver::buildAccelerationStructuresKHR (VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) const
+{
+	const ApiCallTimer timer (m_counters[301]);
+	return m_vk.buildAccelerationStructuresKHR(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+}
+
+VkDeviceAddress ProfilingDeviceDriver::getAccelerationStructureDeviceAddressKHR (VkDevice device, const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[302]);
+	return m_vk.getAccelerationStructureDeviceAddressKHR(device, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::createDeferredOperationKHR (VkDevice device, const VkAllocationCallbacks* pAllocator, VkDeferredOperationKHR* pDeferredOperation) const
+{
+	const ApiCallTimer timer (m_counters[303]);
+	return m_vk.createDeferredOperationKHR(device, pAllocator, pDeferredOperation);
+}
+
+void ProfilingDeviceDriver::destroyDeferredOperationKHR (VkDevice device, VkDeferredOperationKHR operation, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[304]);
+	m_vk.destroyDeferredOperationKHR(device, operation, pAllocator);
+}
+
+uint32_t ProfilingDeviceDriver::getDeferredOperationMaxConcurrencyKHR (VkDevice device, VkDeferredOperationKHR operation) const
+{
+	const ApiCallTimer timer (m_counters[305]);
+	return m_vk.getDeferredOperationMaxConcurrencyKHR(device, operation);
+}
+
+VkResult ProfilingDeviceDriver::getDeferredOperationResultKHR (VkDevice device, VkDeferredOperationKHR operation) const
+{
+	const ApiCallTimer timer (m_counters[306]);
+	return m_vk.getDeferredOperationResultKHR(device, operation);
+}
+
+VkResult ProfilingDeviceDriver::deferredOperationJoinKHR (VkDevice device, VkDeferredOperationKHR operation) const
+{
+	const ApiCallTimer timer (m_counters[307]);
+	return m_vk.deferredOperationJoinKHR(device, operation);
+}
+
+void ProfilingDeviceDriver::cmdSetCullMode (VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) const
+{
+	const ApiCallTimer timer (m_counters[308]);
+	m_vk.cmdSetCullMode(commandBuffer, cullMode);
+}
+
+void ProfilingDeviceDriver::cmdSetFrontFace (VkCommandBuffer commandBuffer, VkFrontFace frontFace) const
+{
+	const ApiCallTimer timer (m_counters[309]);
+	m_vk.cmdSetFrontFace(commandBuffer, frontFace);
+}
+
+void ProfilingDeviceDriver::cmdSetPrimitiveTopology (VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) const
+{
+	const ApiCallTimer timer (m_counters[310]);
+	m_vk.cmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
+}
+
+void ProfilingDeviceDriver::cmdSetViewportWithCount (VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports) const
+{
+	const ApiCallTimer timer (m_counters[311]);
+	m_vk.cmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
+}
+
+void ProfilingDeviceDriver::cmdSetScissorWithCount (VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) const
+{
+	const ApiCallTimer timer (m_counters[312]);
+	m_vk.cmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
+}
+
+void ProfilingDeviceDriver::cmdBindVertexBuffers2 (VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) const
+{
+	const ApiCallTimer timer (m_counters[313]);
+	m_vk.cmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthTestEnable (VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const
+{
+	const ApiCallTimer timer (m_counters[314]);
+	m_vk.cmdSetDepthTestEnable(commandBuffer, depthTestEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthWriteEnable (VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) const
+{
+	const ApiCallTimer timer (m_counters[315]);
+	m_vk.cmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthCompareOp (VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) const
+{
+	const ApiCallTimer timer (m_counters[316]);
+	m_vk.cmdSetDepthCompareOp(commandBuffer, depthCompareOp);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthBoundsTestEnable (VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) const
+{
+	const ApiCallTimer timer (m_counters[317]);
+	m_vk.cmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilTestEnable (VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) const
+{
+	const ApiCallTimer timer (m_counters[318]);
+	m_vk.cmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilOp (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) const
+{
+	const ApiCallTimer timer (m_counters[319]);
+	m_vk.cmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+}
+
+void ProfilingDeviceDriver::cmdSetPatchControlPointsEXT (VkCommandBuffer commandBuffer, uint32_t patchControlPoints) const
+{
+	const ApiCallTimer timer (m_counters[320]);
+	m_vk.cmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
+}
+
+void ProfilingDeviceDriver::cmdSetRasterizerDiscardEnable (VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) const
+{
+	const ApiCallTimer timer (m_counters[321]);
+	m_vk.cmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthBiasEnable (VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) const
+{
+	const ApiCallTimer timer (m_counters[322]);
+	m_vk.cmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetLogicOpEXT (VkCommandBuffer commandBuffer, VkLogicOp logicOp) const
+{
+	const ApiCallTimer timer (m_counters[323]);
+	m_vk.cmdSetLogicOpEXT(commandBuffer, logicOp);
+}
+
+void ProfilingDeviceDriver::cmdSetPrimitiveRestartEnable (VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) const
+{
+	const ApiCallTimer timer (m_counters[324]);
+	m_vk.cmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
+}
+
+VkResult ProfilingDeviceDriver::createPrivateDataSlot (VkDevice device, const VkPrivateDataSlotCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPrivateDataSlot* pPrivateDataSlot) const
+{
+	const ApiCallTimer timer (m_counters[325]);
+	return m_vk.createPrivateDataSlot(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+}
+
+void ProfilingDeviceDriver::cmdSetTessellationDomainOriginEXT (VkCommandBuffer commandBuffer, VkTessellationDomainOrigin domainOrigin) const
+{
+	const ApiCallTimer timer (m_counters[326]);
+	m_vk.cmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthClampEnableEXT (VkCommandBuffer commandBuffer, VkBool32 depthClampEnable) const
+{
+	const ApiCallTimer timer (m_counters[327]);
+	m_vk.cmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetPolygonModeEXT (VkCommandBuffer commandBuffer, VkPolygonMode polygonMode) const
+{
+	const ApiCallTimer timer (m_counters[328]);
+	m_vk.cmdSetPolygonModeEXT(commandBuffer, polygonMode);
+}
+
+void ProfilingDeviceDriver::cmdSetRasterizationSamplesEXT (VkCommandBuffer commandBuffer, VkSampleCountFlagBits rasterizationSamples) const
+{
+	const ApiCallTimer timer (m_counters[329]);
+	m_vk.cmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
+}
+
+void ProfilingDeviceDriver::cmdSetSampleMaskEXT (VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples, const VkSampleMask* pSampleMask) const
+{
+	const ApiCallTimer timer (m_counters[330]);
+	m_vk.cmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
+}
+
+void ProfilingDeviceDriver::cmdSetAlphaToCoverageEnableEXT (VkCommandBuffer commandBuffer, VkBool32 alphaToCoverageEnable) const
+{
+	const ApiCallTimer timer (m_counters[331]);
+	m_vk.cmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetAlphaToOneEnableEXT (VkCommandBuffer commandBuffer, VkBool32 alphaToOneEnable) const
+{
+	const ApiCallTimer timer (m_counters[332]);
+	m_vk.cmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetLogicOpEnableEXT (VkCommandBuffer commandBuffer, VkBool32 logicOpEnable) const
+{
+	const ApiCallTimer timer (m_counters[333]);
+	m_vk.cmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetColorBlendEnableEXT (VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkBool32* pColorBlendEnables) const
+{
+	const ApiCallTimer timer (m_counters[334]);
+	m_vk.cmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+}
+
+void ProfilingDeviceDriver::cmdSetColorBlendEquationEXT (VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendEquationEXT* pColorBlendEquations) const
+{
+	const ApiCallTimer timer (m_counters[335]);
+	m_vk.cmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+}
+
+void ProfilingDeviceDriver::cmdSetColorWriteMaskEXT (VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorComponentFlags* pColorWriteMasks) const
+{
+	const ApiCallTimer timer (m_counters[336]);
+	m_vk.cmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+}
+
+void ProfilingDeviceDriver::cmdSetRasterizationStreamEXT (VkCommandBuffer commandBuffer, uint32_t rasterizationStream) const
+{
+	const ApiCallTimer timer (m_counters[337]);
+	m_vk.cmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
+}
+
+void ProfilingDeviceDriver::cmdSetConservativeRasterizationModeEXT (VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) const
+{
+	const ApiCallTimer timer (m_counters[338]);
+	m_vk.cmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
+}
+
+void ProfilingDeviceDriver::cmdSetExtraPrimitiveOverestimationSizeEXT (VkCommandBuffer commandBuffer, float extraPrimitiveOverestimationSize) const
+{
+	const ApiCallTimer timer (m_counters[339]);
+	m_vk.cmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthClipEnableEXT (VkCommandBuffer commandBuffer, VkBool32 depthClipEnable) const
+{
+	const ApiCallTimer timer (m_counters[340]);
+	m_vk.cmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetSampleLocationsEnableEXT (VkCommandBuffer commandBuffer, VkBool32 sampleLocationsEnable) const
+{
+	const ApiCallTimer timer (m_counters[341]);
+	m_vk.cmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetColorBlendAdvancedEXT (VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendAdvancedEXT* pColorBlendAdvanced) const
+{
+	const ApiCallTimer timer (m_counters[342]);
+	m_vk.cmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+}
+
+void ProfilingDeviceDriver::cmdSetProvokingVertexModeEXT (VkCommandBuffer commandBuffer, VkProvokingVertexModeEXT provokingVertexMode) const
+{
+	const ApiCallTimer timer (m_counters[343]);
+	m_vk.cmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
+}
+
+void ProfilingDeviceDriver::cmdSetLineRasterizationModeEXT (VkCommandBuffer commandBuffer, VkLineRasterizationModeEXT lineRasterizationMode) const
+{
+	const ApiCallTimer timer (m_counters[344]);
+	m_vk.cmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
+}
+
+void ProfilingDeviceDriver::cmdSetLineStippleEnableEXT (VkCommandBuffer commandBuffer, VkBool32 stippledLineEnable) const
+{
+	const ApiCallTimer timer (m_counters[345]);
+	m_vk.cmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthClipNegativeOneToOneEXT (VkCommandBuffer commandBuffer, VkBool32 negativeOneToOne) const
+{
+	const ApiCallTimer timer (m_counters[346]);
+	m_vk.cmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
+}
+
+void ProfilingDeviceDriver::cmdSetViewportWScalingEnableNV (VkCommandBuffer commandBuffer, VkBool32 viewportWScalingEnable) const
+{
+	const ApiCallTimer timer (m_counters[347]);
+	m_vk.cmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetViewportSwizzleNV (VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportSwizzleNV* pViewportSwizzles) const
+{
+	const ApiCallTimer timer (m_counters[348]);
+	m_vk.cmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+}
+
+void ProfilingDeviceDriver::cmdSetCoverageToColorEnableNV (VkCommandBuffer commandBuffer, VkBool32 coverageToColorEnable) const
+{
+	const ApiCallTimer timer (m_counters[349]);
+	m_vk.cmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetCoverageToColorLocationNV (VkCommandBuffer commandBuffer, uint32_t coverageToColorLocation) const
+{
+	const ApiCallTimer timer (m_counters[350]);
+	m_vk.cmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
+}
+
+void ProfilingDeviceDriver::cmdSetCoverageModulationModeNV (VkCommandBuffer commandBuffer, VkCoverageModulationModeNV coverageModulationMode) const
+{
+	const ApiCallTimer timer (m_counters[351]);
+	m_vk.cmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
+}
+
+void ProfilingDeviceDriver::cmdSetCoverageModulationTableEnableNV (VkCommandBuffer commandBuffer, VkBool32 coverageModulationTableEnable) const
+{
+	const ApiCallTimer timer (m_counters[352]);
+	m_vk.cmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetCoverageModulationTableNV (VkCommandBuffer commandBuffer, uint32_t coverageModulationTableCount, const float* pCoverageModulationTable) const
+{
+	const ApiCallTimer timer (m_counters[353]);
+	m_vk.cmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+}
+
+void ProfilingDeviceDriver::cmdSetShadingRateImageEnableNV (VkCommandBuffer commandBuffer, VkBool32 shadingRateImageEnable) const
+{
+	const ApiCallTimer timer (m_counters[354]);
+	m_vk.cmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetCoverageReductionModeNV (VkCommandBuffer commandBuffer, VkCoverageReductionModeNV coverageReductionMode) const
+{
+	const ApiCallTimer timer (m_counters[355]);
+	m_vk.cmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
+}
+
+void ProfilingDeviceDriver::cmdSetRepresentativeFragmentTestEnableNV (VkCommandBuffer commandBuffer, VkBool32 representativeFragmentTestEnable) const
+{
+	const ApiCallTimer timer (m_counters[356]);
+	m_vk.cmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
+}
+
+void ProfilingDeviceDriver::destroyPrivateDataSlot (VkDevice device, VkPrivateDataSlot privateDataSlot, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[357]);
+	m_vk.destroyPrivateDataSlot(device, privateDataSlot, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::setPrivateData (VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t data) const
+{
+	const ApiCallTimer timer (m_counters[358]);
+	return m_vk.setPrivateData(device, objectType, objectHandle, privateDataSlot, data);
+}
+
+void ProfilingDeviceDriver::getPrivateData (VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t* pData) const
+{
+	const ApiCallTimer timer (m_counters[359]);
+	m_vk.getPrivateData(device, objectType, objectHandle, privateDataSlot, pData);
+}
+
+void ProfilingDeviceDriver::cmdCopyBuffer2 (VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) const
+{
+	const ApiCallTimer timer (m_counters[360]);
+	m_vk.cmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyImage2 (VkCommandBuffer commandBuffer, const VkCopyImageInfo2* pCopyImageInfo) const
+{
+	const ApiCallTimer timer (m_counters[361]);
+	m_vk.cmdCopyImage2(commandBuffer, pCopyImageInfo);
+}
+
+void ProfilingDeviceDriver::cmdBlitImage2 (VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo) const
+{
+	const ApiCallTimer timer (m_counters[362]);
+	m_vk.cmdBlitImage2(commandBuffer, pBlitImageInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyBufferToImage2 (VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) const
+{
+	const ApiCallTimer timer (m_counters[363]);
+	m_vk.cmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyImageToBuffer2 (VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) const
+{
+	const ApiCallTimer timer (m_counters[364]);
+	m_vk.cmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
+}
+
+void ProfilingDeviceDriver::cmdResolveImage2 (VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo) const
+{
+	const ApiCallTimer timer (m_counters[365]);
+	m_vk.cmdResolveImage2(commandBuffer, pResolveImageInfo);
+}
+
+void ProfilingDeviceDriver::cmdSetFragmentShadingRateKHR (VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize, const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const
+{
+	const ApiCallTimer timer (m_counters[366]);
+	m_vk.cmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
+}
+
+void ProfilingDeviceDriver::cmdSetFragmentShadingRateEnumNV (VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate, const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const
+{
+	const ApiCallTimer timer (m_counters[367]);
+	m_vk.cmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
+}
+
+void ProfilingDeviceDriver::getAccelerationStructureBuildSizesKHR (VkDevice device, VkAccelerationStructureBuildTypeKHR buildType, const VkAccelerationStructureBuildGeometryInfoKHR* pBuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR* pSizeInfo) const
+{
+	const ApiCallTimer timer (m_counters[368]);
+	m_vk.getAccelerationStructureBuildSizesKHR(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+}
+
+void ProfilingDeviceDriver::cmdSetVertexInputEXT (VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount, const VkVertexInputBindingDescription2EXT* pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount, const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions) const
+{
+	const ApiCallTimer timer (m_counters[369]);
+	m_vk.cmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+}
+
+void ProfilingDeviceDriver::cmdSetColorWriteEnableEXT (VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkBool32* pColorWriteEnables) const
+{
+	const ApiCallTimer timer (m_counters[370]);
+	m_vk.cmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
+}
+
+void ProfilingDeviceDriver::cmdSetEvent2 (VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo* pDependencyInfo) const
+{
+	const ApiCallTimer timer (m_counters[371]);
+	m_vk.cmdSetEvent2(commandBuffer, event, pDependencyInfo);
+}
+
+void ProfilingDeviceDriver::cmdResetEvent2 (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) const
+{
+	const ApiCallTimer timer (m_counters[372]);
+	m_vk.cmdResetEvent2(commandBuffer, event, stageMask);
+}
+
+void ProfilingDeviceDriver::cmdWaitEvents2 (VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfo* pDependencyInfos) const
+{
+	const ApiCallTimer timer (m_counters[373]);
+	m_vk.cmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
+}
+
+void ProfilingDeviceDriver::cmdPipelineBarrier2 (VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) const
+{
+	const ApiCallTimer timer (m_counters[374]);
+	m_vk.cmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+}
+
+VkResult ProfilingDeviceDriver::queueSubmit2 (VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) const
+{
+	const ApiCallTimer timer (m_counters[375]);
+	return m_vk.queueSubmit2(queue, submitCount, pSubmits, fence);
+}
+
+void ProfilingDeviceDriver::cmdWriteTimestamp2 (VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query) const
+{
+	const ApiCallTimer timer (m_counters[376]);
+	m_vk.cmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
+}
+
+void ProfilingDeviceDriver::cmdWriteBufferMarker2AMD (VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const
+{
+	const ApiCallTimer timer (m_counters[377]);
+	m_vk.cmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
+}
+
+void ProfilingDeviceDriver::getQueueCheckpointData2NV (VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointData2NV* pCheckpointData) const
+{
+	const ApiCallTimer timer (m_counters[378]);
+	m_vk.getQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
+}
+
+VkResult ProfilingDeviceDriver::createVideoSessionKHR (VkDevice device, const VkVideoSessionCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionKHR* pVideoSession) const
+{
+	const ApiCallTimer timer (m_counters[379]);
+	return m_vk.createVideoSessionKHR(device, pCreateInfo, pAllocator, pVideoSession);
+}
+
+void ProfilingDeviceDriver::destroyVideoSessionKHR (VkDevice device, VkVideoSessionKHR videoSession, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[380]);
+	m_vk.destroyVideoSessionKHR(device, videoSession, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createVideoSessionParametersKHR (VkDevice device, const VkVideoSessionParametersCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkVideoSessionParametersKHR* pVideoSessionParameters) const
+{
+	const ApiCallTimer timer (m_counters[381]);
+	return m_vk.createVideoSessionParametersKHR(device, pCreateInfo, pAllocator, pVideoSessionParameters);
+}
+
+VkResult ProfilingDeviceDriver::updateVideoSessionParametersKHR (VkDevice device, VkVideoSessionParametersKHR videoSessionParameters, const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo) const
+{
+	const ApiCallTimer timer (m_counters[382]);
+	return m_vk.updateVideoSessionParametersKHR(device, videoSessionParameters, pUpdateInfo);
+}
+
+void ProfilingDeviceDriver::destroyVideoSessionParametersKHR (VkDevice device, VkVideoSessionParametersKHR videoSessionParameters, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[383]);
+	m_vk.destroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::getVideoSessionMemoryRequirementsKHR (VkDevice device, VkVideoSessionKHR videoSession, uint32_t* pMemoryRequirementsCount, VkVideoSessionMemoryRequirementsKHR* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[384]);
+	return m_vk.getVideoSessionMemoryRequirementsKHR(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
+}
+
+VkResult ProfilingDeviceDriver::bindVideoSessionMemoryKHR (VkDevice device, VkVideoSessionKHR videoSession, uint32_t bindSessionMemoryInfoCount, const VkBindVideoSessionMemoryInfoKHR* pBindSessionMemoryInfos) const
+{
+	const ApiCallTimer timer (m_counters[385]);
+	return m_vk.bindVideoSessionMemoryKHR(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
+}
+
+void ProfilingDeviceDriver::cmdDecodeVideoKHR (VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR* pDecodeInfo) const
+{
+	const ApiCallTimer timer (m_counters[386]);
+	m_vk.cmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
+}
+
+void ProfilingDeviceDriver::cmdBeginVideoCodingKHR (VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR* pBeginInfo) const
+{
+	const ApiCallTimer timer (m_counters[387]);
+	m_vk.cmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
+}
+
+void ProfilingDeviceDriver::cmdControlVideoCodingKHR (VkCommandBuffer commandBuffer, const VkVideoCodingControlInfoKHR* pCodingControlInfo) const
+{
+	const ApiCallTimer timer (m_counters[388]);
+	m_vk.cmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
+}
+
+void ProfilingDeviceDriver::cmdEndVideoCodingKHR (VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR* pEndCodingInfo) const
+{
+	const ApiCallTimer timer (m_counters[389]);
+	m_vk.cmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
+}
+
+void ProfilingDeviceDriver::cmdEncodeVideoKHR (VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR* pEncodeInfo) const
+{
+	const ApiCallTimer timer (m_counters[390]);
+	m_vk.cmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
+}
+
+VkResult ProfilingDeviceDriver::createCuModuleNVX (VkDevice device, const VkCuModuleCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCuModuleNVX* pModule) const
+{
+	const ApiCallTimer timer (m_counters[391]);
+	return m_vk.createCuModuleNVX(device, pCreateInfo, pAllocator, pModule);
+}
+
+VkResult ProfilingDeviceDriver::createCuFunctionNVX (VkDevice device, const VkCuFunctionCreateInfoNVX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCuFunctionNVX* pFunction) const
+{
+	const ApiCallTimer timer (m_counters[392]);
+	return m_vk.createCuFunctionNVX(device, pCreateInfo, pAllocator, pFunction);
+}
+
+void ProfilingDeviceDriver::destroyCuModuleNVX (VkDevice device, VkCuModuleNVX module, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[393]);
+	m_vk.destroyCuModuleNVX(device, module, pAllocator);
+}
+
+void ProfilingDeviceDriver::destroyCuFunctionNVX (VkDevice device, VkCuFunctionNVX function, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[394]);
+	m_vk.destroyCuFunctionNVX(device, function, pAllocator);
+}
+
+void ProfilingDeviceDriver::cmdCuLaunchKernelNVX (VkCommandBuffer commandBuffer, const VkCuLaunchInfoNVX* pLaunchInfo) const
+{
+	const ApiCallTimer timer (m_counters[395]);
+	m_vk.cmdCuLaunchKernelNVX(commandBuffer, pLaunchInfo);
+}
+
+void ProfilingDeviceDriver::setDeviceMemoryPriorityEXT (VkDevice device, VkDeviceMemory memory, float priority) const
+{
+	const ApiCallTimer timer (m_counters[396]);
+	m_vk.setDeviceMemoryPriorityEXT(device, memory, priority);
+}
+
+VkResult ProfilingDeviceDriver::waitForPresentKHR (VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout) const
+{
+	const ApiCallTimer timer (m_counters[397]);
+	return m_vk.waitForPresentKHR(device, swapchain, presentId, timeout);
+}
+
+VkResult ProfilingDeviceDriver::createBufferCollectionFUCHSIA (VkDevice device, const VkBufferCollectionCreateInfoFUCHSIA* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferCollectionFUCHSIA* pCollection) const
+{
+	const ApiCallTimer timer (m_counters[398]);
+	return m_vk.createBufferCollectionFUCHSIA(device, pCreateInfo, pAllocator, pCollection);
+}
+
+VkResult ProfilingDeviceDriver::setBufferCollectionBufferConstraintsFUCHSIA (VkDevice device, VkBufferCollectionFUCHSIA collection, const VkBufferConstraintsInfoFUCHSIA* pBufferConstraintsInfo) const
+{
+	const ApiCallTimer timer (m_counters[399]);
+	return m_vk.setBufferCollectionBufferConstraintsFUCHSIA(device, collection, pBufferConstraintsInfo);
+}
+
+VkResult ProfilingDeviceDriver::setBufferCollectionImageConstraintsFUCHSIA (VkDevice device, VkBufferCollectionFUCHSIA collection, const VkImageConstraintsInfoFUCHSIA* pImageConstraintsInfo) const
+{
+	const ApiCallTimer timer (m_counters[400]);
+	return m_vk.setBufferCollectionImageConstraintsFUCHSIA(device, collection, pImageConstraintsInfo);
+}
+
+void ProfilingDeviceDriver::destroyBufferCollectionFUCHSIA (VkDevice device, VkBufferCollectionFUCHSIA collection, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[401]);
+	m_vk.destroyBufferCollectionFUCHSIA(device, collection, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::getBufferCollectionPropertiesFUCHSIA (VkDevice device, VkBufferCollectionFUCHSIA collection, VkBufferCollectionPropertiesFUCHSIA* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[402]);
+	return m_vk.getBufferCollectionPropertiesFUCHSIA(device, collection, pProperties);
+}
+
+void ProfilingDeviceDriver::cmdBeginRendering (VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) const
+{
+	const ApiCallTimer timer (m_counters[403]);
+	m_vk.cmdBeginRendering(commandBuffer, pRenderingInfo);
+}
+
+void ProfilingDeviceDriver::cmdEndRendering (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[404]);
+	m_vk.cmdEndRendering(commandBuffer);
+}
+
+void ProfilingDeviceDriver::getDescriptorSetLayoutHostMappingInfoVALVE (VkDevice device, const VkDescriptorSetBindingReferenceVALVE* pBindingReference, VkDescriptorSetLayoutHostMappingInfoVALVE* pHostMapping) const
+{
+	const ApiCallTimer timer (m_counters[405]);
+	m_vk.getDescriptorSetLayoutHostMappingInfoVALVE(device, pBindingReference, pHostMapping);
+}
+
+void ProfilingDeviceDriver::getDescriptorSetHostMappingVALVE (VkDevice device, VkDescriptorSet descriptorSet, void** ppData) const
+{
+	const ApiCallTimer timer (m_counters[406]);
+	m_vk.getDescriptorSetHostMappingVALVE(device, descriptorSet, ppData);
+}
+
+VkResult ProfilingDeviceDriver::createMicromapEXT (VkDevice device, const VkMicromapCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkMicromapEXT* pMicromap) const
+{
+	const ApiCallTimer timer (m_counters[407]);
+	return m_vk.createMicromapEXT(device, pCreateInfo, pAllocator, pMicromap);
+}
+
+void ProfilingDeviceDriver::cmdBuildMicromapsEXT (VkCommandBuffer commandBuffer, uint32_t infoCount, const VkMicromapBuildInfoEXT* pInfos) const
+{
+	const ApiCallTimer timer (m_counters[408]);
+	m_vk.cmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
+}
+
+VkResult ProfilingDeviceDriver::buildMicromapsEXT (VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkMicromapBuildInfoEXT* pInfos) const
+{
+	const ApiCallTimer timer (m_counters[409]);
+	return m_vk.buildMicromapsEXT(device, deferredOperation, infoCount, pInfos);
+}
+
+void ProfilingDeviceDriver::destroyMicromapEXT (VkDevice device, VkMicromapEXT micromap, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[410]);
+	m_vk.destroyMicromapEXT(device, micromap, pAllocator);
+}
+
+void ProfilingDeviceDriver::cmdCopyMicromapEXT (VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[411]);
+	m_vk.cmdCopyMicromapEXT(commandBuffer, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::copyMicromapEXT (VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMicromapInfoEXT* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[412]);
+	return m_vk.copyMicromapEXT(device, deferredOperation, pInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyMicromapToMemoryEXT (VkCommandBuffer commandBuffer, const VkCopyMicromapToMemoryInfoEXT* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[413]);
+	m_vk.cmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::copyMicromapToMemoryEXT (VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMicromapToMemoryInfoEXT* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[414]);
+	return m_vk.copyMicromapToMemoryEXT(device, deferredOperation, pInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyMemoryToMicromapEXT (VkCommandBuffer commandBuffer, const VkCopyMemoryToMicromapInfoEXT* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[415]);
+	m_vk.cmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
+}
+
+VkResult ProfilingDeviceDriver::copyMemoryToMicromapEXT (VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToMicromapInfoEXT* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[416]);
+	return m_vk.copyMemoryToMicromapEXT(device, deferredOperation, pInfo);
+}
+
+void ProfilingDeviceDriver::cmdWriteMicromapsPropertiesEXT (VkCommandBuffer commandBuffer, uint32_t micromapCount, const VkMicromapEXT* pMicromaps, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) const
+{
+	const ApiCallTimer timer (m_counters[417]);
+	m_vk.cmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+}
+
+VkResult ProfilingDeviceDriver::writeMicromapsPropertiesEXT (VkDevice device, uint32_t micromapCount, const VkMicromapEXT* pMicromaps, VkQueryType queryType, size_t dataSize, void* pData, size_t stride) const
+{
+	const ApiCallTimer timer (m_counters[418]);
+	return m_vk.writeMicromapsPropertiesEXT(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
+}
+
+void ProfilingDeviceDriver::getDeviceMicromapCompatibilityEXT (VkDevice device, const VkMicromapVersionInfoEXT* pVersionInfo, VkAccelerationStructureCompatibilityKHR* pCompatibility) const
+{
+	const ApiCallTimer timer (m_counters[419]);
+	m_vk.getDeviceMicromapCompatibilityEXT(device, pVersionInfo, pCompatibility);
+}
+
+void ProfilingDeviceDriver::getMicromapBuildSizesEXT (VkDevice device, VkAccelerationStructureBuildTypeKHR buildType, const VkMicromapBuildInfoEXT* pBuildInfo, VkMicromapBuildSizesInfoEXT* pSizeInfo) const
+{
+	const ApiCallTimer timer (m_counters[420]);
+	m_vk.getMicromapBuildSizesEXT(device, buildType, pBuildInfo, pSizeInfo);
+}
+
+void ProfilingDeviceDriver::getShaderModuleIdentifierEXT (VkDevice device, VkShaderModule shaderModule, VkShaderModuleIdentifierEXT* pIdentifier) const
+{
+	const ApiCallTimer timer (m_counters[421]);
+	m_vk.getShaderModuleIdentifierEXT(device, shaderModule, pIdentifier);
+}
+
+void ProfilingDeviceDriver::getShaderModuleCreateInfoIdentifierEXT (VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, VkShaderModuleIdentifierEXT* pIdentifier) const
+{
+	const ApiCallTimer timer (m_counters[422]);
+	m_vk.getShaderModuleCreateInfoIdentifierEXT(device, pCreateInfo, pIdentifier);
+}
+
+void ProfilingDeviceDriver::getImageSubresourceLayout2EXT (VkDevice device, VkImage image, const VkImageSubresource2EXT* pSubresource, VkSubresourceLayout2EXT* pLayout) const
+{
+	const ApiCallTimer timer (m_counters[423]);
+	m_vk.getImageSubresourceLayout2EXT(device, image, pSubresource, pLayout);
+}
+
+VkResult ProfilingDeviceDriver::getPipelinePropertiesEXT (VkDevice device, const VkPipelineInfoEXT* pPipelineInfo, VkBaseOutStructure* pPipelineProperties) const
+{
+	const ApiCallTimer timer (m_counters[424]);
+	return m_vk.getPipelinePropertiesEXT(device, pPipelineInfo, pPipelineProperties);
+}
+
+void ProfilingDeviceDriver::exportMetalObjectsEXT (VkDevice device, VkExportMetalObjectsInfoEXT* pMetalObjectsInfo) const
+{
+	const ApiCallTimer timer (m_counters[425]);
+	m_vk.exportMetalObjectsEXT(device, pMetalObjectsInfo);
+}
+
+VkResult ProfilingDeviceDriver::getFramebufferTilePropertiesQCOM (VkDevice device, VkFramebuffer framebuffer, uint32_t* pPropertiesCount, VkTilePropertiesQCOM* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[426]);
+	return m_vk.getFramebufferTilePropertiesQCOM(device, framebuffer, pPropertiesCount, pProperties);
+}
+
+VkResult ProfilingDeviceDriver::getDynamicRenderingTilePropertiesQCOM (VkDevice device, const VkRenderingInfo* pRenderingInfo, VkTilePropertiesQCOM* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[427]);
+	return m_vk.getDynamicRenderingTilePropertiesQCOM(device, pRenderingInfo, pProperties);
+}
+
+VkResult ProfilingDeviceDriver::createOpticalFlowSessionNV (VkDevice device, const VkOpticalFlowSessionCreateInfoNV* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkOpticalFlowSessionNV* pSession) const
+{
+	const ApiCallTimer timer (m_counters[428]);
+	return m_vk.createOpticalFlowSessionNV(device, pCreateInfo, pAllocator, pSession);
+}
+
+void ProfilingDeviceDriver::destroyOpticalFlowSessionNV (VkDevice device, VkOpticalFlowSessionNV session, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[429]);
+	m_vk.destroyOpticalFlowSessionNV(device, session, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::bindOpticalFlowSessionImageNV (VkDevice device, VkOpticalFlowSessionNV session, VkOpticalFlowSessionBindingPointNV bindingPoint, VkImageView view, VkImageLayout layout) const
+{
+	const ApiCallTimer timer (m_counters[430]);
+	return m_vk.bindOpticalFlowSessionImageNV(device, session, bindingPoint, view, layout);
+}
+
+void ProfilingDeviceDriver::cmdOpticalFlowExecuteNV (VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session, const VkOpticalFlowExecuteInfoNV* pExecuteInfo) const
+{
+	const ApiCallTimer timer (m_counters[431]);
+	m_vk.cmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
+}
+
+VkResult ProfilingDeviceDriver::getDeviceFaultInfoEXT (VkDevice device, VkDeviceFaultCountsEXT* pFaultCounts, VkDeviceFaultInfoEXT* pFaultInfo) const
+{
+	const ApiCallTimer timer (m_counters[432]);
+	return m_vk.getDeviceFaultInfoEXT(device, pFaultCounts, pFaultInfo);
+}
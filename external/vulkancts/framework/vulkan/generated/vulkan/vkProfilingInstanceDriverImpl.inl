@@ -0,0 +1,618 @@
+/* Profiling forwarders for InstanceInterface.
+ * Not generated: derived by hand from vkConcreteInstanceInterface.inl in this
+ * directory. Update it when that file changes; s_instanceFunctionNames must
+ * stay in the same order as the forwarders.
+ */
+
+static const char* const s_instanceFunctionNames[] =
+{
+	"vkDestroyInstance",
+	"vkEnumeratePhysicalDevices",
+	"vkGetPhysicalDeviceProperties",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkGetPhysicalDeviceFeatures",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkCreateDevice",
+	"vkEnumerateDeviceLayerProperties",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkGetPhysicalDeviceSparseImageFormatProperties",
+	"vkCreateAndroidSurfaceKHR",
+	"vkGetPhysicalDeviceDisplayPropertiesKHR",
+	"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+	"vkGetDisplayPlaneSupportedDisplaysKHR",
+	"vkGetDisplayModePropertiesKHR",
+	"vkCreateDisplayModeKHR",
+	"vkGetDisplayPlaneCapabilitiesKHR",
+	"vkCreateDisplayPlaneSurfaceKHR",
+	"vkDestroySurfaceKHR",
+	"vkGetPhysicalDeviceSurfaceSupportKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+	"vkGetPhysicalDeviceSurfaceFormatsKHR",
+	"vkGetPhysicalDeviceSurfacePresentModesKHR",
+	"vkCreateViSurfaceNN",
+	"vkCreateWaylandSurfaceKHR",
+	"vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+	"vkCreateWin32SurfaceKHR",
+	"vkGetPhysicalDeviceWin32PresentationSupportKHR",
+	"vkCreateXlibSurfaceKHR",
+	"vkGetPhysicalDeviceXlibPresentationSupportKHR",
+	"vkCreateXcbSurfaceKHR",
+	"vkGetPhysicalDeviceXcbPresentationSupportKHR",
+	"vkCreateImagePipeSurfaceFUCHSIA",
+	"vkCreateStreamDescriptorSurfaceGGP",
+	"vkCreateScreenSurfaceQNX",
+	"vkGetPhysicalDeviceScreenPresentationSupportQNX",
+	"vkCreateDebugReportCallbackEXT",
+	"vkDestroyDebugReportCallbackEXT",
+	"vkDebugReportMessageEXT",
+	"vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+	"vkGetPhysicalDeviceFeatures2",
+	"vkGetPhysicalDeviceProperties2",
+	"vkGetPhysicalDeviceFormatProperties2",
+	"vkGetPhysicalDeviceImageFormatProperties2",
+	"vkGetPhysicalDeviceQueueFamilyProperties2",
+	"vkGetPhysicalDeviceMemoryProperties2",
+	"vkGetPhysicalDeviceSparseImageFormatProperties2",
+	"vkGetPhysicalDeviceExternalBufferProperties",
+	"vkGetPhysicalDeviceExternalSemaphoreProperties",
+	"vkGetPhysicalDeviceExternalFenceProperties",
+	"vkReleaseDisplayEXT",
+	"vkAcquireXlibDisplayEXT",
+	"vkGetRandROutputDisplayEXT",
+	"vkAcquireWinrtDisplayNV",
+	"vkGetWinrtDisplayNV",
+	"vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+	"vkEnumeratePhysicalDeviceGroups",
+	"vkGetPhysicalDevicePresentRectanglesKHR",
+	"vkCreateIOSSurfaceMVK",
+	"vkCreateMacOSSurfaceMVK",
+	"vkCreateMetalSurfaceEXT",
+	"vkGetPhysicalDeviceMultisamplePropertiesEXT",
+	"vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+	"vkGetPhysicalDeviceSurfaceFormats2KHR",
+	"vkGetPhysicalDeviceDisplayProperties2KHR",
+	"vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+	"vkGetDisplayModeProperties2KHR",
+	"vkGetDisplayPlaneCapabilities2KHR",
+	"vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",
+	"vkCreateDebugUtilsMessengerEXT",
+	"vkDestroyDebugUtilsMessengerEXT",
+	"vkSubmitDebugUtilsMessageEXT",
+	"vkGetPhysicalDeviceCooperativeMatrixPropertiesNV",
+	"vkGetPhysicalDeviceSurfacePresentModes2EXT",
+	"vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+	"vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+	"vkCreateHeadlessSurfaceEXT",
+	"vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+	"vkGetPhysicalDeviceToolProperties",
+	"vkGetPhysicalDeviceFragmentShadingRatesKHR",
+	"vkGetPhysicalDeviceVideoCapabilitiesKHR",
+	"vkGetPhysicalDeviceVideoFormatPropertiesKHR",
+	"vkAcquireDrmDisplayEXT",
+	"vkGetDrmDisplayEXT",
+	"vkGetPhysicalDeviceOpticalFlowImageFormatsNV",
+};
+
+void ProfilingInstanceDriver::destroyInstance (VkInstance instance, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[0]);
+	m_vk.destroyInstance(instance, pAllocator);
+}
+
+VkResult ProfilingInstanceDriver::enumeratePhysicalDevices (VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const
+{
+	const ApiCallTimer timer (m_counters[1]);
+	return m_vk.enumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceProperties (VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[2]);
+	m_vk.getPhysicalDeviceProperties(physicalDevice, pProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceQueueFamilyProperties (VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) const
+{
+	const ApiCallTimer timer (m_counters[3]);
+	m_vk.getPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceMemoryProperties (VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) const
+{
+	const ApiCallTimer timer (m_counters[4]);
+	m_vk.getPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceFeatures (VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) const
+{
+	const ApiCallTimer timer (m_counters[5]);
+	m_vk.getPhysicalDeviceFeatures(physicalDevice, pFeatures);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[6]);
+	m_vk.getPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceImageFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[7]);
+	return m_vk.getPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+}
+
+VkResult ProfilingInstanceDriver::createDevice (VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const
+{
+	const ApiCallTimer timer (m_counters[8]);
+	return m_vk.createDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+}
+
+VkResult ProfilingInstanceDriver::enumerateDeviceLayerProperties (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[9]);
+	return m_vk.enumerateDeviceLayerProperties(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::enumerateDeviceExtensionProperties (VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[10]);
+	return m_vk.enumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceSparseImageFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[11]);
+	m_vk.getPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::createAndroidSurfaceKHR (VkInstance instance, const VkAndroidSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[12]);
+	return m_vk.createAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceDisplayPropertiesKHR (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[13]);
+	return m_vk.getPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceDisplayPlanePropertiesKHR (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[14]);
+	return m_vk.getPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayPlaneSupportedDisplaysKHR (VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays) const
+{
+	const ApiCallTimer timer (m_counters[15]);
+	return m_vk.getDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayModePropertiesKHR (VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[16]);
+	return m_vk.getDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::createDisplayModeKHR (VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) const
+{
+	const ApiCallTimer timer (m_counters[17]);
+	return m_vk.createDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayPlaneCapabilitiesKHR (VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[18]);
+	return m_vk.getDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::createDisplayPlaneSurfaceKHR (VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[19]);
+	return m_vk.createDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+void ProfilingInstanceDriver::destroySurfaceKHR (VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[20]);
+	m_vk.destroySurfaceKHR(instance, surface, pAllocator);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceSupportKHR (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) const
+{
+	const ApiCallTimer timer (m_counters[21]);
+	return m_vk.getPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceCapabilitiesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[22]);
+	return m_vk.getPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceFormatsKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) const
+{
+	const ApiCallTimer timer (m_counters[23]);
+	return m_vk.getPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfacePresentModesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) const
+{
+	const ApiCallTimer timer (m_counters[24]);
+	return m_vk.getPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
+}
+
+VkResult ProfilingInstanceDriver::createViSurfaceNN (VkInstance instance, const VkViSurfaceCreateInfoNN* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[25]);
+	return m_vk.createViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkResult ProfilingInstanceDriver::createWaylandSurfaceKHR (VkInstance instance, const VkWaylandSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[26]);
+	return m_vk.createWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkBool32 ProfilingInstanceDriver::getPhysicalDeviceWaylandPresentationSupportKHR (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, pt::WaylandDisplayPtr display) const
+{
+	const ApiCallTimer timer (m_counters[27]);
+	return m_vk.getPhysicalDeviceWaylandPresentationSupportKHR(physicalDevice, queueFamilyIndex, display);
+}
+
+VkResult ProfilingInstanceDriver::createWin32SurfaceKHR (VkInstance instance, const VkWin32SurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[28]);
+	return m_vk.createWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkBool32 ProfilingInstanceDriver::getPhysicalDeviceWin32PresentationSupportKHR (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex) const
+{
+	const ApiCallTimer timer (m_counters[29]);
+	return m_vk.getPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
+}
+
+VkResult ProfilingInstanceDriver::createXlibSurfaceKHR (VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[30]);
+	return m_vk.createXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkBool32 ProfilingInstanceDriver::getPhysicalDeviceXlibPresentationSupportKHR (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, pt::XlibDisplayPtr dpy, pt::XlibVisualID visualID) const
+{
+	const ApiCallTimer timer (m_counters[31]);
+	return m_vk.getPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID);
+}
+
+VkResult ProfilingInstanceDriver::createXcbSurfaceKHR (VkInstance instance, const VkXcbSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[32]);
+	return m_vk.createXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkBool32 ProfilingInstanceDriver::getPhysicalDeviceXcbPresentationSupportKHR (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, pt::XcbConnectionPtr connection, pt::XcbVisualid visual_id) const
+{
+	const ApiCallTimer timer (m_counters[33]);
+	return m_vk.getPhysicalDeviceXcbPresentationSupportKHR(physicalDevice, queueFamilyIndex, connection, visual_id);
+}
+
+VkResult ProfilingInstanceDriver::createImagePipeSurfaceFUCHSIA (VkInstance instance, const VkImagePipeSurfaceCreateInfoFUCHSIA* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[34]);
+	return m_vk.createImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkResult ProfilingInstanceDriver::createStreamDescriptorSurfaceGGP (VkInstance instance, const VkStreamDescriptorSurfaceCreateInfoGGP* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[35]);
+	return m_vk.createStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkResult ProfilingInstanceDriver::createScreenSurfaceQNX (VkInstance instance, const VkScreenSurfaceCreateInfoQNX* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[36]);
+	return m_vk.createScreenSurfaceQNX(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkBool32 ProfilingInstanceDriver::getPhysicalDeviceScreenPresentationSupportQNX (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, pt::QNXScreenWindowPtr window) const
+{
+	const ApiCallTimer timer (m_counters[37]);
+	return m_vk.getPhysicalDeviceScreenPresentationSupportQNX(physicalDevice, queueFamilyIndex, window);
+}
+
+VkResult ProfilingInstanceDriver::createDebugReportCallbackEXT (VkInstance instance, const VkDebugReportCallbackCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback) const
+{
+	const ApiCallTimer timer (m_counters[38]);
+	return m_vk.createDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
+}
+
+void ProfilingInstanceDriver::destroyDebugReportCallbackEXT (VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[39]);
+	m_vk.destroyDebugReportCallbackEXT(instance, callback, pAllocator);
+}
+
+void ProfilingInstanceDriver::debugReportMessageEXT (VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char* pLayerPrefix, const char* pMessage) const
+{
+	const ApiCallTimer timer (m_counters[40]);
+	m_vk.debugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceExternalImageFormatPropertiesNV (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkExternalMemoryHandleTypeFlagsNV externalHandleType, VkExternalImageFormatPropertiesNV* pExternalImageFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[41]);
+	return m_vk.getPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceFeatures2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures) const
+{
+	const ApiCallTimer timer (m_counters[42]);
+	m_vk.getPhysicalDeviceFeatures2(physicalDevice, pFeatures);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceProperties2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[43]);
+	m_vk.getPhysicalDeviceProperties2(physicalDevice, pProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceFormatProperties2 (VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2* pFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[44]);
+	m_vk.getPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceImageFormatProperties2 (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[45]);
+	return m_vk.getPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceQueueFamilyProperties2 (VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2* pQueueFamilyProperties) const
+{
+	const ApiCallTimer timer (m_counters[46]);
+	m_vk.getPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceMemoryProperties2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties) const
+{
+	const ApiCallTimer timer (m_counters[47]);
+	m_vk.getPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceSparseImageFormatProperties2 (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[48]);
+	m_vk.getPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceExternalBufferProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties) const
+{
+	const ApiCallTimer timer (m_counters[49]);
+	m_vk.getPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceExternalSemaphoreProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties) const
+{
+	const ApiCallTimer timer (m_counters[50]);
+	m_vk.getPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceExternalFenceProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties) const
+{
+	const ApiCallTimer timer (m_counters[51]);
+	m_vk.getPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+}
+
+VkResult ProfilingInstanceDriver::releaseDisplayEXT (VkPhysicalDevice physicalDevice, VkDisplayKHR display) const
+{
+	const ApiCallTimer timer (m_counters[52]);
+	return m_vk.releaseDisplayEXT(physicalDevice, display);
+}
+
+VkResult ProfilingInstanceDriver::acquireXlibDisplayEXT (VkPhysicalDevice physicalDevice, pt::XlibDisplayPtr dpy, VkDisplayKHR display) const
+{
+	const ApiCallTimer timer (m_counters[53]);
+	return m_vk.acquireXlibDisplayEXT(physicalDevice, dpy, display);
+}
+
+VkResult ProfilingInstanceDriver::getRandROutputDisplayEXT (VkPhysicalDevice physicalDevice, pt::XlibDisplayPtr dpy, pt::RROutput rrOutput, VkDisplayKHR* pDisplay) const
+{
+	const ApiCallTimer timer (m_counters[54]);
+	return m_vk.getRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
+}
+
+VkResult ProfilingInstanceDriver::acquireWinrtDisplayNV (VkPhysicalDevice physicalDevice, VkDisplayKHR display) const
+{
+	const ApiCallTimer timer (m_counters[55]);
+	return m_vk.acquireWinrtDisplayNV(physicalDevice, display);
+}
+
+VkResult ProfilingInstanceDriver::getWinrtDisplayNV (VkPhysicalDevice physicalDevice, uint32_t deviceRelativeId, VkDisplayKHR* pDisplay) const
+{
+	const ApiCallTimer timer (m_counters[56]);
+	return m_vk.getWinrtDisplayNV(physicalDevice, deviceRelativeId, pDisplay);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceCapabilities2EXT (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilities2EXT* pSurfaceCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[57]);
+	return m_vk.getPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::enumeratePhysicalDeviceGroups (VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties) const
+{
+	const ApiCallTimer timer (m_counters[58]);
+	return m_vk.enumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDevicePresentRectanglesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects) const
+{
+	const ApiCallTimer timer (m_counters[59]);
+	return m_vk.getPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
+}
+
+VkResult ProfilingInstanceDriver::createIOSSurfaceMVK (VkInstance instance, const VkIOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[60]);
+	return m_vk.createIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkResult ProfilingInstanceDriver::createMacOSSurfaceMVK (VkInstance instance, const VkMacOSSurfaceCreateInfoMVK* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[61]);
+	return m_vk.createMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkResult ProfilingInstanceDriver::createMetalSurfaceEXT (VkInstance instance, const VkMetalSurfaceCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[62]);
+	return m_vk.createMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceMultisamplePropertiesEXT (VkPhysicalDevice physicalDevice, VkSampleCountFlagBits samples, VkMultisamplePropertiesEXT* pMultisampleProperties) const
+{
+	const ApiCallTimer timer (m_counters[63]);
+	m_vk.getPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceCapabilities2KHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[64]);
+	return m_vk.getPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceFormats2KHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats) const
+{
+	const ApiCallTimer timer (m_counters[65]);
+	return m_vk.getPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceDisplayProperties2KHR (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayProperties2KHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[66]);
+	return m_vk.getPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceDisplayPlaneProperties2KHR (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlaneProperties2KHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[67]);
+	return m_vk.getPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayModeProperties2KHR (VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModeProperties2KHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[68]);
+	return m_vk.getDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayPlaneCapabilities2KHR (VkPhysicalDevice physicalDevice, const VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR* pCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[69]);
+	return m_vk.getDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceCalibrateableTimeDomainsEXT (VkPhysicalDevice physicalDevice, uint32_t* pTimeDomainCount, VkTimeDomainEXT* pTimeDomains) const
+{
+	const ApiCallTimer timer (m_counters[70]);
+	return m_vk.getPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
+}
+
+VkResult ProfilingInstanceDriver::createDebugUtilsMessengerEXT (VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pMessenger) const
+{
+	const ApiCallTimer timer (m_counters[71]);
+	return m_vk.createDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
+}
+
+void ProfilingInstanceDriver::destroyDebugUtilsMessengerEXT (VkInstance instance, VkDebugUtilsMessengerEXT messenger, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[72]);
+	m_vk.destroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
+}
+
+void ProfilingInstanceDriver::submitDebugUtilsMessageEXT (VkInstance instance, VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageTypes, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData) const
+{
+	const ApiCallTimer timer (m_counters[73]);
+	m_vk.submitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceCooperativeMatrixPropertiesNV (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkCooperativeMatrixPropertiesNV* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[74]);
+	return m_vk.getPhysicalDeviceCooperativeMatrixPropertiesNV(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfacePresentModes2EXT (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) const
+{
+	const ApiCallTimer timer (m_counters[75]);
+	return m_vk.getPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
+}
+
+VkResult ProfilingInstanceDriver::enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, uint32_t* pCounterCount, VkPerformanceCounterKHR* pCounters, VkPerformanceCounterDescriptionKHR* pCounterDescriptions) const
+{
+	const ApiCallTimer timer (m_counters[76]);
+	return m_vk.enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR (VkPhysicalDevice physicalDevice, const VkQueryPoolPerformanceCreateInfoKHR* pPerformanceQueryCreateInfo, uint32_t* pNumPasses) const
+{
+	const ApiCallTimer timer (m_counters[77]);
+	m_vk.getPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
+}
+
+VkResult ProfilingInstanceDriver::createHeadlessSurfaceEXT (VkInstance instance, const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[78]);
+	return m_vk.createHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV (VkPhysicalDevice physicalDevice, uint32_t* pCombinationCount, VkFramebufferMixedSamplesCombinationNV* pCombinations) const
+{
+	const ApiCallTimer timer (m_counters[79]);
+	return m_vk.getPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(physicalDevice, pCombinationCount, pCombinations);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceToolProperties (VkPhysicalDevice physicalDevice, uint32_t* pToolCount, VkPhysicalDeviceToolProperties* pToolProperties) const
+{
+	const ApiCallTimer timer (m_counters[80]);
+	return m_vk.getPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceFragmentShadingRatesKHR (VkPhysicalDevice physicalDevice, uint32_t* pFragmentShadingRateCount, VkPhysicalDeviceFragmentShadingRateKHR* pFragmentShadingRates) const
+{
+	const ApiCallTimer timer (m_counters[81]);
+	return m_vk.getPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceVideoCapabilitiesKHR (VkPhysicalDevice physicalDevice, const VkVideoProfileInfoKHR* pVideoProfile, VkVideoCapabilitiesKHR* pCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[82]);
+	return m_vk.getPhysicalDeviceVideoCapabilitiesKHR(physicalDevice, pVideoProfile, pCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceVideoFormatPropertiesKHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceVideoFormatInfoKHR* pVideoFormatInfo, uint32_t* pVideoFormatPropertyCount, VkVideoFormatPropertiesKHR* pVideoFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[83]);
+	return m_vk.getPhysicalDeviceVideoFormatPropertiesKHR(physicalDevice, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties);
+}
+
+VkResult ProfilingInstanceDriver::acquireDrmDisplayEXT (VkPhysicalDevice physicalDevice, int32_t drmFd, VkDisplayKHR display) const
+{
+	const ApiCallTimer timer (m_counters[84]);
+	return m_vk.acquireDrmDisplayEXT(physicalDevice, drmFd, display);
+}
+
+VkResult ProfilingInstanceDriver::getDrmDisplayEXT (VkPhysicalDevice physicalDevice, int32_t drmFd, uint32_t connectorId, VkDisplayKHR* display) const
+{
+	const ApiCallTimer timer (m_counters[85]);
+	return m_vk.getDrmDisplayEXT(physicalDevice, drmFd, connectorId, display);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceOpticalFlowImageFormatsNV (VkPhysicalDevice physicalDevice, const VkOpticalFlowImageFormatInfoNV* pOpticalFlowImageFormatInfo, uint32_t* pFormatCount, VkOpticalFlowImageFormatPropertiesNV* pImageFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[86]);
+	return m_vk.getPhysicalDeviceOpticalFlowImageFormatsNV(physicalDevice, pOpticalFlowImageFormatInfo, pFormatCount, pImageFormatProperties);
+}
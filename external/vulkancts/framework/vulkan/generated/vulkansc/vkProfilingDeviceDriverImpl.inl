@@ -0,0 +1,1465 @@
+/* Profiling forwarders for DeviceInterface.
+ * Not generated: derived by hand from vkConcreteDeviceInterface.inl in this
+ * directory. Update it when that file changes; s_deviceFunctionNames must
+ * stay in the same order as the forwarders.
+ */
+
+static const char* const s_deviceFunctionNames[] =
+{
+	"vkGetDeviceProcAddr",
+	"vkDestroyDevice",
+	"vkGetDeviceQueue",
+	"vkQueueSubmit",
+	"vkQueueWaitIdle",
+	"vkDeviceWaitIdle",
+	"vkAllocateMemory",
+	"vkMapMemory",
+	"vkUnmapMemory",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkBindBufferMemory",
+	"vkBindImageMemory",
+	"vkGetBufferMemoryRequirements",
+	"vkGetImageMemoryRequirements",
+	"vkCreateFence",
+	"vkDestroyFence",
+	"vkResetFences",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkGetQueryPoolResults",
+	"vkCreateBuffer",
+	"vkDestroyBuffer",
+	"vkCreateBufferView",
+	"vkDestroyBufferView",
+	"vkCreateImage",
+	"vkDestroyImage",
+	"vkGetImageSubresourceLayout",
+	"vkCreateImageView",
+	"vkDestroyImageView",
+	"vkCreatePipelineCache",
+	"vkDestroyPipelineCache",
+	"vkCreateGraphicsPipelines",
+	"vkCreateComputePipelines",
+	"vkDestroyPipeline",
+	"vkCreatePipelineLayout",
+	"vkDestroyPipelineLayout",
+	"vkCreateSampler",
+	"vkDestroySampler",
+	"vkCreateDescriptorSetLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorPool",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkCreateCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+	"vkBindBufferMemory2",
+	"vkBindImageMemory2",
+	"vkGetDeviceGroupPeerMemoryFeatures",
+	"vkCmdSetDeviceMask",
+	"vkCmdDispatchBase",
+	"vkGetImageMemoryRequirements2",
+	"vkGetBufferMemoryRequirements2",
+	"vkGetDeviceQueue2",
+	"vkCreateSamplerYcbcrConversion",
+	"vkDestroySamplerYcbcrConversion",
+	"vkGetDescriptorSetLayoutSupport",
+	"vkCmdDrawIndirectCount",
+	"vkCmdDrawIndexedIndirectCount",
+	"vkCreateRenderPass2",
+	"vkCmdBeginRenderPass2",
+	"vkCmdNextSubpass2",
+	"vkCmdEndRenderPass2",
+	"vkResetQueryPool",
+	"vkGetSemaphoreCounterValue",
+	"vkWaitSemaphores",
+	"vkSignalSemaphore",
+	"vkGetBufferDeviceAddress",
+	"vkGetBufferOpaqueCaptureAddress",
+	"vkGetDeviceMemoryOpaqueCaptureAddress",
+	"vkGetCommandPoolMemoryConsumption",
+	"vkGetFaultData",
+	"vkCreateSwapchainKHR",
+	"vkGetSwapchainImagesKHR",
+	"vkAcquireNextImageKHR",
+	"vkQueuePresentKHR",
+	"vkGetDeviceGroupPresentCapabilitiesKHR",
+	"vkGetDeviceGroupSurfacePresentModesKHR",
+	"vkAcquireNextImage2KHR",
+	"vkCreateSharedSwapchainsKHR",
+	"vkGetMemoryFdKHR",
+	"vkGetMemoryFdPropertiesKHR",
+	"vkImportSemaphoreFdKHR",
+	"vkGetSemaphoreFdKHR",
+	"vkGetSwapchainStatusKHR",
+	"vkImportFenceFdKHR",
+	"vkGetFenceFdKHR",
+	"vkAcquireProfilingLockKHR",
+	"vkReleaseProfilingLockKHR",
+	"vkCmdSetFragmentShadingRateKHR",
+	"vkCmdRefreshObjectsKHR",
+	"vkCmdSetEvent2KHR",
+	"vkCmdResetEvent2KHR",
+	"vkCmdWaitEvents2KHR",
+	"vkCmdPipelineBarrier2KHR",
+	"vkCmdWriteTimestamp2KHR",
+	"vkQueueSubmit2KHR",
+	"vkCmdWriteBufferMarker2AMD",
+	"vkGetQueueCheckpointData2NV",
+	"vkCmdCopyBuffer2KHR",
+	"vkCmdCopyImage2KHR",
+	"vkCmdCopyBufferToImage2KHR",
+	"vkCmdCopyImageToBuffer2KHR",
+	"vkCmdBlitImage2KHR",
+	"vkCmdResolveImage2KHR",
+	"vkDisplayPowerControlEXT",
+	"vkRegisterDeviceEventEXT",
+	"vkRegisterDisplayEventEXT",
+	"vkGetSwapchainCounterEXT",
+	"vkCmdSetDiscardRectangleEXT",
+	"vkSetHdrMetadataEXT",
+	"vkSetDebugUtilsObjectNameEXT",
+	"vkSetDebugUtilsObjectTagEXT",
+	"vkQueueBeginDebugUtilsLabelEXT",
+	"vkQueueEndDebugUtilsLabelEXT",
+	"vkQueueInsertDebugUtilsLabelEXT",
+	"vkCmdBeginDebugUtilsLabelEXT",
+	"vkCmdEndDebugUtilsLabelEXT",
+	"vkCmdInsertDebugUtilsLabelEXT",
+	"vkCmdSetSampleLocationsEXT",
+	"vkGetImageDrmFormatModifierPropertiesEXT",
+	"vkGetMemoryHostPointerPropertiesEXT",
+	"vkGetCalibratedTimestampsEXT",
+	"vkCmdSetLineStippleEXT",
+	"vkCmdSetCullModeEXT",
+	"vkCmdSetFrontFaceEXT",
+	"vkCmdSetPrimitiveTopologyEXT",
+	"vkCmdSetViewportWithCountEXT",
+	"vkCmdSetScissorWithCountEXT",
+	"vkCmdBindVertexBuffers2EXT",
+	"vkCmdSetDepthTestEnableEXT",
+	"vkCmdSetDepthWriteEnableEXT",
+	"vkCmdSetDepthCompareOpEXT",
+	"vkCmdSetDepthBoundsTestEnableEXT",
+	"vkCmdSetStencilTestEnableEXT",
+	"vkCmdSetStencilOpEXT",
+	"vkCmdSetVertexInputEXT",
+	"vkCmdSetPatchControlPointsEXT",
+	"vkCmdSetRasterizerDiscardEnableEXT",
+	"vkCmdSetDepthBiasEnableEXT",
+	"vkCmdSetLogicOpEXT",
+	"vkCmdSetPrimitiveRestartEnableEXT",
+	"vkCmdSetColorWriteEnableEXT",
+};
+
+PFN_vkVoidFunction ProfilingDeviceDriver::getDeviceProcAddr (VkDevice device, const char* pName) const
+{
+	const ApiCallTimer timer (m_counters[0]);
+	return m_vk.getDeviceProcAddr(device, pName);
+}
+
+void ProfilingDeviceDriver::destroyDevice (VkDevice device, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[1]);
+	m_vk.destroyDevice(device, pAllocator);
+}
+
+void ProfilingDeviceDriver::getDeviceQueue (VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) const
+{
+	const ApiCallTimer timer (m_counters[2]);
+	m_vk.getDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+}
+
+VkResult ProfilingDeviceDriver::queueSubmit (VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const
+{
+	const ApiCallTimer timer (m_counters[3]);
+	return m_vk.queueSubmit(queue, submitCount, pSubmits, fence);
+}
+
+VkResult ProfilingDeviceDriver::queueWaitIdle (VkQueue queue) const
+{
+	const ApiCallTimer timer (m_counters[4]);
+	return m_vk.queueWaitIdle(queue);
+}
+
+VkResult ProfilingDeviceDriver::deviceWaitIdle (VkDevice device) const
+{
+	const ApiCallTimer timer (m_counters[5]);
+	return m_vk.deviceWaitIdle(device);
+}
+
+VkResult ProfilingDeviceDriver::allocateMemory (VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) const
+{
+	const ApiCallTimer timer (m_counters[6]);
+	return m_vk.allocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+}
+
+VkResult ProfilingDeviceDriver::mapMemory (VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) const
+{
+	const ApiCallTimer timer (m_counters[7]);
+	return m_vk.mapMemory(device, memory, offset, size, flags, ppData);
+}
+
+void ProfilingDeviceDriver::unmapMemory (VkDevice device, VkDeviceMemory memory) const
+{
+	const ApiCallTimer timer (m_counters[8]);
+	m_vk.unmapMemory(device, memory);
+}
+
+VkResult ProfilingDeviceDriver::flushMappedMemoryRanges (VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const
+{
+	const ApiCallTimer timer (m_counters[9]);
+	return m_vk.flushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+VkResult ProfilingDeviceDriver::invalidateMappedMemoryRanges (VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const
+{
+	const ApiCallTimer timer (m_counters[10]);
+	return m_vk.invalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+void ProfilingDeviceDriver::getDeviceMemoryCommitment (VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) const
+{
+	const ApiCallTimer timer (m_counters[11]);
+	m_vk.getDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+}
+
+VkResult ProfilingDeviceDriver::bindBufferMemory (VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
+{
+	const ApiCallTimer timer (m_counters[12]);
+	return m_vk.bindBufferMemory(device, buffer, memory, memoryOffset);
+}
+
+VkResult ProfilingDeviceDriver::bindImageMemory (VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
+{
+	const ApiCallTimer timer (m_counters[13]);
+	return m_vk.bindImageMemory(device, image, memory, memoryOffset);
+}
+
+void ProfilingDeviceDriver::getBufferMemoryRequirements (VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[14]);
+	m_vk.getBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+}
+
+void ProfilingDeviceDriver::getImageMemoryRequirements (VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[15]);
+	m_vk.getImageMemoryRequirements(device, image, pMemoryRequirements);
+}
+
+VkResult ProfilingDeviceDriver::createFence (VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const
+{
+	const ApiCallTimer timer (m_counters[16]);
+	return m_vk.createFence(device, pCreateInfo, pAllocator, pFence);
+}
+
+void ProfilingDeviceDriver::destroyFence (VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[17]);
+	m_vk.destroyFence(device, fence, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::resetFences (VkDevice device, uint32_t fenceCount, const VkFence* pFences) const
+{
+	const ApiCallTimer timer (m_counters[18]);
+	return m_vk.resetFences(device, fenceCount, pFences);
+}
+
+VkResult ProfilingDeviceDriver::getFenceStatus (VkDevice device, VkFence fence) const
+{
+	const ApiCallTimer timer (m_counters[19]);
+	return m_vk.getFenceStatus(device, fence);
+}
+
+VkResult ProfilingDeviceDriver::waitForFences (VkDevice device, uint32_t fenceCount, const VkFence* pFences, VkBool32 waitAll, uint64_t timeout) const
+{
+	const ApiCallTimer timer (m_counters[20]);
+	return m_vk.waitForFences(device, fenceCount, pFences, waitAll, timeout);
+}
+
+VkResult ProfilingDeviceDriver::createSemaphore (VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) const
+{
+	const ApiCallTimer timer (m_counters[21]);
+	return m_vk.createSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+}
+
+void ProfilingDeviceDriver::destroySemaphore (VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[22]);
+	m_vk.destroySemaphore(device, semaphore, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createEvent (VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) const
+{
+	const ApiCallTimer timer (m_counters[23]);
+	return m_vk.createEvent(device, pCreateInfo, pAllocator, pEvent);
+}
+
+void ProfilingDeviceDriver::destroyEvent (VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[24]);
+	m_vk.destroyEvent(device, event, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::getEventStatus (VkDevice device, VkEvent event) const
+{
+	const ApiCallTimer timer (m_counters[25]);
+	return m_vk.getEventStatus(device, event);
+}
+
+VkResult ProfilingDeviceDriver::setEvent (VkDevice device, VkEvent event) const
+{
+	const ApiCallTimer timer (m_counters[26]);
+	return m_vk.setEvent(device, event);
+}
+
+VkResult ProfilingDeviceDriver::resetEvent (VkDevice device, VkEvent event) const
+{
+	const ApiCallTimer timer (m_counters[27]);
+	return m_vk.resetEvent(device, event);
+}
+
+VkResult ProfilingDeviceDriver::createQueryPool (VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) const
+{
+	const ApiCallTimer timer (m_counters[28]);
+	return m_vk.createQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+}
+
+VkResult ProfilingDeviceDriver::getQueryPoolResults (VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[29]);
+	return m_vk.getQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+
+VkResult ProfilingDeviceDriver::createBuffer (VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) const
+{
+	const ApiCallTimer timer (m_counters[30]);
+	return m_vk.createBuffer(device, pCreateInfo, pAllocator, pBuffer);
+}
+
+void ProfilingDeviceDriver::destroyBuffer (VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[31]);
+	m_vk.destroyBuffer(device, buffer, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createBufferView (VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) const
+{
+	const ApiCallTimer timer (m_counters[32]);
+	return m_vk.createBufferView(device, pCreateInfo, pAllocator, pView);
+}
+
+void ProfilingDeviceDriver::destroyBufferView (VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[33]);
+	m_vk.destroyBufferView(device, bufferView, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createImage (VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) const
+{
+	const ApiCallTimer timer (m_counters[34]);
+	return m_vk.createImage(device, pCreateInfo, pAllocator, pImage);
+}
+
+void ProfilingDeviceDriver::destroyImage (VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[35]);
+	m_vk.destroyImage(device, image, pAllocator);
+}
+
+void ProfilingDeviceDriver::getImageSubresourceLayout (VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) const
+{
+	const ApiCallTimer timer (m_counters[36]);
+	m_vk.getImageSubresourceLayout(device, image, pSubresource, pLayout);
+}
+
+VkResult ProfilingDeviceDriver::createImageView (VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) const
+{
+	const ApiCallTimer timer (m_counters[37]);
+	return m_vk.createImageView(device, pCreateInfo, pAllocator, pView);
+}
+
+void ProfilingDeviceDriver::destroyImageView (VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[38]);
+	m_vk.destroyImageView(device, imageView, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createPipelineCache (VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) const
+{
+	const ApiCallTimer timer (m_counters[39]);
+	return m_vk.createPipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+
+void ProfilingDeviceDriver::destroyPipelineCache (VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[40]);
+	m_vk.destroyPipelineCache(device, pipelineCache, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createGraphicsPipelines (VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	const ApiCallTimer timer (m_counters[41]);
+	return m_vk.createGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+VkResult ProfilingDeviceDriver::createComputePipelines (VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	const ApiCallTimer timer (m_counters[42]);
+	return m_vk.createComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+void ProfilingDeviceDriver::destroyPipeline (VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[43]);
+	m_vk.destroyPipeline(device, pipeline, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createPipelineLayout (VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) const
+{
+	const ApiCallTimer timer (m_counters[44]);
+	return m_vk.createPipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+
+void ProfilingDeviceDriver::destroyPipelineLayout (VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[45]);
+	m_vk.destroyPipelineLayout(device, pipelineLayout, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createSampler (VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) const
+{
+	const ApiCallTimer timer (m_counters[46]);
+	return m_vk.createSampler(device, pCreateInfo, pAllocator, pSampler);
+}
+
+void ProfilingDeviceDriver::destroySampler (VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[47]);
+	m_vk.destroySampler(device, sampler, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createDescriptorSetLayout (VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) const
+{
+	const ApiCallTimer timer (m_counters[48]);
+	return m_vk.createDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+}
+
+void ProfilingDeviceDriver::destroyDescriptorSetLayout (VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[49]);
+	m_vk.destroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createDescriptorPool (VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) const
+{
+	const ApiCallTimer timer (m_counters[50]);
+	return m_vk.createDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+
+VkResult ProfilingDeviceDriver::resetDescriptorPool (VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[51]);
+	return m_vk.resetDescriptorPool(device, descriptorPool, flags);
+}
+
+VkResult ProfilingDeviceDriver::allocateDescriptorSets (VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) const
+{
+	const ApiCallTimer timer (m_counters[52]);
+	return m_vk.allocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+}
+
+VkResult ProfilingDeviceDriver::freeDescriptorSets (VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) const
+{
+	const ApiCallTimer timer (m_counters[53]);
+	return m_vk.freeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+
+void ProfilingDeviceDriver::updateDescriptorSets (VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) const
+{
+	const ApiCallTimer timer (m_counters[54]);
+	m_vk.updateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+}
+
+VkResult ProfilingDeviceDriver::createFramebuffer (VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) const
+{
+	const ApiCallTimer timer (m_counters[55]);
+	return m_vk.createFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+
+void ProfilingDeviceDriver::destroyFramebuffer (VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[56]);
+	m_vk.destroyFramebuffer(device, framebuffer, pAllocator);
+}
+
+VkResult ProfilingDeviceDriver::createRenderPass (VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const
+{
+	const ApiCallTimer timer (m_counters[57]);
+	return m_vk.createRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+void ProfilingDeviceDriver::destroyRenderPass (VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[58]);
+	m_vk.destroyRenderPass(device, renderPass, pAllocator);
+}
+
+void ProfilingDeviceDriver::getRenderAreaGranularity (VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) const
+{
+	const ApiCallTimer timer (m_counters[59]);
+	m_vk.getRenderAreaGranularity(device, renderPass, pGranularity);
+}
+
+VkResult ProfilingDeviceDriver::createCommandPool (VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const
+{
+	const ApiCallTimer timer (m_counters[60]);
+	return m_vk.createCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+}
+
+VkResult ProfilingDeviceDriver::resetCommandPool (VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[61]);
+	return m_vk.resetCommandPool(device, commandPool, flags);
+}
+
+VkResult ProfilingDeviceDriver::allocateCommandBuffers (VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) const
+{
+	const ApiCallTimer timer (m_counters[62]);
+	return m_vk.allocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+}
+
+void ProfilingDeviceDriver::freeCommandBuffers (VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) const
+{
+	const ApiCallTimer timer (m_counters[63]);
+	m_vk.freeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+VkResult ProfilingDeviceDriver::beginCommandBuffer (VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) const
+{
+	const ApiCallTimer timer (m_counters[64]);
+	return m_vk.beginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+VkResult ProfilingDeviceDriver::endCommandBuffer (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[65]);
+	return m_vk.endCommandBuffer(commandBuffer);
+}
+
+VkResult ProfilingDeviceDriver::resetCommandBuffer (VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[66]);
+	return m_vk.resetCommandBuffer(commandBuffer, flags);
+}
+
+void ProfilingDeviceDriver::cmdBindPipeline (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const
+{
+	const ApiCallTimer timer (m_counters[67]);
+	m_vk.cmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+
+void ProfilingDeviceDriver::cmdSetViewport (VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) const
+{
+	const ApiCallTimer timer (m_counters[68]);
+	m_vk.cmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+
+void ProfilingDeviceDriver::cmdSetScissor (VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) const
+{
+	const ApiCallTimer timer (m_counters[69]);
+	m_vk.cmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+
+void ProfilingDeviceDriver::cmdSetLineWidth (VkCommandBuffer commandBuffer, float lineWidth) const
+{
+	const ApiCallTimer timer (m_counters[70]);
+	m_vk.cmdSetLineWidth(commandBuffer, lineWidth);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthBias (VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) const
+{
+	const ApiCallTimer timer (m_counters[71]);
+	m_vk.cmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+
+void ProfilingDeviceDriver::cmdSetBlendConstants (VkCommandBuffer commandBuffer, const float blendConstants[4]) const
+{
+	const ApiCallTimer timer (m_counters[72]);
+	m_vk.cmdSetBlendConstants(commandBuffer, blendConstants);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthBounds (VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) const
+{
+	const ApiCallTimer timer (m_counters[73]);
+	m_vk.cmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilCompareMask (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) const
+{
+	const ApiCallTimer timer (m_counters[74]);
+	m_vk.cmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilWriteMask (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) const
+{
+	const ApiCallTimer timer (m_counters[75]);
+	m_vk.cmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilReference (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) const
+{
+	const ApiCallTimer timer (m_counters[76]);
+	m_vk.cmdSetStencilReference(commandBuffer, faceMask, reference);
+}
+
+void ProfilingDeviceDriver::cmdBindDescriptorSets (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) const
+{
+	const ApiCallTimer timer (m_counters[77]);
+	m_vk.cmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+
+void ProfilingDeviceDriver::cmdBindIndexBuffer (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) const
+{
+	const ApiCallTimer timer (m_counters[78]);
+	m_vk.cmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+
+void ProfilingDeviceDriver::cmdBindVertexBuffers (VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) const
+{
+	const ApiCallTimer timer (m_counters[79]);
+	m_vk.cmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+
+void ProfilingDeviceDriver::cmdDraw (VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+{
+	const ApiCallTimer timer (m_counters[80]);
+	m_vk.cmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndexed (VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const
+{
+	const ApiCallTimer timer (m_counters[81]);
+	m_vk.cmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[82]);
+	m_vk.cmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndexedIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[83]);
+	m_vk.cmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDispatch (VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const
+{
+	const ApiCallTimer timer (m_counters[84]);
+	m_vk.cmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+
+void ProfilingDeviceDriver::cmdDispatchIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) const
+{
+	const ApiCallTimer timer (m_counters[85]);
+	m_vk.cmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+void ProfilingDeviceDriver::cmdCopyBuffer (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[86]);
+	m_vk.cmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdCopyImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[87]);
+	m_vk.cmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdBlitImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions, VkFilter filter) const
+{
+	const ApiCallTimer timer (m_counters[88]);
+	m_vk.cmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+}
+
+void ProfilingDeviceDriver::cmdCopyBufferToImage (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[89]);
+	m_vk.cmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdCopyImageToBuffer (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[90]);
+	m_vk.cmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdUpdateBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData) const
+{
+	const ApiCallTimer timer (m_counters[91]);
+	m_vk.cmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+
+void ProfilingDeviceDriver::cmdFillBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) const
+{
+	const ApiCallTimer timer (m_counters[92]);
+	m_vk.cmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+
+void ProfilingDeviceDriver::cmdClearColorImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) const
+{
+	const ApiCallTimer timer (m_counters[93]);
+	m_vk.cmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+
+void ProfilingDeviceDriver::cmdClearDepthStencilImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange* pRanges) const
+{
+	const ApiCallTimer timer (m_counters[94]);
+	m_vk.cmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+
+void ProfilingDeviceDriver::cmdClearAttachments (VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment* pAttachments, uint32_t rectCount, const VkClearRect* pRects) const
+{
+	const ApiCallTimer timer (m_counters[95]);
+	m_vk.cmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+
+void ProfilingDeviceDriver::cmdResolveImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve* pRegions) const
+{
+	const ApiCallTimer timer (m_counters[96]);
+	m_vk.cmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void ProfilingDeviceDriver::cmdSetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const
+{
+	const ApiCallTimer timer (m_counters[97]);
+	m_vk.cmdSetEvent(commandBuffer, event, stageMask);
+}
+
+void ProfilingDeviceDriver::cmdResetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const
+{
+	const ApiCallTimer timer (m_counters[98]);
+	m_vk.cmdResetEvent(commandBuffer, event, stageMask);
+}
+
+void ProfilingDeviceDriver::cmdWaitEvents (VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const
+{
+	const ApiCallTimer timer (m_counters[99]);
+	m_vk.cmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+void ProfilingDeviceDriver::cmdPipelineBarrier (VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const
+{
+	const ApiCallTimer timer (m_counters[100]);
+	m_vk.cmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+void ProfilingDeviceDriver::cmdBeginQuery (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[101]);
+	m_vk.cmdBeginQuery(commandBuffer, queryPool, query, flags);
+}
+
+void ProfilingDeviceDriver::cmdEndQuery (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) const
+{
+	const ApiCallTimer timer (m_counters[102]);
+	m_vk.cmdEndQuery(commandBuffer, queryPool, query);
+}
+
+void ProfilingDeviceDriver::cmdResetQueryPool (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const
+{
+	const ApiCallTimer timer (m_counters[103]);
+	m_vk.cmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+}
+
+void ProfilingDeviceDriver::cmdWriteTimestamp (VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) const
+{
+	const ApiCallTimer timer (m_counters[104]);
+	m_vk.cmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+}
+
+void ProfilingDeviceDriver::cmdCopyQueryPoolResults (VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) const
+{
+	const ApiCallTimer timer (m_counters[105]);
+	m_vk.cmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+}
+
+void ProfilingDeviceDriver::cmdPushConstants (VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) const
+{
+	const ApiCallTimer timer (m_counters[106]);
+	m_vk.cmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+
+void ProfilingDeviceDriver::cmdBeginRenderPass (VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) const
+{
+	const ApiCallTimer timer (m_counters[107]);
+	m_vk.cmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+}
+
+void ProfilingDeviceDriver::cmdNextSubpass (VkCommandBuffer commandBuffer, VkSubpassContents contents) const
+{
+	const ApiCallTimer timer (m_counters[108]);
+	m_vk.cmdNextSubpass(commandBuffer, contents);
+}
+
+void ProfilingDeviceDriver::cmdEndRenderPass (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[109]);
+	m_vk.cmdEndRenderPass(commandBuffer);
+}
+
+void ProfilingDeviceDriver::cmdExecuteCommands (VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) const
+{
+	const ApiCallTimer timer (m_counters[110]);
+	m_vk.cmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
+
+VkResult ProfilingDeviceDriver::bindBufferMemory2 (VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo* pBindInfos) const
+{
+	const ApiCallTimer timer (m_counters[111]);
+	return m_vk.bindBufferMemory2(device, bindInfoCount, pBindInfos);
+}
+
+VkResult ProfilingDeviceDriver::bindImageMemory2 (VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo* pBindInfos) const
+{
+	const ApiCallTimer timer (m_counters[112]);
+	return m_vk.bindImageMemory2(device, bindInfoCount, pBindInfos);
+}
+
+void ProfilingDeviceDriver::getDeviceGroupPeerMemoryFeatures (VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) const
+{
+	const ApiCallTimer timer (m_counters[113]);
+	m_vk.getDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+}
+
+void ProfilingDeviceDriver::cmdSetDeviceMask (VkCommandBuffer commandBuffer, uint32_t deviceMask) const
+{
+	const ApiCallTimer timer (m_counters[114]);
+	m_vk.cmdSetDeviceMask(commandBuffer, deviceMask);
+}
+
+void ProfilingDeviceDriver::cmdDispatchBase (VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) const
+{
+	const ApiCallTimer timer (m_counters[115]);
+	m_vk.cmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+}
+
+void ProfilingDeviceDriver::getImageMemoryRequirements2 (VkDevice device, const VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[116]);
+	m_vk.getImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+}
+
+void ProfilingDeviceDriver::getBufferMemoryRequirements2 (VkDevice device, const VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) const
+{
+	const ApiCallTimer timer (m_counters[117]);
+	m_vk.getBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+}
+
+void ProfilingDeviceDriver::getDeviceQueue2 (VkDevice device, const VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) const
+{
+	const ApiCallTimer timer (m_counters[118]);
+	m_vk.getDeviceQueue2(device, pQueueInfo, pQueue);
+}
+
+VkResult ProfilingDeviceDriver::createSamplerYcbcrConversion (VkDevice device, const VkSamplerYcbcrConversionCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion) const
+{
+	const ApiCallTimer timer (m_counters[119]);
+	return m_vk.createSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+
+void ProfilingDeviceDriver::destroySamplerYcbcrConversion (VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[120]);
+	m_vk.destroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
+}
+
+void ProfilingDeviceDriver::getDescriptorSetLayoutSupport (VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport) const
+{
+	const ApiCallTimer timer (m_counters[121]);
+	m_vk.getDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndirectCount (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[122]);
+	m_vk.cmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+void ProfilingDeviceDriver::cmdDrawIndexedIndirectCount (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) const
+{
+	const ApiCallTimer timer (m_counters[123]);
+	m_vk.cmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+VkResult ProfilingDeviceDriver::createRenderPass2 (VkDevice device, const VkRenderPassCreateInfo2* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const
+{
+	const ApiCallTimer timer (m_counters[124]);
+	return m_vk.createRenderPass2(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+void ProfilingDeviceDriver::cmdBeginRenderPass2 (VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, const VkSubpassBeginInfo* pSubpassBeginInfo) const
+{
+	const ApiCallTimer timer (m_counters[125]);
+	m_vk.cmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+
+void ProfilingDeviceDriver::cmdNextSubpass2 (VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo, const VkSubpassEndInfo* pSubpassEndInfo) const
+{
+	const ApiCallTimer timer (m_counters[126]);
+	m_vk.cmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+}
+
+void ProfilingDeviceDriver::cmdEndRenderPass2 (VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) const
+{
+	const ApiCallTimer timer (m_counters[127]);
+	m_vk.cmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+}
+
+void ProfilingDeviceDriver::resetQueryPool (VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) const
+{
+	const ApiCallTimer timer (m_counters[128]);
+	m_vk.resetQueryPool(device, queryPool, firstQuery, queryCount);
+}
+
+VkResult ProfilingDeviceDriver::getSemaphoreCounterValue (VkDevice device, VkSemaphore semaphore, uint64_t* pValue) const
+{
+	const ApiCallTimer timer (m_counters[129]);
+	return m_vk.getSemaphoreCounterValue(device, semaphore, pValue);
+}
+
+VkResult ProfilingDeviceDriver::waitSemaphores (VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) const
+{
+	const ApiCallTimer timer (m_counters[130]);
+	return m_vk.waitSemaphores(device, pWaitInfo, timeout);
+}
+
+VkResult ProfilingDeviceDriver::signalSemaphore (VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) const
+{
+	const ApiCallTimer timer (m_counters[131]);
+	return m_vk.signalSemaphore(device, pSignalInfo);
+}
+
+VkDeviceAddress ProfilingDeviceDriver::getBufferDeviceAddress (VkDevice device, const VkBufferDeviceAddressInfo* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[132]);
+	return m_vk.getBufferDeviceAddress(device, pInfo);
+}
+
+uint64_t ProfilingDeviceDriver::getBufferOpaqueCaptureAddress (VkDevice device, const VkBufferDeviceAddressInfo* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[133]);
+	return m_vk.getBufferOpaqueCaptureAddress(device, pInfo);
+}
+
+uint64_t ProfilingDeviceDriver::getDeviceMemoryOpaqueCaptureAddress (VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[134]);
+	return m_vk.getDeviceMemoryOpaqueCaptureAddress(device, pInfo);
+}
+
+void ProfilingDeviceDriver::getCommandPoolMemoryConsumption (VkDevice device, VkCommandPool commandPool, VkCommandBuffer commandBuffer, VkCommandPoolMemoryConsumption* pConsumption) const
+{
+	const ApiCallTimer timer (m_counters[135]);
+	m_vk.getCommandPoolMemoryConsumption(device, commandPool, commandBuffer, pConsumption);
+}
+
+VkResult ProfilingDeviceDriver::getFaultData (VkDevice device, VkFaultQueryBehavior faultQueryBehavior, VkBool32* pUnrecordedFaults, uint32_t* pFaultCount, VkFaultData* pFaults) const
+{
+	const ApiCallTimer timer (m_counters[136]);
+	return m_vk.getFaultData(device, faultQueryBehavior, pUnrecordedFaults, pFaultCount, pFaults);
+}
+
+VkResult ProfilingDeviceDriver::createSwapchainKHR (VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) const
+{
+	const ApiCallTimer timer (m_counters[137]);
+	return m_vk.createSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+}
+
+VkResult ProfilingDeviceDriver::getSwapchainImagesKHR (VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const
+{
+	const ApiCallTimer timer (m_counters[138]);
+	return m_vk.getSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+
+VkResult ProfilingDeviceDriver::acquireNextImageKHR (VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) const
+{
+	const ApiCallTimer timer (m_counters[139]);
+	return m_vk.acquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+}
+
+VkResult ProfilingDeviceDriver::queuePresentKHR (VkQueue queue, const VkPresentInfoKHR* pPresentInfo) const
+{
+	const ApiCallTimer timer (m_counters[140]);
+	return m_vk.queuePresentKHR(queue, pPresentInfo);
+}
+
+VkResult ProfilingDeviceDriver::getDeviceGroupPresentCapabilitiesKHR (VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[141]);
+	return m_vk.getDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
+}
+
+VkResult ProfilingDeviceDriver::getDeviceGroupSurfacePresentModesKHR (VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes) const
+{
+	const ApiCallTimer timer (m_counters[142]);
+	return m_vk.getDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
+}
+
+VkResult ProfilingDeviceDriver::acquireNextImage2KHR (VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex) const
+{
+	const ApiCallTimer timer (m_counters[143]);
+	return m_vk.acquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+}
+
+VkResult ProfilingDeviceDriver::createSharedSwapchainsKHR (VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) const
+{
+	const ApiCallTimer timer (m_counters[144]);
+	return m_vk.createSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryFdKHR (VkDevice device, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) const
+{
+	const ApiCallTimer timer (m_counters[145]);
+	return m_vk.getMemoryFdKHR(device, pGetFdInfo, pFd);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryFdPropertiesKHR (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) const
+{
+	const ApiCallTimer timer (m_counters[146]);
+	return m_vk.getMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
+}
+
+VkResult ProfilingDeviceDriver::importSemaphoreFdKHR (VkDevice device, const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) const
+{
+	const ApiCallTimer timer (m_counters[147]);
+	return m_vk.importSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+}
+
+VkResult ProfilingDeviceDriver::getSemaphoreFdKHR (VkDevice device, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) const
+{
+	const ApiCallTimer timer (m_counters[148]);
+	return m_vk.getSemaphoreFdKHR(device, pGetFdInfo, pFd);
+}
+
+VkResult ProfilingDeviceDriver::getSwapchainStatusKHR (VkDevice device, VkSwapchainKHR swapchain) const
+{
+	const ApiCallTimer timer (m_counters[149]);
+	return m_vk.getSwapchainStatusKHR(device, swapchain);
+}
+
+VkResult ProfilingDeviceDriver::importFenceFdKHR (VkDevice device, const VkImportFenceFdInfoKHR* pImportFenceFdInfo) const
+{
+	const ApiCallTimer timer (m_counters[150]);
+	return m_vk.importFenceFdKHR(device, pImportFenceFdInfo);
+}
+
+VkResult ProfilingDeviceDriver::getFenceFdKHR (VkDevice device, const VkFenceGetFdInfoKHR* pGetFdInfo, int* pFd) const
+{
+	const ApiCallTimer timer (m_counters[151]);
+	return m_vk.getFenceFdKHR(device, pGetFdInfo, pFd);
+}
+
+VkResult ProfilingDeviceDriver::acquireProfilingLockKHR (VkDevice device, const VkAcquireProfilingLockInfoKHR* pInfo) const
+{
+	const ApiCallTimer timer (m_counters[152]);
+	return m_vk.acquireProfilingLockKHR(device, pInfo);
+}
+
+void ProfilingDeviceDriver::releaseProfilingLockKHR (VkDevice device) const
+{
+	const ApiCallTimer timer (m_counters[153]);
+	m_vk.releaseProfilingLockKHR(device);
+}
+
+void ProfilingDeviceDriver::cmdSetFragmentShadingRateKHR (VkCommandBuffer commandBuffer, const VkExtent2D* pFragmentSize, const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) const
+{
+	const ApiCallTimer timer (m_counters[154]);
+	m_vk.cmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
+}
+
+void ProfilingDeviceDriver::cmdRefreshObjectsKHR (VkCommandBuffer commandBuffer, const VkRefreshObjectListKHR* pRefreshObjects) const
+{
+	const ApiCallTimer timer (m_counters[155]);
+	m_vk.cmdRefreshObjectsKHR(commandBuffer, pRefreshObjects);
+}
+
+void ProfilingDeviceDriver::cmdSetEvent2KHR (VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfoKHR* pDependencyInfo) const
+{
+	const ApiCallTimer timer (m_counters[156]);
+	m_vk.cmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
+}
+
+void ProfilingDeviceDriver::cmdResetEvent2KHR (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2KHR stageMask) const
+{
+	const ApiCallTimer timer (m_counters[157]);
+	m_vk.cmdResetEvent2KHR(commandBuffer, event, stageMask);
+}
+
+void ProfilingDeviceDriver::cmdWaitEvents2KHR (VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents, const VkDependencyInfoKHR* pDependencyInfos) const
+{
+	const ApiCallTimer timer (m_counters[158]);
+	m_vk.cmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+}
+
+void ProfilingDeviceDriver::cmdPipelineBarrier2KHR (VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo) const
+{
+	const ApiCallTimer timer (m_counters[159]);
+	m_vk.cmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+}
+
+void ProfilingDeviceDriver::cmdWriteTimestamp2KHR (VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkQueryPool queryPool, uint32_t query) const
+{
+	const ApiCallTimer timer (m_counters[160]);
+	m_vk.cmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
+}
+
+VkResult ProfilingDeviceDriver::queueSubmit2KHR (VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits, VkFence fence) const
+{
+	const ApiCallTimer timer (m_counters[161]);
+	return m_vk.queueSubmit2KHR(queue, submitCount, pSubmits, fence);
+}
+
+void ProfilingDeviceDriver::cmdWriteBufferMarker2AMD (VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR stage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) const
+{
+	const ApiCallTimer timer (m_counters[162]);
+	m_vk.cmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
+}
+
+void ProfilingDeviceDriver::getQueueCheckpointData2NV (VkQueue queue, uint32_t* pCheckpointDataCount, VkCheckpointData2NV* pCheckpointData) const
+{
+	const ApiCallTimer timer (m_counters[163]);
+	m_vk.getQueueCheckpointData2NV(queue, pCheckpointDataCount, pCheckpointData);
+}
+
+void ProfilingDeviceDriver::cmdCopyBuffer2KHR (VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR* pCopyBufferInfo) const
+{
+	const ApiCallTimer timer (m_counters[164]);
+	m_vk.cmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyImage2KHR (VkCommandBuffer commandBuffer, const VkCopyImageInfo2KHR* pCopyImageInfo) const
+{
+	const ApiCallTimer timer (m_counters[165]);
+	m_vk.cmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyBufferToImage2KHR (VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2KHR* pCopyBufferToImageInfo) const
+{
+	const ApiCallTimer timer (m_counters[166]);
+	m_vk.cmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
+}
+
+void ProfilingDeviceDriver::cmdCopyImageToBuffer2KHR (VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2KHR* pCopyImageToBufferInfo) const
+{
+	const ApiCallTimer timer (m_counters[167]);
+	m_vk.cmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
+}
+
+void ProfilingDeviceDriver::cmdBlitImage2KHR (VkCommandBuffer commandBuffer, const VkBlitImageInfo2KHR* pBlitImageInfo) const
+{
+	const ApiCallTimer timer (m_counters[168]);
+	m_vk.cmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
+}
+
+void ProfilingDeviceDriver::cmdResolveImage2KHR (VkCommandBuffer commandBuffer, const VkResolveImageInfo2KHR* pResolveImageInfo) const
+{
+	const ApiCallTimer timer (m_counters[169]);
+	m_vk.cmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
+}
+
+VkResult ProfilingDeviceDriver::displayPowerControlEXT (VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT* pDisplayPowerInfo) const
+{
+	const ApiCallTimer timer (m_counters[170]);
+	return m_vk.displayPowerControlEXT(device, display, pDisplayPowerInfo);
+}
+
+VkResult ProfilingDeviceDriver::registerDeviceEventEXT (VkDevice device, const VkDeviceEventInfoEXT* pDeviceEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const
+{
+	const ApiCallTimer timer (m_counters[171]);
+	return m_vk.registerDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
+}
+
+VkResult ProfilingDeviceDriver::registerDisplayEventEXT (VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT* pDisplayEventInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const
+{
+	const ApiCallTimer timer (m_counters[172]);
+	return m_vk.registerDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
+}
+
+VkResult ProfilingDeviceDriver::getSwapchainCounterEXT (VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t* pCounterValue) const
+{
+	const ApiCallTimer timer (m_counters[173]);
+	return m_vk.getSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
+}
+
+void ProfilingDeviceDriver::cmdSetDiscardRectangleEXT (VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D* pDiscardRectangles) const
+{
+	const ApiCallTimer timer (m_counters[174]);
+	m_vk.cmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+}
+
+void ProfilingDeviceDriver::setHdrMetadataEXT (VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR* pSwapchains, const VkHdrMetadataEXT* pMetadata) const
+{
+	const ApiCallTimer timer (m_counters[175]);
+	m_vk.setHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+}
+
+VkResult ProfilingDeviceDriver::setDebugUtilsObjectNameEXT (VkDevice device, const VkDebugUtilsObjectNameInfoEXT* pNameInfo) const
+{
+	const ApiCallTimer timer (m_counters[176]);
+	return m_vk.setDebugUtilsObjectNameEXT(device, pNameInfo);
+}
+
+VkResult ProfilingDeviceDriver::setDebugUtilsObjectTagEXT (VkDevice device, const VkDebugUtilsObjectTagInfoEXT* pTagInfo) const
+{
+	const ApiCallTimer timer (m_counters[177]);
+	return m_vk.setDebugUtilsObjectTagEXT(device, pTagInfo);
+}
+
+void ProfilingDeviceDriver::queueBeginDebugUtilsLabelEXT (VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo) const
+{
+	const ApiCallTimer timer (m_counters[178]);
+	m_vk.queueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
+}
+
+void ProfilingDeviceDriver::queueEndDebugUtilsLabelEXT (VkQueue queue) const
+{
+	const ApiCallTimer timer (m_counters[179]);
+	m_vk.queueEndDebugUtilsLabelEXT(queue);
+}
+
+void ProfilingDeviceDriver::queueInsertDebugUtilsLabelEXT (VkQueue queue, const VkDebugUtilsLabelEXT* pLabelInfo) const
+{
+	const ApiCallTimer timer (m_counters[180]);
+	m_vk.queueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
+}
+
+void ProfilingDeviceDriver::cmdBeginDebugUtilsLabelEXT (VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) const
+{
+	const ApiCallTimer timer (m_counters[181]);
+	m_vk.cmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+}
+
+void ProfilingDeviceDriver::cmdEndDebugUtilsLabelEXT (VkCommandBuffer commandBuffer) const
+{
+	const ApiCallTimer timer (m_counters[182]);
+	m_vk.cmdEndDebugUtilsLabelEXT(commandBuffer);
+}
+
+void ProfilingDeviceDriver::cmdInsertDebugUtilsLabelEXT (VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT* pLabelInfo) const
+{
+	const ApiCallTimer timer (m_counters[183]);
+	m_vk.cmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+}
+
+void ProfilingDeviceDriver::cmdSetSampleLocationsEXT (VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT* pSampleLocationsInfo) const
+{
+	const ApiCallTimer timer (m_counters[184]);
+	m_vk.cmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+}
+
+VkResult ProfilingDeviceDriver::getImageDrmFormatModifierPropertiesEXT (VkDevice device, VkImage image, VkImageDrmFormatModifierPropertiesEXT* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[185]);
+	return m_vk.getImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
+}
+
+VkResult ProfilingDeviceDriver::getMemoryHostPointerPropertiesEXT (VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, const void* pHostPointer, VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties) const
+{
+	const ApiCallTimer timer (m_counters[186]);
+	return m_vk.getMemoryHostPointerPropertiesEXT(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+}
+
+VkResult ProfilingDeviceDriver::getCalibratedTimestampsEXT (VkDevice device, uint32_t timestampCount, const VkCalibratedTimestampInfoEXT* pTimestampInfos, uint64_t* pTimestamps, uint64_t* pMaxDeviation) const
+{
+	const ApiCallTimer timer (m_counters[187]);
+	return m_vk.getCalibratedTimestampsEXT(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+}
+
+void ProfilingDeviceDriver::cmdSetLineStippleEXT (VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern) const
+{
+	const ApiCallTimer timer (m_counters[188]);
+	m_vk.cmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+
+void ProfilingDeviceDriver::cmdSetCullModeEXT (VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) const
+{
+	const ApiCallTimer timer (m_counters[189]);
+	m_vk.cmdSetCullModeEXT(commandBuffer, cullMode);
+}
+
+void ProfilingDeviceDriver::cmdSetFrontFaceEXT (VkCommandBuffer commandBuffer, VkFrontFace frontFace) const
+{
+	const ApiCallTimer timer (m_counters[190]);
+	m_vk.cmdSetFrontFaceEXT(commandBuffer, frontFace);
+}
+
+void ProfilingDeviceDriver::cmdSetPrimitiveTopologyEXT (VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) const
+{
+	const ApiCallTimer timer (m_counters[191]);
+	m_vk.cmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
+}
+
+void ProfilingDeviceDriver::cmdSetViewportWithCountEXT (VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport* pViewports) const
+{
+	const ApiCallTimer timer (m_counters[192]);
+	m_vk.cmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
+}
+
+void ProfilingDeviceDriver::cmdSetScissorWithCountEXT (VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D* pScissors) const
+{
+	const ApiCallTimer timer (m_counters[193]);
+	m_vk.cmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
+}
+
+void ProfilingDeviceDriver::cmdBindVertexBuffers2EXT (VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) const
+{
+	const ApiCallTimer timer (m_counters[194]);
+	m_vk.cmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthTestEnableEXT (VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) const
+{
+	const ApiCallTimer timer (m_counters[195]);
+	m_vk.cmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthWriteEnableEXT (VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) const
+{
+	const ApiCallTimer timer (m_counters[196]);
+	m_vk.cmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthCompareOpEXT (VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) const
+{
+	const ApiCallTimer timer (m_counters[197]);
+	m_vk.cmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthBoundsTestEnableEXT (VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) const
+{
+	const ApiCallTimer timer (m_counters[198]);
+	m_vk.cmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilTestEnableEXT (VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) const
+{
+	const ApiCallTimer timer (m_counters[199]);
+	m_vk.cmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetStencilOpEXT (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) const
+{
+	const ApiCallTimer timer (m_counters[200]);
+	m_vk.cmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+}
+
+void ProfilingDeviceDriver::cmdSetVertexInputEXT (VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount, const VkVertexInputBindingDescription2EXT* pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount, const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions) const
+{
+	const ApiCallTimer timer (m_counters[201]);
+	m_vk.cmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+}
+
+void ProfilingDeviceDriver::cmdSetPatchControlPointsEXT (VkCommandBuffer commandBuffer, uint32_t patchControlPoints) const
+{
+	const ApiCallTimer timer (m_counters[202]);
+	m_vk.cmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
+}
+
+void ProfilingDeviceDriver::cmdSetRasterizerDiscardEnableEXT (VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) const
+{
+	const ApiCallTimer timer (m_counters[203]);
+	m_vk.cmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetDepthBiasEnableEXT (VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) const
+{
+	const ApiCallTimer timer (m_counters[204]);
+	m_vk.cmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetLogicOpEXT (VkCommandBuffer commandBuffer, VkLogicOp logicOp) const
+{
+	const ApiCallTimer timer (m_counters[205]);
+	m_vk.cmdSetLogicOpEXT(commandBuffer, logicOp);
+}
+
+void ProfilingDeviceDriver::cmdSetPrimitiveRestartEnableEXT (VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) const
+{
+	const ApiCallTimer timer (m_counters[206]);
+	m_vk.cmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
+}
+
+void ProfilingDeviceDriver::cmdSetColorWriteEnableEXT (VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkBool32* pColorWriteEnables) const
+{
+	const ApiCallTimer timer (m_counters[207]);
+	m_vk.cmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
+}
@@ -0,0 +1,373 @@
+/* Profiling forwarders for InstanceInterface.
+ * Not generated: derived by hand from vkConcreteInstanceInterface.inl in this
+ * directory. Update it when that file changes; s_instanceFunctionNames must
+ * stay in the same order as the forwarders.
+ */
+
+static const char* const s_instanceFunctionNames[] =
+{
+	"vkDestroyInstance",
+	"vkEnumeratePhysicalDevices",
+	"vkGetPhysicalDeviceFeatures",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkGetPhysicalDeviceProperties",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkCreateDevice",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkEnumerateDeviceLayerProperties",
+	"vkEnumeratePhysicalDeviceGroups",
+	"vkGetPhysicalDeviceFeatures2",
+	"vkGetPhysicalDeviceProperties2",
+	"vkGetPhysicalDeviceFormatProperties2",
+	"vkGetPhysicalDeviceImageFormatProperties2",
+	"vkGetPhysicalDeviceQueueFamilyProperties2",
+	"vkGetPhysicalDeviceMemoryProperties2",
+	"vkGetPhysicalDeviceExternalBufferProperties",
+	"vkGetPhysicalDeviceExternalFenceProperties",
+	"vkGetPhysicalDeviceExternalSemaphoreProperties",
+	"vkDestroySurfaceKHR",
+	"vkGetPhysicalDeviceSurfaceSupportKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+	"vkGetPhysicalDeviceSurfaceFormatsKHR",
+	"vkGetPhysicalDeviceSurfacePresentModesKHR",
+	"vkGetPhysicalDevicePresentRectanglesKHR",
+	"vkGetPhysicalDeviceDisplayPropertiesKHR",
+	"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+	"vkGetDisplayPlaneSupportedDisplaysKHR",
+	"vkGetDisplayModePropertiesKHR",
+	"vkCreateDisplayModeKHR",
+	"vkGetDisplayPlaneCapabilitiesKHR",
+	"vkCreateDisplayPlaneSurfaceKHR",
+	"vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+	"vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+	"vkGetPhysicalDeviceSurfaceFormats2KHR",
+	"vkGetPhysicalDeviceDisplayProperties2KHR",
+	"vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+	"vkGetDisplayModeProperties2KHR",
+	"vkGetDisplayPlaneCapabilities2KHR",
+	"vkGetPhysicalDeviceFragmentShadingRatesKHR",
+	"vkGetPhysicalDeviceRefreshableObjectTypesKHR",
+	"vkReleaseDisplayEXT",
+	"vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+	"vkCreateDebugUtilsMessengerEXT",
+	"vkDestroyDebugUtilsMessengerEXT",
+	"vkSubmitDebugUtilsMessageEXT",
+	"vkGetPhysicalDeviceMultisamplePropertiesEXT",
+	"vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",
+	"vkCreateHeadlessSurfaceEXT",
+};
+
+void ProfilingInstanceDriver::destroyInstance (VkInstance instance, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[0]);
+	m_vk.destroyInstance(instance, pAllocator);
+}
+
+VkResult ProfilingInstanceDriver::enumeratePhysicalDevices (VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const
+{
+	const ApiCallTimer timer (m_counters[1]);
+	return m_vk.enumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceFeatures (VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) const
+{
+	const ApiCallTimer timer (m_counters[2]);
+	m_vk.getPhysicalDeviceFeatures(physicalDevice, pFeatures);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[3]);
+	m_vk.getPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceImageFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[4]);
+	return m_vk.getPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceProperties (VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[5]);
+	m_vk.getPhysicalDeviceProperties(physicalDevice, pProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceQueueFamilyProperties (VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) const
+{
+	const ApiCallTimer timer (m_counters[6]);
+	m_vk.getPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceMemoryProperties (VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) const
+{
+	const ApiCallTimer timer (m_counters[7]);
+	m_vk.getPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
+}
+
+VkResult ProfilingInstanceDriver::createDevice (VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const
+{
+	const ApiCallTimer timer (m_counters[8]);
+	return m_vk.createDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+}
+
+VkResult ProfilingInstanceDriver::enumerateDeviceExtensionProperties (VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[9]);
+	return m_vk.enumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::enumerateDeviceLayerProperties (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[10]);
+	return m_vk.enumerateDeviceLayerProperties(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::enumeratePhysicalDeviceGroups (VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties) const
+{
+	const ApiCallTimer timer (m_counters[11]);
+	return m_vk.enumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceFeatures2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures) const
+{
+	const ApiCallTimer timer (m_counters[12]);
+	m_vk.getPhysicalDeviceFeatures2(physicalDevice, pFeatures);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceProperties2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[13]);
+	m_vk.getPhysicalDeviceProperties2(physicalDevice, pProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceFormatProperties2 (VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2* pFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[14]);
+	m_vk.getPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceImageFormatProperties2 (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties) const
+{
+	const ApiCallTimer timer (m_counters[15]);
+	return m_vk.getPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceQueueFamilyProperties2 (VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2* pQueueFamilyProperties) const
+{
+	const ApiCallTimer timer (m_counters[16]);
+	m_vk.getPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceMemoryProperties2 (VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties) const
+{
+	const ApiCallTimer timer (m_counters[17]);
+	m_vk.getPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceExternalBufferProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties) const
+{
+	const ApiCallTimer timer (m_counters[18]);
+	m_vk.getPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceExternalFenceProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties) const
+{
+	const ApiCallTimer timer (m_counters[19]);
+	m_vk.getPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceExternalSemaphoreProperties (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties) const
+{
+	const ApiCallTimer timer (m_counters[20]);
+	m_vk.getPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+}
+
+void ProfilingInstanceDriver::destroySurfaceKHR (VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[21]);
+	m_vk.destroySurfaceKHR(instance, surface, pAllocator);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceSupportKHR (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) const
+{
+	const ApiCallTimer timer (m_counters[22]);
+	return m_vk.getPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceCapabilitiesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[23]);
+	return m_vk.getPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceFormatsKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) const
+{
+	const ApiCallTimer timer (m_counters[24]);
+	return m_vk.getPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfacePresentModesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) const
+{
+	const ApiCallTimer timer (m_counters[25]);
+	return m_vk.getPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDevicePresentRectanglesKHR (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects) const
+{
+	const ApiCallTimer timer (m_counters[26]);
+	return m_vk.getPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceDisplayPropertiesKHR (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[27]);
+	return m_vk.getPhysicalDeviceDisplayPropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceDisplayPlanePropertiesKHR (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[28]);
+	return m_vk.getPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayPlaneSupportedDisplaysKHR (VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays) const
+{
+	const ApiCallTimer timer (m_counters[29]);
+	return m_vk.getDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayModePropertiesKHR (VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[30]);
+	return m_vk.getDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::createDisplayModeKHR (VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) const
+{
+	const ApiCallTimer timer (m_counters[31]);
+	return m_vk.createDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayPlaneCapabilitiesKHR (VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[32]);
+	return m_vk.getDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::createDisplayPlaneSurfaceKHR (VkInstance instance, const VkDisplaySurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[33]);
+	return m_vk.createDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+}
+
+VkResult ProfilingInstanceDriver::enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR (VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, uint32_t* pCounterCount, VkPerformanceCounterKHR* pCounters, VkPerformanceCounterDescriptionKHR* pCounterDescriptions) const
+{
+	const ApiCallTimer timer (m_counters[34]);
+	return m_vk.enumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR (VkPhysicalDevice physicalDevice, const VkQueryPoolPerformanceCreateInfoKHR* pPerformanceQueryCreateInfo, uint32_t* pNumPasses) const
+{
+	const ApiCallTimer timer (m_counters[35]);
+	m_vk.getPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceCapabilities2KHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[36]);
+	return m_vk.getPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceFormats2KHR (VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats) const
+{
+	const ApiCallTimer timer (m_counters[37]);
+	return m_vk.getPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceDisplayProperties2KHR (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayProperties2KHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[38]);
+	return m_vk.getPhysicalDeviceDisplayProperties2KHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceDisplayPlaneProperties2KHR (VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlaneProperties2KHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[39]);
+	return m_vk.getPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayModeProperties2KHR (VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModeProperties2KHR* pProperties) const
+{
+	const ApiCallTimer timer (m_counters[40]);
+	return m_vk.getDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
+}
+
+VkResult ProfilingInstanceDriver::getDisplayPlaneCapabilities2KHR (VkPhysicalDevice physicalDevice, const VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR* pCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[41]);
+	return m_vk.getDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceFragmentShadingRatesKHR (VkPhysicalDevice physicalDevice, uint32_t* pFragmentShadingRateCount, VkPhysicalDeviceFragmentShadingRateKHR* pFragmentShadingRates) const
+{
+	const ApiCallTimer timer (m_counters[42]);
+	return m_vk.getPhysicalDeviceFragmentShadingRatesKHR(physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceRefreshableObjectTypesKHR (VkPhysicalDevice physicalDevice, uint32_t* pRefreshableObjectTypeCount, VkObjectType* pRefreshableObjectTypes) const
+{
+	const ApiCallTimer timer (m_counters[43]);
+	return m_vk.getPhysicalDeviceRefreshableObjectTypesKHR(physicalDevice, pRefreshableObjectTypeCount, pRefreshableObjectTypes);
+}
+
+VkResult ProfilingInstanceDriver::releaseDisplayEXT (VkPhysicalDevice physicalDevice, VkDisplayKHR display) const
+{
+	const ApiCallTimer timer (m_counters[44]);
+	return m_vk.releaseDisplayEXT(physicalDevice, display);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceSurfaceCapabilities2EXT (VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilities2EXT* pSurfaceCapabilities) const
+{
+	const ApiCallTimer timer (m_counters[45]);
+	return m_vk.getPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
+}
+
+VkResult ProfilingInstanceDriver::createDebugUtilsMessengerEXT (VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDebugUtilsMessengerEXT* pMessenger) const
+{
+	const ApiCallTimer timer (m_counters[46]);
+	return m_vk.createDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
+}
+
+void ProfilingInstanceDriver::destroyDebugUtilsMessengerEXT (VkInstance instance, VkDebugUtilsMessengerEXT messenger, const VkAllocationCallbacks* pAllocator) const
+{
+	const ApiCallTimer timer (m_counters[47]);
+	m_vk.destroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
+}
+
+void ProfilingInstanceDriver::submitDebugUtilsMessageEXT (VkInstance instance, VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageTypes, const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData) const
+{
+	const ApiCallTimer timer (m_counters[48]);
+	m_vk.submitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
+}
+
+void ProfilingInstanceDriver::getPhysicalDeviceMultisamplePropertiesEXT (VkPhysicalDevice physicalDevice, VkSampleCountFlagBits samples, VkMultisamplePropertiesEXT* pMultisampleProperties) const
+{
+	const ApiCallTimer timer (m_counters[49]);
+	m_vk.getPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
+}
+
+VkResult ProfilingInstanceDriver::getPhysicalDeviceCalibrateableTimeDomainsEXT (VkPhysicalDevice physicalDevice, uint32_t* pTimeDomainCount, VkTimeDomainEXT* pTimeDomains) const
+{
+	const ApiCallTimer timer (m_counters[50]);
+	return m_vk.getPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, pTimeDomainCount, pTimeDomains);
+}
+
+VkResult ProfilingInstanceDriver::createHeadlessSurfaceEXT (VkInstance instance, const VkHeadlessSurfaceCreateInfoEXT* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const
+{
+	const ApiCallTimer timer (m_counters[51]);
+	return m_vk.createHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
+}
@@ -27,6 +27,7 @@
 #include "vkQueryUtil.hpp"
 #include "tcuFunctionLibrary.hpp"
 #include "deMemory.h"
+#include "deString.h"
 
 #if (DE_OS == DE_OS_ANDROID) && defined(__ANDROID_API_O__) && (DE_ANDROID_API >= __ANDROID_API_O__ /* __ANDROID_API_O__ */)
 #	define USE_ANDROID_O_HARDWARE_BUFFER
@@ -1456,7 +1457,13 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr (VkInstance instanc
 {
 	if (instance)
 	{
-		return reinterpret_cast<Instance*>(instance)->getProcAddr(pName);
+		const PFN_vkVoidFunction	func	= reinterpret_cast<Instance*>(instance)->getProcAddr(pName);
+
+		// vkGetDeviceProcAddr is not in the instance function table, but DeviceDriver loads it through the instance.
+		if (!func && deStringEqual(pName, "vkGetDeviceProcAddr"))
+			return (PFN_vkVoidFunction)getDeviceProcAddr;
+
+		return func;
 	}
 	else
 	{
@@ -0,0 +1,171 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Vulkan API call profiling wrappers.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkProfilingDriver.hpp"
+#include "tcuTestLog.hpp"
+#include "deArrayUtil.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace vk
+{
+
+#include "vkProfilingInstanceDriverImpl.inl"
+#include "vkProfilingDeviceDriverImpl.inl"
+
+namespace
+{
+
+void resetCounters (std::vector<ApiCallProfile::Counter>& counters)
+{
+	for (size_t ndx = 0; ndx < counters.size(); ++ndx)
+	{
+		counters[ndx].numCalls.store(0, std::memory_order_relaxed);
+		counters[ndx].totalTimeNs.store(0, std::memory_order_relaxed);
+	}
+}
+
+void appendEntries (const std::vector<ApiCallProfile::Counter>& counters, const char* const* names, std::vector<ApiCallProfile::Entry>& dst)
+{
+	for (size_t ndx = 0; ndx < counters.size(); ++ndx)
+	{
+		const ApiCallProfile::Entry entry =
+		{
+			names[ndx],
+			counters[ndx].numCalls.load(std::memory_order_relaxed),
+			counters[ndx].totalTimeNs.load(std::memory_order_relaxed),
+		};
+
+		if (entry.numCalls != 0)
+			dst.push_back(entry);
+	}
+}
+
+bool compareTotalTime (const ApiCallProfile::Entry& a, const ApiCallProfile::Entry& b)
+{
+	if (a.totalTimeNs != b.totalTimeNs)
+		return a.totalTimeNs > b.totalTimeNs;
+	else
+		return a.numCalls > b.numCalls;
+}
+
+} // anonymous
+
+// ApiCallProfile
+
+ApiCallProfile::ApiCallProfile (void)
+	: m_instanceCounters	(DE_LENGTH_OF_ARRAY(s_instanceFunctionNames))
+	, m_deviceCounters		(DE_LENGTH_OF_ARRAY(s_deviceFunctionNames))
+{
+	reset();
+}
+
+void ApiCallProfile::reset (void)
+{
+	resetCounters(m_instanceCounters);
+	resetCounters(m_deviceCounters);
+}
+
+std::vector<ApiCallProfile::Entry> ApiCallProfile::getEntries (void) const
+{
+	std::vector<Entry> entries;
+
+	appendEntries(m_instanceCounters, s_instanceFunctionNames, entries);
+	appendEntries(m_deviceCounters, s_deviceFunctionNames, entries);
+
+	std::sort(entries.begin(), entries.end(), compareTotalTime);
+
+	return entries;
+}
+
+void ApiCallProfile::log (tcu::TestLog& log, size_t maxEntries) const
+{
+	const std::vector<Entry>	entries		= getEntries();
+	deUint64					totalCalls	= 0;
+	deUint64					totalTimeNs	= 0;
+
+	if (entries.empty())
+		return;
+
+	for (size_t ndx = 0; ndx < entries.size(); ++ndx)
+	{
+		totalCalls	+= entries[ndx].numCalls;
+		totalTimeNs	+= entries[ndx].totalTimeNs;
+	}
+
+	log << tcu::TestLog::Section("ApiCallProfile", "Vulkan API call profile")
+		<< tcu::TestLog::Message << totalCalls << " calls to " << entries.size() << " entry points, " << (totalTimeNs / 1000) << " us total" << tcu::TestLog::EndMessage;
+
+	{
+		std::ostringstream table;
+
+		table << std::left << std::setw(48) << "Entry point" << std::right
+			  << std::setw(12) << "Calls"
+			  << std::setw(14) << "Total (us)"
+			  << std::setw(12) << "Avg (ns)"
+			  << std::setw(9) << "Time %";
+
+		for (size_t ndx = 0; ndx < de::min(maxEntries, entries.size()); ++ndx)
+		{
+			const Entry& entry = entries[ndx];
+
+			table << "\n" << std::left << std::setw(48) << entry.name << std::right
+				  << std::setw(12) << entry.numCalls
+				  << std::setw(14) << (entry.totalTimeNs / 1000)
+				  << std::setw(12) << (entry.totalTimeNs / entry.numCalls)
+				  << std::setw(8) << std::fixed << std::setprecision(1) << (totalTimeNs != 0 ? 100.0 * (double)entry.totalTimeNs / (double)totalTimeNs : 0.0) << "%";
+		}
+
+		log << tcu::TestLog::Message << table.str() << tcu::TestLog::EndMessage;
+	}
+
+	log << tcu::TestLog::EndSection;
+}
+
+// ProfilingInstanceDriver
+
+ProfilingInstanceDriver::ProfilingInstanceDriver (const InstanceInterface& vk, ApiCallProfile& profile)
+	: m_vk			(vk)
+	, m_counters	(profile.getInstanceCounters())
+{
+}
+
+ProfilingInstanceDriver::~ProfilingInstanceDriver (void)
+{
+}
+
+// ProfilingDeviceDriver
+
+ProfilingDeviceDriver::ProfilingDeviceDriver (const DeviceInterface& vk, ApiCallProfile& profile)
+	: m_vk			(vk)
+	, m_counters	(profile.getDeviceCounters())
+{
+}
+
+ProfilingDeviceDriver::~ProfilingDeviceDriver (void)
+{
+}
+
+} // vk
@@ -0,0 +1,136 @@
+#ifndef _VKPROFILINGDRIVER_HPP
+#define _VKPROFILINGDRIVER_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Vulkan API call profiling wrappers.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkPlatform.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace tcu
+{
+class TestLog;
+}
+
+namespace vk
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Per entry point call counts and accumulated wall time
+ *
+ * Counters are updated with relaxed atomics, so profiled interfaces can be
+ * used from several threads.
+ *//*--------------------------------------------------------------------*/
+class ApiCallProfile
+{
+public:
+	struct Counter
+	{
+		std::atomic<deUint64>	numCalls;
+		std::atomic<deUint64>	totalTimeNs;
+	};
+
+	struct Entry
+	{
+		const char*				name;
+		deUint64				numCalls;
+		deUint64				totalTimeNs;
+	};
+
+									ApiCallProfile			(void);
+
+	Counter*						getInstanceCounters		(void) { return &m_instanceCounters[0];	}
+	Counter*						getDeviceCounters		(void) { return &m_deviceCounters[0];	}
+
+	void							reset					(void);
+
+	//! Entry points called since last reset, sorted by descending total time.
+	std::vector<Entry>				getEntries				(void) const;
+
+	//! Write the maxEntries most expensive entry points to log.
+	void							log						(tcu::TestLog& log, size_t maxEntries) const;
+
+private:
+									ApiCallProfile			(const ApiCallProfile&);
+	ApiCallProfile&					operator=				(const ApiCallProfile&);
+
+	std::vector<Counter>			m_instanceCounters;
+	std::vector<Counter>			m_deviceCounters;
+};
+
+class ApiCallTimer
+{
+public:
+									ApiCallTimer			(ApiCallProfile::Counter& counter)
+										: m_counter	(counter)
+										, m_start	(std::chrono::steady_clock::now())
+									{
+									}
+
+									~ApiCallTimer			(void)
+									{
+										const deUint64 timeNs = (deUint64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+
+										m_counter.numCalls.fetch_add(1, std::memory_order_relaxed);
+										m_counter.totalTimeNs.fetch_add(timeNs, std::memory_order_relaxed);
+									}
+
+private:
+	ApiCallProfile::Counter&							m_counter;
+	const std::chrono::steady_clock::time_point			m_start;
+};
+
+//! InstanceInterface that forwards to another interface and records calls to profile.
+class ProfilingInstanceDriver : public InstanceInterface
+{
+public:
+									ProfilingInstanceDriver	(const InstanceInterface& vk, ApiCallProfile& profile);
+	virtual							~ProfilingInstanceDriver	(void);
+
+#include "vkConcreteInstanceInterface.inl"
+
+private:
+	const InstanceInterface&		m_vk;
+	ApiCallProfile::Counter* const	m_counters;
+};
+
+//! DeviceInterface that forwards to another interface and records calls to profile.
+class ProfilingDeviceDriver : public DeviceInterface
+{
+public:
+									ProfilingDeviceDriver	(const DeviceInterface& vk, ApiCallProfile& profile);
+	virtual							~ProfilingDeviceDriver	(void);
+
+#include "vkConcreteDeviceInterface.inl"
+
+private:
+	const DeviceInterface&			m_vk;
+	ApiCallProfile::Counter* const	m_counters;
+};
+
+} // vk
+
+#endif // _VKPROFILINGDRIVER_HPP
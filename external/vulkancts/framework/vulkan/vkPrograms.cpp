@@ -35,10 +35,12 @@
 #include "deArrayUtil.hpp"
 #include "deMemory.h"
 #include "deInt32.h"
+#include "deSha1.h"
 
 #include "tcuCommandLine.hpp"
 
 #include <map>
+#include <set>
 
 #if DE_OS == DE_OS_ANDROID
 #define DISABLE_SHADERCACHE_IPC
@@ -794,6 +796,286 @@ ProgramBinary* buildProgram (const HlslSource& program, glu::ShaderProgramInfo*
 	return res;
 }
 
+// SPIR-V assembly cache
+//
+// Assembled binaries are memoized in-process and optionally in an append-only
+// file shared by test runs and vk-build-programs. Entries are keyed by SHA-1 of
+// the assembly source, build options, optimization recipe and tool versions.
+//
+// File is a sequence of records:
+//   deUint32	SPIRV_ASM_CACHE_RECORD_MAGIC
+//   deSha1		key
+//   deUint32	number of words
+//   deUint32	words[number of words]
+
+namespace
+{
+
+enum
+{
+	SPIRV_ASM_CACHE_RECORD_MAGIC	= 0x4d534153,		// "SASM"
+	SPIRV_ASM_CACHE_MAX_WORDS		= 16 * 1024 * 1024,	//!< Sanity limit for a single record.
+	SPIRV_ASM_CACHE_MAX_MEMO_BYTES	= 64 * 1024 * 1024	//!< In-process memo is cleared when it grows past this.
+};
+
+struct SpirVAsmCacheKey
+{
+	deSha1	hash;
+
+	bool	operator<	(const SpirVAsmCacheKey& other) const { return deMemCmp(hash.hash, other.hash.hash, sizeof(hash.hash)) < 0;	}
+	bool	operator==	(const SpirVAsmCacheKey& other) const { return deSha1_equal(&hash, &other.hash) == DE_TRUE;						}
+};
+
+class SpirVAsmCache
+{
+public:
+	static SpirVAsmCache&		getInstance			(void);
+
+	bool						load				(const SpirVAsmCacheKey& key, const char* filename, bool truncate, vector<deUint32>& dst);
+	void						store				(const SpirVAsmCacheKey& key, const char* filename, bool truncate, const vector<deUint32>& binary);
+	SpirVAsmCacheStats			getStats			(void) const;
+
+private:
+								SpirVAsmCache		(void) : m_memoSizeBytes(0) {}
+
+	void						indexFile			(const char* filename, bool truncate);
+	bool						readRecord			(const SpirVAsmCacheKey& key, long recordOffset, vector<deUint32>& dst) const;
+	void						memoize				(const SpirVAsmCacheKey& key, const vector<deUint32>& binary);
+
+	typedef map<SpirVAsmCacheKey, vector<deUint32> >	MemoMap;
+	typedef map<SpirVAsmCacheKey, long>				FileIndexMap;
+
+	mutable de::Mutex			m_lock;
+	MemoMap						m_memo;
+	size_t						m_memoSizeBytes;
+	std::string					m_filename;			//!< File m_fileIndex refers to.
+	FileIndexMap				m_fileIndex;		//!< Record offsets in file.
+	std::set<std::string>		m_truncatedFiles;	//!< Files already truncated by this process.
+	SpirVAsmCacheStats			m_stats;
+};
+
+SpirVAsmCache& SpirVAsmCache::getInstance (void)
+{
+	static SpirVAsmCache s_cache;
+	return s_cache;
+}
+
+bool readCacheRecordHeader (FILE* file, SpirVAsmCacheKey& key, deUint32& numWords)
+{
+	deUint32 magic = 0;
+
+	if (fread(&magic, sizeof(magic), 1, file) != 1 || magic != SPIRV_ASM_CACHE_RECORD_MAGIC)
+		return false;
+
+	if (fread(&key.hash, sizeof(key.hash), 1, file) != 1)
+		return false;
+
+	if (fread(&numWords, sizeof(numWords), 1, file) != 1 || numWords == 0 || numWords > SPIRV_ASM_CACHE_MAX_WORDS)
+		return false;
+
+	return true;
+}
+
+// \note Called with m_lock held.
+void SpirVAsmCache::indexFile (const char* filename, bool truncate)
+{
+	if (m_filename == filename)
+		return;
+
+	m_filename = filename;
+	m_fileIndex.clear();
+
+	// Truncate once per process, same as the shader cache
+	if (truncate && m_truncatedFiles.insert(m_filename).second)
+	{
+		FILE* const file = fopen(filename, "wb");
+
+		if (file)
+			fclose(file);
+
+		return;
+	}
+
+	FILE* const file = fopen(filename, "rb");
+
+	if (!file)
+		return;
+
+	fseek(file, 0, SEEK_END);
+	const long fileSize = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	for (;;)
+	{
+		const long			recordOffset	= ftell(file);
+		SpirVAsmCacheKey	key;
+		deUint32			numWords		= 0;
+
+		if (!readCacheRecordHeader(file, key, numWords))
+			break;
+
+		const long dataEnd = ftell(file) + (long)(numWords * sizeof(deUint32));
+
+		// Truncated tail, e.g. from an interrupted write.
+		if (dataEnd > fileSize || fseek(file, dataEnd, SEEK_SET) != 0)
+			break;
+
+		m_fileIndex[key] = recordOffset;
+	}
+
+	fclose(file);
+}
+
+// \note Called with m_lock held.
+bool SpirVAsmCache::readRecord (const SpirVAsmCacheKey& key, long recordOffset, vector<deUint32>& dst) const
+{
+	FILE* const			file		= fopen(m_filename.c_str(), "rb");
+	SpirVAsmCacheKey	storedKey;
+	deUint32			numWords	= 0;
+	bool				ok			= file != DE_NULL;
+
+	if (ok) ok = fseek(file, recordOffset, SEEK_SET) == 0;
+	if (ok) ok = readCacheRecordHeader(file, storedKey, numWords);
+	if (ok) ok = storedKey == key; // Guards against records appended concurrently by another process.
+
+	if (ok)
+	{
+		dst.resize(numWords);
+		ok = fread(&dst[0], sizeof(deUint32), numWords, file) == numWords;
+	}
+
+	if (file)
+		fclose(file);
+
+	return ok;
+}
+
+// \note Called with m_lock held.
+void SpirVAsmCache::memoize (const SpirVAsmCacheKey& key, const vector<deUint32>& binary)
+{
+	const size_t binarySizeBytes = binary.size() * sizeof(deUint32);
+
+	if (m_memoSizeBytes + binarySizeBytes > SPIRV_ASM_CACHE_MAX_MEMO_BYTES)
+	{
+		m_memo.clear();
+		m_memoSizeBytes = 0;
+	}
+
+	if (m_memo.insert(std::make_pair(key, binary)).second)
+		m_memoSizeBytes += binarySizeBytes;
+}
+
+bool SpirVAsmCache::load (const SpirVAsmCacheKey& key, const char* filename, bool truncate, vector<deUint32>& dst)
+{
+	const de::ScopedLock lock (m_lock);
+
+	{
+		const MemoMap::const_iterator memoPos = m_memo.find(key);
+
+		if (memoPos != m_memo.end())
+		{
+			dst = memoPos->second;
+			m_stats.numMemoryHits += 1;
+			return true;
+		}
+	}
+
+	if (filename[0] != 0)
+	{
+		indexFile(filename, truncate);
+
+		const FileIndexMap::const_iterator indexPos = m_fileIndex.find(key);
+
+		if (indexPos != m_fileIndex.end() && readRecord(key, indexPos->second, dst))
+		{
+			memoize(key, dst);
+			m_stats.numFileHits += 1;
+			return true;
+		}
+	}
+
+	m_stats.numMisses += 1;
+	return false;
+}
+
+void SpirVAsmCache::store (const SpirVAsmCacheKey& key, const char* filename, bool truncate, const vector<deUint32>& binary)
+{
+	const de::ScopedLock lock (m_lock);
+
+	DE_ASSERT(!binary.empty());
+
+	memoize(key, binary);
+
+	if (filename[0] == 0 || binary.size() > SPIRV_ASM_CACHE_MAX_WORDS)
+		return;
+
+	indexFile(filename, truncate);
+
+	// Already written, possibly by another thread assembling the same source.
+	if (m_fileIndex.find(key) != m_fileIndex.end())
+		return;
+
+	FILE* const file = fopen(filename, "ab");
+
+	if (!file)
+		return;
+
+	fseek(file, 0, SEEK_END);
+
+	{
+		const long		recordOffset	= ftell(file);
+		const deUint32	magic			= SPIRV_ASM_CACHE_RECORD_MAGIC;
+		const deUint32	numWords		= (deUint32)binary.size();
+		bool			ok				= true;
+
+		if (ok) ok = fwrite(&magic, sizeof(magic), 1, file) == 1;
+		if (ok) ok = fwrite(&key.hash, sizeof(key.hash), 1, file) == 1;
+		if (ok) ok = fwrite(&numWords, sizeof(numWords), 1, file) == 1;
+		if (ok) ok = fwrite(&binary[0], sizeof(deUint32), numWords, file) == numWords;
+
+		if (ok)
+			m_fileIndex[key] = recordOffset;
+	}
+
+	fclose(file);
+}
+
+SpirVAsmCacheStats SpirVAsmCache::getStats (void) const
+{
+	const de::ScopedLock lock (m_lock);
+	return m_stats;
+}
+
+SpirVAsmCacheKey getSpirVAsmCacheKey (const SpirVAsmSource& program, int optimizationRecipe)
+{
+	const SpirVAsmBuildOptions&	buildOptions	= program.buildOptions;
+	std::string					header;
+	deSha1Stream				stream;
+	SpirVAsmCacheKey			key;
+
+	getCompileEnvironment(header);
+	header += "Target Spir-V " + getSpirvVersionName(buildOptions.targetVersion) + "\n";
+	header += "Vulkan version " + de::toString(buildOptions.vulkanVersion) + "\n";
+	header += "VK_KHR_spirv_1_4 " + de::toString(buildOptions.supports_VK_KHR_spirv_1_4) + "\n";
+	header += "VK_KHR_maintenance4 " + de::toString(buildOptions.supports_VK_KHR_maintenance4) + "\n";
+	header += "Optimization recipe " + de::toString(optimizationRecipe) + "\n";
+	header += "Validate " + de::toString(VALIDATE_BINARIES) + "\n";
+
+	deSha1Stream_init(&stream);
+	deSha1Stream_process(&stream, header.size(), header.c_str());
+	deSha1Stream_process(&stream, program.source.size(), program.source.c_str());
+	deSha1Stream_finalize(&stream, &key.hash);
+
+	return key;
+}
+
+} // anonymous
+
+SpirVAsmCacheStats getSpirVAsmCacheStats (void)
+{
+	return SpirVAsmCache::getInstance().getStats();
+}
+
 ProgramBinary* assembleProgram (const SpirVAsmSource& program, SpirVProgramInfo* buildInfo, const tcu::CommandLine& commandLine)
 {
 	const SpirvVersion	spirvVersion		= program.buildOptions.targetVersion;
@@ -803,6 +1085,24 @@ ProgramBinary* assembleProgram (const SpirVAsmSource& program, SpirVProgramInfo*
 	std::string			cachekey;
 	const int			optimizationRecipe	= commandLine.isSpirvOptimizationEnabled() ? commandLine.getOptimizationRecipe() : 0;
 	deUint32			hash				= 0;
+	const bool			useAsmCache			= commandLine.isSpirvAsmCacheEnabled();
+	SpirVAsmCacheKey	asmCacheKey;
+
+	// \note Assembly cache is checked first, the generic shader cache is used on a miss.
+	if (useAsmCache)
+	{
+		asmCacheKey = getSpirVAsmCacheKey(program, optimizationRecipe);
+
+		if (SpirVAsmCache::getInstance().load(asmCacheKey, commandLine.getSpirvAsmCacheFilename(), commandLine.isShaderCacheTruncateEnabled(), binary))
+		{
+			buildInfo->source			= program.source;
+			buildInfo->compileOk		= true;
+			buildInfo->compileTimeUs	= 0;
+			buildInfo->infoLog			= "Loaded from SPIR-V assembly cache";
+
+			return createProgramBinaryFromSpirV(binary);
+		}
+	}
 
 	if (commandLine.isShadercacheEnabled())
 	{
@@ -851,6 +1151,11 @@ ProgramBinary* assembleProgram (const SpirVAsmSource& program, SpirVProgramInfo*
 		}
 
 		res = createProgramBinaryFromSpirV(binary);
+		if (useAsmCache)
+		{
+			SpirVAsmCache::getInstance().store(asmCacheKey, commandLine.getSpirvAsmCacheFilename(), commandLine.isShaderCacheTruncateEnabled(), binary);
+		}
+
 		if (commandLine.isShadercacheEnabled())
 		{
 			shadercacheSave(res, cachekey, commandLine.getShaderCacheFilename(), hash);
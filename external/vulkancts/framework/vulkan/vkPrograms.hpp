@@ -28,6 +28,8 @@
 #include "vkSpirVProgram.hpp"
 #include "vkShaderProgram.hpp"
 
+#include "tcuHarnessProfile.hpp"
+
 #include "deUniquePtr.hpp"
 #include "deSTLUtil.hpp"
 
@@ -186,6 +188,8 @@ bool ProgramCollection<Program, BuildOptions>::contains (const std::string& name
 template<typename Program, typename BuildOptions>
 const Program& ProgramCollection<Program, BuildOptions>::get (const std::string& name) const
 {
+	const tcu::HarnessPhaseScope phaseScope (tcu::HARNESS_PHASE_PROGRAMS);
+
 	DE_ASSERT(contains(name));
 	return *m_programs.find(name)->second;
 }
@@ -215,10 +219,25 @@ struct SourceCollections
 
 typedef ProgramCollection<ProgramBinary, BinaryBuildOptions>	BinaryCollection;
 
+struct SpirVAsmCacheStats
+{
+	deUint64	numMemoryHits;		//!< Binaries found in in-process memo.
+	deUint64	numFileHits;		//!< Binaries loaded from cache file.
+	deUint64	numMisses;			//!< Sources that had to be assembled.
+
+	SpirVAsmCacheStats (void)
+		: numMemoryHits	(0)
+		, numFileHits	(0)
+		, numMisses		(0)
+	{
+	}
+};
+
 ProgramBinary*			buildProgram		(const GlslSource& program, glu::ShaderProgramInfo* buildInfo, const tcu::CommandLine& commandLine);
 ProgramBinary*			buildProgram		(const HlslSource& program, glu::ShaderProgramInfo* buildInfo, const tcu::CommandLine& commandLine);
 ProgramBinary*			assembleProgram		(const vk::SpirVAsmSource& program, SpirVProgramInfo* buildInfo, const tcu::CommandLine& commandLine);
 void					disassembleProgram	(const ProgramBinary& program, std::ostream* dst);
+SpirVAsmCacheStats		getSpirVAsmCacheStats	(void);
 bool					validateProgram		(const ProgramBinary& program, std::ostream* dst, const SpirvValidatorOptions&);
 
 #ifdef CTS_USES_VULKANSC
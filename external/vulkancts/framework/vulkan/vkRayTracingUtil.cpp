@@ -28,13 +28,20 @@
 #include "vkObjUtil.hpp"
 #include "vkBarrierUtil.hpp"
 #include "vkCmdUtil.hpp"
+#include "vkImageUtil.hpp"
+
+#include "tcuTexture.hpp"
+#include "tcuVectorUtil.hpp"
 
 #include "deStringUtil.hpp"
 #include "deSTLUtil.hpp"
+#include "deThread.h"
 
 #include <vector>
 #include <string>
 #include <thread>
+#include <algorithm>
+#include <numeric>
 #include <limits>
 #include <type_traits>
 #include <map>
@@ -3308,6 +3315,764 @@ bool queryAccelerationStructureSize (const DeviceInterface&							vk,
 	return queryAccelerationStructureSizeKHR(vk, device, cmdBuffer, accelerationStructureHandles, buildType, queryPool, queryType, firstQuery, results);
 }
 
+struct RayTracingReferenceTracer::Impl
+{
+	struct Aabb
+	{
+		tcu::Vec3	minPos;
+		tcu::Vec3	maxPos;
+
+		Aabb (void)
+			: minPos	(std::numeric_limits<float>::infinity())
+			, maxPos	(-std::numeric_limits<float>::infinity())
+		{
+		}
+
+		void		extend		(const tcu::Vec3& pos)	{ minPos = tcu::min(minPos, pos);		maxPos = tcu::max(maxPos, pos);			}
+		void		extend		(const Aabb& other)		{ minPos = tcu::min(minPos, other.minPos);	maxPos = tcu::max(maxPos, other.maxPos);	}
+		tcu::Vec3	getCenter	(void) const			{ return (minPos + maxPos) * 0.5f; }
+	};
+
+	// Leaves reference count items starting from first. Inner nodes have zero count and their children at first and first + 1.
+	struct BvhNode
+	{
+		Aabb		bounds;
+		deUint32	first;
+		deUint32	count;
+	};
+
+	struct Bvh
+	{
+		std::vector<BvhNode>	nodes;
+		std::vector<deUint32>	items;
+	};
+
+	struct Primitive
+	{
+		tcu::Vec3	vertices[3];	// Triangle vertices, or AABB minimum and maximum in the first two.
+		deUint32	geometryIndex;
+		deUint32	primitiveIndex;
+		bool		triangle;
+		bool		opaque;
+	};
+
+	struct Blas
+	{
+		std::vector<Primitive>	primitives;
+		Bvh						bvh;
+	};
+
+	struct Instance
+	{
+		const Blas*			blas;
+		double				worldToObject[3][4];
+		Aabb				worldBounds;
+		deUint32			instanceCustomIndex;
+		deUint32			mask;
+		deUint32			flags;
+	};
+
+	// Ray in the space of the structure being traversed, with values precomputed for slab tests and watertight triangle
+	// intersection (Woop et al. 2013).
+	struct TraversalRay
+	{
+		tcu::Vec3	origin;
+		tcu::Vec3	direction;
+		tcu::Vec3	invDirection;
+		int			kx;
+		int			ky;
+		int			kz;
+		float		sx;
+		float		sy;
+		float		sz;
+
+		TraversalRay (const tcu::Vec3& origin_, const tcu::Vec3& direction_);
+	};
+
+	struct Candidate
+	{
+		bool		hit;			// False for misses within tolerance.
+		bool		nearEdge;
+		float		t;
+		tcu::Vec2	barycentrics;
+	};
+
+	struct TraversalState
+	{
+		ReferenceHit	closest;
+		bool			closestUncertain;
+		float			competingT;		// Closest other hit.
+		float			uncertainT;		// Closest candidate whose hit or miss status depends on rounding.
+	};
+
+	std::vector<de::SharedPtr<Blas>>	blases;
+	std::vector<Instance>				instances;
+	Bvh									topLevelBvh;
+	float								tolerance;
+
+						Impl					(const TopLevelAccelerationStructure& topLevelAccelerationStructure, float tolerance_);
+
+	float				getBand					(float t) const { return tolerance * de::max(1.0f, de::abs(t)); }
+
+	ReferenceHit		traceRay				(const ReferenceRay& ray) const;
+	void				traverseBlas			(const Instance& instance, deUint32 instanceIndex, const ReferenceRay& ray, TraversalState& state) const;
+	void				addCandidate			(const Candidate& candidate, const ReferenceRay& ray, TraversalState& state, const ReferenceHit& hit) const;
+
+	static void			buildBvh				(Bvh& bvh, const std::vector<Aabb>& itemBounds);
+	static void			readGeometry			(Blas& blas, const RaytracedGeometryBase& geometry, deUint32 geometryIndex);
+	static bool			intersectSlabs			(const Aabb& box, const TraversalRay& ray, float& tEnter, float& tExit);
+	bool				intersectNode			(const Aabb& box, const TraversalRay& ray, float tMin, float tMax, float& tEnter) const;
+
+	template<typename LeafFunc>
+	void				traverseBvh				(const Bvh& bvh, const TraversalRay& traversalRay, const ReferenceRay& ray, const TraversalState& state, LeafFunc leafFunc) const;
+	Candidate			intersectTriangle		(const Primitive& primitive, const TraversalRay& ray) const;
+};
+
+RayTracingReferenceTracer::Impl::TraversalRay::TraversalRay (const tcu::Vec3& origin_, const tcu::Vec3& direction_)
+	: origin		(origin_)
+	, direction		(direction_)
+	, invDirection	(1.0f / direction_.x(), 1.0f / direction_.y(), 1.0f / direction_.z())
+{
+	const tcu::Vec3 absDirection = tcu::abs(direction);
+
+	kz = (absDirection.x() > absDirection.y()) ? (absDirection.x() > absDirection.z() ? 0 : 2) : (absDirection.y() > absDirection.z() ? 1 : 2);
+	kx = (kz + 1) % 3;
+	ky = (kx + 1) % 3;
+
+	// Keep winding of the edge functions independent of the direction.
+	if (direction[kz] < 0.0f)
+		std::swap(kx, ky);
+
+	sx = direction[kx] / direction[kz];
+	sy = direction[ky] / direction[kz];
+	sz = 1.0f / direction[kz];
+}
+
+RayTracingReferenceTracer::Impl::Impl (const TopLevelAccelerationStructure& topLevelAccelerationStructure, float tolerance_)
+	: tolerance	(tolerance_)
+{
+	const std::vector<de::SharedPtr<BottomLevelAccelerationStructure> >&	bottomLevels	= topLevelAccelerationStructure.getBottomLevelInstances();
+	const std::vector<InstanceData>&										instanceData	= topLevelAccelerationStructure.getInstanceData();
+	std::map<const BottomLevelAccelerationStructure*, const Blas*>			builtBlases;
+	std::vector<Aabb>														instanceBounds;
+
+	DE_ASSERT(bottomLevels.size() == instanceData.size());
+
+	for (size_t instanceNdx = 0; instanceNdx < bottomLevels.size(); ++instanceNdx)
+	{
+		const BottomLevelAccelerationStructure*	bottomLevel	= bottomLevels[instanceNdx].get();
+		const Blas*								blas		= DE_NULL;
+
+		if (builtBlases.find(bottomLevel) == builtBlases.end())
+		{
+			const de::SharedPtr<Blas>	newBlas		(new Blas());
+			std::vector<Aabb>			itemBounds;
+
+			for (size_t geometryNdx = 0; geometryNdx < bottomLevel->getGeometries().size(); ++geometryNdx)
+				readGeometry(*newBlas, *bottomLevel->getGeometries()[geometryNdx], static_cast<deUint32>(geometryNdx));
+
+			itemBounds.resize(newBlas->primitives.size());
+			for (size_t primitiveNdx = 0; primitiveNdx < newBlas->primitives.size(); ++primitiveNdx)
+			{
+				const Primitive& primitive = newBlas->primitives[primitiveNdx];
+
+				for (int vertexNdx = 0; vertexNdx < (primitive.triangle ? 3 : 2); ++vertexNdx)
+					itemBounds[primitiveNdx].extend(primitive.vertices[vertexNdx]);
+			}
+
+			buildBvh(newBlas->bvh, itemBounds);
+			blases.push_back(newBlas);
+			builtBlases[bottomLevel] = newBlas.get();
+		}
+
+		blas = builtBlases[bottomLevel];
+
+		if (blas->bvh.nodes.empty())
+			continue;
+
+		{
+			const VkTransformMatrixKHR&	matrix		= instanceData[instanceNdx].matrix;
+			const Aabb&					blasBounds	= blas->bvh.nodes[0].bounds;
+			Instance					instance;
+			double						inverse[3][3];
+			double						det;
+
+			instance.blas					= blas;
+			instance.instanceCustomIndex	= instanceData[instanceNdx].instanceCustomIndex;
+			instance.mask					= instanceData[instanceNdx].mask;
+			instance.flags					= instanceData[instanceNdx].flags;
+
+			// Invert the 3x4 object to world matrix: linear part by cofactors, translation by the inverted linear part.
+			for (int row = 0; row < 3; ++row)
+			for (int col = 0; col < 3; ++col)
+			{
+				const int r0 = (col + 1) % 3;
+				const int r1 = (col + 2) % 3;
+				const int c0 = (row + 1) % 3;
+				const int c1 = (row + 2) % 3;
+
+				inverse[row][col] = (double)matrix.matrix[r0][c0] * matrix.matrix[r1][c1] - (double)matrix.matrix[r0][c1] * matrix.matrix[r1][c0];
+			}
+
+			det = (double)matrix.matrix[0][0] * inverse[0][0] + (double)matrix.matrix[0][1] * inverse[1][0] + (double)matrix.matrix[0][2] * inverse[2][0];
+
+			if (det == 0.0)
+				TCU_THROW(InternalError, "Instance transform is not invertible");
+
+			for (int row = 0; row < 3; ++row)
+			{
+				for (int col = 0; col < 3; ++col)
+					instance.worldToObject[row][col] = inverse[row][col] / det;
+
+				instance.worldToObject[row][3] = 0.0;
+				for (int col = 0; col < 3; ++col)
+					instance.worldToObject[row][3] -= instance.worldToObject[row][col] * matrix.matrix[col][3];
+			}
+
+			for (int cornerNdx = 0; cornerNdx < 8; ++cornerNdx)
+			{
+				const tcu::Vec3	corner	((cornerNdx & 1) ? blasBounds.maxPos.x() : blasBounds.minPos.x(),
+										 (cornerNdx & 2) ? blasBounds.maxPos.y() : blasBounds.minPos.y(),
+										 (cornerNdx & 4) ? blasBounds.maxPos.z() : blasBounds.minPos.z());
+				tcu::Vec3		world;
+
+				for (int row = 0; row < 3; ++row)
+					world[row] = matrix.matrix[row][0] * corner.x() + matrix.matrix[row][1] * corner.y() + matrix.matrix[row][2] * corner.z() + matrix.matrix[row][3];
+
+				instance.worldBounds.extend(world);
+			}
+
+			instanceBounds.push_back(instance.worldBounds);
+			instances.push_back(instance);
+		}
+	}
+
+	buildBvh(topLevelBvh, instanceBounds);
+}
+
+void RayTracingReferenceTracer::Impl::readGeometry (Blas& blas, const RaytracedGeometryBase& geometry, deUint32 geometryIndex)
+{
+	const deUint32	primitiveCount	= geometry.getPrimitiveCount();
+	const bool		opaque			= (geometry.getGeometryFlags() & VK_GEOMETRY_OPAQUE_BIT_KHR) != 0;
+
+	if (primitiveCount == 0u)
+		return;
+
+	blas.primitives.reserve(blas.primitives.size() + primitiveCount);
+
+	if (geometry.isTrianglesType())
+	{
+		const bool					directCopy		= geometry.getVertexFormat() == VK_FORMAT_R32G32B32_SFLOAT;
+		const tcu::TextureFormat	format			= directCopy ? tcu::TextureFormat() : mapVkFormat(geometry.getVertexFormat());
+		const deUint8*				vertexPtr		= geometry.getVertexPointer();
+		const size_t				vertexStride	= static_cast<size_t>(geometry.getVertexStride());
+		const deUint8*				indexPtr		= geometry.usesIndices() ? geometry.getIndexPointer() : DE_NULL;
+
+		for (deUint32 primitiveNdx = 0; primitiveNdx < primitiveCount; ++primitiveNdx)
+		{
+			Primitive	primitive;
+			bool		inactive	= false;
+
+			for (deUint32 cornerNdx = 0; cornerNdx < 3; ++cornerNdx)
+			{
+				const deUint32	indexNdx	= 3u * primitiveNdx + cornerNdx;
+				deUint32		vertexNdx	= indexNdx;
+
+				if (geometry.getIndexType() == VK_INDEX_TYPE_UINT16)
+					vertexNdx = reinterpret_cast<const deUint16*>(indexPtr)[indexNdx];
+				else if (geometry.getIndexType() == VK_INDEX_TYPE_UINT32)
+					vertexNdx = reinterpret_cast<const deUint32*>(indexPtr)[indexNdx];
+
+				if (directCopy)
+					deMemcpy(primitive.vertices[cornerNdx].getPtr(), vertexPtr + vertexNdx * vertexStride, sizeof(tcu::Vec3));
+				else
+					primitive.vertices[cornerNdx] = tcu::ConstPixelBufferAccess(format, 1, 1, 1, vertexPtr + vertexNdx * vertexStride).getPixel(0, 0).swizzle(0, 1, 2);
+
+				// Triangles with NaN in X component of any vertex are inactive.
+				inactive = inactive || deIsNaN(primitive.vertices[cornerNdx].x());
+			}
+
+			if (inactive)
+				continue;
+
+			primitive.geometryIndex		= geometryIndex;
+			primitive.primitiveIndex	= primitiveNdx;
+			primitive.triangle			= true;
+			primitive.opaque			= opaque;
+			blas.primitives.push_back(primitive);
+		}
+	}
+	else
+	{
+		const deUint8*	aabbPtr		= geometry.getVertexPointer();
+		const size_t	aabbStride	= static_cast<size_t>(geometry.getAABBStride());
+
+		for (deUint32 primitiveNdx = 0; primitiveNdx < primitiveCount; ++primitiveNdx)
+		{
+			Primitive	primitive;
+			float		positions[6];
+
+			// VkAabbPositionsKHR
+			deMemcpy(positions, aabbPtr + primitiveNdx * aabbStride, sizeof(positions));
+
+			// AABBs with NaN minimum X are inactive.
+			if (deIsNaN(positions[0]))
+				continue;
+
+			primitive.vertices[0]		= tcu::Vec3(positions[0], positions[1], positions[2]);
+			primitive.vertices[1]		= tcu::Vec3(positions[3], positions[4], positions[5]);
+			primitive.vertices[2]		= tcu::Vec3(0.0f);
+			primitive.geometryIndex		= geometryIndex;
+			primitive.primitiveIndex	= primitiveNdx;
+			primitive.triangle			= false;
+			primitive.opaque			= opaque;
+			blas.primitives.push_back(primitive);
+		}
+	}
+}
+
+// Median split along the longest axis of item centers. Quality is lower than with SAH, but build time stays low for
+// millions of primitives and the tree depth is logarithmic.
+void RayTracingReferenceTracer::Impl::buildBvh (Bvh& bvh, const std::vector<Aabb>& itemBounds)
+{
+	const deUint32			maxLeafSize	= 4u;
+	const deUint32			itemCount	= static_cast<deUint32>(itemBounds.size());
+	std::vector<tcu::Vec3>	centers		(itemCount);
+	std::vector<deUint32>	nodeStack;
+
+	bvh.nodes.clear();
+	bvh.items.resize(itemCount);
+
+	if (itemCount == 0u)
+		return;
+
+	std::iota(bvh.items.begin(), bvh.items.end(), 0u);
+
+	for (deUint32 itemNdx = 0; itemNdx < itemCount; ++itemNdx)
+		centers[itemNdx] = itemBounds[itemNdx].getCenter();
+
+	bvh.nodes.reserve(2u * (itemCount / maxLeafSize + 1u) * 2u);
+	bvh.nodes.push_back(BvhNode());
+	bvh.nodes[0].first = 0u;
+	bvh.nodes[0].count = itemCount;
+	nodeStack.push_back(0u);
+
+	while (!nodeStack.empty())
+	{
+		const deUint32	nodeNdx		= nodeStack.back();
+		const deUint32	first		= bvh.nodes[nodeNdx].first;
+		const deUint32	count		= bvh.nodes[nodeNdx].count;
+		Aabb			bounds;
+		Aabb			centerBounds;
+
+		nodeStack.pop_back();
+
+		for (deUint32 ndx = first; ndx < first + count; ++ndx)
+		{
+			bounds.extend(itemBounds[bvh.items[ndx]]);
+			centerBounds.extend(centers[bvh.items[ndx]]);
+		}
+
+		bvh.nodes[nodeNdx].bounds = bounds;
+
+		{
+			const tcu::Vec3	extent	= centerBounds.maxPos - centerBounds.minPos;
+			const int		axis	= (extent.x() > extent.y()) ? (extent.x() > extent.z() ? 0 : 2) : (extent.y() > extent.z() ? 1 : 2);
+			const deUint32	middle	= first + count / 2u;
+
+			// Items with equal centers cannot be split.
+			if (count <= maxLeafSize || extent[axis] <= 0.0f)
+				continue;
+
+			std::nth_element(bvh.items.begin() + first, bvh.items.begin() + middle, bvh.items.begin() + first + count,
+							 [&centers, axis](deUint32 a, deUint32 b) { return centers[a][axis] < centers[b][axis]; });
+
+			{
+				const deUint32	childNdx	= static_cast<deUint32>(bvh.nodes.size());
+				BvhNode			child;
+
+				child.first = first;
+				child.count = middle - first;
+				bvh.nodes.push_back(child);
+
+				child.first = middle;
+				child.count = first + count - middle;
+				bvh.nodes.push_back(child);
+
+				bvh.nodes[nodeNdx].first = childNdx;
+				bvh.nodes[nodeNdx].count = 0u;
+
+				nodeStack.push_back(childNdx);
+				nodeStack.push_back(childNdx + 1u);
+			}
+		}
+	}
+}
+
+// Computes the interval where the line of the ray is inside the box. False if the ray is parallel to and outside of a slab,
+// otherwise the interval may still be empty.
+bool RayTracingReferenceTracer::Impl::intersectSlabs (const Aabb& box, const TraversalRay& ray, float& tEnter, float& tExit)
+{
+	tEnter	= -std::numeric_limits<float>::infinity();
+	tExit	= std::numeric_limits<float>::infinity();
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		if (ray.direction[axis] == 0.0f)
+		{
+			if (ray.origin[axis] < box.minPos[axis] || ray.origin[axis] > box.maxPos[axis])
+				return false;
+		}
+		else
+		{
+			const float t0 = (box.minPos[axis] - ray.origin[axis]) * ray.invDirection[axis];
+			const float t1 = (box.maxPos[axis] - ray.origin[axis]) * ray.invDirection[axis];
+
+			tEnter	= de::max(tEnter, de::min(t0, t1));
+			tExit	= de::min(tExit, de::max(t0, t1));
+		}
+	}
+
+	return true;
+}
+
+// Conservative node test, the exit distance is padded against rounding in the slab test.
+bool RayTracingReferenceTracer::Impl::intersectNode (const Aabb& box, const TraversalRay& ray, float tMin, float tMax, float& tEnter) const
+{
+	float tExit;
+
+	if (!intersectSlabs(box, ray, tEnter, tExit))
+		return false;
+
+	tExit += getBand(tExit) + de::abs(tExit) * 1e-6f;
+
+	return tEnter <= tExit && tEnter <= tMax && tExit >= tMin;
+}
+
+// Visits leaves front to back, skipping nodes beyond the closest hit found so far.
+template<typename LeafFunc>
+void RayTracingReferenceTracer::Impl::traverseBvh (const Bvh& bvh, const TraversalRay& traversalRay, const ReferenceRay& ray, const TraversalState& state, LeafFunc leafFunc) const
+{
+	const float					tMin		= ray.tMin - getBand(ray.tMin);
+	std::pair<deUint32, float>	stack[64];
+	int							stackSize	= 0;
+	float						tEnter;
+
+	if (bvh.nodes.empty() || !intersectNode(bvh.nodes[0].bounds, traversalRay, tMin, ray.tMax + getBand(ray.tMax), tEnter))
+		return;
+
+	stack[stackSize++] = std::make_pair(0u, tEnter);
+
+	while (stackSize > 0)
+	{
+		const std::pair<deUint32, float>	entry	= stack[--stackSize];
+		const BvhNode&						node	= bvh.nodes[entry.first];
+		const bool							prune	= state.closest.hit && (ray.flags & RAY_FLAG_TERMINATE_ON_FIRST_HIT) == 0;
+		const float							limit	= prune ? state.closest.t + getBand(state.closest.t) : ray.tMax + getBand(ray.tMax);
+		float								tEnters[2];
+		bool								isHit[2];
+
+		if (entry.second > limit)
+			continue;
+
+		if (node.count != 0u)
+		{
+			leafFunc(node);
+			continue;
+		}
+
+		isHit[0] = intersectNode(bvh.nodes[node.first].bounds, traversalRay, tMin, limit, tEnters[0]);
+		isHit[1] = intersectNode(bvh.nodes[node.first + 1u].bounds, traversalRay, tMin, limit, tEnters[1]);
+
+		DE_ASSERT(stackSize + 2 <= DE_LENGTH_OF_ARRAY(stack));
+
+		// Nearer child is pushed last to be visited first.
+		for (int order = 0; order < 2; ++order)
+		{
+			const int childNdx = ((tEnters[0] <= tEnters[1]) == (order == 0)) ? 1 : 0;
+
+			if (isHit[childNdx])
+				stack[stackSize++] = std::make_pair(node.first + static_cast<deUint32>(childNdx), tEnters[childNdx]);
+		}
+	}
+}
+
+RayTracingReferenceTracer::Impl::Candidate RayTracingReferenceTracer::Impl::intersectTriangle (const Primitive& primitive, const TraversalRay& ray) const
+{
+	const tcu::Vec3	a		= primitive.vertices[0] - ray.origin;
+	const tcu::Vec3	b		= primitive.vertices[1] - ray.origin;
+	const tcu::Vec3	c		= primitive.vertices[2] - ray.origin;
+	const float		ax		= a[ray.kx] - ray.sx * a[ray.kz];
+	const float		ay		= a[ray.ky] - ray.sy * a[ray.kz];
+	const float		bx		= b[ray.kx] - ray.sx * b[ray.kz];
+	const float		by		= b[ray.ky] - ray.sy * b[ray.kz];
+	const float		cx		= c[ray.kx] - ray.sx * c[ray.kz];
+	const float		cy		= c[ray.ky] - ray.sy * c[ray.kz];
+	float			u		= cx * by - cy * bx;
+	float			v		= ax * cy - ay * cx;
+	float			w		= bx * ay - by * ax;
+	Candidate		result;
+
+	result.hit		= false;
+	result.nearEdge	= false;
+	result.t		= 0.0f;
+
+	// Edge functions exactly zero are recomputed in double precision so that edges shared by triangles are never missed.
+	if (u == 0.0f || v == 0.0f || w == 0.0f)
+	{
+		u = static_cast<float>((double)cx * by - (double)cy * bx);
+		v = static_cast<float>((double)ax * cy - (double)ay * cx);
+		w = static_cast<float>((double)bx * ay - (double)by * ax);
+	}
+
+	{
+		const float	absSum		= de::abs(u) + de::abs(v) + de::abs(w);
+		const float	negSum		= de::max(-u, 0.0f) + de::max(-v, 0.0f) + de::max(-w, 0.0f);
+		const float	posSum		= absSum - negSum;
+		const float	det			= u + v + w;
+		const bool	inside		= negSum == 0.0f || posSum == 0.0f;
+		const float	minAbs		= de::min(de::abs(u), de::min(de::abs(v), de::abs(w)));
+
+		if (det == 0.0f)
+			return result;
+
+		// Near edge: barycentrics within tolerance from zero, or for misses, the edge functions with minority sign are.
+		result.nearEdge	= inside ? (minAbs <= tolerance * absSum) : (de::min(negSum, posSum) <= tolerance * absSum);
+
+		if (!inside && !result.nearEdge)
+			return result;
+
+		{
+			const float az	= ray.sz * a[ray.kz];
+			const float bz	= ray.sz * b[ray.kz];
+			const float cz	= ray.sz * c[ray.kz];
+
+			result.hit			= inside;
+			result.t			= (u * az + v * bz + w * cz) / det;
+			result.barycentrics	= tcu::Vec2(v / det, w / det);
+		}
+	}
+
+	return result;
+}
+
+void RayTracingReferenceTracer::Impl::addCandidate (const Candidate& candidate, const ReferenceRay& ray, TraversalState& state, const ReferenceHit& hit) const
+{
+	const float band		= getBand(candidate.t);
+	bool		uncertain	= candidate.nearEdge || !candidate.hit;
+
+	if (candidate.t < ray.tMin - band || candidate.t > ray.tMax + band)
+		return;
+
+	uncertain = uncertain || candidate.t < ray.tMin + band || candidate.t > ray.tMax - band;
+
+	if (uncertain)
+		state.uncertainT = de::min(state.uncertainT, candidate.t);
+
+	if (!candidate.hit || candidate.t < ray.tMin || candidate.t > ray.tMax)
+		return;
+
+	if (!state.closest.hit || candidate.t < state.closest.t)
+	{
+		if (state.closest.hit)
+			state.competingT = de::min(state.competingT, state.closest.t);
+
+		state.closest			= hit;
+		state.closest.hit		= true;
+		state.closest.t			= candidate.t;
+		state.closestUncertain	= uncertain;
+	}
+	else
+		state.competingT = de::min(state.competingT, candidate.t);
+}
+
+void RayTracingReferenceTracer::Impl::traverseBlas (const Instance& instance, deUint32 instanceIndex, const ReferenceRay& ray, TraversalState& state) const
+{
+	const Blas&		blas			= *instance.blas;
+	const double	(&m)[3][4]		= instance.worldToObject;
+	tcu::Vec3		objectOrigin;
+	tcu::Vec3		objectDirection;
+
+	for (int row = 0; row < 3; ++row)
+	{
+		objectOrigin[row]		= static_cast<float>(m[row][0] * ray.origin.x() + m[row][1] * ray.origin.y() + m[row][2] * ray.origin.z() + m[row][3]);
+		objectDirection[row]	= static_cast<float>(m[row][0] * ray.direction.x() + m[row][1] * ray.direction.y() + m[row][2] * ray.direction.z());
+	}
+
+	{
+		const TraversalRay	objectRay		(objectOrigin, objectDirection);
+		const bool			forceOpaque		= (instance.flags & VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR) != 0;
+		const bool			forceNoOpaque	= (instance.flags & VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR) != 0;
+		const bool			cullDisable		= (instance.flags & VK_GEOMETRY_INSTANCE_TRIANGLE_FACING_CULL_DISABLE_BIT_KHR) != 0;
+		const bool			flipFacing		= (instance.flags & VK_GEOMETRY_INSTANCE_TRIANGLE_FLIP_FACING_BIT_KHR) != 0;
+
+		traverseBvh(blas.bvh, objectRay, ray, state, [&](const BvhNode& node)
+		{
+			for (deUint32 itemNdx = node.first; itemNdx < node.first + node.count; ++itemNdx)
+			{
+				const Primitive&	primitive	= blas.primitives[blas.bvh.items[itemNdx]];
+				bool				opaque		= primitive.opaque;
+				ReferenceHit		hit;
+				Candidate			candidate;
+
+				if ((ray.flags & (primitive.triangle ? RAY_FLAG_SKIP_TRIANGLES : RAY_FLAG_SKIP_AABBS)) != 0)
+					continue;
+
+				opaque = forceOpaque ? true : forceNoOpaque ? false : opaque;
+				opaque = (ray.flags & RAY_FLAG_OPAQUE) ? true : (ray.flags & RAY_FLAG_NO_OPAQUE) ? false : opaque;
+
+				if ((ray.flags & (opaque ? RAY_FLAG_CULL_OPAQUE : RAY_FLAG_CULL_NO_OPAQUE)) != 0)
+					continue;
+
+				hit.triangle			= primitive.triangle;
+				hit.instanceIndex		= instanceIndex;
+				hit.instanceCustomIndex	= instance.instanceCustomIndex;
+				hit.geometryIndex		= primitive.geometryIndex;
+				hit.primitiveIndex		= primitive.primitiveIndex;
+
+				if (primitive.triangle)
+				{
+					const tcu::Vec3 normal = tcu::cross(primitive.vertices[1] - primitive.vertices[0], primitive.vertices[2] - primitive.vertices[0]);
+
+					candidate = intersectTriangle(primitive, objectRay);
+
+					if (!candidate.hit && !candidate.nearEdge)
+						continue;
+
+					hit.frontFace		= (tcu::dot(normal, objectDirection) < 0.0f) != flipFacing;
+					hit.barycentrics	= candidate.barycentrics;
+
+					if (!cullDisable && (ray.flags & (hit.frontFace ? RAY_FLAG_CULL_FRONT_FACING_TRIANGLES : RAY_FLAG_CULL_BACK_FACING_TRIANGLES)) != 0)
+						continue;
+				}
+				else
+				{
+					Aabb	box;
+					float	tEnter;
+					float	tExit;
+
+					box.minPos = primitive.vertices[0];
+					box.maxPos = primitive.vertices[1];
+
+					if (!intersectSlabs(box, objectRay, tEnter, tExit))
+						continue;
+
+					// Grazing edges or corners, or exiting the box close to tMin are uncertain.
+					candidate.hit		= tEnter <= tExit && tExit >= ray.tMin;
+					candidate.nearEdge	= de::abs(tExit - tEnter) <= getBand(tExit) || de::abs(tExit - ray.tMin) <= getBand(ray.tMin);
+					candidate.t			= de::max(tEnter, ray.tMin);
+
+					if (!candidate.hit && !candidate.nearEdge)
+						continue;
+				}
+
+				addCandidate(candidate, ray, state, hit);
+			}
+		});
+	}
+}
+
+ReferenceHit RayTracingReferenceTracer::Impl::traceRay (const ReferenceRay& ray) const
+{
+	TraversalState state;
+
+	state.closestUncertain	= false;
+	state.competingT		= std::numeric_limits<float>::infinity();
+	state.uncertainT		= std::numeric_limits<float>::infinity();
+
+	if (topLevelBvh.nodes.empty() || ray.direction == tcu::Vec3(0.0f))
+		return state.closest;
+
+	{
+		const TraversalRay worldRay (ray.origin, ray.direction);
+
+		traverseBvh(topLevelBvh, worldRay, ray, state, [&](const BvhNode& node)
+		{
+			for (deUint32 itemNdx = node.first; itemNdx < node.first + node.count; ++itemNdx)
+			{
+				const deUint32	instanceNdx	= topLevelBvh.items[itemNdx];
+				const Instance&	instance	= instances[instanceNdx];
+
+				if ((instance.mask & ray.cullMask) == 0u)
+					continue;
+
+				traverseBlas(instance, instanceNdx, ray, state);
+			}
+		});
+	}
+
+	if (state.closest.hit)
+	{
+		const float	maxT		= state.closest.t + getBand(state.closest.t);
+		// Traversal is not pruned with TerminateOnFirstHit, so all other candidates in the interval have been seen.
+		const bool	anyHit		= (ray.flags & RAY_FLAG_TERMINATE_ON_FIRST_HIT) != 0;
+		const bool	hasOthers	= state.competingT < std::numeric_limits<float>::infinity() || state.uncertainT < std::numeric_limits<float>::infinity();
+
+		state.closest.ambiguous = state.closestUncertain || state.competingT <= maxT || state.uncertainT <= maxT || (anyHit && hasOthers);
+	}
+	else
+		state.closest.ambiguous = state.uncertainT < std::numeric_limits<float>::infinity();
+
+	return state.closest;
+}
+
+RayTracingReferenceTracer::RayTracingReferenceTracer (const TopLevelAccelerationStructure& topLevelAccelerationStructure, float tolerance)
+	: m_impl	(new Impl(topLevelAccelerationStructure, tolerance))
+{
+}
+
+RayTracingReferenceTracer::~RayTracingReferenceTracer (void)
+{
+	delete m_impl;
+}
+
+float RayTracingReferenceTracer::getTolerance (void) const
+{
+	return m_impl->tolerance;
+}
+
+ReferenceHit RayTracingReferenceTracer::traceRay (const ReferenceRay& ray) const
+{
+	return m_impl->traceRay(ray);
+}
+
+std::vector<ReferenceHit> RayTracingReferenceTracer::traceRays (const std::vector<ReferenceRay>& rays, deUint32 threadCount) const
+{
+	const size_t				numThreads	= de::min<size_t>(threadCount != 0u ? threadCount : de::max(deGetNumAvailableLogicalCores(), 1u), rays.size());
+	std::vector<ReferenceHit>	hits		(rays.size());
+	std::vector<std::thread>	threads;
+	const Impl&					impl		= *m_impl;
+
+	if (numThreads <= 1u)
+	{
+		for (size_t rayNdx = 0; rayNdx < rays.size(); ++rayNdx)
+			hits[rayNdx] = impl.traceRay(rays[rayNdx]);
+
+		return hits;
+	}
+
+	// Contiguous batches, each thread writes only its own range of results.
+	{
+		const size_t batchSize = (rays.size() + numThreads - 1u) / numThreads;
+
+		for (size_t batchStart = 0; batchStart < rays.size(); batchStart += batchSize)
+		{
+			const size_t batchEnd = de::min(batchStart + batchSize, rays.size());
+
+			threads.push_back(std::thread([&impl, &rays, &hits, batchStart, batchEnd]()
+			{
+				for (size_t rayNdx = batchStart; rayNdx < batchEnd; ++rayNdx)
+					hits[rayNdx] = impl.traceRay(rays[rayNdx]);
+			}));
+		}
+
+		for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+			threads[threadNdx].join();
+	}
+
+	return hits;
+}
+
 RayTracingPipeline::RayTracingPipeline ()
 	: m_shadersModules			()
 	, m_pipelineLibraries		()
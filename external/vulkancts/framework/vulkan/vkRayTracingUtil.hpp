@@ -637,6 +637,8 @@ public:
 																								 VkDeviceAddress								deviceAddress			= 0u);
 
 	virtual const VkAccelerationStructureKHR*			getPtr									(void) const = DE_NULL;
+
+	const std::vector<de::SharedPtr<RaytracedGeometryBase>>&	getGeometries						(void) const { return m_geometriesData; }
 protected:
 	std::vector<de::SharedPtr<RaytracedGeometryBase>>	m_geometriesData;
 	VkDeviceSize										m_structureSize;
@@ -845,6 +847,9 @@ public:
 																										 size_t										instanceIndex,
 																										 const VkTransformMatrixKHR&				matrix) = 0;
 
+	const std::vector<de::SharedPtr<BottomLevelAccelerationStructure> >&	getBottomLevelInstances		(void) const { return m_bottomLevelInstances; }
+	const std::vector<InstanceData>&								getInstanceData						(void) const { return m_instanceData; }
+
 protected:
 	std::vector<de::SharedPtr<BottomLevelAccelerationStructure> >	m_bottomLevelInstances;
 	std::vector<InstanceData>										m_instanceData;
@@ -875,6 +880,104 @@ bool queryAccelerationStructureSize (const DeviceInterface&							vk,
 									 deUint32										firstQuery,
 									 std::vector<VkDeviceSize>&						results);
 
+// Ray traced by RayTracingReferenceTracer. Flags use the SPIR-V RayFlags values.
+struct ReferenceRay
+{
+	tcu::Vec3	origin;
+	float		tMin;
+	tcu::Vec3	direction;
+	float		tMax;
+	deUint32	flags;
+	deUint32	cullMask;
+
+	ReferenceRay (const tcu::Vec3& origin_, float tMin_, const tcu::Vec3& direction_, float tMax_, deUint32 flags_ = 0u, deUint32 cullMask_ = 0xFFu)
+		: origin(origin_), tMin(tMin_), direction(direction_), tMax(tMax_), flags(flags_), cullMask(cullMask_)
+	{
+	}
+};
+
+// Closest hit found by RayTracingReferenceTracer.
+struct ReferenceHit
+{
+	bool		hit;
+	bool		triangle;				// Triangle or AABB hit.
+	bool		frontFace;
+	bool		ambiguous;				// Implementations may legitimately return a different result, see RayTracingReferenceTracer.
+	float		t;
+	tcu::Vec2	barycentrics;			// Barycentrics of the second and third vertex, as in gl_HitAttributeEXT.
+	deUint32	instanceIndex;
+	deUint32	instanceCustomIndex;
+	deUint32	geometryIndex;
+	deUint32	primitiveIndex;
+
+	ReferenceHit (void)
+		: hit(false), triangle(false), frontFace(false), ambiguous(false), t(0.0f), barycentrics(0.0f), instanceIndex(0u), instanceCustomIndex(0u), geometryIndex(0u), primitiveIndex(0u)
+	{
+	}
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief CPU reference for ray traversal
+ *
+ * Builds BVHs from geometry data of a top level acceleration structure and
+ * its bottom level instances, and finds the closest hit of rays with
+ * watertight ray/triangle intersection and slab test for AABBs. Bottom
+ * level structures shared between instances are built once.
+ *
+ * All intersections are treated as committed, as if any hit shaders
+ * accepted them or ray queries confirmed all candidates. AABBs are hit at
+ * the point where the ray enters the box, clamped to tMin. Instance mask,
+ * geometry and instance opacity and facing flags, and the culling and
+ * opacity ray flags are respected. With TerminateOnFirstHit any hit in
+ * the ray interval may be returned; the closest one is reported, and it
+ * is flagged ambiguous if there are other candidates.
+ *
+ * A hit is flagged ambiguous when the result depends on rounding: the
+ * closest hit lies within the tolerance of a primitive edge, of tMin or
+ * tMax, or of another candidate, or a primitive missed within the
+ * tolerance could become the closest hit. Tolerance is relative to
+ * barycentrics and to the hit distance. Misses are ambiguous when such a
+ * near miss exists. Tests should only check exact results for
+ * unambiguous rays.
+ *
+ * Geometry must not be changed while the tracer is in use. Tracing is
+ * thread safe.
+ *//*--------------------------------------------------------------------*/
+class RayTracingReferenceTracer
+{
+public:
+	enum RayFlagBits
+	{
+		RAY_FLAG_OPAQUE							= 0x001,
+		RAY_FLAG_NO_OPAQUE						= 0x002,
+		RAY_FLAG_TERMINATE_ON_FIRST_HIT			= 0x004,
+		RAY_FLAG_SKIP_CLOSEST_HIT_SHADER		= 0x008,
+		RAY_FLAG_CULL_BACK_FACING_TRIANGLES		= 0x010,
+		RAY_FLAG_CULL_FRONT_FACING_TRIANGLES	= 0x020,
+		RAY_FLAG_CULL_OPAQUE					= 0x040,
+		RAY_FLAG_CULL_NO_OPAQUE					= 0x080,
+		RAY_FLAG_SKIP_TRIANGLES					= 0x100,
+		RAY_FLAG_SKIP_AABBS						= 0x200,
+	};
+
+	explicit					RayTracingReferenceTracer	(const TopLevelAccelerationStructure& topLevelAccelerationStructure, float tolerance = 1e-5f);
+								RayTracingReferenceTracer	(const RayTracingReferenceTracer& other) = delete;
+								~RayTracingReferenceTracer	(void);
+
+	RayTracingReferenceTracer&	operator=					(const RayTracingReferenceTracer& other) = delete;
+
+	float						getTolerance				(void) const;
+
+	ReferenceHit				traceRay					(const ReferenceRay& ray) const;
+
+	// Traces rays in batches on threadCount threads. Zero uses all available cores.
+	std::vector<ReferenceHit>	traceRays					(const std::vector<ReferenceRay>& rays, deUint32 threadCount = 0u) const;
+
+private:
+	struct Impl;
+	Impl*						m_impl;
+};
+
 class RayTracingPipeline
 {
 public:
@@ -27,6 +27,8 @@
 #include "deUniquePtr.hpp"
 #include "deStringUtil.hpp"
 #include "deSTLUtil.hpp"
+#include "deSharedPtr.hpp"
+#include "deThread.hpp"
 
 #include "vktTestCaseUtil.hpp"
 #include "vkPrograms.hpp"
@@ -47,6 +49,8 @@
 #include "tcuVectorType.hpp"
 #include "tcuStringTemplate.hpp"
 
+#include <algorithm>
+
 namespace vkt
 {
 namespace image
@@ -78,7 +82,8 @@ using tcu::TestContext;
 
 enum
 {
-	NUM_INVOCATIONS_PER_PIXEL = 5u
+	NUM_INVOCATIONS_PER_PIXEL					= 5u,	//!< Default number of atomic invocations operating on each pixel.
+	MAX_INTERM_VALUES_VERIFY_THREADS			= 16u
 };
 
 enum AtomicOperation
@@ -808,7 +813,8 @@ public:
 																 const bool					useTransfer,
 																 const ShaderReadType		shaderReadType,
 																 const ImageBackingType		backingType,
-																 const glu::GLSLVersion		glslVersion);
+																 const glu::GLSLVersion		glslVersion,
+																 const deUint32				numInvocationsPerPixel = NUM_INVOCATIONS_PER_PIXEL);
 
 	void						initPrograms					(SourceCollections&			sourceCollections) const;
 	TestInstance*				createInstance					(Context&					context) const;
@@ -824,6 +830,7 @@ private:
 	const ShaderReadType		m_readType;
 	const ImageBackingType		m_backingType;
 	const glu::GLSLVersion		m_glslVersion;
+	const deUint32				m_numInvocationsPerPixel;
 };
 
 BinaryAtomicIntermValuesCase::BinaryAtomicIntermValuesCase (TestContext&			testCtx,
@@ -837,17 +844,19 @@ BinaryAtomicIntermValuesCase::BinaryAtomicIntermValuesCase (TestContext&			testC
 															const bool				useTransfer,
 															const ShaderReadType	shaderReadType,
 															const ImageBackingType	backingType,
-															const glu::GLSLVersion	glslVersion)
-	: TestCase		(testCtx, name, description)
-	, m_imageType	(imageType)
-	, m_imageSize	(imageSize)
-	, m_format		(format)
-	, m_tiling		(tiling)
-	, m_operation	(operation)
-	, m_useTransfer	(useTransfer)
-	, m_readType	(shaderReadType)
-	, m_backingType	(backingType)
-	, m_glslVersion	(glslVersion)
+															const glu::GLSLVersion	glslVersion,
+															const deUint32			numInvocationsPerPixel)
+	: TestCase					(testCtx, name, description)
+	, m_imageType				(imageType)
+	, m_imageSize				(imageSize)
+	, m_format					(format)
+	, m_tiling					(tiling)
+	, m_operation				(operation)
+	, m_useTransfer				(useTransfer)
+	, m_readType				(shaderReadType)
+	, m_backingType				(backingType)
+	, m_glslVersion				(glslVersion)
+	, m_numInvocationsPerPixel	(numInvocationsPerPixel)
 {
 }
 
@@ -888,7 +897,7 @@ void BinaryAtomicIntermValuesCase::initPrograms (SourceCollections& sourceCollec
 		const string	invocationCoord			= getCoordStr(m_imageType, "gx", "gy", "gz");
 		const string	atomicArgExpr			= type + getAtomicFuncArgumentShaderStr(m_operation,
 																						"gx", "gy", "gz",
-																						IVec3(NUM_INVOCATIONS_PER_PIXEL*gridSize.x(), gridSize.y(), gridSize.z()));
+																						IVec3(m_numInvocationsPerPixel*gridSize.x(), gridSize.y(), gridSize.z()));
 
 		const string	compareExchangeStr		= (m_operation == ATOMIC_OPERATION_COMPARE_EXCHANGE) ?
 												  (componentWidth == 64 ? ", 820338753304" : ", 18") + string(uintFormat ? "u" : "") + string(componentWidth == 64 ? "l" : "") :
@@ -940,7 +949,8 @@ public:
 														  const AtomicOperation			operation,
 														  const bool					useTransfer,
 														  const ShaderReadType			shaderReadType,
-														  const ImageBackingType		backingType);
+														  const ImageBackingType		backingType,
+														  const deUint32				numInvocationsPerPixel);
 
 	tcu::TestStatus				iterate					 (void);
 
@@ -988,6 +998,7 @@ protected:
 	const bool						m_useTransfer;
 	const ShaderReadType			m_readType;
 	const ImageBackingType			m_backingType;
+	const deUint32					m_numInvocationsPerPixel;
 
 	de::MovePtr<BufferWithMemory>	m_inputBuffer;
 	de::MovePtr<BufferWithMemory>	m_outputBuffer;
@@ -1015,17 +1026,19 @@ BinaryAtomicInstanceBase::BinaryAtomicInstanceBase (Context&				context,
 													const AtomicOperation	operation,
 													const bool				useTransfer,
 													const ShaderReadType	shaderReadType,
-													const ImageBackingType	backingType)
-	: vkt::TestInstance	(context)
-	, m_name			(name)
-	, m_imageType		(imageType)
-	, m_imageSize		(imageSize)
-	, m_format			(format)
-	, m_tiling			(tiling)
-	, m_operation		(operation)
-	, m_useTransfer		(useTransfer)
-	, m_readType		(shaderReadType)
-	, m_backingType		(backingType)
+													const ImageBackingType	backingType,
+													const deUint32			numInvocationsPerPixel)
+	: vkt::TestInstance			(context)
+	, m_name					(name)
+	, m_imageType				(imageType)
+	, m_imageSize				(imageSize)
+	, m_format					(format)
+	, m_tiling					(tiling)
+	, m_operation				(operation)
+	, m_useTransfer				(useTransfer)
+	, m_readType				(shaderReadType)
+	, m_backingType				(backingType)
+	, m_numInvocationsPerPixel	(numInvocationsPerPixel)
 {
 }
 
@@ -1163,7 +1176,7 @@ tcu::TestStatus	BinaryAtomicInstanceBase::iterate (void)
 	deviceInterface.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, *pipeline);
 	deviceInterface.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, *pipelineLayout, 0u, 1u, &m_descriptorSet.get(), 0u, DE_NULL);
 
-	deviceInterface.cmdDispatch(*cmdBuffer, NUM_INVOCATIONS_PER_PIXEL * gridSize.x(), gridSize.y(), gridSize.z());
+	deviceInterface.cmdDispatch(*cmdBuffer, m_numInvocationsPerPixel * gridSize.x(), gridSize.y(), gridSize.z());
 
 	commandsAfterCompute(*cmdBuffer,
 						 *pipelineReadImage,
@@ -1345,7 +1358,7 @@ public:
 														const bool					useTransfer,
 														const ShaderReadType		shaderReadType,
 														const ImageBackingType		backingType)
-							: BinaryAtomicInstanceBase(context, name, imageType, imageSize, format, tiling, operation, useTransfer, shaderReadType, backingType) {}
+							: BinaryAtomicInstanceBase(context, name, imageType, imageSize, format, tiling, operation, useTransfer, shaderReadType, backingType, NUM_INVOCATIONS_PER_PIXEL) {}
 
 	virtual deUint32	getOutputBufferSize			   (void) const;
 
@@ -1627,8 +1640,9 @@ public:
 															const AtomicOperation	operation,
 															const bool				useTransfer,
 															const ShaderReadType	shaderReadType,
-															const ImageBackingType	backingType)
-							: BinaryAtomicInstanceBase(context, name, imageType, imageSize, format, tiling, operation, useTransfer, shaderReadType, backingType) {}
+															const ImageBackingType	backingType,
+															const deUint32			numInvocationsPerPixel)
+							: BinaryAtomicInstanceBase(context, name, imageType, imageSize, format, tiling, operation, useTransfer, shaderReadType, backingType, numInvocationsPerPixel) {}
 
 	virtual deUint32	getOutputBufferSize				   (void) const;
 
@@ -1646,10 +1660,15 @@ public:
 	virtual bool		verifyResult					   (Allocation&				outputBufferAllocation,
 															const bool				is64Bit) const;
 
+	bool				verifyRows						   (const tcu::ConstPixelBufferAccess& resultBuffer,
+															const bool				is64Bit,
+															const deInt32			firstRow,
+															const deInt32			rowStride) const;
+
 protected:
 
 	template <typename T>
-	bool				areValuesCorrect				   (tcu::ConstPixelBufferAccess& resultBuffer,
+	bool				areValuesCorrect				   (const tcu::ConstPixelBufferAccess& resultBuffer,
 															const bool isFloatingPoint,
 															deInt32 x,
 															deInt32 y,
@@ -1657,27 +1676,21 @@ protected:
 															const UVec3& gridSize,
 															const IVec3 extendedGridSize) const;
 
-	template <typename T>
-	bool				verifyRecursive					   (const deInt32			index,
-															const T					valueSoFar,
-															bool					argsUsed[NUM_INVOCATIONS_PER_PIXEL],
-															const T					atomicArgs[NUM_INVOCATIONS_PER_PIXEL],
-															const T					resultValues[NUM_INVOCATIONS_PER_PIXEL]) const;
 	de::MovePtr<Image>	m_intermResultsImage;
 	Move<VkImageView>	m_intermResultsImageView;
 };
 
 deUint32 BinaryAtomicIntermValuesInstance::getOutputBufferSize (void) const
 {
-	return NUM_INVOCATIONS_PER_PIXEL * tcu::getPixelSize(m_format) * getNumPixels(m_imageType, m_imageSize);
+	return m_numInvocationsPerPixel * tcu::getPixelSize(m_format) * getNumPixels(m_imageType, m_imageSize);
 }
 
 void BinaryAtomicIntermValuesInstance::prepareResources (const bool useTransfer)
 {
 	const UVec3 layerSize			= getLayerSize(m_imageType, m_imageSize);
 	const bool  isCubeBasedImage	= (m_imageType == IMAGE_TYPE_CUBE || m_imageType == IMAGE_TYPE_CUBE_ARRAY);
-	const UVec3 extendedLayerSize	= isCubeBasedImage	? UVec3(NUM_INVOCATIONS_PER_PIXEL * layerSize.x(), NUM_INVOCATIONS_PER_PIXEL * layerSize.y(), layerSize.z())
-														: UVec3(NUM_INVOCATIONS_PER_PIXEL * layerSize.x(), layerSize.y(), layerSize.z());
+	const UVec3 extendedLayerSize	= isCubeBasedImage	? UVec3(m_numInvocationsPerPixel * layerSize.x(), m_numInvocationsPerPixel * layerSize.y(), layerSize.z())
+														: UVec3(m_numInvocationsPerPixel * layerSize.x(), layerSize.y(), layerSize.z());
 
 	createImageAndView(mapTextureFormat(m_format), extendedLayerSize, useTransfer, m_intermResultsImage, m_intermResultsImageView);
 }
@@ -1769,7 +1782,7 @@ void BinaryAtomicIntermValuesInstance::commandsAfterCompute (const VkCommandBuff
 
 		deviceInterface.cmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, DE_FALSE, 0u, DE_NULL, 0u, DE_NULL, 1u, &imagePostDispatchBarrier);
 
-		const UVec3					extendedLayerSize		= UVec3(NUM_INVOCATIONS_PER_PIXEL * layerSize.x(), layerSize.y(), layerSize.z());
+		const UVec3					extendedLayerSize		= UVec3(m_numInvocationsPerPixel * layerSize.x(), layerSize.y(), layerSize.z());
 		const VkBufferImageCopy		bufferImageCopyParams	= makeBufferImageCopy(makeExtent3D(extendedLayerSize), getNumLayers(m_imageType, m_imageSize));
 
 		deviceInterface.cmdCopyImageToBuffer(cmdBuffer, m_intermResultsImage->get(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m_outputBuffer->get(), 1u, &bufferImageCopyParams);
@@ -1805,32 +1818,193 @@ void BinaryAtomicIntermValuesInstance::commandsAfterCompute (const VkCommandBuff
 		switch (m_imageType)
 		{
 			case IMAGE_TYPE_1D_ARRAY:
-				deviceInterface.cmdDispatch(cmdBuffer, NUM_INVOCATIONS_PER_PIXEL * layerSize.x(), subresourceRange.layerCount, layerSize.z());
+				deviceInterface.cmdDispatch(cmdBuffer, m_numInvocationsPerPixel * layerSize.x(), subresourceRange.layerCount, layerSize.z());
 				break;
 			case IMAGE_TYPE_2D_ARRAY:
 			case IMAGE_TYPE_CUBE:
 			case IMAGE_TYPE_CUBE_ARRAY:
-				deviceInterface.cmdDispatch(cmdBuffer, NUM_INVOCATIONS_PER_PIXEL * layerSize.x(), layerSize.y(), subresourceRange.layerCount);
+				deviceInterface.cmdDispatch(cmdBuffer, m_numInvocationsPerPixel * layerSize.x(), layerSize.y(), subresourceRange.layerCount);
 				break;
 			default:
-				deviceInterface.cmdDispatch(cmdBuffer, NUM_INVOCATIONS_PER_PIXEL * layerSize.x(), layerSize.y(), layerSize.z());
+				deviceInterface.cmdDispatch(cmdBuffer, m_numInvocationsPerPixel * layerSize.x(), layerSize.y(), layerSize.z());
 				break;
 		}
 	}
 }
 
+//! Checks that the values returned by the atomic operations on one pixel form a valid sequence.
+//!
+//! Invocation i moves the pixel from resultValues[i] to op(resultValues[i], atomicArgs[i]). Taking these as edges of a
+//! directed multigraph over pixel values, a valid ordering of the invocations is exactly an Eulerian trail starting from
+//! the initial value. Its existence is decided from degree balance and connectivity, so the check is O(n log n) for any
+//! operation instead of trying every ordering.
+template <typename T>
+static bool isValidAtomicSequence (const AtomicOperation op, const T initialValue, const vector<T>& resultValues, const vector<T>& atomicArgs)
+{
+	const size_t	numEdges	= resultValues.size();
+	vector<T>		nodes;
+	vector<T>		edgeEnds	(numEdges);
+
+	DE_ASSERT(atomicArgs.size() == numEdges);
+
+	nodes.reserve(2 * numEdges + 1);
+	nodes.push_back(initialValue);
+
+	for (size_t edgeNdx = 0; edgeNdx < numEdges; edgeNdx++)
+	{
+		edgeEnds[edgeNdx] = computeBinaryAtomicOperationResult(op, resultValues[edgeNdx], atomicArgs[edgeNdx]);
+		nodes.push_back(resultValues[edgeNdx]);
+		nodes.push_back(edgeEnds[edgeNdx]);
+	}
+
+	std::sort(nodes.begin(), nodes.end());
+	nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+
+	const int		numNodes	= (int)nodes.size();
+	const int		startNode	= (int)(std::lower_bound(nodes.begin(), nodes.end(), initialValue) - nodes.begin());
+	vector<int>		balance		(numNodes, 0);	// out-degree minus in-degree
+	vector<int>		component	(numNodes);
+	vector<int>		edgeStarts	(numEdges);
+
+	for (int nodeNdx = 0; nodeNdx < numNodes; nodeNdx++)
+		component[nodeNdx] = nodeNdx;
+
+	for (size_t edgeNdx = 0; edgeNdx < numEdges; edgeNdx++)
+	{
+		const int	from	= (int)(std::lower_bound(nodes.begin(), nodes.end(), resultValues[edgeNdx]) - nodes.begin());
+		const int	to		= (int)(std::lower_bound(nodes.begin(), nodes.end(), edgeEnds[edgeNdx]) - nodes.begin());
+		int			rootA	= from;
+		int			rootB	= to;
+
+		while (component[rootA] != rootA) rootA = component[rootA] = component[component[rootA]];
+		while (component[rootB] != rootB) rootB = component[rootB] = component[component[rootB]];
+		component[rootA] = rootB;
+
+		balance[from]		+= 1;
+		balance[to]			-= 1;
+		edgeStarts[edgeNdx]	 = from;
+	}
+
+	// Trail must start at the initial value, and may end anywhere.
+	{
+		int numEnds = 0;
+
+		for (int nodeNdx = 0; nodeNdx < numNodes; nodeNdx++)
+		{
+			if (nodeNdx == startNode)
+			{
+				if (balance[nodeNdx] != 0 && balance[nodeNdx] != 1)
+					return false;
+			}
+			else if (balance[nodeNdx] == -1)
+				numEnds += 1;
+			else if (balance[nodeNdx] != 0)
+				return false;
+		}
+
+		if (numEnds != balance[startNode])
+			return false;
+	}
+
+	// All edges must be reachable from the initial value.
+	{
+		int startRoot = startNode;
+
+		while (component[startRoot] != startRoot)
+			startRoot = component[startRoot];
+
+		for (size_t edgeNdx = 0; edgeNdx < numEdges; edgeNdx++)
+		{
+			int root = edgeStarts[edgeNdx];
+
+			while (component[root] != root)
+				root = component[root];
+
+			if (root != startRoot)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+class IntermValuesVerifyThread : public de::Thread
+{
+public:
+							IntermValuesVerifyThread	(const BinaryAtomicIntermValuesInstance&	instance,
+														 const tcu::ConstPixelBufferAccess&			resultBuffer,
+														 const bool									is64Bit,
+														 const deInt32								firstRow,
+														 const deInt32								rowStride)
+								: m_instance		(instance)
+								, m_resultBuffer	(resultBuffer)
+								, m_is64Bit			(is64Bit)
+								, m_firstRow		(firstRow)
+								, m_rowStride		(rowStride)
+								, m_result			(false)
+							{
+							}
+
+	void					run							(void)			{ m_result = m_instance.verifyRows(m_resultBuffer, m_is64Bit, m_firstRow, m_rowStride); }
+	bool					getResult					(void) const	{ return m_result; }
+
+private:
+	const BinaryAtomicIntermValuesInstance&	m_instance;
+	const tcu::ConstPixelBufferAccess		m_resultBuffer;
+	const bool								m_is64Bit;
+	const deInt32							m_firstRow;
+	const deInt32							m_rowStride;
+	bool									m_result;
+};
+
 bool BinaryAtomicIntermValuesInstance::verifyResult (Allocation&	outputBufferAllocation,
 													 const bool		is64Bit) const
 {
 	const UVec3	gridSize		 = getShaderGridSize(m_imageType, m_imageSize);
-	const IVec3 extendedGridSize = IVec3(NUM_INVOCATIONS_PER_PIXEL*gridSize.x(), gridSize.y(), gridSize.z());
+	const IVec3 extendedGridSize = IVec3(m_numInvocationsPerPixel*gridSize.x(), gridSize.y(), gridSize.z());
 
 	tcu::ConstPixelBufferAccess resultBuffer(m_format, extendedGridSize.x(), extendedGridSize.y(), extendedGridSize.z(), outputBufferAllocation.getHostPtr());
 
-	for (deInt32 z = 0; z < resultBuffer.getDepth(); z++)
-	for (deInt32 y = 0; y < resultBuffer.getHeight(); y++)
+	// Rows of pixels are verified in parallel; each thread takes every numThreads'th row.
+	const deInt32	numRows		= resultBuffer.getHeight() * resultBuffer.getDepth();
+	const deInt32	numThreads	= de::clamp(de::min((deInt32)deGetNumAvailableLogicalCores(), numRows), 1, (deInt32)MAX_INTERM_VALUES_VERIFY_THREADS);
+
+	if (numThreads == 1)
+		return verifyRows(resultBuffer, is64Bit, 0, 1);
+
+	vector<de::SharedPtr<IntermValuesVerifyThread> >	threads;
+	bool												allOk	= true;
+
+	for (deInt32 threadNdx = 0; threadNdx < numThreads; threadNdx++)
+	{
+		threads.push_back(de::SharedPtr<IntermValuesVerifyThread>(new IntermValuesVerifyThread(*this, resultBuffer, is64Bit, threadNdx, numThreads)));
+		threads.back()->start();
+	}
+
+	for (deInt32 threadNdx = 0; threadNdx < numThreads; threadNdx++)
+	{
+		threads[threadNdx]->join();
+		allOk = allOk && threads[threadNdx]->getResult();
+	}
+
+	return allOk;
+}
+
+bool BinaryAtomicIntermValuesInstance::verifyRows (const tcu::ConstPixelBufferAccess&	resultBuffer,
+												   const bool							is64Bit,
+												   const deInt32						firstRow,
+												   const deInt32						rowStride) const
+{
+	const UVec3	gridSize		 = getShaderGridSize(m_imageType, m_imageSize);
+	const IVec3 extendedGridSize = IVec3(m_numInvocationsPerPixel*gridSize.x(), gridSize.y(), gridSize.z());
+	const int	numRows			 = resultBuffer.getHeight() * resultBuffer.getDepth();
+
+	for (deInt32 row = firstRow; row < numRows; row += rowStride)
 	for (deUint32 x = 0; x < gridSize.x(); x++)
 	{
+		const deInt32 y = row % resultBuffer.getHeight();
+		const deInt32 z = row / resultBuffer.getHeight();
+
 		if (isUintFormat(mapTextureFormat(m_format)))
 		{
 			if (is64Bit)
@@ -1869,16 +2043,15 @@ bool BinaryAtomicIntermValuesInstance::verifyResult (Allocation&	outputBufferAll
 }
 
 template <typename T>
-bool BinaryAtomicIntermValuesInstance::areValuesCorrect(tcu::ConstPixelBufferAccess& resultBuffer, const bool isFloatingPoint, deInt32 x, deInt32 y, deInt32 z, const UVec3& gridSize, const IVec3 extendedGridSize) const
+bool BinaryAtomicIntermValuesInstance::areValuesCorrect(const tcu::ConstPixelBufferAccess& resultBuffer, const bool isFloatingPoint, deInt32 x, deInt32 y, deInt32 z, const UVec3& gridSize, const IVec3 extendedGridSize) const
 {
-	T		resultValues[NUM_INVOCATIONS_PER_PIXEL];
-	T		atomicArgs[NUM_INVOCATIONS_PER_PIXEL];
-	bool	argsUsed[NUM_INVOCATIONS_PER_PIXEL];
+	vector<T>	resultValues	(m_numInvocationsPerPixel);
+	vector<T>	atomicArgs		(m_numInvocationsPerPixel);
 
-	for (deInt32 i = 0; i < static_cast<deInt32>(NUM_INVOCATIONS_PER_PIXEL); i++)
+	for (deInt32 i = 0; i < static_cast<deInt32>(m_numInvocationsPerPixel); i++)
 	{
 		IVec3 gid(x + i*gridSize.x(), y, z);
-		T data = *((T*)resultBuffer.getPixelPtr(gid.x(), gid.y(), gid.z()));
+		T data = *((const T*)resultBuffer.getPixelPtr(gid.x(), gid.y(), gid.z()));
 		if (isFloatingPoint)
 		{
 			float fData;
@@ -1887,44 +2060,15 @@ bool BinaryAtomicIntermValuesInstance::areValuesCorrect(tcu::ConstPixelBufferAcc
 		}
 		resultValues[i] = data;
 		atomicArgs[i]	= getAtomicFuncArgument<T>(m_operation, gid, extendedGridSize);
-		argsUsed[i]		= false;
 	}
 
 	// Verify that the return values form a valid sequence.
-	return verifyRecursive(0, getOperationInitialValue<T>(m_operation), argsUsed, atomicArgs, resultValues);
-}
-
-template <typename T>
-bool BinaryAtomicIntermValuesInstance::verifyRecursive (const deInt32	index,
-														const T			valueSoFar,
-														bool			argsUsed[NUM_INVOCATIONS_PER_PIXEL],
-														const T			atomicArgs[NUM_INVOCATIONS_PER_PIXEL],
-														const T			resultValues[NUM_INVOCATIONS_PER_PIXEL]) const
-{
-	if (index >= static_cast<deInt32>(NUM_INVOCATIONS_PER_PIXEL))
-		return true;
-
-	for (deInt32 i = 0; i < static_cast<deInt32>(NUM_INVOCATIONS_PER_PIXEL); i++)
-	{
-		if (!argsUsed[i] && resultValues[i] == valueSoFar)
-		{
-			argsUsed[i] = true;
-
-			if (verifyRecursive(index + 1, computeBinaryAtomicOperationResult(m_operation, valueSoFar, atomicArgs[i]), argsUsed, atomicArgs, resultValues))
-			{
-				return true;
-			}
-
-			argsUsed[i] = false;
-		}
-	}
-
-	return false;
+	return isValidAtomicSequence(m_operation, getOperationInitialValue<T>(m_operation), resultValues, atomicArgs);
 }
 
 TestInstance* BinaryAtomicIntermValuesCase::createInstance (Context& context) const
 {
-	return new BinaryAtomicIntermValuesInstance(context, m_name, m_imageType, m_imageSize, m_format, m_tiling, m_operation, m_useTransfer, m_readType, m_backingType);
+	return new BinaryAtomicIntermValuesInstance(context, m_name, m_imageType, m_imageSize, m_format, m_tiling, m_operation, m_useTransfer, m_readType, m_backingType, m_numInvocationsPerPixel);
 }
 
 } // anonymous ns
@@ -2096,6 +2240,63 @@ tcu::TestCaseGroup* createImageAtomicOperationTests (tcu::TestContext& testCtx)
 		imageAtomicOperationsTests->addChild(operationGroup.release());
 	}
 
+	// High-contention variants: many invocations operate on each pixel of a small image. Only intermediate values are
+	// checked, as the end result is the same as with lower contention.
+	{
+		const tcu::UVec3	highContentionImageSize		(8u, 8u, 1u);
+		const deUint32		highContentionInvocations[]	= { 64u, 256u };
+
+		de::MovePtr<tcu::TestCaseGroup> highContentionGroup(new tcu::TestCaseGroup(testCtx, "high_contention", "Intermediate values with many invocations per pixel"));
+
+		for (deUint32 operationI = 0; operationI < ATOMIC_OPERATION_LAST; operationI++)
+		{
+			const AtomicOperation operation = (AtomicOperation)operationI;
+
+			// SPIR-V shaders in vktImageAtomicSpirvShaders.cpp assume 64-wide images.
+			if (isSpirvAtomicOperation(operation))
+				continue;
+
+			de::MovePtr<tcu::TestCaseGroup> operationGroup(new tcu::TestCaseGroup(testCtx, getAtomicOperationCaseName(operation).c_str(), ""));
+
+			for (int invocationsNdx = 0; invocationsNdx < DE_LENGTH_OF_ARRAY(highContentionInvocations); invocationsNdx++)
+			{
+				const deUint32					numInvocations	= highContentionInvocations[invocationsNdx];
+				de::MovePtr<tcu::TestCaseGroup>	invocationsGroup	(new tcu::TestCaseGroup(testCtx, (toString(numInvocations) + "_invocations").c_str(), ""));
+
+				for (deUint32 formatNdx = 0; formatNdx < DE_LENGTH_OF_ARRAY(formats); formatNdx++)
+				{
+					const TextureFormat&	format		= formats[formatNdx];
+					const std::string		formatName	= getShaderImageFormatQualifier(format);
+
+					if (format.type == tcu::TextureFormat::FLOAT)
+					{
+						if (operation != ATOMIC_OPERATION_ADD &&
+#ifndef CTS_USES_VULKANSC
+							operation != ATOMIC_OPERATION_MIN &&
+							operation != ATOMIC_OPERATION_MAX &&
+#endif // CTS_USES_VULKANSC
+							operation != ATOMIC_OPERATION_EXCHANGE)
+						{
+							continue;
+						}
+
+						// Partial sums would exceed the range where floats represent integers exactly.
+						if (operation == ATOMIC_OPERATION_ADD && numInvocations > 64u)
+							continue;
+					}
+
+					invocationsGroup->addChild(new BinaryAtomicIntermValuesCase(testCtx, formatName + "_intermediate_values", "", IMAGE_TYPE_2D, highContentionImageSize, format, VK_IMAGE_TILING_OPTIMAL, operation, false, ShaderReadType::NORMAL, ImageBackingType::NORMAL, glu::GLSL_VERSION_450, numInvocations));
+				}
+
+				operationGroup->addChild(invocationsGroup.release());
+			}
+
+			highContentionGroup->addChild(operationGroup.release());
+		}
+
+		imageAtomicOperationsTests->addChild(highContentionGroup.release());
+	}
+
 	return imageAtomicOperationsTests.release();
 }
 
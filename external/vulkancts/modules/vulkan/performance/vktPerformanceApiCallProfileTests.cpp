@@ -0,0 +1,220 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *
+ *//*!
+ * \file
+ * \brief API call profiler tests
+ *
+ * Instance and device interfaces of the null driver are wrapped in the
+ * profiling interfaces and a known sequence of calls is made through
+ * them. The profile must report exactly those entry points with matching
+ * call counts, so the tests run on any platform without a device.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceApiCallProfileTests.hpp"
+#include "vktTestGroupUtil.hpp"
+
+#include "vkNullDriver.hpp"
+#include "vkPlatform.hpp"
+#include "vkProfilingDriver.hpp"
+#include "vkRefUtil.hpp"
+
+#include "tcuTestLog.hpp"
+
+#include "deUniquePtr.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace vkt
+{
+namespace performance
+{
+
+using namespace vk;
+using tcu::TestLog;
+
+namespace
+{
+
+enum
+{
+	NUM_BUFFERS	= 16
+};
+
+class NullDriverProfileCase : public tcu::TestCase
+{
+public:
+							NullDriverProfileCase	(tcu::TestContext& testCtx, const char* name, const char* description)
+								: tcu::TestCase(testCtx, name, description)
+							{
+							}
+
+	IterateResult			iterate					(void);
+};
+
+bool checkEntries (TestLog& log, const std::vector<ApiCallProfile::Entry>& entries, const std::map<std::string, deUint64>& expected)
+{
+	bool	allOk	= entries.size() == expected.size();
+
+	if (!allOk)
+		log << TestLog::Message << "Expected " << expected.size() << " profiled entry points, got " << entries.size() << TestLog::EndMessage;
+
+	for (size_t ndx = 0; ndx < entries.size(); ++ndx)
+	{
+		const std::map<std::string, deUint64>::const_iterator	iter	= expected.find(entries[ndx].name);
+
+		if (iter == expected.end())
+		{
+			log << TestLog::Message << "Unexpected entry point " << entries[ndx].name << " with " << entries[ndx].numCalls << " calls" << TestLog::EndMessage;
+			allOk = false;
+		}
+		else if (iter->second != entries[ndx].numCalls)
+		{
+			log << TestLog::Message << entries[ndx].name << ": expected " << iter->second << " calls, got " << entries[ndx].numCalls << TestLog::EndMessage;
+			allOk = false;
+		}
+	}
+
+	return allOk;
+}
+
+tcu::TestCase::IterateResult NullDriverProfileCase::iterate (void)
+{
+	TestLog&							log				= m_testCtx.getLog();
+	const de::UniquePtr<Library>		library			(createNullDriver());
+	const PlatformInterface&			vkp				= library->getPlatformInterface();
+	ApiCallProfile						profile;
+	std::map<std::string, deUint64>		expected;
+	bool								allOk			= true;
+
+	const VkApplicationInfo				appInfo			=
+	{
+		VK_STRUCTURE_TYPE_APPLICATION_INFO,
+		DE_NULL,
+		"deqp",
+		0u,
+		"deqp",
+		0u,
+		VK_API_VERSION_1_0
+	};
+	const VkInstanceCreateInfo			instanceInfo	=
+	{
+		VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+		DE_NULL,
+		(VkInstanceCreateFlags)0,
+		&appInfo,
+		0u,
+		DE_NULL,
+		0u,
+		DE_NULL
+	};
+	const Unique<VkInstance>			instance		(createInstance(vkp, &instanceInfo));
+	const InstanceDriver				instanceDriver	(vkp, *instance);
+	const ProfilingInstanceDriver		vki				(instanceDriver, profile);
+
+	VkPhysicalDevice					physicalDevice	= DE_NULL;
+	deUint32							numDevices		= 1u;
+	VkPhysicalDeviceProperties			properties;
+
+	VK_CHECK(vki.enumeratePhysicalDevices(*instance, &numDevices, &physicalDevice));
+	vki.getPhysicalDeviceProperties(physicalDevice, &properties);
+
+	const float							queuePriority	= 1.0f;
+	const VkDeviceQueueCreateInfo		queueInfo		=
+	{
+		VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+		DE_NULL,
+		(VkDeviceQueueCreateFlags)0,
+		0u,
+		1u,
+		&queuePriority
+	};
+	const VkDeviceCreateInfo			deviceInfo		=
+	{
+		VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+		DE_NULL,
+		(VkDeviceCreateFlags)0,
+		1u,
+		&queueInfo,
+		0u,
+		DE_NULL,
+		0u,
+		DE_NULL,
+		DE_NULL
+	};
+	const Unique<VkDevice>				device			(createDevice(vkp, *instance, vki, physicalDevice, &deviceInfo));
+	const DeviceDriver					deviceDriver	(vkp, *instance, *device);
+	const ProfilingDeviceDriver			vkd				(deviceDriver, profile);
+
+	const VkBufferCreateInfo			bufferInfo		=
+	{
+		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		DE_NULL,
+		(VkBufferCreateFlags)0,
+		1024u,
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+		VK_SHARING_MODE_EXCLUSIVE,
+		0u,
+		DE_NULL
+	};
+
+	for (int ndx = 0; ndx < NUM_BUFFERS; ++ndx)
+	{
+		const Unique<VkBuffer>			buffer			(createBuffer(vkd, *device, &bufferInfo));
+	}
+
+	expected["vkEnumeratePhysicalDevices"]		= 1u;
+	expected["vkGetPhysicalDeviceProperties"]	= 1u;
+	expected["vkCreateDevice"]					= 1u;
+	expected["vkCreateBuffer"]					= NUM_BUFFERS;
+	expected["vkDestroyBuffer"]					= NUM_BUFFERS;
+
+	profile.log(log, expected.size());
+
+	if (!checkEntries(log, profile.getEntries(), expected))
+		allOk = false;
+
+	profile.reset();
+
+	if (!profile.getEntries().empty())
+	{
+		log << TestLog::Message << "Profile not empty after reset" << TestLog::EndMessage;
+		allOk = false;
+	}
+
+	m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS : QP_TEST_RESULT_FAIL, allOk ? "Pass" : "Profile does not match calls made");
+	return STOP;
+}
+
+void createChildren (tcu::TestCaseGroup* group)
+{
+	group->addChild(new NullDriverProfileCase(group->getTestContext(), "null_driver", "Profile calls made to null driver through profiling interfaces"));
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createApiCallProfileTests (tcu::TestContext& testCtx)
+{
+	return createTestGroup(testCtx, "api_call_profile", "API call profiler tests", createChildren);
+}
+
+} // performance
+} // vkt
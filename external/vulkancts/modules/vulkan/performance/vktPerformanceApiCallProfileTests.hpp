@@ -0,0 +1,39 @@
+#ifndef _VKTPERFORMANCEAPICALLPROFILETESTS_HPP
+#define _VKTPERFORMANCEAPICALLPROFILETESTS_HPP
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief API call profiler tests
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTestCase.hpp"
+
+namespace vkt
+{
+namespace performance
+{
+
+tcu::TestCaseGroup*	createApiCallProfileTests	(tcu::TestContext& testCtx);
+
+} // performance
+} // vkt
+
+#endif // _VKTPERFORMANCEAPICALLPROFILETESTS_HPP
@@ -0,0 +1,451 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Upload and readback bandwidth benchmarks
+ *
+ * Each case is run for every host visible memory type usable for the
+ * transfer, so that coherent, cached and non-coherent paths can be
+ * compared from one log. Transfer sizes are swept and bandwidth is
+ * estimated from the slope of a line fitted to transfer times, which
+ * excludes fixed costs such as submission and fence wait. Copies are
+ * timed with GPU timestamps when the queue supports them.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceBandwidthTests.hpp"
+#include "vktPerformanceUtil.hpp"
+#include "vktTestCase.hpp"
+#include "vktTestGroupUtil.hpp"
+
+#include "vkBarrierUtil.hpp"
+#include "vkCmdUtil.hpp"
+#include "vkBufferWithMemory.hpp"
+#include "vkImageWithMemory.hpp"
+#include "vkMemUtil.hpp"
+#include "vkObjUtil.hpp"
+#include "vkQueryUtil.hpp"
+#include "vkRefUtil.hpp"
+#include "vkTypeUtil.hpp"
+
+#include "tcuCommandLine.hpp"
+#include "tcuCPUWarmup.hpp"
+
+#include "deStringUtil.hpp"
+#include "deUniquePtr.hpp"
+
+#include <vector>
+
+namespace vkt
+{
+namespace performance
+{
+
+using namespace vk;
+using tcu::TestLog;
+
+namespace
+{
+
+enum TransferType
+{
+	TRANSFER_HOST_WRITE = 0,			//!< memcpy() to mapped memory.
+	TRANSFER_HOST_READ,					//!< memcpy() from mapped memory.
+	TRANSFER_FLUSH,						//!< vkFlushMappedMemoryRanges() on non-coherent memory.
+	TRANSFER_INVALIDATE,				//!< vkInvalidateMappedMemoryRanges() on non-coherent memory.
+	TRANSFER_COPY_BUFFER,				//!< vkCmdCopyBuffer() from staging buffer to device local buffer.
+	TRANSFER_COPY_BUFFER_TO_IMAGE,		//!< vkCmdCopyBufferToImage() from staging buffer to device local image.
+	TRANSFER_COPY_IMAGE_TO_BUFFER,		//!< vkCmdCopyImageToBuffer() from device local image to host visible buffer, and invalidate.
+
+	TRANSFER_LAST
+};
+
+enum
+{
+	MIN_TRANSFER_SIZE	= 64 * 1024,
+	MAX_TRANSFER_SIZE	= 64 * 1024 * 1024,
+	NUM_REPEATS			= 4,
+	IMAGE_WIDTH			= 4096,			//!< Minimum guaranteed maxImageDimension2D.
+	IMAGE_TEXEL_SIZE	= 4
+};
+
+const VkFormat IMAGE_FORMAT = VK_FORMAT_R8G8B8A8_UINT;
+
+bool isDeviceTransfer (TransferType type)
+{
+	return type == TRANSFER_COPY_BUFFER || type == TRANSFER_COPY_BUFFER_TO_IMAGE || type == TRANSFER_COPY_IMAGE_TO_BUFFER;
+}
+
+bool requiresNonCoherent (TransferType type)
+{
+	return type == TRANSFER_FLUSH || type == TRANSFER_INVALIDATE;
+}
+
+//! Bandwidth in MB/s from fitted transfer time slope. Zero if slope is not positive.
+float getFittedBandwidth (const tcu::PerfMeasureResult& result)
+{
+	return result.fit.coefficient > 0.0f ? 1.0f / result.fit.coefficient : 0.0f;
+}
+
+class BandwidthTestInstance : public TestInstance, private tcu::PerfWorkload
+{
+public:
+									BandwidthTestInstance	(Context& context, TransferType type);
+
+	tcu::TestStatus					iterate					(void);
+
+private:
+	tcu::PerfMeasureResult			measureMemoryType		(deUint32 memoryTypeNdx, VkDeviceSize maxSize);
+	void							run						(int size, tcu::PerfTimer& timer);
+	void							runDeviceTransfer		(VkDeviceSize size, tcu::PerfTimer& timer);
+
+	const TransferType				m_type;
+	const VkPhysicalDeviceMemoryProperties	m_memoryProperties;
+	std::vector<deUint8>			m_hostData;
+
+	de::MovePtr<BufferWithMemory>	m_deviceBuffer;
+	de::MovePtr<ImageWithMemory>	m_deviceImage;
+	Move<VkCommandPool>				m_cmdPool;
+	Move<VkCommandBuffer>			m_cmdBuffer;
+
+	de::MovePtr<tcu::PerfTimer>		m_timer;
+	TimestampTimer*					m_timestampTimer;		//!< m_timer if GPU timestamps are used, null otherwise.
+
+	// Memory type being measured.
+	VkDeviceMemory					m_memory;
+	void*							m_hostPtr;
+	VkBuffer						m_hostBuffer;
+};
+
+BandwidthTestInstance::BandwidthTestInstance (Context& context, TransferType type)
+	: TestInstance			(context)
+	, m_type				(type)
+	, m_memoryProperties	(getPhysicalDeviceMemoryProperties(context.getInstanceInterface(), context.getPhysicalDevice()))
+	, m_timestampTimer		(DE_NULL)
+	, m_memory				(DE_NULL)
+	, m_hostPtr				(DE_NULL)
+	, m_hostBuffer			(DE_NULL)
+{
+	const DeviceInterface&	vk			= context.getDeviceInterface();
+	const VkDevice			device		= context.getDevice();
+	Allocator&				allocator	= context.getDefaultAllocator();
+
+	// Copies are timed on the GPU when possible, so submission and wait do not add noise.
+	if (isDeviceTransfer(m_type) && TimestampTimer::isSupported(context))
+	{
+		m_timestampTimer	= new TimestampTimer(context);
+		m_timer				= de::MovePtr<tcu::PerfTimer>(m_timestampTimer);
+	}
+	else
+		m_timer = de::MovePtr<tcu::PerfTimer>(new tcu::WallClockTimer());
+
+	if (!isDeviceTransfer(m_type))
+	{
+		m_hostData.resize(MAX_TRANSFER_SIZE);
+
+		for (size_t ndx = 0; ndx < m_hostData.size(); ++ndx)
+			m_hostData[ndx] = (deUint8)(ndx * 31u);
+
+		return;
+	}
+
+	m_cmdPool	= makeCommandPool(vk, device, context.getUniversalQueueFamilyIndex());
+	m_cmdBuffer	= allocateCommandBuffer(vk, device, *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
+	if (m_type == TRANSFER_COPY_BUFFER)
+		m_deviceBuffer = de::MovePtr<BufferWithMemory>(new BufferWithMemory(vk, device, allocator, makeBufferCreateInfo(MAX_TRANSFER_SIZE, VK_BUFFER_USAGE_TRANSFER_DST_BIT), MemoryRequirement::Any));
+	else
+	{
+		const bool				isUpload		= m_type == TRANSFER_COPY_BUFFER_TO_IMAGE;
+		const VkImageLayout		layout			= isUpload ? VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		const VkImageCreateInfo	imageCreateInfo	=
+		{
+			VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,														// VkStructureType			sType;
+			DE_NULL,																					// const void*				pNext;
+			0u,																							// VkImageCreateFlags		flags;
+			VK_IMAGE_TYPE_2D,																			// VkImageType				imageType;
+			IMAGE_FORMAT,																				// VkFormat					format;
+			makeExtent3D(IMAGE_WIDTH, MAX_TRANSFER_SIZE / (IMAGE_WIDTH * IMAGE_TEXEL_SIZE), 1u),		// VkExtent3D				extent;
+			1u,																							// deUint32					mipLevels;
+			1u,																							// deUint32					arrayLayers;
+			VK_SAMPLE_COUNT_1_BIT,																		// VkSampleCountFlagBits	samples;
+			VK_IMAGE_TILING_OPTIMAL,																	// VkImageTiling			tiling;
+			VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,							// VkImageUsageFlags		usage;
+			VK_SHARING_MODE_EXCLUSIVE,																	// VkSharingMode			sharingMode;
+			0u,																							// deUint32					queueFamilyIndexCount;
+			DE_NULL,																					// const deUint32*			pQueueFamilyIndices;
+			VK_IMAGE_LAYOUT_UNDEFINED,																	// VkImageLayout			initialLayout;
+		};
+		const VkImageMemoryBarrier	layoutBarrier	= makeImageMemoryBarrier(0u, VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED, layout, DE_NULL,
+																			 makeImageSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u));
+
+		m_deviceImage = de::MovePtr<ImageWithMemory>(new ImageWithMemory(vk, device, allocator, imageCreateInfo, MemoryRequirement::Any));
+
+		// Image contents are irrelevant, only the layout is set up once.
+		{
+			VkImageMemoryBarrier barrier = layoutBarrier;
+			barrier.image = m_deviceImage->get();
+
+			beginCommandBuffer(vk, *m_cmdBuffer);
+			cmdPipelineImageMemoryBarrier(vk, *m_cmdBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, &barrier);
+			endCommandBuffer(vk, *m_cmdBuffer);
+			submitCommandsAndWait(vk, device, context.getUniversalQueue(), *m_cmdBuffer);
+		}
+	}
+}
+
+void BandwidthTestInstance::runDeviceTransfer (VkDeviceSize size, tcu::PerfTimer& timer)
+{
+	const DeviceInterface&	vk				= m_context.getDeviceInterface();
+	const VkDevice			device			= m_context.getDevice();
+	const VkMemoryBarrier	transferBarrier	= makeMemoryBarrier(VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+	const VkMemoryBarrier	hostBarrier		= makeMemoryBarrier(VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT);
+
+	VK_CHECK(vk.resetCommandPool(device, *m_cmdPool, 0u));
+
+	beginCommandBuffer(vk, *m_cmdBuffer);
+	cmdPipelineMemoryBarrier(vk, *m_cmdBuffer, VK_PIPELINE_STAGE_HOST_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, &transferBarrier);
+
+	if (m_timestampTimer)
+		m_timestampTimer->writeBegin(*m_cmdBuffer);
+
+	switch (m_type)
+	{
+		case TRANSFER_COPY_BUFFER:
+		{
+			const VkBufferCopy region = makeBufferCopy(0u, 0u, size);
+			vk.cmdCopyBuffer(*m_cmdBuffer, m_hostBuffer, m_deviceBuffer->get(), 1u, &region);
+			break;
+		}
+
+		case TRANSFER_COPY_BUFFER_TO_IMAGE:
+		case TRANSFER_COPY_IMAGE_TO_BUFFER:
+		{
+			const deUint32			numRows	= (deUint32)(size / (IMAGE_WIDTH * IMAGE_TEXEL_SIZE));
+			const VkBufferImageCopy	region	= makeBufferImageCopy(makeExtent3D(IMAGE_WIDTH, numRows, 1u), makeImageSubresourceLayers(VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u));
+
+			if (m_type == TRANSFER_COPY_BUFFER_TO_IMAGE)
+				vk.cmdCopyBufferToImage(*m_cmdBuffer, m_hostBuffer, m_deviceImage->get(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1u, &region);
+			else
+				vk.cmdCopyImageToBuffer(*m_cmdBuffer, m_deviceImage->get(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m_hostBuffer, 1u, &region);
+			break;
+		}
+
+		default:
+			DE_ASSERT(false);
+	}
+
+	if (m_timestampTimer)
+		m_timestampTimer->writeEnd(*m_cmdBuffer);
+
+	cmdPipelineMemoryBarrier(vk, *m_cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, &hostBarrier);
+	endCommandBuffer(vk, *m_cmdBuffer);
+
+	timer.begin();
+
+	submitCommandsAndWait(vk, device, m_context.getUniversalQueue(), *m_cmdBuffer);
+
+	// Readback is not complete before the data is visible to host.
+	if (m_type == TRANSFER_COPY_IMAGE_TO_BUFFER)
+		invalidateMappedMemoryRange(vk, device, m_memory, 0u, size);
+
+	timer.end();
+}
+
+void BandwidthTestInstance::run (int size, tcu::PerfTimer& timer)
+{
+	const DeviceInterface&		vk			= m_context.getDeviceInterface();
+	const VkDevice				device		= m_context.getDevice();
+
+	if (isDeviceTransfer(m_type))
+	{
+		runDeviceTransfer((VkDeviceSize)size, timer);
+		return;
+	}
+
+	// Make sure flushed and invalidated ranges have something to do.
+	if (m_type == TRANSFER_FLUSH)
+		deMemset(m_hostPtr, size, (size_t)size);
+
+	timer.begin();
+
+	switch (m_type)
+	{
+		case TRANSFER_HOST_WRITE:	deMemcpy(m_hostPtr, &m_hostData[0], (size_t)size);							break;
+		case TRANSFER_HOST_READ:	deMemcpy(&m_hostData[0], m_hostPtr, (size_t)size);							break;
+		case TRANSFER_FLUSH:		flushMappedMemoryRange(vk, device, m_memory, 0u, (VkDeviceSize)size);		break;
+		case TRANSFER_INVALIDATE:	invalidateMappedMemoryRange(vk, device, m_memory, 0u, (VkDeviceSize)size);	break;
+		default:
+			DE_ASSERT(false);
+	}
+
+	timer.end();
+}
+
+tcu::PerfMeasureResult BandwidthTestInstance::measureMemoryType (deUint32 memoryTypeNdx, VkDeviceSize maxSize)
+{
+	const DeviceInterface&			vk			= m_context.getDeviceInterface();
+	const VkDevice					device		= m_context.getDevice();
+	const VkMemoryAllocateInfo		allocInfo	=
+	{
+		VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,	// VkStructureType	sType;
+		DE_NULL,								// const void*		pNext;
+		maxSize,								// VkDeviceSize		allocationSize;
+		memoryTypeNdx,							// deUint32			memoryTypeIndex;
+	};
+	const Unique<VkDeviceMemory>	memory		(allocateMemory(vk, device, &allocInfo));
+	Move<VkBuffer>					hostBuffer;
+	tcu::PerfMeasureParams			params		(MIN_TRANSFER_SIZE, (int)maxSize);
+	tcu::PerfMeasureResult			result;
+
+	params.numRepeats = NUM_REPEATS;
+
+	if (isDeviceTransfer(m_type))
+	{
+		hostBuffer = makeBuffer(vk, device, maxSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+		VK_CHECK(vk.bindBufferMemory(device, *hostBuffer, *memory, 0u));
+	}
+
+	VK_CHECK(vk.mapMemory(device, *memory, 0u, VK_WHOLE_SIZE, 0u, &m_hostPtr));
+
+	m_memory		= *memory;
+	m_hostBuffer	= *hostBuffer;
+
+	// Touch all pages so that first use page faults are not measured.
+	deMemset(m_hostPtr, 0, (size_t)maxSize);
+	flushMappedMemoryRange(vk, device, *memory, 0u, VK_WHOLE_SIZE);
+
+	result = tcu::measurePerformance(*this, *m_timer, params);
+
+	vk.unmapMemory(device, *memory);
+
+	m_memory		= DE_NULL;
+	m_hostPtr		= DE_NULL;
+	m_hostBuffer	= DE_NULL;
+
+	return result;
+}
+
+tcu::TestStatus BandwidthTestInstance::iterate (void)
+{
+	const DeviceInterface&				vk					= m_context.getDeviceInterface();
+	const VkDevice						device				= m_context.getDevice();
+	TestLog&							log					= m_context.getTestContext().getLog();
+	const tcu::MeasurementEnvironment	environment			(m_context.getTestContext().getCommandLine().getPerfCPUAffinity());
+	deUint32							allowedTypeBits		= ~0u;
+	float								bestBandwidth		= 0.0f;
+	int									numMeasuredTypes	= 0;
+
+	// Only memory types the staging buffer can be bound to.
+	if (isDeviceTransfer(m_type))
+	{
+		const Unique<VkBuffer> buffer (makeBuffer(vk, device, MAX_TRANSFER_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT));
+		allowedTypeBits = getBufferMemoryRequirements(vk, device, *buffer).memoryTypeBits;
+	}
+
+	log << TestLog::Message << "Timer: " << m_timer->getName() << TestLog::EndMessage;
+
+	tcu::warmupCPU();
+
+	for (deUint32 memoryTypeNdx = 0; memoryTypeNdx < m_memoryProperties.memoryTypeCount; ++memoryTypeNdx)
+	{
+		const VkMemoryType&		memoryType	= m_memoryProperties.memoryTypes[memoryTypeNdx];
+		const VkDeviceSize		heapSize	= m_memoryProperties.memoryHeaps[memoryType.heapIndex].size;
+		const bool				isCoherent	= (memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+		VkDeviceSize			maxSize		= MAX_TRANSFER_SIZE;
+
+		if ((allowedTypeBits & (1u << memoryTypeNdx)) == 0 ||
+			(memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == 0 ||
+			(memoryType.propertyFlags & VK_MEMORY_PROPERTY_PROTECTED_BIT) != 0 ||
+#ifndef CTS_USES_VULKANSC
+			(memoryType.propertyFlags & VK_MEMORY_PROPERTY_DEVICE_COHERENT_BIT_AMD) != 0 ||
+#endif // CTS_USES_VULKANSC
+			(requiresNonCoherent(m_type) && isCoherent))
+			continue;
+
+		// Leave room for other allocations in small heaps.
+		while (maxSize > MIN_TRANSFER_SIZE && maxSize > heapSize / 4)
+			maxSize /= 4;
+
+		{
+			const std::string				typeName	= "MemoryType" + de::toString(memoryTypeNdx);
+			const tcu::PerfMeasureResult	result		= measureMemoryType(memoryTypeNdx, maxSize);
+			const float						bandwidth	= getFittedBandwidth(result);
+
+			logPerfSamples(log, typeName, "Memory type " + de::toString(memoryTypeNdx) + ", heap " + de::toString(memoryType.heapIndex) + ", " + de::toString(getMemoryPropertyFlagsStr(memoryType.propertyFlags)), result);
+			log << TestLog::Float(typeName + "Bandwidth", "Fitted bandwidth of memory type " + de::toString(memoryTypeNdx), "MB/s", QP_KEY_TAG_PERFORMANCE, bandwidth);
+
+			bestBandwidth = de::max(bestBandwidth, bandwidth);
+			numMeasuredTypes += 1;
+		}
+	}
+
+	if (numMeasuredTypes == 0)
+		TCU_THROW(NotSupportedError, requiresNonCoherent(m_type) ? "No host visible non-coherent memory types" : "No suitable host visible memory types");
+
+	environment.logReport(log);
+
+	return tcu::TestStatus::pass(de::floatToString(bestBandwidth, 2));
+}
+
+class BandwidthTestCase : public TestCase
+{
+public:
+							BandwidthTestCase	(tcu::TestContext& testCtx, const std::string& name, const std::string& description, TransferType type)
+								: TestCase	(testCtx, name, description)
+								, m_type	(type)
+							{
+							}
+
+	TestInstance*			createInstance		(Context& context) const { return new BandwidthTestInstance(context, m_type); }
+
+private:
+	const TransferType		m_type;
+};
+
+void createChildren (tcu::TestCaseGroup* bandwidthTests)
+{
+	static const struct
+	{
+		TransferType	type;
+		const char*		name;
+		const char*		description;
+	} cases[] =
+	{
+		{ TRANSFER_HOST_WRITE,				"host_write",				"memcpy() to mapped memory"											},
+		{ TRANSFER_HOST_READ,				"host_read",				"memcpy() from mapped memory"										},
+		{ TRANSFER_FLUSH,					"flush",					"vkFlushMappedMemoryRanges() on non-coherent memory"				},
+		{ TRANSFER_INVALIDATE,				"invalidate",				"vkInvalidateMappedMemoryRanges() on non-coherent memory"			},
+		{ TRANSFER_COPY_BUFFER,				"copy_buffer",				"Staging buffer to device local buffer with vkCmdCopyBuffer()"		},
+		{ TRANSFER_COPY_BUFFER_TO_IMAGE,	"copy_buffer_to_image",		"Staging buffer to device local image with vkCmdCopyBufferToImage()"	},
+		{ TRANSFER_COPY_IMAGE_TO_BUFFER,	"copy_image_to_buffer",		"Device local image readback with vkCmdCopyImageToBuffer()"			},
+	};
+
+	for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(cases); ++caseNdx)
+		bandwidthTests->addChild(new BandwidthTestCase(bandwidthTests->getTestContext(), cases[caseNdx].name, cases[caseNdx].description, cases[caseNdx].type));
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createBandwidthTests (tcu::TestContext& testCtx)
+{
+	return createTestGroup(testCtx, "bandwidth", "Upload and readback bandwidth per memory type", createChildren);
+}
+
+} // performance
+} // vkt
@@ -0,0 +1,523 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Descriptor update and allocation throughput benchmarks
+ *
+ * One call is the allocation, reset or update of one descriptor set. Sets
+ * have a single arrayed binding, and the number of descriptors in it and
+ * their type are swept over cases. Per set cost is estimated from batches
+ * of varying size, so fixed costs such as one vkUpdateDescriptorSets() or
+ * vkResetDescriptorPool() call do not skew it.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceDescriptorTests.hpp"
+#include "vktPerformanceUtil.hpp"
+#include "vktTestCase.hpp"
+#include "vktTestGroupUtil.hpp"
+
+#include "vkBufferWithMemory.hpp"
+#include "vkBuilderUtil.hpp"
+#include "vkCmdUtil.hpp"
+#include "vkImageUtil.hpp"
+#include "vkImageWithMemory.hpp"
+#include "vkObjUtil.hpp"
+#include "vkRefUtil.hpp"
+#include "vkTypeUtil.hpp"
+
+#include "tcuTexture.hpp"
+
+#include "deStringUtil.hpp"
+#include "deUniquePtr.hpp"
+
+#include <vector>
+
+namespace vkt
+{
+namespace performance
+{
+
+using namespace vk;
+
+namespace
+{
+
+enum UpdateMethod
+{
+	METHOD_ALLOCATE = 0,		//!< vkAllocateDescriptorSets() per set.
+	METHOD_RESET_POOL,			//!< vkResetDescriptorPool() on a pool with allocated sets.
+	METHOD_WRITE,				//!< One vkUpdateDescriptorSets() with a write per set.
+	METHOD_COPY,				//!< One vkUpdateDescriptorSets() with a copy per set.
+#ifndef CTS_USES_VULKANSC
+	METHOD_UPDATE_TEMPLATE,		//!< vkUpdateDescriptorSetWithTemplate() per set.
+	METHOD_PUSH_DESCRIPTOR,		//!< vkCmdPushDescriptorSetKHR() per set.
+#endif // CTS_USES_VULKANSC
+
+	METHOD_LAST
+};
+
+struct TestParams
+{
+	UpdateMethod		method;
+	VkDescriptorType	descriptorType;
+	deUint32			descriptorCount;	//!< Array size of the only binding in set.
+};
+
+enum
+{
+	MIN_SETS	= 16,
+	MAX_SETS	= 1024
+};
+
+const VkFormat				IMAGE_FORMAT	= VK_FORMAT_R8G8B8A8_UNORM;
+const VkShaderStageFlags	STAGE			= VK_SHADER_STAGE_COMPUTE_BIT;
+
+bool isImageType (VkDescriptorType type)
+{
+	return type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+}
+
+bool isPushDescriptor (UpdateMethod method)
+{
+#ifndef CTS_USES_VULKANSC
+	return method == METHOD_PUSH_DESCRIPTOR;
+#else
+	DE_UNREF(method);
+	return false;
+#endif // CTS_USES_VULKANSC
+}
+
+//! Per stage limit of descriptors of given type.
+deUint32 getMaxPerStageDescriptors (const VkPhysicalDeviceLimits& limits, VkDescriptorType type)
+{
+	switch (type)
+	{
+		case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:				return limits.maxPerStageDescriptorUniformBuffers;
+		case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:				return limits.maxPerStageDescriptorStorageBuffers;
+		case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:		return de::min(limits.maxPerStageDescriptorSampledImages, limits.maxPerStageDescriptorSamplers);
+		default:
+			DE_ASSERT(false);
+			return 0u;
+	}
+}
+
+//! Write of all descriptors of the only binding.
+VkWriteDescriptorSet makeBindingWrite (VkDescriptorSet set, const TestParams& params, const VkDescriptorImageInfo* imageInfos, const VkDescriptorBufferInfo* bufferInfos)
+{
+	const VkWriteDescriptorSet	write	=
+	{
+		VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// VkStructureType					sType;
+		DE_NULL,								// const void*						pNext;
+		set,									// VkDescriptorSet					dstSet;
+		0u,										// deUint32							dstBinding;
+		0u,										// deUint32							dstArrayElement;
+		params.descriptorCount,					// deUint32							descriptorCount;
+		params.descriptorType,					// VkDescriptorType					descriptorType;
+		imageInfos,								// const VkDescriptorImageInfo*		pImageInfo;
+		bufferInfos,							// const VkDescriptorBufferInfo*	pBufferInfo;
+		DE_NULL,								// const VkBufferView*				pTexelBufferView;
+	};
+
+	return write;
+}
+
+//! Copy of all descriptors of the only binding.
+VkCopyDescriptorSet makeBindingCopy (VkDescriptorSet srcSet, VkDescriptorSet dstSet, const TestParams& params)
+{
+	const VkCopyDescriptorSet	copy	=
+	{
+		VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET,	// VkStructureType	sType;
+		DE_NULL,								// const void*		pNext;
+		srcSet,									// VkDescriptorSet	srcSet;
+		0u,										// deUint32			srcBinding;
+		0u,										// deUint32			srcArrayElement;
+		dstSet,									// VkDescriptorSet	dstSet;
+		0u,										// deUint32			dstBinding;
+		0u,										// deUint32			dstArrayElement;
+		params.descriptorCount,					// deUint32			descriptorCount;
+	};
+
+	return copy;
+}
+
+class DescriptorBenchmarkInstance : public CallBenchmarkInstance
+{
+public:
+											DescriptorBenchmarkInstance	(Context& context, const TestParams& params);
+
+protected:
+	void									run							(int numCalls, tcu::PerfTimer& timer);
+
+private:
+	void									allocateSets				(int numSets);
+
+	const TestParams						m_params;
+
+	de::MovePtr<BufferWithMemory>			m_buffer;
+	de::MovePtr<ImageWithMemory>			m_image;
+	Move<VkImageView>						m_imageView;
+	Move<VkSampler>							m_sampler;
+	std::vector<VkDescriptorBufferInfo>		m_bufferInfos;
+	std::vector<VkDescriptorImageInfo>		m_imageInfos;
+
+	Move<VkDescriptorSetLayout>				m_setLayout;
+	Move<VkDescriptorPool>					m_pool;
+	std::vector<VkDescriptorSet>			m_sets;						//!< m_sets[0] is the source for copies.
+
+	Move<VkPipelineLayout>					m_pipelineLayout;
+	Move<VkCommandPool>						m_cmdPool;
+	Move<VkCommandBuffer>					m_cmdBuffer;
+
+#ifndef CTS_USES_VULKANSC
+	Move<VkDescriptorUpdateTemplate>		m_updateTemplate;
+#endif // CTS_USES_VULKANSC
+};
+
+DescriptorBenchmarkInstance::DescriptorBenchmarkInstance (Context& context, const TestParams& params)
+	: CallBenchmarkInstance	(context, MIN_SETS, MAX_SETS)
+	, m_params				(params)
+{
+	const DeviceInterface&	vk			= context.getDeviceInterface();
+	const VkDevice			device		= context.getDevice();
+	Allocator&				allocator	= context.getDefaultAllocator();
+
+	if (isImageType(m_params.descriptorType))
+	{
+		const VkImageCreateInfo	imageCreateInfo	=
+		{
+			VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,			// VkStructureType			sType;
+			DE_NULL,										// const void*				pNext;
+			0u,												// VkImageCreateFlags		flags;
+			VK_IMAGE_TYPE_2D,								// VkImageType				imageType;
+			IMAGE_FORMAT,									// VkFormat					format;
+			makeExtent3D(4u, 4u, 1u),						// VkExtent3D				extent;
+			1u,												// deUint32					mipLevels;
+			1u,												// deUint32					arrayLayers;
+			VK_SAMPLE_COUNT_1_BIT,							// VkSampleCountFlagBits	samples;
+			VK_IMAGE_TILING_OPTIMAL,						// VkImageTiling			tiling;
+			VK_IMAGE_USAGE_SAMPLED_BIT,						// VkImageUsageFlags		usage;
+			VK_SHARING_MODE_EXCLUSIVE,						// VkSharingMode			sharingMode;
+			0u,												// deUint32					queueFamilyIndexCount;
+			DE_NULL,										// const deUint32*			pQueueFamilyIndices;
+			VK_IMAGE_LAYOUT_UNDEFINED,						// VkImageLayout			initialLayout;
+		};
+		const tcu::Sampler		sampler			(tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::NEAREST, tcu::Sampler::NEAREST);
+		const VkSamplerCreateInfo	samplerCreateInfo	= mapSampler(sampler, mapVkFormat(IMAGE_FORMAT));
+
+		// Image is never accessed, so the layout in descriptors does not need to match.
+		m_image		= de::MovePtr<ImageWithMemory>(new ImageWithMemory(vk, device, allocator, imageCreateInfo, MemoryRequirement::Any));
+		m_imageView	= makeImageView(vk, device, m_image->get(), VK_IMAGE_VIEW_TYPE_2D, IMAGE_FORMAT, makeImageSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u));
+		m_sampler	= createSampler(vk, device, &samplerCreateInfo);
+
+		m_imageInfos.resize(m_params.descriptorCount, makeDescriptorImageInfo(*m_sampler, *m_imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL));
+	}
+	else
+	{
+		const VkBufferUsageFlags	usage	= m_params.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ? VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT : VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+		const VkDeviceSize			range	= 16u;
+
+		m_buffer = de::MovePtr<BufferWithMemory>(new BufferWithMemory(vk, device, allocator, makeBufferCreateInfo(range, usage), MemoryRequirement::Any));
+
+		m_bufferInfos.resize(m_params.descriptorCount, makeDescriptorBufferInfo(m_buffer->get(), 0u, range));
+	}
+
+	{
+		const bool		isPush	= isPushDescriptor(m_params.method);
+		// Copy source set in addition to the measured ones.
+		const deUint32	maxSets	= MAX_SETS + 1u;
+
+		m_setLayout = DescriptorSetLayoutBuilder()
+			.addArrayBinding(m_params.descriptorType, m_params.descriptorCount, STAGE)
+#ifndef CTS_USES_VULKANSC
+			.build(vk, device, isPush ? (VkDescriptorSetLayoutCreateFlags)VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0u);
+#else
+			.build(vk, device);
+#endif // CTS_USES_VULKANSC
+
+		if (isPush)
+		{
+			m_pipelineLayout	= makePipelineLayout(vk, device, *m_setLayout);
+			m_cmdPool			= makeCommandPool(vk, device, context.getUniversalQueueFamilyIndex());
+			m_cmdBuffer			= allocateCommandBuffer(vk, device, *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+		}
+		else
+		{
+			m_pool = DescriptorPoolBuilder()
+				.addType(m_params.descriptorType, m_params.descriptorCount * maxSets)
+				.build(vk, device, 0u, maxSets);
+		}
+	}
+
+	// Update benchmarks need sets to exist already, and copies need a valid source.
+	if (m_params.method != METHOD_ALLOCATE && m_params.method != METHOD_RESET_POOL && m_pool)
+	{
+		allocateSets(MAX_SETS + 1);
+
+		DescriptorSetUpdateBuilder()
+			.write(m_sets[0], 0u, 0u, m_params.descriptorCount, m_params.descriptorType,
+				   m_imageInfos.empty() ? DE_NULL : &m_imageInfos[0], m_bufferInfos.empty() ? DE_NULL : &m_bufferInfos[0], DE_NULL)
+			.update(vk, device);
+	}
+
+#ifndef CTS_USES_VULKANSC
+	if (m_params.method == METHOD_UPDATE_TEMPLATE)
+	{
+		const VkDescriptorUpdateTemplateEntry		entry				=
+		{
+			0u,																								// deUint32			dstBinding;
+			0u,																								// deUint32			dstArrayElement;
+			m_params.descriptorCount,																		// deUint32			descriptorCount;
+			m_params.descriptorType,																		// VkDescriptorType	descriptorType;
+			0u,																								// size_t			offset;
+			isImageType(m_params.descriptorType) ? sizeof(VkDescriptorImageInfo) : sizeof(VkDescriptorBufferInfo),	// size_t			stride;
+		};
+		const VkDescriptorUpdateTemplateCreateInfo	templateCreateInfo	=
+		{
+			VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO,	// VkStructureType							sType;
+			DE_NULL,													// const void*								pNext;
+			0u,															// VkDescriptorUpdateTemplateCreateFlags	flags;
+			1u,															// deUint32									descriptorUpdateEntryCount;
+			&entry,														// const VkDescriptorUpdateTemplateEntry*	pDescriptorUpdateEntries;
+			VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET,			// VkDescriptorUpdateTemplateType			templateType;
+			*m_setLayout,												// VkDescriptorSetLayout					descriptorSetLayout;
+			VK_PIPELINE_BIND_POINT_COMPUTE,								// VkPipelineBindPoint						pipelineBindPoint;
+			DE_NULL,													// VkPipelineLayout							pipelineLayout;
+			0u,															// deUint32									set;
+		};
+
+		m_updateTemplate = createDescriptorUpdateTemplate(vk, device, &templateCreateInfo);
+	}
+#endif // CTS_USES_VULKANSC
+}
+
+void DescriptorBenchmarkInstance::allocateSets (int numSets)
+{
+	const DeviceInterface&				vk			= m_context.getDeviceInterface();
+	const VkDevice						device		= m_context.getDevice();
+	const VkDescriptorSetAllocateInfo	allocInfo	=
+	{
+		VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,	// VkStructureType				sType;
+		DE_NULL,										// const void*					pNext;
+		*m_pool,										// VkDescriptorPool				descriptorPool;
+		1u,												// deUint32						descriptorSetCount;
+		&m_setLayout.get(),								// const VkDescriptorSetLayout*	pSetLayouts;
+	};
+
+	m_sets.resize(numSets);
+
+	for (int setNdx = 0; setNdx < numSets; ++setNdx)
+		VK_CHECK(vk.allocateDescriptorSets(device, &allocInfo, &m_sets[setNdx]));
+}
+
+void DescriptorBenchmarkInstance::run (int numCalls, tcu::PerfTimer& timer)
+{
+	const DeviceInterface&				vk				= m_context.getDeviceInterface();
+	const VkDevice						device			= m_context.getDevice();
+	const VkDescriptorImageInfo*		imageInfos		= m_imageInfos.empty() ? DE_NULL : &m_imageInfos[0];
+	const VkDescriptorBufferInfo*		bufferInfos		= m_bufferInfos.empty() ? DE_NULL : &m_bufferInfos[0];
+	std::vector<VkWriteDescriptorSet>	writes;
+	std::vector<VkCopyDescriptorSet>	copies;
+
+	// Untimed setup. Update structures are built here, so that only the API calls are timed.
+	switch (m_params.method)
+	{
+		case METHOD_ALLOCATE:
+			VK_CHECK(vk.resetDescriptorPool(device, *m_pool, 0u));
+			break;
+
+		case METHOD_RESET_POOL:
+			VK_CHECK(vk.resetDescriptorPool(device, *m_pool, 0u));
+			allocateSets(numCalls);
+			break;
+
+		case METHOD_WRITE:
+			for (int setNdx = 1; setNdx <= numCalls; ++setNdx)
+				writes.push_back(makeBindingWrite(m_sets[setNdx], m_params, imageInfos, bufferInfos));
+			break;
+
+		case METHOD_COPY:
+			for (int setNdx = 1; setNdx <= numCalls; ++setNdx)
+				copies.push_back(makeBindingCopy(m_sets[0], m_sets[setNdx], m_params));
+			break;
+
+#ifndef CTS_USES_VULKANSC
+		case METHOD_UPDATE_TEMPLATE:
+			break;
+
+		case METHOD_PUSH_DESCRIPTOR:
+			writes.push_back(makeBindingWrite(DE_NULL, m_params, imageInfos, bufferInfos));
+			VK_CHECK(vk.resetCommandPool(device, *m_cmdPool, 0u));
+			break;
+#endif // CTS_USES_VULKANSC
+
+		default:
+			DE_ASSERT(false);
+	}
+
+	timer.begin();
+
+	switch (m_params.method)
+	{
+		case METHOD_ALLOCATE:
+			allocateSets(numCalls);
+			break;
+
+		case METHOD_RESET_POOL:
+			VK_CHECK(vk.resetDescriptorPool(device, *m_pool, 0u));
+			break;
+
+		case METHOD_WRITE:
+			vk.updateDescriptorSets(device, (deUint32)writes.size(), &writes[0], 0u, DE_NULL);
+			break;
+
+		case METHOD_COPY:
+			vk.updateDescriptorSets(device, 0u, DE_NULL, (deUint32)copies.size(), &copies[0]);
+			break;
+
+#ifndef CTS_USES_VULKANSC
+		case METHOD_UPDATE_TEMPLATE:
+		{
+			const void* const data = imageInfos ? (const void*)imageInfos : (const void*)bufferInfos;
+
+			for (int setNdx = 1; setNdx <= numCalls; ++setNdx)
+				vk.updateDescriptorSetWithTemplate(device, m_sets[setNdx], *m_updateTemplate, data);
+			break;
+		}
+
+		case METHOD_PUSH_DESCRIPTOR:
+			beginCommandBuffer(vk, *m_cmdBuffer, 0u);
+
+			for (int callNdx = 0; callNdx < numCalls; ++callNdx)
+				vk.cmdPushDescriptorSetKHR(*m_cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, *m_pipelineLayout, 0u, 1u, &writes[0]);
+
+			endCommandBuffer(vk, *m_cmdBuffer);
+			break;
+#endif // CTS_USES_VULKANSC
+
+		default:
+			DE_ASSERT(false);
+	}
+
+	timer.end();
+}
+
+class DescriptorBenchmarkCase : public TestCase
+{
+public:
+							DescriptorBenchmarkCase	(tcu::TestContext& testCtx, const std::string& name, const std::string& description, const TestParams& params);
+
+	void					checkSupport			(Context& context) const;
+	TestInstance*			createInstance			(Context& context) const;
+
+private:
+	const TestParams		m_params;
+};
+
+DescriptorBenchmarkCase::DescriptorBenchmarkCase (tcu::TestContext& testCtx, const std::string& name, const std::string& description, const TestParams& params)
+	: TestCase	(testCtx, name, description)
+	, m_params	(params)
+{
+}
+
+void DescriptorBenchmarkCase::checkSupport (Context& context) const
+{
+	const VkPhysicalDeviceLimits& limits = context.getDeviceProperties().limits;
+
+	if (m_params.descriptorCount > getMaxPerStageDescriptors(limits, m_params.descriptorType))
+		TCU_THROW(NotSupportedError, "Descriptor count exceeds per stage limit");
+
+#ifndef CTS_USES_VULKANSC
+	if (m_params.method == METHOD_UPDATE_TEMPLATE)
+		context.requireDeviceFunctionality("VK_KHR_descriptor_update_template");
+
+	if (m_params.method == METHOD_PUSH_DESCRIPTOR)
+	{
+		context.requireDeviceFunctionality("VK_KHR_push_descriptor");
+
+		if (m_params.descriptorCount > context.getPushDescriptorProperties().maxPushDescriptors)
+			TCU_THROW(NotSupportedError, "Descriptor count exceeds maxPushDescriptors");
+	}
+#endif // CTS_USES_VULKANSC
+}
+
+TestInstance* DescriptorBenchmarkCase::createInstance (Context& context) const
+{
+	return new DescriptorBenchmarkInstance(context, m_params);
+}
+
+void createChildren (tcu::TestCaseGroup* descriptorTests)
+{
+	tcu::TestContext&	testCtx		= descriptorTests->getTestContext();
+
+	static const struct
+	{
+		UpdateMethod	method;
+		const char*		name;
+		const char*		description;
+	} methods[] =
+	{
+		{ METHOD_ALLOCATE,			"allocate",				"vkAllocateDescriptorSets() per set"						},
+		{ METHOD_RESET_POOL,		"reset_pool",			"vkResetDescriptorPool(), per allocated set time"			},
+		{ METHOD_WRITE,				"write",				"One vkUpdateDescriptorSets() with a write per set"		},
+		{ METHOD_COPY,				"copy",					"One vkUpdateDescriptorSets() with a copy per set"		},
+#ifndef CTS_USES_VULKANSC
+		{ METHOD_UPDATE_TEMPLATE,	"update_template",		"vkUpdateDescriptorSetWithTemplate() per set"				},
+		{ METHOD_PUSH_DESCRIPTOR,	"push_descriptor",		"vkCmdPushDescriptorSetKHR() per set"						},
+#endif // CTS_USES_VULKANSC
+	};
+
+	static const struct
+	{
+		VkDescriptorType	type;
+		const char*			name;
+	} types[] =
+	{
+		{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,			"uniform_buffer"			},
+		{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,			"storage_buffer"			},
+		{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,	"combined_image_sampler"	},
+	};
+
+	static const deUint32 descriptorCounts[] = { 1u, 4u, 16u };
+
+	for (int methodNdx = 0; methodNdx < DE_LENGTH_OF_ARRAY(methods); ++methodNdx)
+	{
+		de::MovePtr<tcu::TestCaseGroup> methodGroup (new tcu::TestCaseGroup(testCtx, methods[methodNdx].name, methods[methodNdx].description));
+
+		for (int typeNdx = 0; typeNdx < DE_LENGTH_OF_ARRAY(types); ++typeNdx)
+		for (int countNdx = 0; countNdx < DE_LENGTH_OF_ARRAY(descriptorCounts); ++countNdx)
+		{
+			const TestParams	params	= { methods[methodNdx].method, types[typeNdx].type, descriptorCounts[countNdx] };
+			const std::string	name	= std::string(types[typeNdx].name) + "_" + de::toString(descriptorCounts[countNdx]);
+
+			methodGroup->addChild(new DescriptorBenchmarkCase(testCtx, name, "", params));
+		}
+
+		descriptorTests->addChild(methodGroup.release());
+	}
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createDescriptorTests (tcu::TestContext& testCtx)
+{
+	return createTestGroup(testCtx, "descriptor", "Descriptor allocation and update throughput", createChildren);
+}
+
+} // performance
+} // vkt
@@ -0,0 +1,687 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Draw call and state bind overhead benchmarks
+ *
+ * Measures CPU time spent recording draws and state changes into command
+ * buffers, executing secondary command buffers and submitting to a queue.
+ * Per call time is estimated from batches of varying size, so the fixed
+ * cost of beginning and ending a command buffer does not skew it.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceDrawCallTests.hpp"
+#include "vktPerformanceUtil.hpp"
+#include "vktTestCase.hpp"
+#include "vktTestGroupUtil.hpp"
+
+#include "vkBufferWithMemory.hpp"
+#include "vkImageWithMemory.hpp"
+#include "vkBuilderUtil.hpp"
+#include "vkCmdUtil.hpp"
+#include "vkObjUtil.hpp"
+#include "vkPipelineConstructionUtil.hpp"
+#include "vkRefUtil.hpp"
+#include "vkTypeUtil.hpp"
+
+#include "deUniquePtr.hpp"
+
+#include <vector>
+
+namespace vkt
+{
+namespace performance
+{
+
+using namespace vk;
+
+namespace
+{
+
+enum BenchmarkType
+{
+	BENCHMARK_RECORD = 0,
+	BENCHMARK_SECONDARY,
+	BENCHMARK_SUBMIT,
+
+	BENCHMARK_LAST
+};
+
+enum RecordCommand
+{
+	RECORD_DRAW = 0,
+	RECORD_DRAW_INDEXED,
+	RECORD_DRAW_INDIRECT,
+	RECORD_DRAW_INDEXED_INDIRECT,
+	RECORD_BIND_PIPELINE,			//!< Alternate between two pipelines, draw after each bind.
+	RECORD_BIND_DESCRIPTOR_SETS,	//!< Alternate between two descriptor sets, draw after each bind.
+	RECORD_PUSH_CONSTANTS,			//!< Push new values, draw after each push.
+	RECORD_DYNAMIC_STATE,			//!< Set viewport and scissor, draw after each set.
+
+	RECORD_LAST
+};
+
+enum SecondaryMode
+{
+	SECONDARY_EXECUTE_EACH = 0,		//!< One vkCmdExecuteCommands() per secondary command buffer.
+	SECONDARY_EXECUTE_BATCHED,		//!< All secondary command buffers in one vkCmdExecuteCommands().
+
+	SECONDARY_LAST
+};
+
+enum SubmitMode
+{
+	SUBMIT_SEPARATE = 0,			//!< One vkQueueSubmit() per command buffer.
+	SUBMIT_BATCHED_SUBMIT_INFOS,	//!< One vkQueueSubmit() with a VkSubmitInfo per command buffer.
+	SUBMIT_BATCHED_COMMAND_BUFFERS,	//!< One vkQueueSubmit() with one VkSubmitInfo holding all command buffers.
+
+	SUBMIT_LAST
+};
+
+struct TestParams
+{
+	BenchmarkType	type;
+	int				mode;			//!< RecordCommand, SecondaryMode or SubmitMode depending on type.
+	int				minCalls;
+	int				maxCalls;
+};
+
+const VkFormat	COLOR_FORMAT	= VK_FORMAT_R8G8B8A8_UNORM;
+const deUint32	RENDER_SIZE		= 32u;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Objects needed for recording draws
+ *
+ * Two pipelines and two descriptor sets are created so that binds in the
+ * state change benchmarks are never redundant. Viewport and scissor are
+ * dynamic in both pipelines.
+ *//*--------------------------------------------------------------------*/
+class DrawResources
+{
+public:
+									DrawResources		(Context& context);
+
+	//! Bind state used by all draws. Must be called in a render pass or secondary command buffer.
+	void							bindInitialState	(VkCommandBuffer cmdBuffer) const;
+
+	VkRenderPass					getRenderPass		(void) const { return *m_renderPass;	}
+	VkFramebuffer					getFramebuffer		(void) const { return *m_framebuffer;	}
+	VkPipeline						getPipeline			(int ndx) const { return m_pipelines[ndx]->getPipeline();	}
+	VkPipelineLayout				getPipelineLayout	(void) const { return *m_pipelineLayout;	}
+	VkDescriptorSet					getDescriptorSet	(int ndx) const { return *m_descriptorSets[ndx];	}
+	VkBuffer						getIndirectBuffer	(void) const { return m_indirectBuffer->get();	}
+
+	static VkRect2D					getRenderArea		(void) { return makeRect2D(RENDER_SIZE, RENDER_SIZE);	}
+
+	enum
+	{
+		INDEXED_INDIRECT_OFFSET	= sizeof(VkDrawIndirectCommand)
+	};
+
+private:
+	const DeviceInterface&						m_vk;
+	de::MovePtr<ImageWithMemory>				m_colorImage;
+	Move<VkImageView>							m_colorView;
+	Move<VkRenderPass>							m_renderPass;
+	Move<VkFramebuffer>							m_framebuffer;
+	Move<VkDescriptorSetLayout>					m_descriptorSetLayout;
+	Move<VkDescriptorPool>						m_descriptorPool;
+	Move<VkDescriptorSet>						m_descriptorSets[2];
+	Move<VkPipelineLayout>						m_pipelineLayout;
+	Move<VkShaderModule>						m_vertexShader;
+	Move<VkShaderModule>						m_fragmentShader;
+	de::MovePtr<GraphicsPipelineWrapper>		m_pipelines[2];
+	de::MovePtr<BufferWithMemory>				m_uniformBuffer;
+	de::MovePtr<BufferWithMemory>				m_indexBuffer;
+	de::MovePtr<BufferWithMemory>				m_indirectBuffer;
+};
+
+DrawResources::DrawResources (Context& context)
+	: m_vk	(context.getDeviceInterface())
+{
+	const VkDevice			device			= context.getDevice();
+	Allocator&				allocator		= context.getDefaultAllocator();
+	const VkDeviceSize		uniformStride	= de::max<VkDeviceSize>(sizeof(tcu::Vec4), context.getDeviceProperties().limits.minUniformBufferOffsetAlignment);
+
+	// Color target
+	{
+		const VkImageCreateInfo imageCreateInfo =
+		{
+			VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,		// VkStructureType			sType;
+			DE_NULL,									// const void*				pNext;
+			0u,											// VkImageCreateFlags		flags;
+			VK_IMAGE_TYPE_2D,							// VkImageType				imageType;
+			COLOR_FORMAT,								// VkFormat					format;
+			makeExtent3D(RENDER_SIZE, RENDER_SIZE, 1u),	// VkExtent3D				extent;
+			1u,											// deUint32					mipLevels;
+			1u,											// deUint32					arrayLayers;
+			VK_SAMPLE_COUNT_1_BIT,						// VkSampleCountFlagBits	samples;
+			VK_IMAGE_TILING_OPTIMAL,					// VkImageTiling			tiling;
+			VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,		// VkImageUsageFlags		usage;
+			VK_SHARING_MODE_EXCLUSIVE,					// VkSharingMode			sharingMode;
+			0u,											// deUint32					queueFamilyIndexCount;
+			DE_NULL,									// const deUint32*			pQueueFamilyIndices;
+			VK_IMAGE_LAYOUT_UNDEFINED,					// VkImageLayout			initialLayout;
+		};
+
+		m_colorImage	= de::MovePtr<ImageWithMemory>(new ImageWithMemory(m_vk, device, allocator, imageCreateInfo, MemoryRequirement::Any));
+		m_colorView		= makeImageView(m_vk, device, m_colorImage->get(), VK_IMAGE_VIEW_TYPE_2D, COLOR_FORMAT, makeImageSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u));
+		m_renderPass	= makeRenderPass(m_vk, device, COLOR_FORMAT);
+		m_framebuffer	= makeFramebuffer(m_vk, device, *m_renderPass, *m_colorView, RENDER_SIZE, RENDER_SIZE);
+	}
+
+	// Buffers
+	{
+		const deUint32					indices[]		= { 0u, 1u, 2u };
+		const VkDrawIndirectCommand		drawCommand		= { 3u, 1u, 0u, 0u };
+		const VkDrawIndexedIndirectCommand	indexedCommand	= { 3u, 1u, 0u, 0, 0u };
+
+		m_uniformBuffer		= de::MovePtr<BufferWithMemory>(new BufferWithMemory(m_vk, device, allocator, makeBufferCreateInfo(2u * uniformStride, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT), MemoryRequirement::HostVisible));
+		m_indexBuffer		= de::MovePtr<BufferWithMemory>(new BufferWithMemory(m_vk, device, allocator, makeBufferCreateInfo(sizeof(indices), VK_BUFFER_USAGE_INDEX_BUFFER_BIT), MemoryRequirement::HostVisible));
+		m_indirectBuffer	= de::MovePtr<BufferWithMemory>(new BufferWithMemory(m_vk, device, allocator, makeBufferCreateInfo(INDEXED_INDIRECT_OFFSET + sizeof(indexedCommand), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT), MemoryRequirement::HostVisible));
+
+		deMemset(m_uniformBuffer->getAllocation().getHostPtr(), 0, (size_t)(2u * uniformStride));
+		deMemcpy(m_indexBuffer->getAllocation().getHostPtr(), indices, sizeof(indices));
+		deMemcpy(m_indirectBuffer->getAllocation().getHostPtr(), &drawCommand, sizeof(drawCommand));
+		deMemcpy((deUint8*)m_indirectBuffer->getAllocation().getHostPtr() + INDEXED_INDIRECT_OFFSET, &indexedCommand, sizeof(indexedCommand));
+
+		flushAlloc(m_vk, device, m_uniformBuffer->getAllocation());
+		flushAlloc(m_vk, device, m_indexBuffer->getAllocation());
+		flushAlloc(m_vk, device, m_indirectBuffer->getAllocation());
+	}
+
+	// Descriptors
+	{
+		m_descriptorSetLayout	= DescriptorSetLayoutBuilder()
+									.addSingleBinding(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+									.build(m_vk, device);
+		m_descriptorPool		= DescriptorPoolBuilder()
+									.addType(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2u)
+									.build(m_vk, device, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 2u);
+
+		for (int setNdx = 0; setNdx < 2; ++setNdx)
+		{
+			const VkDescriptorBufferInfo bufferInfo = makeDescriptorBufferInfo(m_uniformBuffer->get(), (VkDeviceSize)setNdx * uniformStride, sizeof(tcu::Vec4));
+
+			m_descriptorSets[setNdx] = makeDescriptorSet(m_vk, device, *m_descriptorPool, *m_descriptorSetLayout);
+
+			DescriptorSetUpdateBuilder()
+				.writeSingle(*m_descriptorSets[setNdx], DescriptorSetUpdateBuilder::Location::binding(0u), VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, &bufferInfo)
+				.update(m_vk, device);
+		}
+	}
+
+	// Pipelines
+	{
+		const VkPushConstantRange						pushConstantRange	= { VK_SHADER_STAGE_VERTEX_BIT, 0u, (deUint32)sizeof(tcu::Vec4) };
+		const VkPipelineVertexInputStateCreateInfo		vertexInputState	= initVulkanStructure();
+		const VkDynamicState							dynamicStates[]		= { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+		const VkPipelineDynamicStateCreateInfo			dynamicState		=
+		{
+			VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,	// VkStructureType						sType;
+			DE_NULL,												// const void*							pNext;
+			0u,														// VkPipelineDynamicStateCreateFlags	flags;
+			DE_LENGTH_OF_ARRAY(dynamicStates),						// deUint32								dynamicStateCount;
+			dynamicStates											// const VkDynamicState*				pDynamicStates;
+		};
+		const VkSpecializationMapEntry					specMapEntry		= { 0u, 0u, sizeof(float) };
+		const float										depthValues[]		= { 0.25f, 0.75f };
+		const std::vector<VkViewport>					viewports;
+		const std::vector<VkRect2D>						scissors;
+
+		m_pipelineLayout	= makePipelineLayout(m_vk, device, 1u, &m_descriptorSetLayout.get(), 1u, &pushConstantRange);
+		m_vertexShader		= createShaderModule(m_vk, device, context.getBinaryCollection().get("vert"), 0u);
+		m_fragmentShader	= createShaderModule(m_vk, device, context.getBinaryCollection().get("frag"), 0u);
+
+		for (int pipelineNdx = 0; pipelineNdx < 2; ++pipelineNdx)
+		{
+			const VkSpecializationInfo specInfo =
+			{
+				1u,							// deUint32							mapEntryCount;
+				&specMapEntry,				// const VkSpecializationMapEntry*	pMapEntries;
+				sizeof(float),				// size_t							dataSize;
+				&depthValues[pipelineNdx]	// const void*						pData;
+			};
+
+			m_pipelines[pipelineNdx] = de::MovePtr<GraphicsPipelineWrapper>(new GraphicsPipelineWrapper(m_vk, device, PIPELINE_CONSTRUCTION_TYPE_MONOLITHIC));
+			m_pipelines[pipelineNdx]->setDynamicState(&dynamicState)
+									 .setDefaultRasterizationState()
+									 .setDefaultMultisampleState()
+									 .setDefaultColorBlendState()
+									 .setupVertexInputState(&vertexInputState)
+									 .setupPreRasterizationShaderState(viewports,
+																	   scissors,
+																	   *m_pipelineLayout,
+																	   *m_renderPass,
+																	   0u,
+																	   *m_vertexShader,
+																	   DE_NULL,
+																	   DE_NULL,
+																	   DE_NULL,
+																	   DE_NULL,
+																	   &specInfo)
+									 .setupFragmentShaderState(*m_pipelineLayout, *m_renderPass, 0u, *m_fragmentShader)
+									 .setupFragmentOutputState(*m_renderPass)
+									 .setMonolithicPipelineLayout(*m_pipelineLayout)
+									 .buildPipeline();
+		}
+	}
+}
+
+void DrawResources::bindInitialState (VkCommandBuffer cmdBuffer) const
+{
+	const VkViewport	viewport	= makeViewport(RENDER_SIZE, RENDER_SIZE);
+	const VkRect2D		scissor		= getRenderArea();
+	const tcu::Vec4		scale		(0.1f);
+
+	m_vk.cmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, getPipeline(0));
+	m_vk.cmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *m_pipelineLayout, 0u, 1u, &m_descriptorSets[0].get(), 0u, DE_NULL);
+	m_vk.cmdPushConstants(cmdBuffer, *m_pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0u, (deUint32)sizeof(scale), scale.getPtr());
+	m_vk.cmdSetViewport(cmdBuffer, 0u, 1u, &viewport);
+	m_vk.cmdSetScissor(cmdBuffer, 0u, 1u, &scissor);
+	m_vk.cmdBindIndexBuffer(cmdBuffer, m_indexBuffer->get(), 0u, VK_INDEX_TYPE_UINT32);
+}
+
+class RecordBenchmarkInstance : public CallBenchmarkInstance
+{
+public:
+							RecordBenchmarkInstance		(Context& context, const TestParams& params);
+
+protected:
+	void					run							(int numCalls, tcu::PerfTimer& timer);
+
+private:
+	void					recordCall					(VkCommandBuffer cmdBuffer, int callNdx) const;
+
+	const RecordCommand		m_command;
+	const DrawResources		m_resources;
+	Move<VkCommandPool>		m_cmdPool;
+	Move<VkCommandBuffer>	m_cmdBuffer;
+};
+
+RecordBenchmarkInstance::RecordBenchmarkInstance (Context& context, const TestParams& params)
+	: CallBenchmarkInstance	(context, params.minCalls, params.maxCalls)
+	, m_command				((RecordCommand)params.mode)
+	, m_resources			(context)
+	, m_cmdPool				(makeCommandPool(context.getDeviceInterface(), context.getDevice(), context.getUniversalQueueFamilyIndex()))
+	, m_cmdBuffer			(allocateCommandBuffer(context.getDeviceInterface(), context.getDevice(), *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))
+{
+}
+
+void RecordBenchmarkInstance::recordCall (VkCommandBuffer cmdBuffer, int callNdx) const
+{
+	const DeviceInterface&	vk			= m_context.getDeviceInterface();
+	const int				alternate	= callNdx & 1;
+
+	switch (m_command)
+	{
+		case RECORD_DRAW:
+			break;
+
+		case RECORD_DRAW_INDEXED:
+			vk.cmdDrawIndexed(cmdBuffer, 3u, 1u, 0u, 0, 0u);
+			return;
+
+		case RECORD_DRAW_INDIRECT:
+			vk.cmdDrawIndirect(cmdBuffer, m_resources.getIndirectBuffer(), 0u, 1u, sizeof(VkDrawIndirectCommand));
+			return;
+
+		case RECORD_DRAW_INDEXED_INDIRECT:
+			vk.cmdDrawIndexedIndirect(cmdBuffer, m_resources.getIndirectBuffer(), DrawResources::INDEXED_INDIRECT_OFFSET, 1u, sizeof(VkDrawIndexedIndirectCommand));
+			return;
+
+		case RECORD_BIND_PIPELINE:
+			vk.cmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_resources.getPipeline(1 - alternate));
+			break;
+
+		case RECORD_BIND_DESCRIPTOR_SETS:
+		{
+			const VkDescriptorSet descriptorSet = m_resources.getDescriptorSet(1 - alternate);
+			vk.cmdBindDescriptorSets(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_resources.getPipelineLayout(), 0u, 1u, &descriptorSet, 0u, DE_NULL);
+			break;
+		}
+
+		case RECORD_PUSH_CONSTANTS:
+		{
+			const tcu::Vec4 scale ((float)(callNdx % 16) / 16.0f);
+			vk.cmdPushConstants(cmdBuffer, m_resources.getPipelineLayout(), VK_SHADER_STAGE_VERTEX_BIT, 0u, (deUint32)sizeof(scale), scale.getPtr());
+			break;
+		}
+
+		case RECORD_DYNAMIC_STATE:
+		{
+			const deUint32		size		= RENDER_SIZE >> alternate;
+			const VkViewport	viewport	= makeViewport(size, size);
+			const VkRect2D		scissor		= makeRect2D(size, size);
+
+			vk.cmdSetViewport(cmdBuffer, 0u, 1u, &viewport);
+			vk.cmdSetScissor(cmdBuffer, 0u, 1u, &scissor);
+			break;
+		}
+
+		default:
+			DE_ASSERT(false);
+	}
+
+	vk.cmdDraw(cmdBuffer, 3u, 1u, 0u, 0u);
+}
+
+void RecordBenchmarkInstance::run (int numCalls, tcu::PerfTimer& timer)
+{
+	const DeviceInterface&	vk			= m_context.getDeviceInterface();
+
+	VK_CHECK(vk.resetCommandPool(m_context.getDevice(), *m_cmdPool, 0u));
+
+	timer.begin();
+
+	beginCommandBuffer(vk, *m_cmdBuffer, 0u);
+	beginRenderPass(vk, *m_cmdBuffer, m_resources.getRenderPass(), m_resources.getFramebuffer(), DrawResources::getRenderArea(), tcu::Vec4(0.0f));
+	m_resources.bindInitialState(*m_cmdBuffer);
+
+	for (int callNdx = 0; callNdx < numCalls; ++callNdx)
+		recordCall(*m_cmdBuffer, callNdx);
+
+	endRenderPass(vk, *m_cmdBuffer);
+	endCommandBuffer(vk, *m_cmdBuffer);
+
+	timer.end();
+}
+
+class SecondaryBenchmarkInstance : public CallBenchmarkInstance
+{
+public:
+										SecondaryBenchmarkInstance	(Context& context, const TestParams& params);
+
+protected:
+	void								run							(int numCalls, tcu::PerfTimer& timer);
+
+private:
+	const SecondaryMode					m_mode;
+	const DrawResources					m_resources;
+	Move<VkCommandPool>					m_secondaryCmdPool;
+	std::vector<VkCommandBuffer>		m_secondaryCmdBuffers;
+	Move<VkCommandPool>					m_cmdPool;
+	Move<VkCommandBuffer>				m_cmdBuffer;
+};
+
+SecondaryBenchmarkInstance::SecondaryBenchmarkInstance (Context& context, const TestParams& params)
+	: CallBenchmarkInstance		(context, params.minCalls, params.maxCalls)
+	, m_mode					((SecondaryMode)params.mode)
+	, m_resources				(context)
+	, m_secondaryCmdPool		(makeCommandPool(context.getDeviceInterface(), context.getDevice(), context.getUniversalQueueFamilyIndex()))
+	, m_secondaryCmdBuffers		(params.maxCalls)
+	, m_cmdPool					(makeCommandPool(context.getDeviceInterface(), context.getDevice(), context.getUniversalQueueFamilyIndex()))
+	, m_cmdBuffer				(allocateCommandBuffer(context.getDeviceInterface(), context.getDevice(), *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY))
+{
+	const DeviceInterface&				vk				= context.getDeviceInterface();
+	const VkCommandBufferAllocateInfo	allocateInfo	=
+	{
+		VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,		// VkStructureType			sType;
+		DE_NULL,											// const void*				pNext;
+		*m_secondaryCmdPool,								// VkCommandPool			commandPool;
+		VK_COMMAND_BUFFER_LEVEL_SECONDARY,					// VkCommandBufferLevel		level;
+		(deUint32)params.maxCalls,							// deUint32					commandBufferCount;
+	};
+
+	// Secondary command buffers are freed with the pool.
+	VK_CHECK(vk.allocateCommandBuffers(context.getDevice(), &allocateInfo, &m_secondaryCmdBuffers[0]));
+
+	for (size_t cmdBufferNdx = 0; cmdBufferNdx < m_secondaryCmdBuffers.size(); ++cmdBufferNdx)
+	{
+		const VkCommandBuffer cmdBuffer = m_secondaryCmdBuffers[cmdBufferNdx];
+
+		beginSecondaryCommandBuffer(vk, cmdBuffer, m_resources.getRenderPass(), m_resources.getFramebuffer(), 0u);
+		m_resources.bindInitialState(cmdBuffer);
+		vk.cmdDraw(cmdBuffer, 3u, 1u, 0u, 0u);
+		endCommandBuffer(vk, cmdBuffer);
+	}
+}
+
+void SecondaryBenchmarkInstance::run (int numCalls, tcu::PerfTimer& timer)
+{
+	const DeviceInterface&	vk			= m_context.getDeviceInterface();
+
+	DE_ASSERT(numCalls <= (int)m_secondaryCmdBuffers.size());
+
+	VK_CHECK(vk.resetCommandPool(m_context.getDevice(), *m_cmdPool, 0u));
+
+	timer.begin();
+
+	beginCommandBuffer(vk, *m_cmdBuffer, 0u);
+	beginRenderPass(vk, *m_cmdBuffer, m_resources.getRenderPass(), m_resources.getFramebuffer(), DrawResources::getRenderArea(), tcu::Vec4(0.0f), VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+	if (m_mode == SECONDARY_EXECUTE_EACH)
+	{
+		for (int callNdx = 0; callNdx < numCalls; ++callNdx)
+			vk.cmdExecuteCommands(*m_cmdBuffer, 1u, &m_secondaryCmdBuffers[callNdx]);
+	}
+	else
+		vk.cmdExecuteCommands(*m_cmdBuffer, (deUint32)numCalls, &m_secondaryCmdBuffers[0]);
+
+	endRenderPass(vk, *m_cmdBuffer);
+	endCommandBuffer(vk, *m_cmdBuffer);
+
+	timer.end();
+}
+
+class SubmitBenchmarkInstance : public CallBenchmarkInstance
+{
+public:
+										SubmitBenchmarkInstance		(Context& context, const TestParams& params);
+
+protected:
+	void								run							(int numCalls, tcu::PerfTimer& timer);
+
+private:
+	const SubmitMode					m_mode;
+	Move<VkCommandPool>					m_cmdPool;
+	std::vector<VkCommandBuffer>		m_cmdBuffers;
+	std::vector<VkSubmitInfo>			m_submitInfos;
+};
+
+SubmitBenchmarkInstance::SubmitBenchmarkInstance (Context& context, const TestParams& params)
+	: CallBenchmarkInstance		(context, params.minCalls, params.maxCalls)
+	, m_mode					((SubmitMode)params.mode)
+	, m_cmdPool					(makeCommandPool(context.getDeviceInterface(), context.getDevice(), context.getUniversalQueueFamilyIndex()))
+	, m_cmdBuffers				(params.maxCalls)
+	, m_submitInfos				(params.maxCalls)
+{
+	const DeviceInterface&				vk				= context.getDeviceInterface();
+	const VkCommandBufferAllocateInfo	allocateInfo	=
+	{
+		VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,		// VkStructureType			sType;
+		DE_NULL,											// const void*				pNext;
+		*m_cmdPool,											// VkCommandPool			commandPool;
+		VK_COMMAND_BUFFER_LEVEL_PRIMARY,					// VkCommandBufferLevel		level;
+		(deUint32)params.maxCalls,							// deUint32					commandBufferCount;
+	};
+
+	VK_CHECK(vk.allocateCommandBuffers(context.getDevice(), &allocateInfo, &m_cmdBuffers[0]));
+
+	// Empty command buffers, so that only submission cost is measured.
+	for (size_t cmdBufferNdx = 0; cmdBufferNdx < m_cmdBuffers.size(); ++cmdBufferNdx)
+	{
+		beginCommandBuffer(vk, m_cmdBuffers[cmdBufferNdx], 0u);
+		endCommandBuffer(vk, m_cmdBuffers[cmdBufferNdx]);
+
+		m_submitInfos[cmdBufferNdx]						= initVulkanStructure();
+		m_submitInfos[cmdBufferNdx].commandBufferCount	= 1u;
+		m_submitInfos[cmdBufferNdx].pCommandBuffers		= &m_cmdBuffers[cmdBufferNdx];
+	}
+}
+
+void SubmitBenchmarkInstance::run (int numCalls, tcu::PerfTimer& timer)
+{
+	const DeviceInterface&	vk			= m_context.getDeviceInterface();
+	const VkQueue			queue		= m_context.getUniversalQueue();
+	VkSubmitInfo			batchedInfo	= initVulkanStructure();
+
+	DE_ASSERT(numCalls <= (int)m_cmdBuffers.size());
+
+	batchedInfo.commandBufferCount	= (deUint32)numCalls;
+	batchedInfo.pCommandBuffers		= &m_cmdBuffers[0];
+
+	timer.begin();
+
+	switch (m_mode)
+	{
+		case SUBMIT_SEPARATE:
+			for (int callNdx = 0; callNdx < numCalls; ++callNdx)
+				VK_CHECK(vk.queueSubmit(queue, 1u, &m_submitInfos[callNdx], DE_NULL));
+			break;
+
+		case SUBMIT_BATCHED_SUBMIT_INFOS:
+			VK_CHECK(vk.queueSubmit(queue, (deUint32)numCalls, &m_submitInfos[0], DE_NULL));
+			break;
+
+		case SUBMIT_BATCHED_COMMAND_BUFFERS:
+			VK_CHECK(vk.queueSubmit(queue, 1u, &batchedInfo, DE_NULL));
+			break;
+
+		default:
+			DE_ASSERT(false);
+	}
+
+	timer.end();
+
+	VK_CHECK(vk.queueWaitIdle(queue));
+}
+
+class DrawCallBenchmarkCase : public TestCase
+{
+public:
+							DrawCallBenchmarkCase	(tcu::TestContext& testCtx, const std::string& name, const std::string& description, const TestParams& params);
+
+	void					initPrograms			(SourceCollections& programCollection) const;
+	TestInstance*			createInstance			(Context& context) const;
+
+private:
+	const TestParams		m_params;
+};
+
+DrawCallBenchmarkCase::DrawCallBenchmarkCase (tcu::TestContext& testCtx, const std::string& name, const std::string& description, const TestParams& params)
+	: TestCase	(testCtx, name, description)
+	, m_params	(params)
+{
+}
+
+void DrawCallBenchmarkCase::initPrograms (SourceCollections& programCollection) const
+{
+	if (m_params.type == BENCHMARK_SUBMIT)
+		return;
+
+	programCollection.glslSources.add("vert") << glu::VertexSource(
+		"#version 450\n"
+		"layout(constant_id = 0) const float depth = 0.0;\n"
+		"layout(set = 0, binding = 0) uniform Offset { vec4 offset; } u_offset;\n"
+		"layout(push_constant) uniform PushConstants { vec4 scale; } pc;\n"
+		"\n"
+		"void main (void)\n"
+		"{\n"
+		"	const vec2 pos = vec2(float(gl_VertexIndex & 1), float(gl_VertexIndex >> 1));\n"
+		"	gl_Position = vec4(pos * pc.scale.xy + u_offset.offset.xy, depth, 1.0);\n"
+		"}\n");
+
+	programCollection.glslSources.add("frag") << glu::FragmentSource(
+		"#version 450\n"
+		"layout(location = 0) out vec4 o_color;\n"
+		"\n"
+		"void main (void)\n"
+		"{\n"
+		"	o_color = vec4(1.0);\n"
+		"}\n");
+}
+
+TestInstance* DrawCallBenchmarkCase::createInstance (Context& context) const
+{
+	switch (m_params.type)
+	{
+		case BENCHMARK_RECORD:		return new RecordBenchmarkInstance(context, m_params);
+		case BENCHMARK_SECONDARY:	return new SecondaryBenchmarkInstance(context, m_params);
+		case BENCHMARK_SUBMIT:		return new SubmitBenchmarkInstance(context, m_params);
+		default:
+			DE_ASSERT(false);
+			return DE_NULL;
+	}
+}
+
+void createRecordTests (tcu::TestCaseGroup* group)
+{
+	static const struct
+	{
+		RecordCommand	command;
+		const char*		name;
+		const char*		description;
+	} commands[] =
+	{
+		{ RECORD_DRAW,					"draw",						"vkCmdDraw()"												},
+		{ RECORD_DRAW_INDEXED,			"draw_indexed",				"vkCmdDrawIndexed()"										},
+		{ RECORD_DRAW_INDIRECT,			"draw_indirect",			"vkCmdDrawIndirect()"										},
+		{ RECORD_DRAW_INDEXED_INDIRECT,	"draw_indexed_indirect",	"vkCmdDrawIndexedIndirect()"								},
+		{ RECORD_BIND_PIPELINE,			"bind_pipeline",			"vkCmdBindPipeline() followed by vkCmdDraw()"				},
+		{ RECORD_BIND_DESCRIPTOR_SETS,	"bind_descriptor_sets",		"vkCmdBindDescriptorSets() followed by vkCmdDraw()"			},
+		{ RECORD_PUSH_CONSTANTS,		"push_constants",			"vkCmdPushConstants() followed by vkCmdDraw()"				},
+		{ RECORD_DYNAMIC_STATE,			"dynamic_state",			"vkCmdSetViewport() and vkCmdSetScissor() followed by vkCmdDraw()"	},
+	};
+
+	for (int commandNdx = 0; commandNdx < DE_LENGTH_OF_ARRAY(commands); ++commandNdx)
+	{
+		const TestParams params = { BENCHMARK_RECORD, commands[commandNdx].command, 64, 4096 };
+		group->addChild(new DrawCallBenchmarkCase(group->getTestContext(), commands[commandNdx].name, commands[commandNdx].description, params));
+	}
+}
+
+void createSecondaryTests (tcu::TestCaseGroup* group)
+{
+	const TestParams eachParams		= { BENCHMARK_SECONDARY, SECONDARY_EXECUTE_EACH,	16, 1024 };
+	const TestParams batchedParams	= { BENCHMARK_SECONDARY, SECONDARY_EXECUTE_BATCHED,	16, 1024 };
+
+	group->addChild(new DrawCallBenchmarkCase(group->getTestContext(), "execute_each",		"vkCmdExecuteCommands() per secondary command buffer",					eachParams));
+	group->addChild(new DrawCallBenchmarkCase(group->getTestContext(), "execute_batched",	"All secondary command buffers in one vkCmdExecuteCommands()",			batchedParams));
+}
+
+void createSubmitTests (tcu::TestCaseGroup* group)
+{
+	const TestParams separateParams			= { BENCHMARK_SUBMIT, SUBMIT_SEPARATE,					1, 256 };
+	const TestParams submitInfosParams		= { BENCHMARK_SUBMIT, SUBMIT_BATCHED_SUBMIT_INFOS,		1, 256 };
+	const TestParams commandBuffersParams	= { BENCHMARK_SUBMIT, SUBMIT_BATCHED_COMMAND_BUFFERS,	1, 256 };
+
+	group->addChild(new DrawCallBenchmarkCase(group->getTestContext(), "separate",					"vkQueueSubmit() per command buffer",										separateParams));
+	group->addChild(new DrawCallBenchmarkCase(group->getTestContext(), "batched_submit_infos",		"One vkQueueSubmit() with VkSubmitInfo per command buffer",					submitInfosParams));
+	group->addChild(new DrawCallBenchmarkCase(group->getTestContext(), "batched_command_buffers",	"One vkQueueSubmit() with all command buffers in one VkSubmitInfo",			commandBuffersParams));
+}
+
+void createChildren (tcu::TestCaseGroup* drawCallTests)
+{
+	tcu::TestContext& testCtx = drawCallTests->getTestContext();
+
+	drawCallTests->addChild(createTestGroup(testCtx, "record",		"Command recording, per call time",				createRecordTests));
+	drawCallTests->addChild(createTestGroup(testCtx, "secondary",	"Secondary command buffer execution",			createSecondaryTests));
+	drawCallTests->addChild(createTestGroup(testCtx, "submit",		"Queue submission of empty command buffers",	createSubmitTests));
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createDrawCallTests (tcu::TestContext& testCtx)
+{
+	return createTestGroup(testCtx, "draw_call", "Draw call and state bind overhead", createChildren);
+}
+
+} // performance
+} // vkt
@@ -0,0 +1,493 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Device memory allocation latency benchmarks
+ *
+ * A pool of live allocations is first filled and then churned: one
+ * allocation chosen by the free pattern is freed and replaced by a new
+ * one, repeatedly. Latency of each vkFreeMemory() and vkAllocateMemory()
+ * call in the churn is timed, so the results reflect steady state with
+ * the given number of live allocations and the fragmentation caused by
+ * the free pattern.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceMemoryAllocationTests.hpp"
+#include "vktPerformanceUtil.hpp"
+#include "vktTestCase.hpp"
+#include "vktTestGroupUtil.hpp"
+
+#include "vkMemUtil.hpp"
+#include "vkObjUtil.hpp"
+#include "vkQueryUtil.hpp"
+#include "vkRefUtil.hpp"
+
+#include "tcuCommandLine.hpp"
+#include "tcuCPUWarmup.hpp"
+
+#include "deClock.h"
+#include "deRandom.hpp"
+#include "deStringUtil.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace vkt
+{
+namespace performance
+{
+
+using namespace vk;
+using tcu::TestLog;
+
+namespace
+{
+
+enum FreePattern
+{
+	FREE_PATTERN_FIFO = 0,		//!< Free the oldest allocation.
+	FREE_PATTERN_LIFO,			//!< Free the newest allocation.
+	FREE_PATTERN_RANDOM,		//!< Free a randomly chosen allocation.
+
+	FREE_PATTERN_LAST
+};
+
+struct TestParams
+{
+	FreePattern		freePattern;
+	VkDeviceSize	size;				//!< Allocation size, or 0 for random power of two sizes.
+	int				numLiveAllocations;
+	bool			dedicated;			//!< Allocate dedicated memory for a buffer.
+};
+
+enum
+{
+	NUM_CHURN_OPERATIONS	= 1024,
+	MIN_MIXED_SIZE_LOG2		= 12,		//!< 4 KiB
+	MAX_MIXED_SIZE_LOG2		= 20		//!< 1 MiB
+};
+
+VkDeviceSize getMaxAllocationSize (const TestParams& params)
+{
+	return params.size != 0 ? params.size : (VkDeviceSize)1u << MAX_MIXED_SIZE_LOG2;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Set of live allocations freed on destruction
+ *
+ * Raw handles are used instead of Move<> so that vkAllocateMemory() and
+ * vkFreeMemory() can be timed on their own.
+ *//*--------------------------------------------------------------------*/
+class LiveAllocations
+{
+public:
+								LiveAllocations		(const DeviceInterface& vk, VkDevice device) : m_vk(vk), m_device(device) {}
+								~LiveAllocations	(void) { clear(); }
+
+	void						clear				(void);
+
+	std::vector<VkDeviceMemory>	memory;
+	std::vector<VkBuffer>		buffers;			//!< Dedicated allocation owners, empty if not dedicated.
+
+private:
+	const DeviceInterface&		m_vk;
+	const VkDevice				m_device;
+};
+
+void LiveAllocations::clear (void)
+{
+	for (size_t ndx = 0; ndx < memory.size(); ++ndx)
+		m_vk.freeMemory(m_device, memory[ndx], DE_NULL);
+
+	for (size_t ndx = 0; ndx < buffers.size(); ++ndx)
+		m_vk.destroyBuffer(m_device, buffers[ndx], DE_NULL);
+
+	memory.clear();
+	buffers.clear();
+}
+
+struct LatencyStats
+{
+	float		p50;
+	float		p90;
+	float		p99;
+	float		max;
+};
+
+LatencyStats getLatencyStats (std::vector<float> latencies)
+{
+	LatencyStats stats;
+
+	std::sort(latencies.begin(), latencies.end());
+
+	stats.p50	= tcu::linearSample(latencies, 0.50f);
+	stats.p90	= tcu::linearSample(latencies, 0.90f);
+	stats.p99	= tcu::linearSample(latencies, 0.99f);
+	stats.max	= latencies.back();
+
+	return stats;
+}
+
+void logLatencyStats (TestLog& log, const std::string& name, const std::string& description, const LatencyStats& stats)
+{
+	log << TestLog::Float(name + "P50",	description + ", median",			"us",	QP_KEY_TAG_TIME,	stats.p50)
+		<< TestLog::Float(name + "P90",	description + ", 90th percentile",	"us",	QP_KEY_TAG_TIME,	stats.p90)
+		<< TestLog::Float(name + "P99",	description + ", 99th percentile",	"us",	QP_KEY_TAG_TIME,	stats.p99)
+		<< TestLog::Float(name + "Max",	description + ", maximum",			"us",	QP_KEY_TAG_TIME,	stats.max);
+}
+
+class MemoryAllocationInstance : public TestInstance
+{
+public:
+										MemoryAllocationInstance	(Context& context, const TestParams& params);
+
+	tcu::TestStatus						iterate						(void);
+
+private:
+	struct TypeResult
+	{
+		std::vector<float>				allocateLatencies;
+		std::vector<float>				freeLatencies;
+		VkDeviceSize					heapUsageBefore;
+		VkDeviceSize					heapUsagePeak;
+		VkDeviceSize					heapUsageAfter;
+		VkDeviceSize					liveBytes;
+	};
+
+	VkDeviceSize						getHeapUsage				(deUint32 heapNdx) const;
+	deUint64							allocateSlot				(LiveAllocations& allocations, size_t slot, deUint32 memoryTypeNdx, VkDeviceSize size);
+	deUint64							freeSlot					(LiveAllocations& allocations, size_t slot);
+	TypeResult							measureMemoryType			(deUint32 memoryTypeNdx);
+
+	const TestParams					m_params;
+	const VkPhysicalDeviceMemoryProperties	m_memoryProperties;
+	const bool							m_hasMemoryBudget;
+	de::Random							m_rnd;
+};
+
+MemoryAllocationInstance::MemoryAllocationInstance (Context& context, const TestParams& params)
+	: TestInstance			(context)
+	, m_params				(params)
+	, m_memoryProperties	(getPhysicalDeviceMemoryProperties(context.getInstanceInterface(), context.getPhysicalDevice()))
+	, m_hasMemoryBudget		(context.isDeviceFunctionalitySupported("VK_EXT_memory_budget"))
+	, m_rnd					(0x3c1a9e5b)
+{
+}
+
+//! Heap usage reported by VK_EXT_memory_budget, or 0 if not supported.
+VkDeviceSize MemoryAllocationInstance::getHeapUsage (deUint32 heapNdx) const
+{
+	if (!m_hasMemoryBudget)
+		return 0u;
+
+	{
+		VkPhysicalDeviceMemoryBudgetPropertiesEXT	budgetProps	= initVulkanStructure();
+		VkPhysicalDeviceMemoryProperties2			memProps	= initVulkanStructure(&budgetProps);
+
+		m_context.getInstanceInterface().getPhysicalDeviceMemoryProperties2(m_context.getPhysicalDevice(), &memProps);
+
+		return budgetProps.heapUsage[heapNdx];
+	}
+}
+
+deUint64 MemoryAllocationInstance::allocateSlot (LiveAllocations& allocations, size_t slot, deUint32 memoryTypeNdx, VkDeviceSize size)
+{
+	const DeviceInterface&			vk				= m_context.getDeviceInterface();
+	const VkDevice					device			= m_context.getDevice();
+	VkMemoryDedicatedAllocateInfo	dedicatedInfo	= initVulkanStructure();
+	VkMemoryAllocateInfo			allocInfo		= initVulkanStructure();
+	VkDeviceMemory					memory			= DE_NULL;
+	deUint64						startTime;
+	deUint64						endTime;
+
+	allocInfo.allocationSize	= size;
+	allocInfo.memoryTypeIndex	= memoryTypeNdx;
+
+	if (m_params.dedicated)
+	{
+		Move<VkBuffer> buffer = makeBuffer(vk, device, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+		dedicatedInfo.buffer		= *buffer;
+		allocInfo.allocationSize	= getBufferMemoryRequirements(vk, device, *buffer).size;
+		allocInfo.pNext				= &dedicatedInfo;
+
+		allocations.buffers[slot]	= buffer.disown();
+	}
+
+	startTime = deGetMicroseconds();
+	VK_CHECK(vk.allocateMemory(device, &allocInfo, DE_NULL, &memory));
+	endTime = deGetMicroseconds();
+
+	allocations.memory[slot] = memory;
+
+	if (m_params.dedicated)
+		VK_CHECK(vk.bindBufferMemory(device, allocations.buffers[slot], memory, 0u));
+
+	return endTime - startTime;
+}
+
+deUint64 MemoryAllocationInstance::freeSlot (LiveAllocations& allocations, size_t slot)
+{
+	const DeviceInterface&	vk			= m_context.getDeviceInterface();
+	const VkDevice			device		= m_context.getDevice();
+	deUint64				startTime;
+	deUint64				endTime;
+
+	startTime = deGetMicroseconds();
+	vk.freeMemory(device, allocations.memory[slot], DE_NULL);
+	endTime = deGetMicroseconds();
+
+	allocations.memory[slot] = DE_NULL;
+
+	if (m_params.dedicated)
+	{
+		vk.destroyBuffer(device, allocations.buffers[slot], DE_NULL);
+		allocations.buffers[slot] = DE_NULL;
+	}
+
+	return endTime - startTime;
+}
+
+MemoryAllocationInstance::TypeResult MemoryAllocationInstance::measureMemoryType (deUint32 memoryTypeNdx)
+{
+	const deUint32			heapNdx		= m_memoryProperties.memoryTypes[memoryTypeNdx].heapIndex;
+	const size_t			numLive		= (size_t)m_params.numLiveAllocations;
+	LiveAllocations			allocations	(m_context.getDeviceInterface(), m_context.getDevice());
+	std::vector<size_t>		order;		// Slots from oldest to newest allocation.
+	std::vector<VkDeviceSize>	sizes	(numLive);
+	TypeResult				result;
+
+	result.heapUsageBefore	= getHeapUsage(heapNdx);
+	result.liveBytes		= 0u;
+
+	allocations.memory.resize(numLive, DE_NULL);
+	if (m_params.dedicated)
+		allocations.buffers.resize(numLive, DE_NULL);
+
+	for (size_t slot = 0; slot < numLive; ++slot)
+	{
+		sizes[slot] = m_params.size != 0 ? m_params.size : (VkDeviceSize)1u << m_rnd.getInt(MIN_MIXED_SIZE_LOG2, MAX_MIXED_SIZE_LOG2);
+		result.liveBytes += sizes[slot];
+
+		allocateSlot(allocations, slot, memoryTypeNdx, sizes[slot]);
+		order.push_back(slot);
+	}
+
+	result.heapUsagePeak = getHeapUsage(heapNdx);
+
+	for (int opNdx = 0; opNdx < NUM_CHURN_OPERATIONS; ++opNdx)
+	{
+		size_t orderNdx;
+
+		switch (m_params.freePattern)
+		{
+			case FREE_PATTERN_FIFO:		orderNdx = 0;											break;
+			case FREE_PATTERN_LIFO:		orderNdx = order.size() - 1;							break;
+			case FREE_PATTERN_RANDOM:	orderNdx = (size_t)m_rnd.getInt(0, (int)numLive - 1);	break;
+			default:
+				DE_ASSERT(false);
+				orderNdx = 0;
+		}
+
+		{
+			const size_t slot = order[orderNdx];
+
+			result.freeLatencies.push_back((float)freeSlot(allocations, slot));
+
+			// Live byte count varies with mixed sizes, peak usage is tracked only from the initial fill.
+			if (m_params.size == 0)
+				sizes[slot] = (VkDeviceSize)1u << m_rnd.getInt(MIN_MIXED_SIZE_LOG2, MAX_MIXED_SIZE_LOG2);
+
+			result.allocateLatencies.push_back((float)allocateSlot(allocations, slot, memoryTypeNdx, sizes[slot]));
+
+			order.erase(order.begin() + orderNdx);
+			order.push_back(slot);
+		}
+	}
+
+	allocations.clear();
+
+	result.heapUsageAfter = getHeapUsage(heapNdx);
+
+	return result;
+}
+
+tcu::TestStatus MemoryAllocationInstance::iterate (void)
+{
+	const DeviceInterface&				vk					= m_context.getDeviceInterface();
+	const VkDevice						device				= m_context.getDevice();
+	TestLog&							log					= m_context.getTestContext().getLog();
+	const tcu::MeasurementEnvironment	environment			(m_context.getTestContext().getCommandLine().getPerfCPUAffinity());
+	const VkDeviceSize					maxLiveBytes		= getMaxAllocationSize(m_params) * (VkDeviceSize)m_params.numLiveAllocations;
+	deUint32							allowedTypeBits		= ~0u;
+	float								worstAllocateP99	= 0.0f;
+	int									numMeasuredTypes	= 0;
+
+	if ((deUint32)m_params.numLiveAllocations + 1u > m_context.getDeviceProperties().limits.maxMemoryAllocationCount)
+		TCU_THROW(NotSupportedError, "Live allocation count exceeds maxMemoryAllocationCount");
+
+	// Dedicated allocations must be bindable to the buffer.
+	if (m_params.dedicated)
+	{
+		const Unique<VkBuffer> buffer (makeBuffer(vk, device, getMaxAllocationSize(m_params), VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT));
+		allowedTypeBits = getBufferMemoryRequirements(vk, device, *buffer).memoryTypeBits;
+	}
+
+	log << TestLog::Message << "Churning " << m_params.numLiveAllocations << " live allocations with " << NUM_CHURN_OPERATIONS << " free and allocate pairs per memory type"
+		<< (m_hasMemoryBudget ? "" : ", VK_EXT_memory_budget not supported, heap usage not logged") << TestLog::EndMessage;
+
+	tcu::warmupCPU();
+
+	for (deUint32 memoryTypeNdx = 0; memoryTypeNdx < m_memoryProperties.memoryTypeCount; ++memoryTypeNdx)
+	{
+		const VkMemoryType&		memoryType	= m_memoryProperties.memoryTypes[memoryTypeNdx];
+		const VkDeviceSize		heapSize	= m_memoryProperties.memoryHeaps[memoryType.heapIndex].size;
+		const std::string		typeName	= "MemoryType" + de::toString(memoryTypeNdx);
+
+		if ((allowedTypeBits & (1u << memoryTypeNdx)) == 0 ||
+			(memoryType.propertyFlags & (VK_MEMORY_PROPERTY_PROTECTED_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT)) != 0 ||
+#ifndef CTS_USES_VULKANSC
+			(memoryType.propertyFlags & VK_MEMORY_PROPERTY_DEVICE_COHERENT_BIT_AMD) != 0 ||
+#endif // CTS_USES_VULKANSC
+			maxLiveBytes > heapSize / 4)
+			continue;
+
+		{
+			const TypeResult			result	= measureMemoryType(memoryTypeNdx);
+			const LatencyStats			alloc	= getLatencyStats(result.allocateLatencies);
+			const tcu::ScopedLogSection	section	(log, typeName, "Memory type " + de::toString(memoryTypeNdx) + ", heap " + de::toString(memoryType.heapIndex) + ", " + de::toString(getMemoryPropertyFlagsStr(memoryType.propertyFlags)));
+
+			logLatencyStats(log, "AllocateLatency",	"vkAllocateMemory() latency",	alloc);
+			logLatencyStats(log, "FreeLatency",		"vkFreeMemory() latency",		getLatencyStats(result.freeLatencies));
+
+			if (m_hasMemoryBudget)
+			{
+				log << TestLog::Integer("LiveBytes",			"Bytes allocated by initial fill",			"bytes",	QP_KEY_TAG_NONE,	(deInt64)result.liveBytes)
+					<< TestLog::Integer("HeapUsageDelta",		"Heap usage change after initial fill",		"bytes",	QP_KEY_TAG_NONE,	(deInt64)result.heapUsagePeak - (deInt64)result.heapUsageBefore)
+					<< TestLog::Integer("HeapUsageResidual",	"Heap usage change after freeing all",		"bytes",	QP_KEY_TAG_NONE,	(deInt64)result.heapUsageAfter - (deInt64)result.heapUsageBefore);
+			}
+
+			worstAllocateP99 = de::max(worstAllocateP99, alloc.p99);
+			numMeasuredTypes += 1;
+		}
+	}
+
+	if (numMeasuredTypes == 0)
+		TCU_THROW(NotSupportedError, "No memory types with enough heap space");
+
+	environment.logReport(log);
+
+	return tcu::TestStatus::pass(de::floatToString(worstAllocateP99, 2));
+}
+
+class MemoryAllocationCase : public TestCase
+{
+public:
+							MemoryAllocationCase	(tcu::TestContext& testCtx, const std::string& name, const std::string& description, const TestParams& params)
+								: TestCase	(testCtx, name, description)
+								, m_params	(params)
+							{
+							}
+
+	void					checkSupport			(Context& context) const
+							{
+								if (m_params.dedicated)
+									context.requireDeviceFunctionality("VK_KHR_dedicated_allocation");
+							}
+
+	TestInstance*			createInstance			(Context& context) const { return new MemoryAllocationInstance(context, m_params); }
+
+private:
+	const TestParams		m_params;
+};
+
+void createPatternTests (tcu::TestCaseGroup* group, bool dedicated)
+{
+	tcu::TestContext&	testCtx		= group->getTestContext();
+
+	static const struct
+	{
+		FreePattern		pattern;
+		const char*		name;
+		const char*		description;
+	} patterns[] =
+	{
+		{ FREE_PATTERN_FIFO,	"fifo",		"Free the oldest allocation"		},
+		{ FREE_PATTERN_LIFO,	"lifo",		"Free the newest allocation"		},
+		{ FREE_PATTERN_RANDOM,	"random",	"Free a random allocation"			},
+	};
+
+	static const struct
+	{
+		VkDeviceSize	size;
+		const char*		name;
+	} sizes[] =
+	{
+		{ 4u * 1024u,			"4k"		},
+		{ 64u * 1024u,			"64k"		},
+		{ 1024u * 1024u,		"1m"		},
+		{ 0u,					"mixed"		},
+	};
+
+	static const int liveCounts[] = { 16, 256, 1024 };
+
+	for (int patternNdx = 0; patternNdx < DE_LENGTH_OF_ARRAY(patterns); ++patternNdx)
+	{
+		de::MovePtr<tcu::TestCaseGroup> patternGroup (new tcu::TestCaseGroup(testCtx, patterns[patternNdx].name, patterns[patternNdx].description));
+
+		for (int sizeNdx = 0; sizeNdx < DE_LENGTH_OF_ARRAY(sizes); ++sizeNdx)
+		for (int liveNdx = 0; liveNdx < DE_LENGTH_OF_ARRAY(liveCounts); ++liveNdx)
+		{
+			const TestParams	params	= { patterns[patternNdx].pattern, sizes[sizeNdx].size, liveCounts[liveNdx], dedicated };
+			const std::string	name	= std::string(sizes[sizeNdx].name) + "_" + de::toString(liveCounts[liveNdx]) + "_live";
+
+			patternGroup->addChild(new MemoryAllocationCase(testCtx, name, "", params));
+		}
+
+		group->addChild(patternGroup.release());
+	}
+}
+
+void createBasicTests (tcu::TestCaseGroup* group)
+{
+	createPatternTests(group, false);
+}
+
+void createDedicatedTests (tcu::TestCaseGroup* group)
+{
+	createPatternTests(group, true);
+}
+
+void createChildren (tcu::TestCaseGroup* allocationTests)
+{
+	tcu::TestContext& testCtx = allocationTests->getTestContext();
+
+	allocationTests->addChild(createTestGroup(testCtx, "basic",		"Allocations without dedicated allocation info",	createBasicTests));
+	allocationTests->addChild(createTestGroup(testCtx, "dedicated",	"Dedicated allocations for buffers",				createDedicatedTests));
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createMemoryAllocationTests (tcu::TestContext& testCtx)
+{
+	return createTestGroup(testCtx, "memory_allocation", "Device memory allocation latency with live allocations", createChildren);
+}
+
+} // performance
+} // vkt
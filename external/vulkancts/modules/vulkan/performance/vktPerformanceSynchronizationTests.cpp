@@ -0,0 +1,920 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Fence and timeline semaphore signaling performance tests
+ *
+ * These cases do not verify anything beyond API return codes.
+ *
+ * Round trips of submit batches and queue chains are measured with
+ * tcu::measurePerformance() over a range of batch sizes. The fitted time
+ * per submit or hop is the result, and the fixed overhead is the round
+ * trip latency.
+ *
+ * Host signal and wakeup cases measure individual events. They log raw
+ * measurements as a sample list together with median and percentile
+ * statistics, and report the median as the test result value.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceSynchronizationTests.hpp"
+#include "vktPerformanceUtil.hpp"
+#include "vktTestCaseUtil.hpp"
+#include "vktCustomInstancesDevices.hpp"
+
+#include "vkDefs.hpp"
+#include "vkPlatform.hpp"
+#include "vkQueryUtil.hpp"
+#include "vkRef.hpp"
+#include "vkRefUtil.hpp"
+
+#include "tcuTestLog.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuPerfMeasurement.hpp"
+
+#include "deThread.hpp"
+#include "deStringUtil.hpp"
+#include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace vkt
+{
+namespace performance
+{
+namespace
+{
+
+using namespace vk;
+using tcu::TestLog;
+using de::MovePtr;
+using de::SharedPtr;
+
+enum TestType
+{
+	TEST_TYPE_FENCE_ROUND_TRIP = 0,		//!< Batches of vkQueueSubmit followed by vkWaitForFences.
+	TEST_TYPE_TIMELINE_ROUND_TRIP,		//!< Batches of vkQueueSubmit signaling a timeline followed by vkWaitSemaphores.
+	TEST_TYPE_HOST_DEVICE_ROUND_TRIP,	//!< vkSignalSemaphore unblocking a pending submit, followed by vkWaitSemaphores.
+	TEST_TYPE_HOST_SIGNAL_THROUGHPUT,	//!< vkSignalSemaphore called from several threads.
+	TEST_TYPE_HOST_WAIT_WAKEUP,			//!< vkSignalSemaphore waking up several threads blocked in vkWaitSemaphores.
+	TEST_TYPE_QUEUE_PING_PONG,			//!< Timeline semaphore chains alternating between two queues.
+
+	TEST_TYPE_LAST
+};
+
+struct TestParams
+{
+	TestType	testType;
+	deUint32	numThreads;
+	deUint32	batchSize;			//!< Not used by cases measured over a range of batch sizes.
+};
+
+enum
+{
+	NUM_WARMUP_ITERATIONS	= 10,
+	NUM_SAMPLES				= 200,
+	MAX_BATCH_SIZE			= 64,	//!< Largest batch or chain for cases measured with tcu::measurePerformance().
+};
+
+const deUint64 WAIT_TIMEOUT_NS = 5000000000ull;
+
+deUint64 getTimeNs (void)
+{
+	return (deUint64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double nsToUs (deUint64 ns)
+{
+	return (double)ns / 1000.0;
+}
+
+struct SampleValueInfo
+{
+	const char*			name;
+	const char*			description;
+	const char*			unit;
+	qpSampleValueTag	tag;
+};
+
+typedef std::vector<double> Sample;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Log samples and statistics of one of the sample values
+ *
+ * \return Median of the value at statisticNdx
+ *//*--------------------------------------------------------------------*/
+double logSamples (TestLog&								log,
+				   const std::vector<SampleValueInfo>&	valueInfos,
+				   const std::vector<Sample>&			samples,
+				   size_t								statisticNdx)
+{
+	std::vector<float> sorted;
+
+	DE_ASSERT(!samples.empty() && statisticNdx < valueInfos.size());
+
+	log << TestLog::SampleList("Samples", "Samples")
+		<< TestLog::SampleInfo;
+
+	for (size_t valueNdx = 0; valueNdx < valueInfos.size(); ++valueNdx)
+		log << TestLog::ValueInfo(valueInfos[valueNdx].name, valueInfos[valueNdx].description, valueInfos[valueNdx].unit, valueInfos[valueNdx].tag);
+
+	log << TestLog::EndSampleInfo;
+
+	for (size_t sampleNdx = 0; sampleNdx < samples.size(); ++sampleNdx)
+	{
+		tcu::SampleBuilder builder = log << TestLog::Sample;
+
+		DE_ASSERT(samples[sampleNdx].size() == valueInfos.size());
+
+		for (size_t valueNdx = 0; valueNdx < samples[sampleNdx].size(); ++valueNdx)
+			builder << samples[sampleNdx][valueNdx];
+
+		builder << TestLog::EndSample;
+
+		sorted.push_back((float)samples[sampleNdx][statisticNdx]);
+	}
+
+	log << TestLog::EndSampleList;
+
+	std::sort(sorted.begin(), sorted.end());
+
+	{
+		const SampleValueInfo&	info	= valueInfos[statisticNdx];
+		const std::string		name	= info.name;
+
+		log << TestLog::Float(name + "Min",		info.description + std::string(", minimum"),			info.unit, QP_KEY_TAG_TIME, sorted.front())
+			<< TestLog::Float(name + "Median",	info.description + std::string(", median"),				info.unit, QP_KEY_TAG_TIME, tcu::linearSample(sorted, 0.50f))
+			<< TestLog::Float(name + "P90",		info.description + std::string(", 90th percentile"),	info.unit, QP_KEY_TAG_TIME, tcu::linearSample(sorted, 0.90f))
+			<< TestLog::Float(name + "P99",		info.description + std::string(", 99th percentile"),	info.unit, QP_KEY_TAG_TIME, tcu::linearSample(sorted, 0.99f))
+			<< TestLog::Float(name + "Max",		info.description + std::string(", maximum"),			info.unit, QP_KEY_TAG_TIME, sorted.back());
+	}
+
+	return tcu::linearSample(sorted, 0.50f);
+}
+
+tcu::TestStatus makeResult (double medianUs)
+{
+	return tcu::TestStatus::pass(de::floatToString((float)medianUs, 2));
+}
+
+void waitSemaphore (const DeviceInterface& vk, VkDevice device, VkSemaphore semaphore, deUint64 value)
+{
+	const VkSemaphoreWaitInfo	waitInfo	=
+	{
+		VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,	// VkStructureType			sType;
+		DE_NULL,								// const void*				pNext;
+		0u,										// VkSemaphoreWaitFlags		flags;
+		1u,										// deUint32					semaphoreCount;
+		&semaphore,								// const VkSemaphore*		pSemaphores;
+		&value,									// const deUint64*			pValues;
+	};
+	const VkResult				result		= vk.waitSemaphores(device, &waitInfo, WAIT_TIMEOUT_NS);
+
+	if (result == VK_TIMEOUT)
+		TCU_FAIL("Timed out waiting for timeline semaphore");
+
+	VK_CHECK(result);
+}
+
+void signalSemaphore (const DeviceInterface& vk, VkDevice device, VkSemaphore semaphore, deUint64 value)
+{
+	const VkSemaphoreSignalInfo	signalInfo	=
+	{
+		VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO,	// VkStructureType	sType;
+		DE_NULL,									// const void*		pNext;
+		semaphore,									// VkSemaphore		semaphore;
+		value,										// deUint64			value;
+	};
+
+	VK_CHECK(vk.signalSemaphore(device, &signalInfo));
+}
+
+// Empty submission optionally waiting on and signaling timeline semaphores.
+void submitTimeline (const DeviceInterface&	vk,
+					 VkQueue				queue,
+					 VkSemaphore			waitSemaphore,
+					 deUint64				waitValue,
+					 VkSemaphore			signalSemaphore,
+					 deUint64				signalValue)
+{
+	const VkPipelineStageFlags			waitStage			= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+	const deUint32						numWaits			= (waitSemaphore != DE_NULL) ? 1u : 0u;
+	const VkTimelineSemaphoreSubmitInfo	timelineInfo		=
+	{
+		VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,	// VkStructureType	sType;
+		DE_NULL,											// const void*		pNext;
+		numWaits,											// deUint32			waitSemaphoreValueCount;
+		&waitValue,											// const deUint64*	pWaitSemaphoreValues;
+		1u,													// deUint32			signalSemaphoreValueCount;
+		&signalValue,										// const deUint64*	pSignalSemaphoreValues;
+	};
+	const VkSubmitInfo					submitInfo			=
+	{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,						// VkStructureType				sType;
+		&timelineInfo,										// const void*					pNext;
+		numWaits,											// deUint32						waitSemaphoreCount;
+		&waitSemaphore,										// const VkSemaphore*			pWaitSemaphores;
+		&waitStage,											// const VkPipelineStageFlags*	pWaitDstStageMask;
+		0u,													// deUint32						commandBufferCount;
+		DE_NULL,											// const VkCommandBuffer*		pCommandBuffers;
+		1u,													// deUint32						signalSemaphoreCount;
+		&signalSemaphore,									// const VkSemaphore*			pSignalSemaphores;
+	};
+
+	VK_CHECK(vk.queueSubmit(queue, 1u, &submitInfo, DE_NULL));
+}
+
+// vkQueueSubmit + vkWaitForFences
+
+class FenceRoundTripInstance : public CallBenchmarkInstance
+{
+public:
+							FenceRoundTripInstance		(Context& context);
+
+protected:
+	void					run							(int numSubmits, tcu::PerfTimer& timer);
+
+private:
+	const Unique<VkFence>	m_fence;
+};
+
+FenceRoundTripInstance::FenceRoundTripInstance (Context& context)
+	: CallBenchmarkInstance	(context, 1, MAX_BATCH_SIZE, "submit")
+	, m_fence				(createFence(context.getDeviceInterface(), context.getDevice()))
+{
+}
+
+void FenceRoundTripInstance::run (int numSubmits, tcu::PerfTimer& timer)
+{
+	const DeviceInterface&		vk				= m_context.getDeviceInterface();
+	const VkDevice				device			= m_context.getDevice();
+	const VkQueue				queue			= m_context.getUniversalQueue();
+	const VkSubmitInfo			submitInfo		=
+	{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,	// VkStructureType				sType;
+		DE_NULL,						// const void*					pNext;
+		0u,								// deUint32						waitSemaphoreCount;
+		DE_NULL,						// const VkSemaphore*			pWaitSemaphores;
+		DE_NULL,						// const VkPipelineStageFlags*	pWaitDstStageMask;
+		0u,								// deUint32						commandBufferCount;
+		DE_NULL,						// const VkCommandBuffer*		pCommandBuffers;
+		0u,								// deUint32						signalSemaphoreCount;
+		DE_NULL,						// const VkSemaphore*			pSignalSemaphores;
+	};
+
+	timer.begin();
+
+	for (int submitNdx = 0; submitNdx < numSubmits; ++submitNdx)
+		VK_CHECK(vk.queueSubmit(queue, 1u, &submitInfo, (submitNdx == numSubmits - 1) ? *m_fence : DE_NULL));
+
+	const VkResult				result			= vk.waitForFences(device, 1u, &m_fence.get(), VK_TRUE, WAIT_TIMEOUT_NS);
+
+	timer.end();
+
+	if (result == VK_TIMEOUT)
+		TCU_FAIL("Timed out waiting for fence");
+	VK_CHECK(result);
+	VK_CHECK(vk.resetFences(device, 1u, &m_fence.get()));
+}
+
+// vkQueueSubmit signaling timeline + vkWaitSemaphores
+
+class TimelineRoundTripInstance : public CallBenchmarkInstance
+{
+public:
+								TimelineRoundTripInstance	(Context& context);
+
+protected:
+	void						run							(int numSubmits, tcu::PerfTimer& timer);
+
+private:
+	const Unique<VkSemaphore>	m_semaphore;
+	deUint64					m_value;
+};
+
+TimelineRoundTripInstance::TimelineRoundTripInstance (Context& context)
+	: CallBenchmarkInstance	(context, 1, MAX_BATCH_SIZE, "submit")
+	, m_semaphore			(createSemaphoreType(context.getDeviceInterface(), context.getDevice(), VK_SEMAPHORE_TYPE_TIMELINE))
+	, m_value				(0u)
+{
+}
+
+void TimelineRoundTripInstance::run (int numSubmits, tcu::PerfTimer& timer)
+{
+	const DeviceInterface&		vk				= m_context.getDeviceInterface();
+	const VkQueue				queue			= m_context.getUniversalQueue();
+
+	timer.begin();
+
+	for (int submitNdx = 0; submitNdx < numSubmits; ++submitNdx)
+		submitTimeline(vk, queue, DE_NULL, 0u, *m_semaphore, ++m_value);
+
+	waitSemaphore(vk, m_context.getDevice(), *m_semaphore, m_value);
+
+	timer.end();
+}
+
+// vkSignalSemaphore -> pending submit -> vkWaitSemaphores
+
+class HostDeviceRoundTripInstance : public TestInstance
+{
+public:
+						HostDeviceRoundTripInstance	(Context& context, const TestParams& params) : TestInstance(context), m_params(params) {}
+	tcu::TestStatus		iterate						(void);
+
+private:
+	const TestParams	m_params;
+};
+
+tcu::TestStatus HostDeviceRoundTripInstance::iterate (void)
+{
+	const DeviceInterface&		vk				= m_context.getDeviceInterface();
+	const VkDevice				device			= m_context.getDevice();
+	const VkQueue				queue			= m_context.getUniversalQueue();
+	const Unique<VkSemaphore>	hostSemaphore	(createSemaphoreType(vk, device, VK_SEMAPHORE_TYPE_TIMELINE));
+	const Unique<VkSemaphore>	deviceSemaphore	(createSemaphoreType(vk, device, VK_SEMAPHORE_TYPE_TIMELINE));
+	const deUint32				numIterations	= deDivRoundUp32(NUM_SAMPLES, m_params.batchSize);
+	const SampleValueInfo		valueInfos[]	=
+	{
+		{ "PendingSubmits",	"Submits pending on the queue",	"",		QP_SAMPLE_VALUE_TAG_PREDICTOR	},
+		{ "RoundTripTime",	"Signal to wait return time",	"us",	QP_SAMPLE_VALUE_TAG_RESPONSE	},
+	};
+	std::vector<Sample>			samples;
+	deUint64					value			= 0;
+
+	for (deUint32 iterNdx = 0; iterNdx < NUM_WARMUP_ITERATIONS + numIterations; ++iterNdx)
+	{
+		const deUint64 firstValue = value + 1;
+
+		// Queue submits that are all blocked on host signals
+		for (deUint32 submitNdx = 0; submitNdx < m_params.batchSize; ++submitNdx)
+		{
+			++value;
+			submitTimeline(vk, queue, *hostSemaphore, value, *deviceSemaphore, value);
+		}
+
+		for (deUint64 hopValue = firstValue; hopValue <= value; ++hopValue)
+		{
+			const deUint64	startTime	= getTimeNs();
+
+			signalSemaphore(vk, device, *hostSemaphore, hopValue);
+			waitSemaphore(vk, device, *deviceSemaphore, hopValue);
+
+			const deUint64	endTime		= getTimeNs();
+
+			if (iterNdx >= NUM_WARMUP_ITERATIONS)
+			{
+				Sample sample;
+
+				sample.push_back((double)(value - hopValue + 1));
+				sample.push_back(nsToUs(endTime - startTime));
+
+				samples.push_back(sample);
+			}
+		}
+	}
+
+	return makeResult(logSamples(m_context.getTestContext().getLog(), std::vector<SampleValueInfo>(DE_ARRAY_BEGIN(valueInfos), DE_ARRAY_END(valueInfos)), samples, 1));
+}
+
+// vkSignalSemaphore from several threads
+
+class HostSignalThread : public de::Thread
+{
+public:
+							HostSignalThread	(const DeviceInterface&		vk,
+												 VkDevice					device,
+												 VkSemaphore				semaphore,
+												 deUint32					batchSize,
+												 std::atomic<deUint32>&		numStarted,
+												 deUint32					numThreads)
+								: m_vk			(vk)
+								, m_device		(device)
+								, m_semaphore	(semaphore)
+								, m_batchSize	(batchSize)
+								, m_numStarted	(numStarted)
+								, m_numThreads	(numThreads)
+								, m_failed		(false)
+							{
+							}
+
+	void					run					(void);
+
+	bool					hasFailed			(void) const { return m_failed;			}
+	const std::vector<deUint64>&	getBatchTimes	(void) const { return m_batchTimesNs;	}
+
+private:
+	const DeviceInterface&	m_vk;
+	const VkDevice			m_device;
+	const VkSemaphore		m_semaphore;
+	const deUint32			m_batchSize;
+	std::atomic<deUint32>&	m_numStarted;
+	const deUint32			m_numThreads;
+	bool					m_failed;
+	std::vector<deUint64>	m_batchTimesNs;
+};
+
+void HostSignalThread::run (void)
+{
+	deUint64 value = 0;
+
+	// Start all threads at the same time to measure contention
+	m_numStarted.fetch_add(1u);
+	while (m_numStarted.load() < m_numThreads)
+		deYield();
+
+	try
+	{
+		for (deUint32 iterNdx = 0; iterNdx < NUM_WARMUP_ITERATIONS + NUM_SAMPLES; ++iterNdx)
+		{
+			const deUint64 startTime = getTimeNs();
+
+			for (deUint32 signalNdx = 0; signalNdx < m_batchSize; ++signalNdx)
+				signalSemaphore(m_vk, m_device, m_semaphore, ++value);
+
+			if (iterNdx >= NUM_WARMUP_ITERATIONS)
+				m_batchTimesNs.push_back(getTimeNs() - startTime);
+		}
+	}
+	catch (...)
+	{
+		m_failed = true;
+	}
+}
+
+class HostSignalThroughputInstance : public TestInstance
+{
+public:
+						HostSignalThroughputInstance	(Context& context, const TestParams& params) : TestInstance(context), m_params(params) {}
+	tcu::TestStatus		iterate							(void);
+
+private:
+	const TestParams	m_params;
+};
+
+tcu::TestStatus HostSignalThroughputInstance::iterate (void)
+{
+	const DeviceInterface&						vk				= m_context.getDeviceInterface();
+	const VkDevice								device			= m_context.getDevice();
+	TestLog&									log				= m_context.getTestContext().getLog();
+	std::vector<SharedPtr<Move<VkSemaphore> > >	semaphores;
+	std::vector<SharedPtr<HostSignalThread> >	threads;
+	std::atomic<deUint32>						numStarted		(0u);
+	const SampleValueInfo						valueInfos[]	=
+	{
+		{ "Thread",			"Signaling thread",				"",		QP_SAMPLE_VALUE_TAG_PREDICTOR	},
+		{ "SignalTime",		"Time per vkSignalSemaphore",	"us",	QP_SAMPLE_VALUE_TAG_RESPONSE	},
+	};
+	std::vector<Sample>							samples;
+	double										throughput		= 0.0;
+
+	// Each thread signals its own semaphore
+	for (deUint32 threadNdx = 0; threadNdx < m_params.numThreads; ++threadNdx)
+	{
+		semaphores.push_back(SharedPtr<Move<VkSemaphore> >(new Move<VkSemaphore>(createSemaphoreType(vk, device, VK_SEMAPHORE_TYPE_TIMELINE))));
+		threads.push_back(SharedPtr<HostSignalThread>(new HostSignalThread(vk, device, **semaphores.back(), m_params.batchSize, numStarted, m_params.numThreads)));
+	}
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+		threads[threadNdx]->start();
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+		threads[threadNdx]->join();
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+	{
+		const std::vector<deUint64>&	batchTimes		= threads[threadNdx]->getBatchTimes();
+		deUint64						threadTimeNs	= 0;
+
+		if (threads[threadNdx]->hasFailed())
+			return tcu::TestStatus::fail("vkSignalSemaphore failed in thread " + de::toString(threadNdx));
+
+		for (size_t batchNdx = 0; batchNdx < batchTimes.size(); ++batchNdx)
+		{
+			Sample sample;
+
+			sample.push_back((double)threadNdx);
+			sample.push_back(nsToUs(batchTimes[batchNdx]) / (double)m_params.batchSize);
+
+			samples.push_back(sample);
+			threadTimeNs += batchTimes[batchNdx];
+		}
+
+		// Threads run concurrently, so aggregate throughput is the sum of per-thread rates
+		throughput += (double)batchTimes.size() * (double)m_params.batchSize / ((double)de::max<deUint64>(threadTimeNs, 1u) / 1.0e9);
+	}
+
+	log << TestLog::Float("Throughput", "Aggregate signal throughput", "signals/s", QP_KEY_TAG_PERFORMANCE, (float)throughput);
+
+	return makeResult(logSamples(log, std::vector<SampleValueInfo>(DE_ARRAY_BEGIN(valueInfos), DE_ARRAY_END(valueInfos)), samples, 1));
+}
+
+// vkSignalSemaphore waking up threads in vkWaitSemaphores
+
+class HostWaitThread : public de::Thread
+{
+public:
+							HostWaitThread		(const DeviceInterface&		vk,
+												 VkDevice					device,
+												 VkSemaphore				semaphore,
+												 deUint32					numIterations,
+												 std::atomic<deUint32>&		numArrived,
+												 std::atomic<bool>&			failed)
+								: m_vk				(vk)
+								, m_device			(device)
+								, m_semaphore		(semaphore)
+								, m_numIterations	(numIterations)
+								, m_numArrived		(numArrived)
+								, m_failed			(failed)
+								, m_wakeTimesNs		(numIterations, 0u)
+							{
+							}
+
+	void					run					(void);
+
+	const std::vector<deUint64>&	getWakeTimes	(void) const { return m_wakeTimesNs; }
+
+private:
+	const DeviceInterface&	m_vk;
+	const VkDevice			m_device;
+	const VkSemaphore		m_semaphore;
+	const deUint32			m_numIterations;
+	std::atomic<deUint32>&	m_numArrived;
+	std::atomic<bool>&		m_failed;
+	std::vector<deUint64>	m_wakeTimesNs;
+};
+
+void HostWaitThread::run (void)
+{
+	try
+	{
+		for (deUint32 iterNdx = 0; iterNdx < m_numIterations; ++iterNdx)
+		{
+			m_numArrived.fetch_add(1u);
+			waitSemaphore(m_vk, m_device, m_semaphore, (deUint64)iterNdx + 1u);
+			m_wakeTimesNs[iterNdx] = getTimeNs();
+		}
+	}
+	catch (...)
+	{
+		m_failed.store(true);
+	}
+}
+
+class HostWaitWakeupInstance : public TestInstance
+{
+public:
+						HostWaitWakeupInstance	(Context& context, const TestParams& params) : TestInstance(context), m_params(params) {}
+	tcu::TestStatus		iterate					(void);
+
+private:
+	const TestParams	m_params;
+};
+
+tcu::TestStatus HostWaitWakeupInstance::iterate (void)
+{
+	const DeviceInterface&						vk				= m_context.getDeviceInterface();
+	const VkDevice								device			= m_context.getDevice();
+	const Unique<VkSemaphore>					semaphore		(createSemaphoreType(vk, device, VK_SEMAPHORE_TYPE_TIMELINE));
+	const deUint32								numIterations	= NUM_WARMUP_ITERATIONS + NUM_SAMPLES;
+	std::atomic<deUint32>						numArrived		(0u);
+	std::atomic<bool>							failed			(false);
+	std::vector<SharedPtr<HostWaitThread> >		threads;
+	std::vector<deUint64>						signalTimesNs	(numIterations, 0u);
+	const SampleValueInfo						valueInfos[]	=
+	{
+		{ "Thread",			"Waiting thread",			"",		QP_SAMPLE_VALUE_TAG_PREDICTOR	},
+		{ "WakeupTime",		"Signal to wakeup time",	"us",	QP_SAMPLE_VALUE_TAG_RESPONSE	},
+	};
+	std::vector<Sample>							samples;
+
+	for (deUint32 threadNdx = 0; threadNdx < m_params.numThreads; ++threadNdx)
+		threads.push_back(SharedPtr<HostWaitThread>(new HostWaitThread(vk, device, *semaphore, numIterations, numArrived, failed)));
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+		threads[threadNdx]->start();
+
+	for (deUint32 iterNdx = 0; iterNdx < numIterations && !failed.load(); ++iterNdx)
+	{
+		// All threads have woken up from the previous value and are about to wait.
+		while (numArrived.load() < (iterNdx + 1u) * m_params.numThreads && !failed.load())
+			deYield();
+
+		// Give them time to actually block in vkWaitSemaphores
+		deSleep(1);
+
+		signalTimesNs[iterNdx] = getTimeNs();
+		signalSemaphore(vk, device, *semaphore, (deUint64)iterNdx + 1u);
+	}
+
+	// Release remaining waiters if any of the threads failed
+	if (failed.load())
+		signalSemaphore(vk, device, *semaphore, (deUint64)numIterations);
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+		threads[threadNdx]->join();
+
+	if (failed.load())
+		return tcu::TestStatus::fail("vkWaitSemaphores failed");
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+	{
+		const std::vector<deUint64>& wakeTimes = threads[threadNdx]->getWakeTimes();
+
+		for (deUint32 iterNdx = NUM_WARMUP_ITERATIONS; iterNdx < numIterations; ++iterNdx)
+		{
+			Sample sample;
+
+			sample.push_back((double)threadNdx);
+			sample.push_back(nsToUs(wakeTimes[iterNdx] - signalTimesNs[iterNdx]));
+
+			samples.push_back(sample);
+		}
+	}
+
+	return makeResult(logSamples(m_context.getTestContext().getLog(), std::vector<SampleValueInfo>(DE_ARRAY_BEGIN(valueInfos), DE_ARRAY_END(valueInfos)), samples, 1));
+}
+
+// Timeline chain ping-ponging between two queues
+
+struct QueuePair
+{
+	deUint32	familyNdx[2];
+	deUint32	queueNdx[2];
+};
+
+bool findQueuePair (const std::vector<VkQueueFamilyProperties>& queueFamilyProperties, deUint32 universalFamilyNdx, QueuePair& queuePair)
+{
+	const VkQueueFlags	submitFlags	= VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+
+	queuePair.familyNdx[0]	= universalFamilyNdx;
+	queuePair.queueNdx[0]	= 0u;
+
+	// Prefer two queues of the universal family, otherwise any other family that accepts submits.
+	if (queueFamilyProperties[universalFamilyNdx].queueCount >= 2u)
+	{
+		queuePair.familyNdx[1]	= universalFamilyNdx;
+		queuePair.queueNdx[1]	= 1u;
+		return true;
+	}
+
+	for (deUint32 familyNdx = 0; familyNdx < (deUint32)queueFamilyProperties.size(); ++familyNdx)
+	{
+		if (familyNdx != universalFamilyNdx && (queueFamilyProperties[familyNdx].queueFlags & submitFlags) != 0 && queueFamilyProperties[familyNdx].queueCount > 0)
+		{
+			queuePair.familyNdx[1]	= familyNdx;
+			queuePair.queueNdx[1]	= 0u;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+Move<VkDevice> createPingPongDevice (Context& context, const QueuePair& queuePair)
+{
+	const float									queuePriorities[]		= { 1.0f, 1.0f };
+	const bool									sameFamily				= queuePair.familyNdx[0] == queuePair.familyNdx[1];
+	VkPhysicalDeviceTimelineSemaphoreFeatures	timelineFeatures		= initVulkanStructure();
+	std::vector<VkDeviceQueueCreateInfo>		queueInfos;
+	std::vector<const char*>					extensions;
+
+	timelineFeatures.timelineSemaphore = VK_TRUE;
+
+	for (deUint32 ndx = 0; ndx < (sameFamily ? 1u : 2u); ++ndx)
+	{
+		const VkDeviceQueueCreateInfo queueInfo =
+		{
+			VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,	// VkStructureType				sType;
+			DE_NULL,									// const void*					pNext;
+			0u,											// VkDeviceQueueCreateFlags		flags;
+			queuePair.familyNdx[ndx],					// deUint32						queueFamilyIndex;
+			sameFamily ? 2u : 1u,						// deUint32						queueCount;
+			queuePriorities,							// const float*					pQueuePriorities;
+		};
+
+		queueInfos.push_back(queueInfo);
+	}
+
+	if (!isCoreDeviceExtension(context.getUsedApiVersion(), "VK_KHR_timeline_semaphore"))
+		extensions.push_back("VK_KHR_timeline_semaphore");
+
+	const VkDeviceCreateInfo deviceInfo =
+	{
+		VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,				// VkStructureType					sType;
+		&timelineFeatures,									// const void*						pNext;
+		0u,													// VkDeviceCreateFlags				flags;
+		(deUint32)queueInfos.size(),						// deUint32							queueCreateInfoCount;
+		&queueInfos[0],										// const VkDeviceQueueCreateInfo*	pQueueCreateInfos;
+		0u,													// deUint32							enabledLayerCount;
+		DE_NULL,											// const char* const*				ppEnabledLayerNames;
+		(deUint32)extensions.size(),						// deUint32							enabledExtensionCount;
+		extensions.empty() ? DE_NULL : &extensions[0],		// const char* const*				ppEnabledExtensionNames;
+		DE_NULL,											// const VkPhysicalDeviceFeatures*	pEnabledFeatures;
+	};
+
+	return createCustomDevice(context.getTestContext().getCommandLine().isValidationEnabled(), context.getPlatformInterface(), context.getInstance(),
+							  context.getInstanceInterface(), context.getPhysicalDevice(), &deviceInfo);
+}
+
+class QueuePingPongInstance : public CallBenchmarkInstance
+{
+public:
+								QueuePingPongInstance	(Context& context, const QueuePair& queuePair);
+
+	tcu::TestStatus				iterate					(void);
+
+protected:
+	void						run						(int numHops, tcu::PerfTimer& timer);
+
+private:
+	const QueuePair				m_queuePair;
+	const Unique<VkDevice>		m_device;
+	const DeviceDriver			m_vk;
+	VkQueue						m_queues[2];
+	const Unique<VkSemaphore>	m_semaphore;
+	deUint64					m_value;
+};
+
+QueuePingPongInstance::QueuePingPongInstance (Context& context, const QueuePair& queuePair)
+	: CallBenchmarkInstance	(context, 2, MAX_BATCH_SIZE, "queue hop")
+	, m_queuePair			(queuePair)
+	, m_device				(createPingPongDevice(context, queuePair))
+	, m_vk					(context.getPlatformInterface(), context.getInstance(), *m_device)
+	, m_semaphore			(createSemaphoreType(m_vk, *m_device, VK_SEMAPHORE_TYPE_TIMELINE))
+	, m_value				(0u)
+{
+	for (int queueNdx = 0; queueNdx < DE_LENGTH_OF_ARRAY(m_queues); ++queueNdx)
+		m_queues[queueNdx] = getDeviceQueue(m_vk, *m_device, queuePair.familyNdx[queueNdx], queuePair.queueNdx[queueNdx]);
+}
+
+tcu::TestStatus QueuePingPongInstance::iterate (void)
+{
+	m_context.getTestContext().getLog()
+		<< TestLog::Message << "Queue families " << m_queuePair.familyNdx[0] << " and " << m_queuePair.familyNdx[1] << TestLog::EndMessage;
+
+	const tcu::TestStatus status = CallBenchmarkInstance::iterate();
+
+	VK_CHECK(m_vk.deviceWaitIdle(*m_device));
+
+	return status;
+}
+
+void QueuePingPongInstance::run (int numHops, tcu::PerfTimer& timer)
+{
+	// Hop N waits for value base+N+1 and signals base+N+2; the host kicks the chain off with base+1.
+	const deUint64	baseValue	= m_value;
+
+	timer.begin();
+
+	for (int hopNdx = 0; hopNdx < numHops; ++hopNdx)
+		submitTimeline(m_vk, m_queues[hopNdx % 2], *m_semaphore, baseValue + hopNdx + 1, *m_semaphore, baseValue + hopNdx + 2);
+
+	m_value = baseValue + numHops + 1;
+
+	signalSemaphore(m_vk, *m_device, *m_semaphore, baseValue + 1);
+	waitSemaphore(m_vk, *m_device, *m_semaphore, m_value);
+
+	timer.end();
+}
+
+class PerformanceTestCase : public TestCase
+{
+public:
+							PerformanceTestCase	(tcu::TestContext& testCtx, const std::string& name, const std::string& description, const TestParams& params)
+								: TestCase	(testCtx, name, description)
+								, m_params	(params)
+							{
+							}
+
+	void					checkSupport		(Context& context) const;
+	TestInstance*			createInstance		(Context& context) const;
+
+private:
+	const TestParams		m_params;
+};
+
+void PerformanceTestCase::checkSupport (Context& context) const
+{
+	if (m_params.testType != TEST_TYPE_FENCE_ROUND_TRIP)
+	{
+		context.requireDeviceFunctionality("VK_KHR_timeline_semaphore");
+
+		if (!context.getTimelineSemaphoreFeatures().timelineSemaphore)
+			TCU_THROW(NotSupportedError, "Timeline semaphores not supported");
+	}
+
+	if (m_params.testType == TEST_TYPE_QUEUE_PING_PONG)
+	{
+		QueuePair queuePair;
+
+		if (!findQueuePair(getPhysicalDeviceQueueFamilyProperties(context.getInstanceInterface(), context.getPhysicalDevice()), context.getUniversalQueueFamilyIndex(), queuePair))
+			TCU_THROW(NotSupportedError, "Two queues accepting submits are required");
+	}
+}
+
+TestInstance* PerformanceTestCase::createInstance (Context& context) const
+{
+	switch (m_params.testType)
+	{
+		case TEST_TYPE_FENCE_ROUND_TRIP:		return new FenceRoundTripInstance		(context);
+		case TEST_TYPE_TIMELINE_ROUND_TRIP:		return new TimelineRoundTripInstance	(context);
+		case TEST_TYPE_HOST_DEVICE_ROUND_TRIP:	return new HostDeviceRoundTripInstance	(context, m_params);
+		case TEST_TYPE_HOST_SIGNAL_THROUGHPUT:	return new HostSignalThroughputInstance	(context, m_params);
+		case TEST_TYPE_HOST_WAIT_WAKEUP:		return new HostWaitWakeupInstance		(context, m_params);
+		case TEST_TYPE_QUEUE_PING_PONG:
+		{
+			QueuePair		queuePair;
+			const bool		found		= findQueuePair(getPhysicalDeviceQueueFamilyProperties(context.getInstanceInterface(), context.getPhysicalDevice()), context.getUniversalQueueFamilyIndex(), queuePair);
+
+			DE_ASSERT(found);
+			DE_UNREF(found);
+
+			return new QueuePingPongInstance(context, queuePair);
+		}
+		default:
+			DE_FATAL("Unknown test type");
+			return DE_NULL;
+	}
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createSynchronizationTests (tcu::TestContext& testCtx)
+{
+	static const struct
+	{
+		TestType	testType;
+		const char*	name;
+		const char*	description;
+		const char*	prefix;			//!< Prefix of the swept cases, or null for a single case measured over batch sizes.
+		bool		sweepThreads;
+	} testTypes[] =
+	{
+		{ TEST_TYPE_FENCE_ROUND_TRIP,		"fence_round_trip",			"vkQueueSubmit batches followed by vkWaitForFences",			DE_NULL,	false	},
+		{ TEST_TYPE_TIMELINE_ROUND_TRIP,	"timeline_round_trip",		"vkQueueSubmit batches followed by vkWaitSemaphores",			DE_NULL,	false	},
+		{ TEST_TYPE_HOST_DEVICE_ROUND_TRIP,	"host_device_round_trip",	"vkSignalSemaphore unblocking a submit, then vkWaitSemaphores",	"pending_",	false	},
+		{ TEST_TYPE_HOST_SIGNAL_THROUGHPUT,	"host_signal_throughput",	"vkSignalSemaphore from several threads",						"threads_",	true	},
+		{ TEST_TYPE_HOST_WAIT_WAKEUP,		"host_wait_wakeup",			"Wakeup latency of threads blocked in vkWaitSemaphores",		"threads_",	true	},
+		{ TEST_TYPE_QUEUE_PING_PONG,		"queue_ping_pong",			"Timeline semaphore chains alternating between two queues",		DE_NULL,	false	},
+	};
+	static const deUint32	batchSizes[]		= { 1u, 4u, 16u, 64u };
+	static const deUint32	threadCounts[]		= { 1u, 2u, 4u, 8u };
+	const deUint32			signalBatchSize		= 64u;
+
+	DE_STATIC_ASSERT(DE_LENGTH_OF_ARRAY(batchSizes) == DE_LENGTH_OF_ARRAY(threadCounts));
+
+	de::MovePtr<tcu::TestCaseGroup> group (new tcu::TestCaseGroup(testCtx, "synchronization", "Fence and timeline semaphore signaling latency and throughput"));
+
+	for (int typeNdx = 0; typeNdx < DE_LENGTH_OF_ARRAY(testTypes); ++typeNdx)
+	{
+		if (!testTypes[typeNdx].prefix)
+		{
+			const TestParams params = { testTypes[typeNdx].testType, 1u, 0u };
+
+			group->addChild(new PerformanceTestCase(testCtx, testTypes[typeNdx].name, testTypes[typeNdx].description, params));
+			continue;
+		}
+
+		de::MovePtr<tcu::TestCaseGroup>	typeGroup	(new tcu::TestCaseGroup(testCtx, testTypes[typeNdx].name, testTypes[typeNdx].description));
+		const deUint32* const			sweep		= testTypes[typeNdx].sweepThreads ? threadCounts : batchSizes;
+
+		for (int sweepNdx = 0; sweepNdx < DE_LENGTH_OF_ARRAY(batchSizes); ++sweepNdx)
+		{
+			const TestParams params =
+			{
+				testTypes[typeNdx].testType,
+				testTypes[typeNdx].sweepThreads ? sweep[sweepNdx] : 1u,
+				testTypes[typeNdx].sweepThreads ? signalBatchSize : sweep[sweepNdx],
+			};
+
+			typeGroup->addChild(new PerformanceTestCase(testCtx, testTypes[typeNdx].prefix + de::toString(sweep[sweepNdx]), "", params));
+		}
+
+		group->addChild(typeGroup.release());
+	}
+
+	return group.release();
+}
+
+} // performance
+} // vkt
@@ -0,0 +1,61 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Performance tests
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceTests.hpp"
+#include "vktPerformanceApiCallProfileTests.hpp"
+#include "vktPerformanceBandwidthTests.hpp"
+#include "vktPerformanceDescriptorTests.hpp"
+#include "vktPerformanceDrawCallTests.hpp"
+#include "vktPerformanceMemoryAllocationTests.hpp"
+#include "vktPerformanceSynchronizationTests.hpp"
+#include "vktTestGroupUtil.hpp"
+
+namespace vkt
+{
+namespace performance
+{
+
+namespace
+{
+
+void createChildren (tcu::TestCaseGroup* performanceTests)
+{
+	tcu::TestContext& testCtx = performanceTests->getTestContext();
+
+	performanceTests->addChild(createDrawCallTests(testCtx));
+	performanceTests->addChild(createBandwidthTests(testCtx));
+	performanceTests->addChild(createDescriptorTests(testCtx));
+	performanceTests->addChild(createMemoryAllocationTests(testCtx));
+	performanceTests->addChild(createSynchronizationTests(testCtx));
+	performanceTests->addChild(createApiCallProfileTests(testCtx));
+}
+
+} // anonymous
+
+tcu::TestCaseGroup* createTests (tcu::TestContext& testCtx)
+{
+	return createTestGroup(testCtx, "performance", "Performance tests", createChildren);
+}
+
+} // performance
+} // vkt
@@ -0,0 +1,134 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Performance test utilities
+ *//*--------------------------------------------------------------------*/
+
+#include "vktPerformanceUtil.hpp"
+
+#include "vkQueryUtil.hpp"
+#include "vkRefUtil.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuCPUWarmup.hpp"
+#include "tcuTestLog.hpp"
+#include "deStringUtil.hpp"
+
+namespace vkt
+{
+namespace performance
+{
+
+using namespace vk;
+using tcu::TestLog;
+
+namespace
+{
+
+deUint32 getTimestampValidBits (const Context& context)
+{
+	const std::vector<VkQueueFamilyProperties> queueProps = getPhysicalDeviceQueueFamilyProperties(context.getInstanceInterface(), context.getPhysicalDevice());
+
+	return queueProps[context.getUniversalQueueFamilyIndex()].timestampValidBits;
+}
+
+} // anonymous
+
+CallBenchmarkInstance::CallBenchmarkInstance (Context& context, int minCalls, int maxCalls, const char* workUnit)
+	: TestInstance	(context)
+	, m_minCalls	(minCalls)
+	, m_maxCalls	(maxCalls)
+	, m_workUnit	(workUnit)
+{
+}
+
+tcu::TestStatus CallBenchmarkInstance::iterate (void)
+{
+	TestLog&							log			= m_context.getTestContext().getLog();
+	const tcu::MeasurementEnvironment	environment	(m_context.getTestContext().getCommandLine().getPerfCPUAffinity());
+	tcu::WallClockTimer					timer;
+	tcu::PerfMeasureParams				params		(m_minCalls, m_maxCalls);
+
+	params.numRepeats = NUM_REPEATS;
+
+	tcu::warmupCPU();
+
+	{
+		const tcu::PerfMeasureResult result = tcu::measurePerformance(*this, timer, params);
+
+		tcu::logPerfSamples(log, "Samples", "Samples", result);
+		tcu::logPerfResult(log, result, m_workUnit);
+		environment.logReport(log);
+
+		return tcu::TestStatus::pass(de::floatToString(result.getPerWorkNs(), 2));
+	}
+}
+
+TimestampTimer::TimestampTimer (Context& context)
+	: m_context				(context)
+	, m_timestampPeriodNs	((double)context.getDeviceProperties().limits.timestampPeriod)
+	, m_validBitsMask		(getTimestampValidBits(context) >= 64u ? ~(deUint64)0u : ((deUint64)1u << getTimestampValidBits(context)) - 1u)
+{
+	const VkQueryPoolCreateInfo queryPoolCreateInfo =
+	{
+		VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,	// VkStructureType					sType;
+		DE_NULL,									// const void*						pNext;
+		0u,											// VkQueryPoolCreateFlags			flags;
+		VK_QUERY_TYPE_TIMESTAMP,					// VkQueryType						queryType;
+		2u,											// deUint32							queryCount;
+		0u,											// VkQueryPipelineStatisticFlags	pipelineStatistics;
+	};
+
+	if (!isSupported(context))
+		TCU_THROW(NotSupportedError, "Timestamps are not supported on the universal queue");
+
+	m_queryPool = createQueryPool(context.getDeviceInterface(), context.getDevice(), &queryPoolCreateInfo);
+}
+
+bool TimestampTimer::isSupported (Context& context)
+{
+	return getTimestampValidBits(context) != 0u;
+}
+
+void TimestampTimer::writeBegin (VkCommandBuffer cmdBuffer) const
+{
+	const DeviceInterface& vk = m_context.getDeviceInterface();
+
+	vk.cmdResetQueryPool(cmdBuffer, *m_queryPool, 0u, 2u);
+	vk.cmdWriteTimestamp(cmdBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, *m_queryPool, 0u);
+}
+
+void TimestampTimer::writeEnd (VkCommandBuffer cmdBuffer) const
+{
+	m_context.getDeviceInterface().cmdWriteTimestamp(cmdBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, *m_queryPool, 1u);
+}
+
+bool TimestampTimer::getDurationUs (double& durationUs)
+{
+	deUint64 timestamps[2] = { 0u, 0u };
+
+	VK_CHECK(m_context.getDeviceInterface().getQueryPoolResults(m_context.getDevice(), *m_queryPool, 0u, 2u, sizeof(timestamps), timestamps, sizeof(deUint64), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT));
+
+	// Wrapped ticks are handled by masking the difference.
+	durationUs = (double)((timestamps[1] - timestamps[0]) & m_validBitsMask) * m_timestampPeriodNs / 1000.0;
+	return true;
+}
+
+} // performance
+} // vkt
@@ -0,0 +1,97 @@
+#ifndef _VKTPERFORMANCEUTIL_HPP
+#define _VKTPERFORMANCEUTIL_HPP
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Performance test utilities
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuPerfMeasurement.hpp"
+#include "vkDefs.hpp"
+#include "vkRef.hpp"
+#include "vktTestCase.hpp"
+
+namespace vkt
+{
+namespace performance
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Base for benchmarks measuring CPU cost of a repeated call
+ *
+ * Subclasses implement tcu::PerfWorkload::run() for a batch of numCalls
+ * calls. Call counts from minCalls to maxCalls are measured with wall
+ * clock timer and the fitted per call time is reported as the result.
+ * workUnit names a call in the logged result descriptions.
+ *//*--------------------------------------------------------------------*/
+class CallBenchmarkInstance : public TestInstance, protected tcu::PerfWorkload
+{
+public:
+	enum
+	{
+		NUM_REPEATS	= 8
+	};
+
+							CallBenchmarkInstance	(Context& context, int minCalls, int maxCalls, const char* workUnit = "call");
+
+	tcu::TestStatus			iterate					(void);
+
+protected:
+	const int				m_minCalls;
+	const int				m_maxCalls;
+	const char* const		m_workUnit;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief vkCmdWriteTimestamp() timer backend
+ *
+ * Workload records writeBegin() and writeEnd() to the command buffer it
+ * submits, outside render passes; begin() and end() do nothing. Results
+ * are converted with timestampPeriod of the device and masked to the
+ * valid bits of the universal queue.
+ *//*--------------------------------------------------------------------*/
+class TimestampTimer : public tcu::PerfTimer
+{
+public:
+	explicit					TimestampTimer		(Context& context);
+
+	static bool					isSupported			(Context& context);
+
+	const char*					getName				(void) const	{ return "vkCmdWriteTimestamp";	}
+
+	void						begin				(void)			{}
+	void						end					(void)			{}
+	bool						getDurationUs		(double& durationUs);
+
+	void						writeBegin			(vk::VkCommandBuffer cmdBuffer) const;
+	void						writeEnd			(vk::VkCommandBuffer cmdBuffer) const;
+
+private:
+	const Context&				m_context;
+	vk::Move<vk::VkQueryPool>	m_queryPool;
+	const double				m_timestampPeriodNs;
+	const deUint64				m_validBitsMask;
+};
+
+} // performance
+} // vkt
+
+#endif // _VKTPERFORMANCEUTIL_HPP
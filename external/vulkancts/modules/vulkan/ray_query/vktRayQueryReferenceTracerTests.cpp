@@ -0,0 +1,521 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *	  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Self tests of the CPU reference ray tracer against brute force.
+ *
+ * The tests do not use a device: a random scene is traced with
+ * RayTracingReferenceTracer and every unambiguous result is compared to
+ * the closest hit found by intersecting the ray with all primitives in
+ * double precision. The scene has triangle and AABB instances with random
+ * rotated, scaled and mirrored transforms, masks and instance flags, and
+ * opaque and non-opaque geometries.
+ *//*--------------------------------------------------------------------*/
+
+#include "vktRayQueryReferenceTracerTests.hpp"
+
+#include "vkRayTracingUtil.hpp"
+
+#include "tcuMatrix.hpp"
+#include "tcuTestLog.hpp"
+#include "tcuVectorUtil.hpp"
+
+#include "deRandom.hpp"
+#include "deStringUtil.hpp"
+#include "deUniquePtr.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace vkt
+{
+namespace RayQuery
+{
+namespace
+{
+
+using namespace vk;
+
+typedef RayTracingReferenceTracer Tracer;
+
+struct SceneGeometry
+{
+	bool					opaque;
+	std::vector<tcu::Vec3>	vertices;		//!< Three per triangle, or minimum and maximum per AABB.
+};
+
+struct SceneBlas
+{
+	bool						triangles;
+	std::vector<SceneGeometry>	geometries;
+};
+
+struct SceneInstance
+{
+	deUint32					blasNdx;
+	VkTransformMatrixKHR		transform;
+	deUint32					mask;
+	VkGeometryInstanceFlagsKHR	flags;
+};
+
+struct BruteForceHit
+{
+	double		t;
+	bool		triangle;
+	bool		frontFace;
+	tcu::DVec2	barycentrics;
+	deUint32	instanceIndex;
+	deUint32	geometryIndex;
+	deUint32	primitiveIndex;
+};
+
+const deUint32	NUM_TRIANGLES			= 250u;		//!< Per geometry.
+const deUint32	NUM_AABBS				= 150u;		//!< Per geometry.
+const deUint32	NUM_INSTANCES			= 12u;
+const deUint32	NUM_RAYS				= 2000u;
+const deUint32	NUM_THREADS				= 4u;
+const deUint32	INSTANCE_CUSTOM_INDEX	= 100u;
+const deUint32	MAX_LOGGED_FAILURES		= 10u;
+
+// Moller-Trumbore, counting hits on the edges. Barycentrics are those of the second and third vertex.
+bool intersectTriangle (const tcu::DVec3& origin, const tcu::DVec3& direction, const tcu::DVec3* vertices, double& t, tcu::DVec2& barycentrics)
+{
+	const tcu::DVec3	e1	= vertices[1] - vertices[0];
+	const tcu::DVec3	e2	= vertices[2] - vertices[0];
+	const tcu::DVec3	p	= tcu::cross(direction, e2);
+	const double		det	= tcu::dot(e1, p);
+
+	if (det == 0.0)
+		return false;
+
+	const tcu::DVec3	s	= origin - vertices[0];
+	const double		u	= tcu::dot(s, p) / det;
+
+	if (u < 0.0 || u > 1.0)
+		return false;
+
+	const tcu::DVec3	q	= tcu::cross(s, e1);
+	const double		v	= tcu::dot(direction, q) / det;
+
+	if (v < 0.0 || u + v > 1.0)
+		return false;
+
+	t				= tcu::dot(e2, q) / det;
+	barycentrics	= tcu::DVec2(u, v);
+
+	return true;
+}
+
+// Slab test. The box is hit where the ray enters it, clamped to tMin.
+bool intersectAabb (const tcu::DVec3& origin, const tcu::DVec3& direction, const tcu::DVec3* minMax, double tMin, double& t)
+{
+	double	enter	= -std::numeric_limits<double>::infinity();
+	double	exit	= std::numeric_limits<double>::infinity();
+
+	for (int axis = 0; axis < 3; ++axis)
+	{
+		const double	t0	= (minMax[0][axis] - origin[axis]) / direction[axis];
+		const double	t1	= (minMax[1][axis] - origin[axis]) / direction[axis];
+
+		enter	= de::max(enter, de::min(t0, t1));
+		exit	= de::min(exit, de::max(t0, t1));
+	}
+
+	if (enter > exit || exit < tMin)
+		return false;
+
+	t = de::max(enter, tMin);
+
+	return true;
+}
+
+//! Random rotation, non-uniform scale with a possible mirroring, and translation.
+VkTransformMatrixKHR makeRandomTransform (de::Random& rnd)
+{
+	const tcu::Vec4			q			= tcu::normalize(tcu::Vec4(rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f)));
+	const float				rotation[]	=
+	{
+		1.0f - 2.0f * (q.y() * q.y() + q.z() * q.z()),	2.0f * (q.x() * q.y() - q.z() * q.w()),			2.0f * (q.x() * q.z() + q.y() * q.w()),
+		2.0f * (q.x() * q.y() + q.z() * q.w()),			1.0f - 2.0f * (q.x() * q.x() + q.z() * q.z()),	2.0f * (q.y() * q.z() - q.x() * q.w()),
+		2.0f * (q.x() * q.z() - q.y() * q.w()),			2.0f * (q.y() * q.z() + q.x() * q.w()),			1.0f - 2.0f * (q.x() * q.x() + q.y() * q.y()),
+	};
+	const tcu::Vec3			scale		(rnd.getFloat(0.5f, 2.0f) * (rnd.getBool() ? -1.0f : 1.0f), rnd.getFloat(0.5f, 2.0f), rnd.getFloat(0.5f, 2.0f));
+	VkTransformMatrixKHR	transform;
+
+	for (int row = 0; row < 3; ++row)
+	{
+		for (int col = 0; col < 3; ++col)
+			transform.matrix[row][col] = rotation[row * 3 + col] * scale[col];
+
+		transform.matrix[row][3] = rnd.getFloat(-20.0f, 20.0f);
+	}
+
+	return transform;
+}
+
+//! All intersections within the ray interval that are not skipped or culled.
+std::vector<BruteForceHit> intersectAll (const std::vector<SceneBlas>& blases, const std::vector<SceneInstance>& instances, const ReferenceRay& ray)
+{
+	std::vector<BruteForceHit> hits;
+
+	for (deUint32 instanceNdx = 0; instanceNdx < (deUint32)instances.size(); ++instanceNdx)
+	{
+		const SceneInstance&	instance		= instances[instanceNdx];
+		const SceneBlas&		blas			= blases[instance.blasNdx];
+		const bool				forceOpaque		= (instance.flags & VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR) != 0;
+		const bool				forceNoOpaque	= (instance.flags & VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR) != 0;
+		const bool				cullDisable		= (instance.flags & VK_GEOMETRY_INSTANCE_TRIANGLE_FACING_CULL_DISABLE_BIT_KHR) != 0;
+		const bool				flipFacing		= (instance.flags & VK_GEOMETRY_INSTANCE_TRIANGLE_FLIP_FACING_BIT_KHR) != 0;
+		tcu::Mat3d				objectToWorld;
+		tcu::DVec3				translation;
+
+		if ((instance.mask & ray.cullMask) == 0u)
+			continue;
+
+		if ((ray.flags & (blas.triangles ? Tracer::RAY_FLAG_SKIP_TRIANGLES : Tracer::RAY_FLAG_SKIP_AABBS)) != 0)
+			continue;
+
+		for (int row = 0; row < 3; ++row)
+		{
+			for (int col = 0; col < 3; ++col)
+				objectToWorld(row, col) = instance.transform.matrix[row][col];
+
+			translation[row] = instance.transform.matrix[row][3];
+		}
+
+		{
+			const tcu::Mat3d	worldToObject	= tcu::matrix::inverse(objectToWorld);
+			const tcu::DVec3	origin			= worldToObject * (ray.origin.cast<double>() - translation);
+			const tcu::DVec3	direction		= worldToObject * ray.direction.cast<double>();
+
+			for (deUint32 geometryNdx = 0; geometryNdx < (deUint32)blas.geometries.size(); ++geometryNdx)
+			{
+				const SceneGeometry&	geometry				= blas.geometries[geometryNdx];
+				const size_t			verticesPerPrimitive	= blas.triangles ? 3u : 2u;
+				bool					opaque					= forceOpaque ? true : forceNoOpaque ? false : geometry.opaque;
+
+				opaque = (ray.flags & Tracer::RAY_FLAG_OPAQUE) ? true : (ray.flags & Tracer::RAY_FLAG_NO_OPAQUE) ? false : opaque;
+
+				if ((ray.flags & (opaque ? Tracer::RAY_FLAG_CULL_OPAQUE : Tracer::RAY_FLAG_CULL_NO_OPAQUE)) != 0)
+					continue;
+
+				for (size_t primitiveNdx = 0; primitiveNdx < geometry.vertices.size() / verticesPerPrimitive; ++primitiveNdx)
+				{
+					tcu::DVec3		primitive[3];
+					BruteForceHit	hit;
+					bool			isHit;
+
+					for (size_t vertexNdx = 0; vertexNdx < verticesPerPrimitive; ++vertexNdx)
+						primitive[vertexNdx] = geometry.vertices[primitiveNdx * verticesPerPrimitive + vertexNdx].cast<double>();
+
+					hit.t				= 0.0;
+					hit.triangle		= blas.triangles;
+					hit.frontFace		= false;
+					hit.barycentrics	= tcu::DVec2(0.0);
+					hit.instanceIndex	= instanceNdx;
+					hit.geometryIndex	= geometryNdx;
+					hit.primitiveIndex	= static_cast<deUint32>(primitiveNdx);
+
+					if (blas.triangles)
+					{
+						// Facing is determined in object space: counterclockwise seen from the ray origin is front facing.
+						const tcu::DVec3 normal = tcu::cross(primitive[1] - primitive[0], primitive[2] - primitive[0]);
+
+						isHit			= intersectTriangle(origin, direction, primitive, hit.t, hit.barycentrics);
+						hit.frontFace	= (tcu::dot(normal, direction) < 0.0) != flipFacing;
+
+						if (!cullDisable && (ray.flags & (hit.frontFace ? Tracer::RAY_FLAG_CULL_FRONT_FACING_TRIANGLES : Tracer::RAY_FLAG_CULL_BACK_FACING_TRIANGLES)) != 0)
+							continue;
+					}
+					else
+						isHit = intersectAabb(origin, direction, primitive, ray.tMin, hit.t);
+
+					if (isHit && hit.t >= ray.tMin && hit.t <= ray.tMax)
+						hits.push_back(hit);
+				}
+			}
+		}
+	}
+
+	return hits;
+}
+
+bool isSameResult (const ReferenceHit& a, const ReferenceHit& b)
+{
+	return a.hit == b.hit
+		&& a.ambiguous == b.ambiguous
+		&& a.t == b.t
+		&& a.frontFace == b.frontFace
+		&& a.barycentrics == b.barycentrics
+		&& a.instanceIndex == b.instanceIndex
+		&& a.geometryIndex == b.geometryIndex
+		&& a.primitiveIndex == b.primitiveIndex;
+}
+
+//! Error message if the unambiguous result does not match the closest brute force hit, or empty string.
+std::string compareHit (const ReferenceHit& result, const BruteForceHit& expected)
+{
+	const double	tTolerance				= 1e-4 * de::max(1.0, expected.t);
+	const double	barycentricTolerance	= 1e-3;
+
+	if (result.instanceIndex != expected.instanceIndex || result.geometryIndex != expected.geometryIndex || result.primitiveIndex != expected.primitiveIndex)
+		return "expected instance " + de::toString(expected.instanceIndex) + " geometry " + de::toString(expected.geometryIndex) + " primitive " + de::toString(expected.primitiveIndex);
+
+	if (de::abs(static_cast<double>(result.t) - expected.t) > tTolerance)
+		return "expected t " + de::toString(expected.t);
+
+	if (result.triangle != expected.triangle || result.instanceCustomIndex != INSTANCE_CUSTOM_INDEX + expected.instanceIndex)
+		return "wrong primitive type or instance custom index";
+
+	if (expected.triangle)
+	{
+		if (result.frontFace != expected.frontFace)
+			return std::string("expected ") + (expected.frontFace ? "front" : "back") + " face";
+
+		if (de::abs(static_cast<double>(result.barycentrics.x()) - expected.barycentrics.x()) > barycentricTolerance ||
+			de::abs(static_cast<double>(result.barycentrics.y()) - expected.barycentrics.y()) > barycentricTolerance)
+			return "expected barycentrics " + de::toString(expected.barycentrics);
+	}
+
+	return std::string();
+}
+
+class ReferenceTracerCase : public tcu::TestCase
+{
+public:
+							ReferenceTracerCase		(tcu::TestContext& testCtx, const char* name, deUint32 rayFlags);
+
+	IterateResult			iterate					(void);
+
+private:
+	const deUint32			m_rayFlags;
+};
+
+ReferenceTracerCase::ReferenceTracerCase (tcu::TestContext& testCtx, const char* name, deUint32 rayFlags)
+	: tcu::TestCase	(testCtx, name, "")
+	, m_rayFlags	(rayFlags)
+{
+}
+
+tcu::TestNode::IterateResult ReferenceTracerCase::iterate (void)
+{
+	const VkGeometryInstanceFlagsKHR	instanceFlagChoices[]	=
+	{
+		0u,
+		VK_GEOMETRY_INSTANCE_TRIANGLE_FACING_CULL_DISABLE_BIT_KHR,
+		VK_GEOMETRY_INSTANCE_TRIANGLE_FLIP_FACING_BIT_KHR,
+		VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR,
+		VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR,
+		VK_GEOMETRY_INSTANCE_TRIANGLE_FLIP_FACING_BIT_KHR | VK_GEOMETRY_INSTANCE_FORCE_OPAQUE_BIT_KHR,
+	};
+	const deUint32						maskChoices[]			= { 0xFFu, 0x01u, 0x02u, 0x03u };
+	tcu::TestLog&						log						= m_testCtx.getLog();
+	const bool							terminateOnFirstHit		= (m_rayFlags & Tracer::RAY_FLAG_TERMINATE_ON_FIRST_HIT) != 0;
+	de::Random							rnd						(1234u);
+	std::vector<SceneBlas>				blases					(2);
+	std::vector<SceneInstance>			instances;
+	std::vector<ReferenceRay>			rays;
+
+	// Triangle and AABB bottom levels, both with an opaque and a non-opaque geometry.
+	for (size_t blasNdx = 0; blasNdx < blases.size(); ++blasNdx)
+	{
+		SceneBlas& blas = blases[blasNdx];
+
+		blas.triangles = blasNdx == 0;
+		blas.geometries.resize(2);
+
+		for (size_t geometryNdx = 0; geometryNdx < blas.geometries.size(); ++geometryNdx)
+		{
+			SceneGeometry& geometry = blas.geometries[geometryNdx];
+
+			geometry.opaque = geometryNdx == 0;
+
+			for (deUint32 primitiveNdx = 0; primitiveNdx < (blas.triangles ? NUM_TRIANGLES : NUM_AABBS); ++primitiveNdx)
+			{
+				const tcu::Vec3 center (rnd.getFloat(-6.0f, 6.0f), rnd.getFloat(-6.0f, 6.0f), rnd.getFloat(-6.0f, 6.0f));
+
+				if (blas.triangles)
+				{
+					for (int vertexNdx = 0; vertexNdx < 3; ++vertexNdx)
+						geometry.vertices.push_back(center + tcu::Vec3(rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f)));
+				}
+				else
+				{
+					const tcu::Vec3 halfSize (rnd.getFloat(0.05f, 0.5f), rnd.getFloat(0.05f, 0.5f), rnd.getFloat(0.05f, 0.5f));
+
+					geometry.vertices.push_back(center - halfSize);
+					geometry.vertices.push_back(center + halfSize);
+				}
+			}
+		}
+	}
+
+	// Every instance flag combination is used with both bottom levels.
+	for (deUint32 instanceNdx = 0; instanceNdx < NUM_INSTANCES; ++instanceNdx)
+	{
+		SceneInstance instance;
+
+		instance.blasNdx	= instanceNdx % 2u;
+		instance.transform	= makeRandomTransform(rnd);
+		instance.mask		= rnd.choose<deUint32>(DE_ARRAY_BEGIN(maskChoices), DE_ARRAY_END(maskChoices));
+		instance.flags		= instanceFlagChoices[(instanceNdx / 2u) % DE_LENGTH_OF_ARRAY(instanceFlagChoices)];
+
+		instances.push_back(instance);
+	}
+
+	// Rays start outside the scene, so that AABB hits are not clamped to tMin.
+	for (deUint32 rayNdx = 0; rayNdx < NUM_RAYS; ++rayNdx)
+	{
+		const tcu::Vec3	origin		= tcu::normalize(tcu::Vec3(rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f), rnd.getFloat(-1.0f, 1.0f))) * 60.0f;
+		const tcu::Vec3	target		(rnd.getFloat(-20.0f, 20.0f), rnd.getFloat(-20.0f, 20.0f), rnd.getFloat(-20.0f, 20.0f));
+		const float		tMin		= rnd.getFloat(0.0f, 0.2f);
+		const float		tMax		= rnd.getFloat(1.0f, 2.0f);
+		const deUint32	cullMask	= rnd.getBool() ? 0xFFu : rnd.choose<deUint32>(DE_ARRAY_BEGIN(maskChoices), DE_ARRAY_END(maskChoices));
+
+		rays.push_back(ReferenceRay(origin, tMin, target - origin, tMax, m_rayFlags, cullMask));
+	}
+
+	{
+		de::MovePtr<TopLevelAccelerationStructure>						tlas		= makeTopLevelAccelerationStructure();
+		std::vector<de::SharedPtr<BottomLevelAccelerationStructure> >	blasObjects;
+
+		for (size_t blasNdx = 0; blasNdx < blases.size(); ++blasNdx)
+		{
+			const SceneBlas&								blas		= blases[blasNdx];
+			de::SharedPtr<BottomLevelAccelerationStructure>	blasObject	(makeBottomLevelAccelerationStructure().release());
+
+			for (size_t geometryNdx = 0; geometryNdx < blas.geometries.size(); ++geometryNdx)
+			{
+				const SceneGeometry&					sceneGeometry	= blas.geometries[geometryNdx];
+				de::SharedPtr<RaytracedGeometryBase>	geometry		= makeRaytracedGeometry(blas.triangles ? VK_GEOMETRY_TYPE_TRIANGLES_KHR : VK_GEOMETRY_TYPE_AABBS_KHR, VK_FORMAT_R32G32B32_SFLOAT, VK_INDEX_TYPE_NONE_KHR);
+
+				geometry->setGeometryFlags(sceneGeometry.opaque ? (VkGeometryFlagsKHR)VK_GEOMETRY_OPAQUE_BIT_KHR : 0u);
+
+				for (size_t vertexNdx = 0; vertexNdx < sceneGeometry.vertices.size(); ++vertexNdx)
+					geometry->addVertex(sceneGeometry.vertices[vertexNdx]);
+
+				blasObject->addGeometry(geometry);
+			}
+
+			blasObjects.push_back(blasObject);
+		}
+
+		for (deUint32 instanceNdx = 0; instanceNdx < (deUint32)instances.size(); ++instanceNdx)
+		{
+			const SceneInstance& instance = instances[instanceNdx];
+
+			tlas->addInstance(blasObjects[instance.blasNdx], instance.transform, INSTANCE_CUSTOM_INDEX + instanceNdx, instance.mask, 0u, instance.flags);
+		}
+
+		const Tracer					tracer			(*tlas);
+		const std::vector<ReferenceHit>	results			= tracer.traceRays(rays, 1u);
+		const std::vector<ReferenceHit>	threadedResults	= tracer.traceRays(rays, NUM_THREADS);
+		deUint32						numHits			= 0u;
+		deUint32						numAmbiguous	= 0u;
+		deUint32						numFailures		= 0u;
+
+		for (deUint32 rayNdx = 0; rayNdx < NUM_RAYS; ++rayNdx)
+		{
+			const ReferenceHit&					result		= results[rayNdx];
+			const std::vector<BruteForceHit>	candidates	= intersectAll(blases, instances, rays[rayNdx]);
+			const BruteForceHit*				closest		= DE_NULL;
+			std::string							error;
+
+			for (size_t candidateNdx = 0; candidateNdx < candidates.size(); ++candidateNdx)
+			{
+				if (!closest || candidates[candidateNdx].t < closest->t)
+					closest = &candidates[candidateNdx];
+			}
+
+			if (!isSameResult(result, threadedResults[rayNdx]))
+				error = "result differs when traced on " + de::toString(NUM_THREADS) + " threads";
+			else if (terminateOnFirstHit && candidates.size() > 1 && !result.ambiguous)
+				error = de::toString(candidates.size()) + " primitives are hit but the result is not ambiguous";
+			else if (result.ambiguous)
+				++numAmbiguous;
+			else if (result.hit != (closest != DE_NULL))
+				error = result.hit ? "expected miss" : "expected hit";
+			else if (result.hit)
+			{
+				error = compareHit(result, *closest);
+				++numHits;
+			}
+
+			if (!error.empty())
+			{
+				if (numFailures < MAX_LOGGED_FAILURES)
+				{
+					log << tcu::TestLog::Message << "Ray " << rayNdx << ": " << error << ", got"
+						<< (result.hit ? "" : " miss")
+						<< (result.hit ? " t " + de::toString(result.t) + " instance " + de::toString(result.instanceIndex) + " geometry " + de::toString(result.geometryIndex)
+										 + " primitive " + de::toString(result.primitiveIndex) + (result.frontFace ? " front" : " back") + " face, barycentrics " + de::toString(result.barycentrics) : "")
+						<< (result.ambiguous ? " (ambiguous)" : "")
+						<< tcu::TestLog::EndMessage;
+				}
+
+				++numFailures;
+			}
+		}
+
+		log << tcu::TestLog::Message << NUM_RAYS << " rays: " << numHits << " unambiguous hits, " << numAmbiguous << " ambiguous results, " << numFailures << " failures" << tcu::TestLog::EndMessage;
+
+		if (numFailures > 0u)
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Reference tracer does not match brute force");
+		else if (numHits == 0u || (!terminateOnFirstHit && numAmbiguous > NUM_RAYS / 20u))
+			m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Too few unambiguous hits to compare");
+		else
+			m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+	}
+
+	return STOP;
+}
+
+} // anonymous
+
+tcu::TestCaseGroup*	createReferenceTracerTests (tcu::TestContext& testCtx)
+{
+	de::MovePtr<tcu::TestCaseGroup> group (new tcu::TestCaseGroup(testCtx, "ray_tracing_reference", "CPU reference ray tracer compared to brute force intersection"));
+
+	const struct
+	{
+		deUint32		rayFlags;
+		const char*		name;
+	} rayFlags[] =
+	{
+		{ 0u,															"closest_hit"					},
+		{ Tracer::RAY_FLAG_TERMINATE_ON_FIRST_HIT,						"terminate_on_first_hit"		},
+		{ Tracer::RAY_FLAG_OPAQUE,										"opaque"						},
+		{ Tracer::RAY_FLAG_NO_OPAQUE,									"no_opaque"						},
+		{ Tracer::RAY_FLAG_CULL_OPAQUE,									"cull_opaque"					},
+		{ Tracer::RAY_FLAG_CULL_NO_OPAQUE,								"cull_no_opaque"				},
+		{ Tracer::RAY_FLAG_OPAQUE | Tracer::RAY_FLAG_CULL_NO_OPAQUE,	"opaque_cull_no_opaque"			},
+		{ Tracer::RAY_FLAG_CULL_BACK_FACING_TRIANGLES,					"cull_back_facing_triangles"	},
+		{ Tracer::RAY_FLAG_CULL_FRONT_FACING_TRIANGLES,					"cull_front_facing_triangles"	},
+		{ Tracer::RAY_FLAG_SKIP_TRIANGLES,								"skip_triangles"				},
+		{ Tracer::RAY_FLAG_SKIP_AABBS,									"skip_aabbs"					},
+	};
+
+	for (size_t rayFlagsNdx = 0; rayFlagsNdx < DE_LENGTH_OF_ARRAY(rayFlags); ++rayFlagsNdx)
+		group->addChild(new ReferenceTracerCase(testCtx, rayFlags[rayFlagsNdx].name, rayFlags[rayFlagsNdx].rayFlags));
+
+	return group.release();
+}
+
+}	// RayQuery
+}	// vkt
@@ -41,11 +41,11 @@
 #include "deRandom.h"
 #include "deSharedPtr.hpp"
 #include "deString.h"
+#include "deThread.hpp"
 
 #include "tcuTestCase.hpp"
 #include "tcuTestLog.hpp"
 
-#include <bitset>
 #include <string>
 #include <sstream>
 #include <set>
@@ -92,30 +92,51 @@ deUint64 subgroupSizeToMask(deUint32 subgroupSize)
 		return (1ULL << subgroupSize) - 1;
 }
 
-typedef std::bitset<128> bitset128;
+// Invocation mask of the 128-invocation workgroup. Bit i of w[i / 64] is invocation i. Subgroups never
+// straddle the two words since the subgroup size is at most 64.
+struct Mask128
+{
+	deUint64 w[2];
+};
+
+inline Mask128 makeMask128 (deUint64 lo, deUint64 hi)
+{
+	Mask128 m;
+	m.w[0] = lo;
+	m.w[1] = hi;
+	return m;
+}
+
+inline Mask128 operator& (const Mask128& a, const Mask128& b)	{ return makeMask128(a.w[0] & b.w[0], a.w[1] & b.w[1]);	}
+inline Mask128 operator| (const Mask128& a, const Mask128& b)	{ return makeMask128(a.w[0] | b.w[0], a.w[1] | b.w[1]);	}
+inline Mask128 operator^ (const Mask128& a, const Mask128& b)	{ return makeMask128(a.w[0] ^ b.w[0], a.w[1] ^ b.w[1]);	}
+inline Mask128 operator~ (const Mask128& a)						{ return makeMask128(~a.w[0], ~a.w[1]);					}
+inline bool maskAny (const Mask128& a)							{ return (a.w[0] | a.w[1]) != 0;						}
+inline bool maskAll (const Mask128& a)							{ return (a.w[0] & a.w[1]) == ~0ULL;					}
+inline bool maskTest (const Mask128& a, deUint32 id)			{ return ((a.w[id / 64] >> (id % 64)) & 1) != 0;		}
 
 // Take a 64-bit integer, mask it to the subgroup size, and then
 // replicate it for each subgroup
-bitset128 bitsetFromU64(deUint64 mask, deUint32 subgroupSize)
+Mask128 maskFromU64 (deUint64 mask, deUint32 subgroupSize)
 {
-	mask &= subgroupSizeToMask(subgroupSize);
-	bitset128 result(mask);
-	for (deUint32 i = 0; i < 128 / subgroupSize - 1; ++i)
-	{
-		result = (result << subgroupSize) | bitset128(mask);
-	}
-	return result;
+	deUint64 word = mask & subgroupSizeToMask(subgroupSize);
+	for (deUint32 shift = subgroupSize; shift < 64; shift *= 2)
+		word |= word << shift;
+	return makeMask128(word, word);
 }
 
 // Pick out the mask for the subgroup that invocationID is a member of
-deUint64 bitsetToU64(const bitset128 &bitset, deUint32 subgroupSize, deUint32 invocationID)
+deUint64 maskToU64 (const Mask128& mask, deUint32 subgroupSize, deUint32 invocationID)
 {
-	bitset128 copy(bitset);
-	copy >>= (invocationID / subgroupSize) * subgroupSize;
-	copy &= bitset128(subgroupSizeToMask(subgroupSize));
-	deUint64 mask = copy.to_ullong();
-	mask &= subgroupSizeToMask(subgroupSize);
-	return mask;
+	const deUint32 base = invocationID & ~(subgroupSize - 1);
+	return (mask.w[base / 64] >> (base % 64)) & subgroupSizeToMask(subgroupSize);
+}
+
+// All invocations with gl_LocalInvocationIndex >= n
+Mask128 maskFromInvocationIndex (deUint32 n)
+{
+	DE_ASSERT(n < 128);
+	return n >= 64 ? makeMask128(0, ~0ULL << (n - 64)) : makeMask128(~0ULL << n, ~0ULL);
 }
 
 class ReconvergenceTestInstance : public TestInstance
@@ -303,30 +324,85 @@ public:
 	deUint32 caseValue;
 };
 
-static int findLSB (deUint64 value)
+// For each subgroup, pick out the elected (lowest active) invocation, and accumulate
+// a mask of all of them
+static Mask128 maskElect (const Mask128& value, deUint32 subgroupSize)
 {
-	for (int i = 0; i < 64; i++)
+	const deUint64	subgroupMask	= subgroupSizeToMask(subgroupSize);
+	Mask128			ret				= makeMask128(0, 0);
+
+	for (deUint32 wordNdx = 0; wordNdx < 2; ++wordNdx)
 	{
-		if (value & (1ULL<<i))
-			return i;
+		for (deUint32 base = 0; base < 64; base += subgroupSize)
+		{
+			const deUint64 bits = (value.w[wordNdx] >> base) & subgroupMask;
+			ret.w[wordNdx] |= (bits & (~bits + 1)) << base;
+		}
 	}
-	return -1;
+	return ret;
 }
 
-// For each subgroup, pick out the elected invocationID, and accumulate
-// a bitset of all of them
-static bitset128 bitsetElect (const bitset128& value, deInt32 subgroupSize)
+// Before simulation, the op list of a RandomProgram is lowered into this bytecode for one
+// subgroup size. Nesting levels, break/continue/return targets, loop jump targets and masks
+// are resolved once, and ops that don't change any mask (endif, case end, ...) are dropped.
+typedef enum
+{
+	SIM_BALLOT,					// output the ballot of the active invocations
+	SIM_STORE,					// output value
+	SIM_AND_PARENT,				// active[level] = active[level-1] & mask
+	SIM_AND_PARENT_LOOPCOUNT,	// active[level] = active[level-1] & (loop count mask of loop level target), inverted if value is 1
+	SIM_ELECT,					// active[level] = elect(active[level-1])
+	SIM_CASE_LOOPCOUNT,			// active[level] = ((1 << trip count of loop level target) & value) ? active[level-1] : 0
+	SIM_LOOP_BEGIN,				// active[level] = active[level-1], trip count = value
+	SIM_END_FOR_UNIF,			// loop ends jump to target while the loop continues; value is the iteration count
+	SIM_END_DO_WHILE_UNIF,
+	SIM_END_FOR_VAR,
+	SIM_END_FOR_INF,
+	SIM_END_DO_WHILE_INF,
+	SIM_BREAK,					// remove the active invocations from levels level..target
+	SIM_CONTINUE,				// as SIM_BREAK, and add them to the continue mask of loop level target
+} SimOpcode;
+
+struct SimInstruction
 {
-	bitset128 ret; // zero initialized
+	SimOpcode	opcode;
+	deUint32	level;
+	deUint32	target;
+	// index of the OP this was lowered from
+	deUint32	opNdx;
+	deUint64	value;
+	Mask128		mask;
+};
 
-	for (deInt32 i = 0; i < 128; i += subgroupSize)
-	{
-		deUint64 mask = bitsetToU64(value, subgroupSize, i);
-		int lsb = findLSB(mask);
-		ret |= bitset128(lsb == -1 ? 0 : (1ULL << lsb)) << i;
-	}
-	return ret;
-}
+struct SimProgram
+{
+	deUint32				subgroupSize;
+	deUint32				numLevels;
+	vector<SimInstruction>	code;
+	// Masks of invocations selected by OP_IF_LOOPCOUNT and still running OP_END_FOR_VAR, indexed by trip count
+	vector<Mask128>			loopCountMasks;
+	vector<Mask128>			forVarMasks;
+};
+
+struct SimOutput
+{
+	// invocations writing this output, each to its next location
+	Mask128		mask;
+	// index of the OP_BALLOT, or ~0u for ballots that are always validated
+	deUint32	opNdx;
+	bool		isBallot;
+	deUint64	value;
+};
+
+struct SimulationResult
+{
+	deUint32			subgroupSize;
+	// max number of outputs written by any invocation
+	deUint32			maxLoc;
+	vector<SimOutput>	outputs;
+	// OP_BALLOTs that were executed workgroup- (or subgroup-) nonuniform
+	vector<bool>		nonUniformBallots;
+};
 
 class RandomProgram
 {
@@ -876,10 +952,19 @@ public:
 			// Retry until the program has some UCF results in it
 			if (caseDef.isUCF())
 			{
-				const deUint32 invocationStride = 128;
-				// Simulate for all subgroup sizes, to determine whether OP_BALLOTs are nonuniform
-				for (deInt32 subgroupSize = 4; subgroupSize <= 64; subgroupSize *= 2) {
-					simulate(true, subgroupSize, invocationStride, DE_NULL);
+				// Simulate for all subgroup sizes in parallel, to determine whether OP_BALLOTs are nonuniform
+				vector<de::SharedPtr<SimulationThread> > threads;
+
+				for (deUint32 subgroupSize = 4; subgroupSize <= 64; subgroupSize *= 2)
+					threads.push_back(de::SharedPtr<SimulationThread>(new SimulationThread(*this, subgroupSize)));
+
+				for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+					threads[threadNdx]->start();
+
+				for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+				{
+					threads[threadNdx]->join();
+					applyNonUniformBallots(threads[threadNdx]->getResult());
 				}
 			}
 		} while (caseDef.isUCF() && !hasUCF());
@@ -1143,407 +1228,420 @@ public:
 		}
 	}
 
-	// Simulate execution of the program. If countOnly is true, just return
-	// the max number of outputs written. If it's false, store out the result
-	// values to ref
-	deUint32 simulate(bool countOnly, deUint32 subgroupSize, deUint32 invocationStride, deUint64 *ref)
+	// Simulate execution of the program, and flag OP_BALLOTs that are
+	// nonuniform for this subgroup size. Returns the max number of outputs
+	// written by an invocation. Use writeReference to store out the result values.
+	deUint32 simulate (deUint32 subgroupSize, SimulationResult& result)
 	{
-		// State of the subgroup at each level of nesting
-		struct SubgroupState
-		{
-			// Currently executing
-			bitset128 activeMask;
-			// Have executed a continue instruction in this loop
-			bitset128 continueMask;
-			// index of the current if test or loop header
-			deUint32 header;
-			// number of loop iterations performed
-			deUint32 tripCount;
-			// is this nesting a loop?
-			deUint32 isLoop;
-			// is this nesting a function call?
-			deUint32 isCall;
-			// is this nesting a switch?
-			deUint32 isSwitch;
-		};
-		SubgroupState stateStack[10];
-		deMemset(&stateStack, 0, sizeof(stateStack));
+		runSimulation(subgroupSize, result);
+		applyNonUniformBallots(result);
 
-		const deUint64 fullSubgroupMask = subgroupSizeToMask(subgroupSize);
+		return result.maxLoc;
+	}
 
+	void writeReference (const SimulationResult& result, deUint32 invocationStride, deUint64 *ref) const
+	{
 		// Per-invocation output location counters
 		deUint32 outLoc[128] = {0};
 
-		nesting = 0;
-		loopNesting = 0;
-		stateStack[nesting].activeMask = ~bitset128(); // initialized to ~0
-
-		deInt32 i = 0;
-		while (i < (deInt32)ops.size())
+		for (size_t outputNdx = 0; outputNdx < result.outputs.size(); ++outputNdx)
 		{
-			switch (ops[i].type)
+			const SimOutput&	output			= result.outputs[outputNdx];
+			// Emit a magic value to indicate that we shouldn't validate this ballot
+			const bool			skipValidation	= output.isBallot && output.opNdx != ~0u && ops[output.opNdx].caseValue != 0;
+			const Mask128		ballot			= skipValidation ? makeMask128(0x12345678, 0) : output.mask;
+
+			for (deUint32 id = 0; id < 128; ++id)
 			{
-			case OP_BALLOT:
+				if (maskTest(output.mask, id))
+					ref[(outLoc[id]++)*invocationStride + id] = output.isBallot ? maskToU64(ballot, result.subgroupSize, id) : output.value;
+			}
+		}
+	}
 
-				// Flag that this ballot is workgroup-nonuniform
-				if (caseDef.isWUCF() && stateStack[nesting].activeMask.any() && !stateStack[nesting].activeMask.all())
-					ops[i].caseValue = 1;
+private:
+	class SimulationThread : public de::Thread
+	{
+	public:
+								SimulationThread	(const RandomProgram& program, deUint32 subgroupSize)
+									: m_program			(program)
+									, m_subgroupSize	(subgroupSize)
+								{}
+
+		void					run					(void) { m_program.runSimulation(m_subgroupSize, m_result); }
+		const SimulationResult&	getResult			(void) const { return m_result; }
+
+	private:
+		const RandomProgram&	m_program;
+		const deUint32			m_subgroupSize;
+		SimulationResult		m_result;
+	};
 
-				if (caseDef.isSUCF())
-				{
-					for (deUint32 id = 0; id < 128; id += subgroupSize)
-					{
-						deUint64 subgroupMask = bitsetToU64(stateStack[nesting].activeMask, subgroupSize, id);
-						// Flag that this ballot is subgroup-nonuniform
-						if (subgroupMask != 0 && subgroupMask != fullSubgroupMask)
-							ops[i].caseValue = 1;
-					}
-				}
+	void runSimulation (deUint32 subgroupSize, SimulationResult& result) const
+	{
+		SimProgram program;
 
-				for (deUint32 id = 0; id < 128; ++id)
-				{
-					if (stateStack[nesting].activeMask.test(id))
-					{
-						if (countOnly)
-						{
-							outLoc[id]++;
-						}
-						else
-						{
-							if (ops[i].caseValue)
-							{
-								// Emit a magic value to indicate that we shouldn't validate this ballot
-								ref[(outLoc[id]++)*invocationStride + id] = bitsetToU64(0x12345678, subgroupSize, id);
-							}
-							else
-								ref[(outLoc[id]++)*invocationStride + id] = bitsetToU64(stateStack[nesting].activeMask, subgroupSize, id);
-						}
-					}
-				}
+		compileSimulation(subgroupSize, program);
+		executeSimulation(program, result);
+	}
+
+	void applyNonUniformBallots (const SimulationResult& result)
+	{
+		for (size_t i = 0; i < ops.size(); ++i)
+		{
+			if (result.nonUniformBallots[i])
+				ops[i].caseValue = 1;
+		}
+	}
+
+	// Lower the op list into bytecode for the given subgroup size
+	void compileSimulation (deUint32 subgroupSize, SimProgram& program) const
+	{
+		// Nesting levels of the enclosing loops, loops and switches (break targets), and calls
+		vector<deUint32>	loopLevels;
+		vector<deUint32>	breakLevels;
+		vector<deUint32>	callLevels;
+		// Op index of the enclosing if/elect, loop and switch headers. Ops copied from a then block
+		// to the else block still refer to the loop headers of the then block, so don't use OP::value.
+		vector<deUint32>	ifHeaders;
+		vector<deUint32>	loopHeaders;
+		vector<deUint32>	switchHeaders;
+		// Index of the first instruction of each loop body, by op index of the loop header
+		vector<deUint32>	bodyStart		(ops.size(), 0);
+		deUint32			level			= 0;
+
+		program.subgroupSize	= subgroupSize;
+		program.numLevels		= 1;
+		program.code.clear();
+		program.loopCountMasks.assign(65, makeMask128(0, 0));
+		program.forVarMasks.assign(65, makeMask128(0, 0));
+
+		for (deUint32 t = 0; t < subgroupSize; ++t)
+		{
+			program.loopCountMasks[t]	= maskFromU64(1ULL << t, subgroupSize);
+			program.forVarMasks[t]		= maskFromU64(~((1ULL << t) - 1), subgroupSize);
+		}
+
+		for (deUint32 i = 0; i < (deUint32)ops.size(); ++i)
+		{
+			SimInstruction inst;
+			inst.opcode	= SIM_AND_PARENT;
+			inst.level	= level;
+			inst.target	= 0;
+			inst.opNdx	= i;
+			inst.value	= 0;
+			inst.mask	= makeMask128(~0ULL, ~0ULL);
+
+			switch (ops[i].type)
+			{
+			case OP_BALLOT:
+				inst.opcode	= SIM_BALLOT;
 				break;
 			case OP_STORE:
-				for (deUint32 id = 0; id < 128; ++id)
-				{
-					if (stateStack[nesting].activeMask.test(id))
-					{
-						if (countOnly)
-							outLoc[id]++;
-						else
-							ref[(outLoc[id]++)*invocationStride + id] = ops[i].value;
-					}
-				}
+				inst.opcode	= SIM_STORE;
+				inst.value	= ops[i].value;
 				break;
 			case OP_IF_MASK:
-				nesting++;
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask & bitsetFromU64(ops[i].value, subgroupSize);
-				stateStack[nesting].header = i;
-				stateStack[nesting].isLoop = 0;
-				stateStack[nesting].isSwitch = 0;
-				break;
-			case OP_ELSE_MASK:
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask & ~bitsetFromU64(ops[stateStack[nesting].header].value, subgroupSize);
-				break;
 			case OP_IF_LOOPCOUNT:
-				{
-					deUint32 n = nesting;
-					while (!stateStack[n].isLoop)
-						n--;
-
-					nesting++;
-					stateStack[nesting].activeMask = stateStack[nesting-1].activeMask & bitsetFromU64((1ULL << stateStack[n].tripCount), subgroupSize);
-					stateStack[nesting].header = i;
-					stateStack[nesting].isLoop = 0;
-					stateStack[nesting].isSwitch = 0;
-					break;
-				}
-			case OP_ELSE_LOOPCOUNT:
-				{
-					deUint32 n = nesting;
-					while (!stateStack[n].isLoop)
-						n--;
-
-					stateStack[nesting].activeMask = stateStack[nesting-1].activeMask & ~bitsetFromU64((1ULL << stateStack[n].tripCount), subgroupSize);
-					break;
-				}
 			case OP_IF_LOCAL_INVOCATION_INDEX:
+			case OP_ELECT:
+				inst.level = ++level;
+				ifHeaders.push_back(i);
+
+				if (ops[i].type == OP_IF_MASK)
+					inst.mask = maskFromU64(ops[i].value, subgroupSize);
+				else if (ops[i].type == OP_IF_LOCAL_INVOCATION_INDEX)
+					inst.mask = maskFromInvocationIndex((deUint32)ops[i].value);
+				else if (ops[i].type == OP_IF_LOOPCOUNT)
 				{
-					// all bits >= N
-					bitset128 mask(0);
-					for (deInt32 j = (deInt32)ops[i].value; j < 128; ++j)
-						mask.set(j);
-
-					nesting++;
-					stateStack[nesting].activeMask = stateStack[nesting-1].activeMask & mask;
-					stateStack[nesting].header = i;
-					stateStack[nesting].isLoop = 0;
-					stateStack[nesting].isSwitch = 0;
-					break;
-				}
-			case OP_ELSE_LOCAL_INVOCATION_INDEX:
-				{
-					// all bits < N
-					bitset128 mask(0);
-					for (deInt32 j = 0; j < (deInt32)ops[i].value; ++j)
-						mask.set(j);
-
-					stateStack[nesting].activeMask = stateStack[nesting-1].activeMask & mask;
-					break;
-				}
-			case OP_ENDIF:
-				nesting--;
-				break;
-			case OP_BEGIN_FOR_UNIF:
-				// XXX TODO: We don't handle a for loop with zero iterations
-				nesting++;
-				loopNesting++;
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask;
-				stateStack[nesting].header = i;
-				stateStack[nesting].tripCount = 0;
-				stateStack[nesting].isLoop = 1;
-				stateStack[nesting].isSwitch = 0;
-				stateStack[nesting].continueMask = 0;
-				break;
-			case OP_END_FOR_UNIF:
-				stateStack[nesting].tripCount++;
-				stateStack[nesting].activeMask |= stateStack[nesting].continueMask;
-				stateStack[nesting].continueMask = 0;
-				if (stateStack[nesting].tripCount < ops[stateStack[nesting].header].value &&
-					stateStack[nesting].activeMask.any())
-				{
-					i = stateStack[nesting].header+1;
-					continue;
+					inst.opcode	= SIM_AND_PARENT_LOOPCOUNT;
+					inst.target	= loopLevels.back();
 				}
 				else
-				{
-					loopNesting--;
-					nesting--;
-				}
+					inst.opcode	= SIM_ELECT;
 				break;
-			case OP_BEGIN_DO_WHILE_UNIF:
-				// XXX TODO: We don't handle a for loop with zero iterations
-				nesting++;
-				loopNesting++;
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask;
-				stateStack[nesting].header = i;
-				stateStack[nesting].tripCount = 1;
-				stateStack[nesting].isLoop = 1;
-				stateStack[nesting].isSwitch = 0;
-				stateStack[nesting].continueMask = 0;
-				break;
-			case OP_END_DO_WHILE_UNIF:
-				stateStack[nesting].activeMask |= stateStack[nesting].continueMask;
-				stateStack[nesting].continueMask = 0;
-				if (stateStack[nesting].tripCount < ops[stateStack[nesting].header].value &&
-					stateStack[nesting].activeMask.any())
-				{
-					i = stateStack[nesting].header+1;
-					stateStack[nesting].tripCount++;
-					continue;
-				}
-				else
-				{
-					loopNesting--;
-					nesting--;
-				}
+			case OP_ELSE_MASK:
+				inst.mask	= ~maskFromU64(ops[ifHeaders.back()].value, subgroupSize);
 				break;
-			case OP_BEGIN_FOR_VAR:
-				// XXX TODO: We don't handle a for loop with zero iterations
-				nesting++;
-				loopNesting++;
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask;
-				stateStack[nesting].header = i;
-				stateStack[nesting].tripCount = 0;
-				stateStack[nesting].isLoop = 1;
-				stateStack[nesting].isSwitch = 0;
-				stateStack[nesting].continueMask = 0;
+			case OP_ELSE_LOOPCOUNT:
+				inst.opcode	= SIM_AND_PARENT_LOOPCOUNT;
+				inst.target	= loopLevels.back();
+				inst.value	= 1;
 				break;
-			case OP_END_FOR_VAR:
-				stateStack[nesting].tripCount++;
-				stateStack[nesting].activeMask |= stateStack[nesting].continueMask;
-				stateStack[nesting].continueMask = 0;
-				stateStack[nesting].activeMask &= bitsetFromU64(stateStack[nesting].tripCount == subgroupSize ? 0 : ~((1ULL << (stateStack[nesting].tripCount)) - 1), subgroupSize);
-				if (stateStack[nesting].activeMask.any())
-				{
-					i = stateStack[nesting].header+1;
-					continue;
-				}
-				else
-				{
-					loopNesting--;
-					nesting--;
-				}
+			case OP_ELSE_LOCAL_INVOCATION_INDEX:
+				inst.mask	= ~maskFromInvocationIndex((deUint32)ops[i].value);
 				break;
+			case OP_ENDIF:
+				ifHeaders.pop_back();
+				level--;
+				continue;
+			case OP_BEGIN_FOR_UNIF:
+			case OP_BEGIN_DO_WHILE_UNIF:
+			case OP_BEGIN_FOR_VAR:
 			case OP_BEGIN_FOR_INF:
 			case OP_BEGIN_DO_WHILE_INF:
-				nesting++;
-				loopNesting++;
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask;
-				stateStack[nesting].header = i;
-				stateStack[nesting].tripCount = 0;
-				stateStack[nesting].isLoop = 1;
-				stateStack[nesting].isSwitch = 0;
-				stateStack[nesting].continueMask = 0;
+				inst.opcode	= SIM_LOOP_BEGIN;
+				inst.level	= ++level;
+				inst.value	= ops[i].type == OP_BEGIN_DO_WHILE_UNIF ? 1 : 0;
+				loopLevels.push_back(level);
+				breakLevels.push_back(level);
+				loopHeaders.push_back(i);
 				break;
+			case OP_END_FOR_UNIF:
+			case OP_END_DO_WHILE_UNIF:
+			case OP_END_FOR_VAR:
 			case OP_END_FOR_INF:
-				stateStack[nesting].tripCount++;
-				stateStack[nesting].activeMask |= stateStack[nesting].continueMask;
-				stateStack[nesting].continueMask = 0;
-				if (stateStack[nesting].activeMask.any())
-				{
-					// output expected OP_BALLOT values
-					for (deUint32 id = 0; id < 128; ++id)
-					{
-						if (stateStack[nesting].activeMask.test(id))
-						{
-							if (countOnly)
-								outLoc[id]++;
-							else
-								ref[(outLoc[id]++)*invocationStride + id] = bitsetToU64(stateStack[nesting].activeMask, subgroupSize, id);
-						}
-					}
-
-					i = stateStack[nesting].header+1;
-					continue;
-				}
-				else
-				{
-					loopNesting--;
-					nesting--;
-				}
-				break;
 			case OP_END_DO_WHILE_INF:
-				stateStack[nesting].tripCount++;
-				stateStack[nesting].activeMask |= stateStack[nesting].continueMask;
-				stateStack[nesting].continueMask = 0;
-				if (stateStack[nesting].activeMask.any())
-				{
-					i = stateStack[nesting].header+1;
-					continue;
-				}
-				else
-				{
-					loopNesting--;
-					nesting--;
-				}
+				inst.opcode	= ops[i].type == OP_END_FOR_UNIF		? SIM_END_FOR_UNIF		:
+							  ops[i].type == OP_END_DO_WHILE_UNIF	? SIM_END_DO_WHILE_UNIF	:
+							  ops[i].type == OP_END_FOR_VAR			? SIM_END_FOR_VAR		:
+							  ops[i].type == OP_END_FOR_INF			? SIM_END_FOR_INF		: SIM_END_DO_WHILE_INF;
+				inst.target	= bodyStart[loopHeaders.back()];
+				inst.value	= ops[loopHeaders.back()].value;
+				loopHeaders.pop_back();
+				loopLevels.pop_back();
+				breakLevels.pop_back();
+				level--;
 				break;
 			case OP_BREAK:
-				{
-					deUint32 n = nesting;
-					bitset128 mask = stateStack[nesting].activeMask;
-					while (true)
-					{
-						stateStack[n].activeMask &= ~mask;
-						if (stateStack[n].isLoop || stateStack[n].isSwitch)
-							break;
-
-						n--;
-					}
-				}
+				inst.opcode	= SIM_BREAK;
+				inst.target	= breakLevels.back();
 				break;
 			case OP_CONTINUE:
-				{
-					deUint32 n = nesting;
-					bitset128 mask = stateStack[nesting].activeMask;
-					while (true)
-					{
-						stateStack[n].activeMask &= ~mask;
-						if (stateStack[n].isLoop)
-						{
-							stateStack[n].continueMask |= mask;
-							break;
-						}
-						n--;
-					}
-				}
-				break;
-			case OP_ELECT:
-				{
-					nesting++;
-					stateStack[nesting].activeMask = bitsetElect(stateStack[nesting-1].activeMask, subgroupSize);
-					stateStack[nesting].header = i;
-					stateStack[nesting].isLoop = 0;
-					stateStack[nesting].isSwitch = 0;
-				}
+				inst.opcode	= SIM_CONTINUE;
+				inst.target	= loopLevels.back();
 				break;
 			case OP_RETURN:
-				{
-					bitset128 mask = stateStack[nesting].activeMask;
-					for (deInt32 n = nesting; n >= 0; --n)
-					{
-						stateStack[n].activeMask &= ~mask;
-						if (stateStack[n].isCall)
-							break;
-					}
-				}
+				inst.opcode	= SIM_BREAK;
+				inst.target	= callLevels.empty() ? 0 : callLevels.back();
 				break;
-
 			case OP_CALL_BEGIN:
-				nesting++;
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask;
-				stateStack[nesting].isLoop = 0;
-				stateStack[nesting].isSwitch = 0;
-				stateStack[nesting].isCall = 1;
+				inst.level	= ++level;
+				callLevels.push_back(level);
 				break;
 			case OP_CALL_END:
-				stateStack[nesting].isCall = 0;
-				nesting--;
-				break;
-			case OP_NOISE:
-				break;
-
+				callLevels.pop_back();
+				level--;
+				continue;
 			case OP_SWITCH_UNIF_BEGIN:
 			case OP_SWITCH_VAR_BEGIN:
 			case OP_SWITCH_LOOP_COUNT_BEGIN:
-				nesting++;
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask;
-				stateStack[nesting].header = i;
-				stateStack[nesting].isLoop = 0;
-				stateStack[nesting].isSwitch = 1;
-				break;
-			case OP_SWITCH_END:
-				nesting--;
+				inst.level	= ++level;
+				breakLevels.push_back(level);
+				switchHeaders.push_back(i);
 				break;
 			case OP_CASE_MASK_BEGIN:
-				stateStack[nesting].activeMask = stateStack[nesting-1].activeMask & bitsetFromU64(ops[i].value, subgroupSize);
+				inst.mask	= maskFromU64(ops[i].value, subgroupSize);
 				break;
 			case OP_CASE_LOOP_COUNT_BEGIN:
-				{
-					deUint32 n = nesting;
-					deUint32 l = loopNesting;
+				inst.opcode	= SIM_CASE_LOOPCOUNT;
+				inst.target	= loopLevels[(size_t)ops[switchHeaders.back()].value];
+				inst.value	= ops[i].value;
+				break;
+			case OP_SWITCH_END:
+				breakLevels.pop_back();
+				switchHeaders.pop_back();
+				level--;
+				continue;
+			case OP_CASE_END:
+			case OP_NOISE:
+				continue;
+			default:
+				DE_ASSERT(0);
+				continue;
+			}
+
+			program.code.push_back(inst);
+			program.numLevels = de::max(program.numLevels, level + 1);
+
+			if (inst.opcode == SIM_LOOP_BEGIN)
+				bodyStart[i] = (deUint32)program.code.size();
+		}
+
+		DE_ASSERT(level == 0);
+	}
+
+	// Add an output written by the invocations in mask. The per-invocation output counters are
+	// bit-sliced: bit i of locCounters[k] is bit k of the counter of invocation i.
+	static void addOutput (SimulationResult& result, Mask128* locCounters, const Mask128& mask, deUint32 opNdx, bool isBallot, deUint64 value)
+	{
+		if (!maskAny(mask))
+			return;
 
-					while (true)
+		const SimOutput output = { mask, opNdx, isBallot, value };
+		result.outputs.push_back(output);
+
+		Mask128 carry = mask;
+		for (deUint32 k = 0; k < 32 && maskAny(carry); ++k)
+		{
+			const Mask128 nextCarry = locCounters[k] & carry;
+			locCounters[k] = locCounters[k] ^ carry;
+			carry = nextCarry;
+		}
+	}
+
+	// Run the compiled program. A single pass produces both the output counts and the outputs.
+	void executeSimulation (const SimProgram& program, SimulationResult& result) const
+	{
+		// State of the subgroup at each level of nesting
+		struct SubgroupState
+		{
+			// Currently executing
+			Mask128 activeMask;
+			// Have executed a continue instruction in this loop
+			Mask128 continueMask;
+			// number of loop iterations performed
+			deUint32 tripCount;
+		};
+
+		const deUint32					subgroupSize		= program.subgroupSize;
+		const deUint64					fullSubgroupMask	= subgroupSizeToMask(subgroupSize);
+		const Mask128					noInvocations		= makeMask128(0, 0);
+		const vector<SimInstruction>&	code				= program.code;
+		vector<SubgroupState>			stateStack			(program.numLevels);
+		Mask128							locCounters[32];
+
+		for (deUint32 k = 0; k < DE_LENGTH_OF_ARRAY(locCounters); ++k)
+			locCounters[k] = noInvocations;
+
+		for (size_t n = 0; n < stateStack.size(); ++n)
+		{
+			stateStack[n].activeMask	= noInvocations;
+			stateStack[n].continueMask	= noInvocations;
+			stateStack[n].tripCount		= 0;
+		}
+
+		result.subgroupSize	= subgroupSize;
+		result.outputs.clear();
+		result.nonUniformBallots.assign(ops.size(), false);
+
+		stateStack[0].activeMask = ~noInvocations;
+
+		deUint32 pc = 0;
+		while (pc < (deUint32)code.size())
+		{
+			const SimInstruction&	inst	= code[pc];
+			SubgroupState&			state	= stateStack[inst.level];
+
+			switch (inst.opcode)
+			{
+			case SIM_BALLOT:
+				// Flag that this ballot is workgroup-nonuniform
+				if (caseDef.isWUCF() && maskAny(state.activeMask) && !maskAll(state.activeMask))
+					result.nonUniformBallots[inst.opNdx] = true;
+
+				if (caseDef.isSUCF())
+				{
+					for (deUint32 id = 0; id < 128; id += subgroupSize)
 					{
-						if (stateStack[n].isLoop)
-						{
-							l--;
-							if (l == ops[stateStack[nesting].header].value)
-								break;
-						}
-						n--;
+						deUint64 subgroupMask = maskToU64(state.activeMask, subgroupSize, id);
+						// Flag that this ballot is subgroup-nonuniform
+						if (subgroupMask != 0 && subgroupMask != fullSubgroupMask)
+							result.nonUniformBallots[inst.opNdx] = true;
 					}
+				}
 
-					if ((1ULL << stateStack[n].tripCount) & ops[i].value)
-						stateStack[nesting].activeMask = stateStack[nesting-1].activeMask;
-					else
-						stateStack[nesting].activeMask = 0;
+				addOutput(result, locCounters, state.activeMask, inst.opNdx, true, 0);
+				break;
+			case SIM_STORE:
+				addOutput(result, locCounters, state.activeMask, inst.opNdx, false, inst.value);
+				break;
+			case SIM_AND_PARENT:
+				state.activeMask = stateStack[inst.level-1].activeMask & inst.mask;
+				break;
+			case SIM_AND_PARENT_LOOPCOUNT:
+				{
+					const Mask128 mask = program.loopCountMasks[de::min(stateStack[inst.target].tripCount, 64u)];
+					state.activeMask = stateStack[inst.level-1].activeMask & (inst.value ? ~mask : mask);
 					break;
 				}
-			case OP_CASE_END:
+			case SIM_ELECT:
+				state.activeMask = maskElect(stateStack[inst.level-1].activeMask, subgroupSize);
+				break;
+			case SIM_CASE_LOOPCOUNT:
+				{
+					const deUint32 tripCount = stateStack[inst.target].tripCount;
+					state.activeMask = (tripCount < 64 && ((1ULL << tripCount) & inst.value)) ? stateStack[inst.level-1].activeMask : noInvocations;
+					break;
+				}
+			case SIM_LOOP_BEGIN:
+				// XXX TODO: We don't handle a for loop with zero iterations
+				state.activeMask	= stateStack[inst.level-1].activeMask;
+				state.continueMask	= noInvocations;
+				state.tripCount		= (deUint32)inst.value;
 				break;
+			case SIM_END_FOR_UNIF:
+			case SIM_END_DO_WHILE_UNIF:
+			case SIM_END_FOR_VAR:
+			case SIM_END_FOR_INF:
+			case SIM_END_DO_WHILE_INF:
+				{
+					if (inst.opcode != SIM_END_DO_WHILE_UNIF)
+						state.tripCount++;
+
+					state.activeMask	= state.activeMask | state.continueMask;
+					state.continueMask	= noInvocations;
+
+					if (inst.opcode == SIM_END_FOR_VAR)
+						state.activeMask = state.activeMask & program.forVarMasks[de::min(state.tripCount, 64u)];
+
+					const bool loop = (inst.opcode == SIM_END_FOR_UNIF || inst.opcode == SIM_END_DO_WHILE_UNIF) ?
+									  (state.tripCount < inst.value && maskAny(state.activeMask)) : maskAny(state.activeMask);
+
+					if (loop)
+					{
+						// output expected OP_BALLOT values
+						if (inst.opcode == SIM_END_FOR_INF)
+							addOutput(result, locCounters, state.activeMask, ~0u, true, 0);
+
+						if (inst.opcode == SIM_END_DO_WHILE_UNIF)
+							state.tripCount++;
+
+						pc = inst.target;
+						continue;
+					}
+					break;
+				}
+			case SIM_BREAK:
+			case SIM_CONTINUE:
+				{
+					const Mask128 mask = state.activeMask;
+
+					for (deUint32 n = inst.level; ; --n)
+					{
+						stateStack[n].activeMask = stateStack[n].activeMask & ~mask;
+						if (n == inst.target)
+							break;
+					}
 
+					if (inst.opcode == SIM_CONTINUE)
+						stateStack[inst.target].continueMask = stateStack[inst.target].continueMask | mask;
+					break;
+				}
 			default:
 				DE_ASSERT(0);
 				break;
 			}
-			i++;
+			pc++;
 		}
-		deUint32 maxLoc = 0;
-		for (deUint32 id = 0; id < ARRAYSIZE(outLoc); ++id)
-			maxLoc = de::max(maxLoc, outLoc[id]);
 
-		return maxLoc;
+		// Take the max over all invocations of the bit-sliced counters
+		Mask128 candidates = ~noInvocations;
+
+		result.maxLoc = 0;
+		for (deInt32 k = DE_LENGTH_OF_ARRAY(locCounters) - 1; k >= 0; --k)
+		{
+			const Mask128 withBit = candidates & locCounters[k];
+
+			if (maskAny(withBit))
+			{
+				result.maxLoc	|= 1u << k;
+				candidates		= withBit;
+			}
+		}
 	}
 
+public:
 	bool hasUCF() const
 	{
 		for (deInt32 i = 0; i < (deInt32)ops.size(); ++i)
@@ -1634,7 +1732,8 @@ tcu::TestStatus ReconvergenceTestInstance::iterate (void)
 	RandomProgram program(m_data);
 	program.generateRandomProgram();
 
-	deUint32 maxLoc = program.simulate(true, subgroupSize, invocationStride, DE_NULL);
+	SimulationResult simulation;
+	deUint32 maxLoc = program.simulate(subgroupSize, simulation);
 
 	// maxLoc is per-invocation. Add one (to make sure no additional writes are done) and multiply by
 	// the number of invocations
@@ -1885,7 +1984,7 @@ tcu::TestStatus ReconvergenceTestInstance::iterate (void)
 		return tcu::TestStatus(QP_TEST_RESULT_NOT_SUPPORTED, "Failed system memory allocation " + de::toString(maxLoc * sizeof(deUint64)) + " bytes");
 	}
 
-	program.simulate(false, subgroupSize, invocationStride, &ref[0]);
+	program.writeReference(simulation, invocationStride, &ref[0]);
 
 	const deUint64 *result = (const deUint64 *)ptrs[1];
 
@@ -3398,49 +3398,183 @@ Maybe<bool> PixelValue::getValue (size_t ndx) const
 		return tcu::Nothing;
 }
 
-void clearReferenceValues (vector<PixelValue>&	values,
+//! Reference values of a single attachment, stored as bit planes.
+//!
+//! Each of the four components has a plane of "defined" bits and a plane of value bits, with 64 horizontally
+//! adjacent pixels per word. Clears and draws of rectangles update whole words at a time.
+class ReferenceValues
+{
+public:
+	enum
+	{
+		PIXELS_PER_WORD = 64
+	};
+
+					ReferenceValues		(void) : m_width(0), m_height(0), m_wordsPerRow(0) {}
+
+	void			resize				(const UVec2& size);
+	UVec2			getSize				(void) const { return UVec2(m_width, m_height); }
+
+	Maybe<bool>		getValue			(deUint32 x, deUint32 y, size_t compNdx) const;
+	void			setValue			(deUint32 x, deUint32 y, size_t compNdx, bool value);
+	void			setUndefined		(deUint32 x, deUint32 y, size_t compNdx);
+
+	//! Sets pixels [xBegin, xEnd) of row y. Bit (x % 64) of pattern is the value of pixel x.
+	void			fillRow				(deUint32 y, deUint32 xBegin, deUint32 xEnd, size_t compNdx, bool defined, deUint64 pattern);
+	void			fillRect			(const UVec2& offset, const UVec2& size, size_t compNdx, bool defined, deUint64 pattern);
+
+	deUint32		getWordsPerRow		(void) const { return m_wordsPerRow; }
+	const deUint64*	getDefinedRow		(deUint32 y, size_t compNdx) const { return &m_defined[getWordNdx(0, y, compNdx)];	}
+	const deUint64*	getValueRow			(deUint32 y, size_t compNdx) const { return &m_values[getWordNdx(0, y, compNdx)];	}
+
+private:
+	size_t			getWordNdx			(deUint32 x, deUint32 y, size_t compNdx) const;
+
+	deUint32		m_width;
+	deUint32		m_height;
+	deUint32		m_wordsPerRow;
+	vector<deUint64>	m_defined;
+	vector<deUint64>	m_values;
+};
+
+//! Row pattern where pixels with even x get value evenValue and pixels with odd x get value oddValue.
+deUint64 getParityPattern (bool evenValue, bool oddValue)
+{
+	return (evenValue ? 0x5555555555555555ull : 0ull) | (oddValue ? 0xAAAAAAAAAAAAAAAAull : 0ull);
+}
+
+deUint64 getConstantPattern (bool value)
+{
+	return value ? ~0ull : 0ull;
+}
+
+void ReferenceValues::resize (const UVec2& size)
+{
+	m_width			= size.x();
+	m_height		= size.y();
+	m_wordsPerRow	= (m_width + PIXELS_PER_WORD - 1) / PIXELS_PER_WORD;
+
+	m_defined.assign(4 * m_height * m_wordsPerRow, 0ull);
+	m_values.assign(4 * m_height * m_wordsPerRow, 0ull);
+}
+
+size_t ReferenceValues::getWordNdx (deUint32 x, deUint32 y, size_t compNdx) const
+{
+	DE_ASSERT(x < de::max(m_width, 1u) && y < m_height && compNdx < 4);
+	return (compNdx * m_height + y) * m_wordsPerRow + x / PIXELS_PER_WORD;
+}
+
+Maybe<bool> ReferenceValues::getValue (deUint32 x, deUint32 y, size_t compNdx) const
+{
+	const size_t	wordNdx	= getWordNdx(x, y, compNdx);
+	const deUint64	bit		= 1ull << (x % PIXELS_PER_WORD);
+
+	if ((m_defined[wordNdx] & bit) != 0)
+		return just((m_values[wordNdx] & bit) != 0);
+	else
+		return tcu::Nothing;
+}
+
+void ReferenceValues::setValue (deUint32 x, deUint32 y, size_t compNdx, bool value)
+{
+	const size_t	wordNdx	= getWordNdx(x, y, compNdx);
+	const deUint64	bit		= 1ull << (x % PIXELS_PER_WORD);
+
+	m_defined[wordNdx] |= bit;
+
+	if (value)
+		m_values[wordNdx] |= bit;
+	else
+		m_values[wordNdx] &= ~bit;
+}
+
+void ReferenceValues::setUndefined (deUint32 x, deUint32 y, size_t compNdx)
+{
+	const size_t	wordNdx	= getWordNdx(x, y, compNdx);
+	const deUint64	bit		= 1ull << (x % PIXELS_PER_WORD);
+
+	m_defined[wordNdx]	&= ~bit;
+	m_values[wordNdx]	&= ~bit;
+}
+
+void ReferenceValues::fillRow (deUint32 y, deUint32 xBegin, deUint32 xEnd, size_t compNdx, bool defined, deUint64 pattern)
+{
+	DE_ASSERT(xBegin <= xEnd && xEnd <= m_width);
+
+	if (xBegin == xEnd)
+		return;
+
+	const deUint32	firstWord	= xBegin / PIXELS_PER_WORD;
+	const deUint32	lastWord	= (xEnd - 1) / PIXELS_PER_WORD;
+	const size_t	rowBase		= getWordNdx(0, y, compNdx);
+
+	for (deUint32 wordNdx = firstWord; wordNdx <= lastWord; wordNdx++)
+	{
+		deUint64 mask = ~0ull;
+
+		if (wordNdx == firstWord)
+			mask &= ~0ull << (xBegin % PIXELS_PER_WORD);
+
+		if (wordNdx == lastWord && (xEnd % PIXELS_PER_WORD) != 0)
+			mask &= (1ull << (xEnd % PIXELS_PER_WORD)) - 1ull;
+
+		if (defined)
+		{
+			m_defined[rowBase + wordNdx]	|= mask;
+			m_values[rowBase + wordNdx]		= (m_values[rowBase + wordNdx] & ~mask) | (pattern & mask);
+		}
+		else
+		{
+			m_defined[rowBase + wordNdx]	&= ~mask;
+			m_values[rowBase + wordNdx]		&= ~mask;
+		}
+	}
+}
+
+void ReferenceValues::fillRect (const UVec2& offset, const UVec2& size, size_t compNdx, bool defined, deUint64 pattern)
+{
+	DE_ASSERT(offset.y() + size.y() <= m_height);
+
+	for (deUint32 y = offset.y(); y < offset.y() + size.y(); y++)
+		fillRow(y, offset.x(), offset.x() + size.x(), compNdx, defined, pattern);
+}
+
+void clearReferenceValues (ReferenceValues&		values,
 						   const UVec2&			targetSize,
 						   const UVec2&			offset,
 						   const UVec2&			size,
 						   const BVec4&			mask,
 						   const PixelValue&	value)
 {
-	DE_ASSERT(targetSize.x() * targetSize.y() == (deUint32)values.size());
+	DE_ASSERT(targetSize == values.getSize());
 	DE_ASSERT(offset.x() + size.x() <= targetSize.x());
 	DE_ASSERT(offset.y() + size.y() <= targetSize.y());
+	DE_UNREF(targetSize);
 
-	for (deUint32 y = offset.y(); y < offset.y() + size.y(); y++)
-	for (deUint32 x = offset.x(); x < offset.x() + size.x(); x++)
+	for (int compNdx = 0; compNdx < 4; compNdx++)
 	{
-		for (int compNdx = 0; compNdx < 4; compNdx++)
+		if (mask[compNdx])
 		{
-			if (mask[compNdx])
-			{
-				if (value.getValue(compNdx))
-					values[x + y * targetSize.x()].setValue(compNdx, *value.getValue(compNdx));
-				else
-					values[x + y * targetSize.x()].setUndefined(compNdx);
-			}
+			const Maybe<bool> compValue = value.getValue(compNdx);
+
+			values.fillRect(offset, size, compNdx, (bool)compValue, getConstantPattern(compValue && *compValue));
 		}
 	}
 }
 
-void markUndefined (vector<PixelValue>&	values,
+void markUndefined (ReferenceValues&	values,
 					const BVec4&		mask,
 					const UVec2&		targetSize,
 					const UVec2&		offset,
 					const UVec2&		size)
 {
-	DE_ASSERT(targetSize.x() * targetSize.y() == (deUint32)values.size());
+	DE_ASSERT(targetSize == values.getSize());
+	DE_UNREF(targetSize);
 
-	for (deUint32 y = offset.y(); y < offset.y() + size.y(); y++)
-	for (deUint32 x = offset.x(); x < offset.x() + size.x(); x++)
+	for (int compNdx = 0; compNdx < 4; compNdx++)
 	{
-		for (int compNdx = 0; compNdx < 4; compNdx++)
-		{
-			if (mask[compNdx])
-				values[x + y * targetSize.x()].setUndefined(compNdx);
-		}
+		if (mask[compNdx])
+			values.fillRect(offset, size, compNdx, false, 0ull);
 	}
 }
 
@@ -3537,7 +3671,7 @@ PixelValue clearValueToPixelValue (const VkClearValue&			value,
 	return pixelValue;
 }
 
-void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
+void renderReferenceValues (vector<ReferenceValues>&			referenceAttachments,
 							const RenderPass&					renderPassInfo,
 							const UVec2&						targetSize,
 							const vector<Maybe<VkClearValue> >&	imageClearValues,
@@ -3557,9 +3691,9 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 	{
 		const Attachment			attachment	= renderPassInfo.getAttachments()[attachmentNdx];
 		const tcu::TextureFormat	format		= mapVkFormat(attachment.getFormat());
-		vector<PixelValue>&			reference	= referenceAttachments[attachmentNdx];
+		ReferenceValues&			reference	= referenceAttachments[attachmentNdx];
 
-		reference.resize(targetSize.x() * targetSize.y());
+		reference.resize(targetSize);
 
 		if (imageClearValues[attachmentNdx])
 			clearReferenceValues(reference, targetSize, UVec2(0, 0), targetSize, BVec4(true), clearValueToPixelValue(*imageClearValues[attachmentNdx], format, depthValues));
@@ -3579,7 +3713,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 			if (!attachmentUsed[attachmentIndex] && colorAttachments[attachmentNdx].getAttachment() != VK_ATTACHMENT_UNUSED)
 			{
 				const Attachment&			attachment	= renderPassInfo.getAttachments()[attachmentIndex];
-				vector<PixelValue>&			reference	= referenceAttachments[attachmentIndex];
+				ReferenceValues&			reference	= referenceAttachments[attachmentIndex];
 				const tcu::TextureFormat	format		= mapVkFormat(attachment.getFormat());
 
 				DE_ASSERT(!tcu::hasDepthComponent(format.order));
@@ -3603,7 +3737,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 			if (!attachmentUsed[attachmentIndex])
 			{
 				const Attachment&			attachment	= renderPassInfo.getAttachments()[attachmentIndex];
-				vector<PixelValue>&			reference	= referenceAttachments[attachmentIndex];
+				ReferenceValues&			reference	= referenceAttachments[attachmentIndex];
 				const tcu::TextureFormat	format		= mapVkFormat(attachment.getFormat());
 
 				if (tcu::hasDepthComponent(format.order))
@@ -3634,7 +3768,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 			const deUint32				attachmentIndex	= subpass.getColorAttachments()[colorClearNdx].getAttachment();
 			const Attachment&			attachment		= renderPassInfo.getAttachments()[attachmentIndex];
 			const tcu::TextureFormat	format			= mapVkFormat(attachment.getFormat());
-			vector<PixelValue>&			reference		= referenceAttachments[attachmentIndex];
+			ReferenceValues&			reference		= referenceAttachments[attachmentIndex];
 			VkClearValue				value;
 
 			value.color = colorClear.getColor();
@@ -3655,7 +3789,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 														&& layout != VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL;
 			const bool					hasDepth		= tcu::hasDepthComponent(format.order)
 														&& layout != VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL;
-			vector<PixelValue>&			reference		= referenceAttachments[attachmentIndex];
+			ReferenceValues&			reference		= referenceAttachments[attachmentIndex];
 			VkClearValue				value;
 
 			value.depthStencil.depth = dsClear.getDepth();
@@ -3691,20 +3825,19 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 					const Attachment&			attachment		= renderPassInfo.getAttachments()[attachmentIndex];
 					const tcu::TextureFormat	format			= mapVkFormat(attachment.getFormat());
 					const tcu::BVec4			channelMask		= tcu::getTextureFormatChannelMask(format);
-					vector<PixelValue>&			reference		= referenceAttachments[attachmentIndex];
+					ReferenceValues&			reference		= referenceAttachments[attachmentIndex];
 
 					for (int y = posAI.y(); y < (int)posBI.y(); y++)
-					for (int x = posAI.x(); x < (int)posBI.x(); x++)
 					{
 						for (int compNdx = 0; compNdx < 4; compNdx++)
 						{
-							const size_t	index	= subpassNdx + attachmentIndex + compNdx;
-							const BoolOp	op		= boolOpFromIndex(index);
-							const bool		boolX	= x % 2 == (int)(index % 2);
-							const bool		boolY	= y % 2 == (int)((index / 2) % 2);
+							const size_t	index		= subpassNdx + attachmentIndex + compNdx;
+							const BoolOp	op			= boolOpFromIndex(index);
+							const bool		boolXEven	= 0 == (int)(index % 2);
+							const bool		boolY		= y % 2 == (int)((index / 2) % 2);
 
 							if (channelMask[compNdx])
-								reference[x + y * targetSize.x()].setValue(compNdx, performBoolOp(op, boolX, boolY));
+								reference.fillRow(y, posAI.x(), posBI.x(), compNdx, true, getParityPattern(performBoolOp(op, boolXEven, boolY), performBoolOp(op, !boolXEven, boolY)));
 						}
 					}
 				}
@@ -3715,21 +3848,20 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 					const VkImageLayout			layout			= subpass.getDepthStencilAttachment().getImageLayout();
 					const Attachment&			attachment		= renderPassInfo.getAttachments()[attachmentIndex];
 					const tcu::TextureFormat	format			= mapVkFormat(attachment.getFormat());
-					vector<PixelValue>&			reference		= referenceAttachments[attachmentIndex];
+					ReferenceValues&			reference		= referenceAttachments[attachmentIndex];
 
 					for (int y = posAI.y(); y < (int)posBI.y(); y++)
-					for (int x = posAI.x(); x < (int)posBI.x(); x++)
 					{
 						if (tcu::hasDepthComponent(format.order)
 							&& layout != VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL
 							&& layout != VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL)
 						{
-							const size_t	index	= subpassNdx + 1;
-							const BoolOp	op		= boolOpFromIndex(index);
-							const bool		boolX	= x % 2 == (int)(index % 2);
-							const bool		boolY	= y % 2 == (int)((index / 2) % 2);
+							const size_t	index		= subpassNdx + 1;
+							const BoolOp	op			= boolOpFromIndex(index);
+							const bool		boolXEven	= 0 == (int)(index % 2);
+							const bool		boolY		= y % 2 == (int)((index / 2) % 2);
 
-							reference[x + y * targetSize.x()].setValue(0, performBoolOp(op, boolX, boolY));
+							reference.fillRow(y, posAI.x(), posBI.x(), 0, true, getParityPattern(performBoolOp(op, boolXEven, boolY), performBoolOp(op, !boolXEven, boolY)));
 						}
 
 						if (tcu::hasStencilComponent(format.order)
@@ -3737,7 +3869,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 							&& layout != VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL)
 						{
 							const size_t	index	= subpassNdx;
-							reference[x + y * targetSize.x()].setValue(1, (index % 2) == 0);
+							reference.fillRow(y, posAI.x(), posBI.x(), 1, true, getConstantPattern((index % 2) == 0));
 						}
 					}
 				}
@@ -3789,7 +3921,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 								if ((compNdx != 0 || layout != VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL)
 									&& (compNdx != 1 || layout != VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL))
 								{
-									inputs.push_back(referenceAttachments[attachmentIndex][x + y * targetSize.x()].getValue(compNdx));
+									inputs.push_back(referenceAttachments[attachmentIndex].getValue(x, y, compNdx));
 								}
 							}
 						}
@@ -3806,7 +3938,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 							const deUint32				attachmentIndex	= subpass.getColorAttachments()[attachmentRefNdx].getAttachment();
 							const Attachment&			attachment		= renderPassInfo.getAttachments()[attachmentIndex];
 							const tcu::TextureFormat	format			= mapVkFormat(attachment.getFormat());
-							vector<PixelValue>&			reference		= referenceAttachments[attachmentIndex];
+							ReferenceValues&			reference		= referenceAttachments[attachmentIndex];
 							const int					componentCount	= tcu::getNumUsedChannels(format.order);
 
 							for (int compNdx = 0; compNdx < componentCount; compNdx++)
@@ -3828,9 +3960,9 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 								}
 
 								if (output)
-									reference[x + y * targetSize.x()].setValue(compNdx, *output);
+									reference.setValue(x, y, compNdx, *output);
 								else
-									reference[x + y * targetSize.x()].setUndefined(compNdx);
+									reference.setUndefined(x, y, compNdx);
 							}
 
 							outputValueNdx += componentCount;
@@ -3841,7 +3973,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 							&& subpass.getDepthStencilAttachment().getImageLayout() != VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL)
 						{
 							const deUint32		attachmentIndex	= subpass.getDepthStencilAttachment().getAttachment();
-							vector<PixelValue>&	reference		= referenceAttachments[attachmentIndex];
+							ReferenceValues&	reference		= referenceAttachments[attachmentIndex];
 							const size_t		index			= subpassNdx + attachmentIndex;
 							const BoolOp		op				= boolOpFromIndex(index);
 							const bool			boolX			= x % 2 == (int)(index % 2);
@@ -3859,9 +3991,9 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 							}
 
 							if (output)
-								reference[x + y * targetSize.x()].setValue(0, *output);
+								reference.setValue(x, y, 0, *output);
 							else
-								reference[x + y * targetSize.x()].setUndefined(0);
+								reference.setUndefined(x, y, 0);
 						}
 
 						inputs.clear();
@@ -3875,16 +4007,13 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 					const deUint32				attachmentIndex	= subpass.getDepthStencilAttachment().getAttachment();
 					const Attachment&			attachment		= renderPassInfo.getAttachments()[attachmentIndex];
 					const tcu::TextureFormat	format			= mapVkFormat(attachment.getFormat());
-					vector<PixelValue>&			reference		= referenceAttachments[attachmentIndex];
+					ReferenceValues&			reference		= referenceAttachments[attachmentIndex];
 
 					if (tcu::hasStencilComponent(format.order))
 					{
-						for (int y = posAI.y(); y < (int)posBI.y(); y++)
-						for (int x = posAI.x(); x < (int)posBI.x(); x++)
-						{
-							const size_t	index	= subpassNdx;
-							reference[x + y * targetSize.x()].setValue(1, (index % 2) == 0);
-						}
+						const size_t	index	= subpassNdx;
+
+						reference.fillRect(UVec2(posAI.x(), posAI.y()), UVec2(posBI.x() - posAI.x(), posBI.y() - posAI.y()), 1, true, getConstantPattern((index % 2) == 0));
 					}
 				}
 			}
@@ -3896,7 +4025,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 	{
 		const Attachment			attachment					= renderPassInfo.getAttachments()[attachmentIndex];
 		const tcu::TextureFormat	format						= mapVkFormat(attachment.getFormat());
-		vector<PixelValue>&			reference					= referenceAttachments[attachmentIndex];
+		ReferenceValues&			reference					= referenceAttachments[attachmentIndex];
 		const bool					isStencilAttachment			= hasStencilComponent(format.order);
 		const bool					isDepthOrStencilAttachment	= hasDepthComponent(format.order) || isStencilAttachment;
 
@@ -3914,7 +4043,7 @@ void renderReferenceValues (vector<vector<PixelValue> >&		referenceAttachments,
 }
 
 void renderReferenceImagesFromValues (vector<tcu::TextureLevel>&			referenceImages,
-									  const vector<vector<PixelValue> >&	referenceValues,
+									  const vector<ReferenceValues>&		referenceValues,
 									  const UVec2&							targetSize,
 									  const RenderPass&						renderPassInfo,
 									  const DepthValuesArray&				depthValues)
@@ -3925,7 +4054,7 @@ void renderReferenceImagesFromValues (vector<tcu::TextureLevel>&			referenceImag
 	{
 		const Attachment			attachment			= renderPassInfo.getAttachments()[attachmentNdx];
 		const tcu::TextureFormat	format				= mapVkFormat(attachment.getFormat());
-		const vector<PixelValue>&	reference			= referenceValues[attachmentNdx];
+		const ReferenceValues&		reference			= referenceValues[attachmentNdx];
 		const bool					hasDepth			= tcu::hasDepthComponent(format.order);
 		const bool					hasStencil			= tcu::hasStencilComponent(format.order);
 		const bool					hasDepthOrStencil	= hasDepth || hasStencil;
@@ -3942,9 +4071,11 @@ void renderReferenceImagesFromValues (vector<tcu::TextureLevel>&			referenceImag
 				for (deUint32 y = 0; y < targetSize.y(); y++)
 				for (deUint32 x = 0; x < targetSize.x(); x++)
 				{
-					if (reference[x + y * targetSize.x()].getValue(0))
+					const Maybe<bool> value = reference.getValue(x, y, 0);
+
+					if (value)
 					{
-						if (*reference[x + y * targetSize.x()].getValue(0))
+						if (*value)
 							depthAccess.setPixDepth(float(depthValues[1]) / 255.0f, x, y);
 						else
 							depthAccess.setPixDepth(float(depthValues[0]) / 255.0f, x, y);
@@ -3961,9 +4092,11 @@ void renderReferenceImagesFromValues (vector<tcu::TextureLevel>&			referenceImag
 				for (deUint32 y = 0; y < targetSize.y(); y++)
 				for (deUint32 x = 0; x < targetSize.x(); x++)
 				{
-					if (reference[x + y * targetSize.x()].getValue(1))
+					const Maybe<bool> value = reference.getValue(x, y, 1);
+
+					if (value)
 					{
-						if (*reference[x + y * targetSize.x()].getValue(1))
+						if (*value)
 							stencilAccess.setPixStencil(0xFFu, x, y);
 						else
 							stencilAccess.setPixStencil(0x0u, x, y);
@@ -3982,9 +4115,11 @@ void renderReferenceImagesFromValues (vector<tcu::TextureLevel>&			referenceImag
 
 				for (int compNdx = 0; compNdx < 4; compNdx++)
 				{
-					if (reference[x + y * targetSize.x()].getValue(compNdx))
+					const Maybe<bool> value = reference.getValue(x, y, compNdx);
+
+					if (value)
 					{
-						if (*reference[x + y * targetSize.x()].getValue(compNdx))
+						if (*value)
 							color[compNdx] = 1.0f;
 						else
 							color[compNdx] = 0.0f;
@@ -3999,48 +4134,62 @@ void renderReferenceImagesFromValues (vector<tcu::TextureLevel>&			referenceImag
 	}
 }
 
-bool verifyColorAttachment (const vector<PixelValue>&		reference,
+bool verifyColorAttachment (const ReferenceValues&			reference,
 							const ConstPixelBufferAccess&	result,
 							const PixelBufferAccess&		errorImage,
 							const deBool					useFormatCompCount)
 {
-	const Vec4	red		(1.0f, 0.0f, 0.0f, 1.0f);
-	const Vec4	green	(0.0f, 1.0f, 0.0f, 1.0f);
-	bool		ok		= true;
-
-	DE_ASSERT(result.getWidth() * result.getHeight() == (int)reference.size());
+	const Vec4		red				(1.0f, 0.0f, 0.0f, 1.0f);
+	const Vec4		green			(0.0f, 1.0f, 0.0f, 1.0f);
+	const deUint32	componentCount	= useFormatCompCount ? (deUint32)tcu::getNumUsedChannels(result.getFormat().order) : 4;
+	const deUint32	wordsPerRow		= reference.getWordsPerRow();
+	vector<deUint64>	resultIsOne		(4 * wordsPerRow);
+	vector<deUint64>	resultIsZero	(4 * wordsPerRow);
+	bool			ok				= true;
+
+	DE_ASSERT(reference.getSize() == UVec2(result.getWidth(), result.getHeight()));
 	DE_ASSERT(result.getWidth() == errorImage.getWidth());
 	DE_ASSERT(result.getHeight() == errorImage.getHeight());
 
 	for (int y = 0; y < result.getHeight(); y++)
-	for (int x = 0; x < result.getWidth(); x++)
 	{
-		const Vec4			resultColor		= result.getPixel(x, y);
-		const PixelValue&	referenceValue	= reference[x + y * result.getWidth()];
-		bool				pixelOk			= true;
-		const deUint32		componentCount	= useFormatCompCount ? (deUint32)tcu::getNumUsedChannels(result.getFormat().order) : 4;
+		// Convert result row into bit planes.
+		std::fill(resultIsOne.begin(), resultIsOne.end(), 0ull);
+		std::fill(resultIsZero.begin(), resultIsZero.end(), 0ull);
 
-		for (deUint32 compNdx = 0; compNdx < componentCount; compNdx++)
+		for (int x = 0; x < result.getWidth(); x++)
 		{
-			const Maybe<bool> maybeValue = referenceValue.getValue(compNdx);
+			const Vec4		resultColor	= result.getPixel(x, y);
+			const deUint32	wordNdx		= (deUint32)x / ReferenceValues::PIXELS_PER_WORD;
+			const deUint64	bit			= 1ull << ((deUint32)x % ReferenceValues::PIXELS_PER_WORD);
 
-			if (maybeValue)
+			for (deUint32 compNdx = 0; compNdx < componentCount; compNdx++)
 			{
-				const bool value = *maybeValue;
-
-				if ((value && (resultColor[compNdx] != 1.0f))
-					|| (!value && resultColor[compNdx] != 0.0f))
-					pixelOk = false;
+				if (resultColor[compNdx] == 1.0f)
+					resultIsOne[compNdx * wordsPerRow + wordNdx] |= bit;
+				else if (resultColor[compNdx] == 0.0f)
+					resultIsZero[compNdx * wordsPerRow + wordNdx] |= bit;
 			}
 		}
 
-		if (!pixelOk)
+		for (deUint32 wordNdx = 0; wordNdx < wordsPerRow; wordNdx++)
 		{
-			errorImage.setPixel(red, x, y);
-			ok = false;
+			deUint64 errorBits = 0ull;
+
+			for (deUint32 compNdx = 0; compNdx < componentCount; compNdx++)
+			{
+				const deUint64	defined	= reference.getDefinedRow(y, compNdx)[wordNdx];
+				const deUint64	value	= reference.getValueRow(y, compNdx)[wordNdx];
+
+				errorBits |= defined & ((value & ~resultIsOne[compNdx * wordsPerRow + wordNdx]) | (~value & ~resultIsZero[compNdx * wordsPerRow + wordNdx]));
+			}
+
+			if (errorBits != 0)
+				ok = false;
+
+			for (int x = (int)wordNdx * ReferenceValues::PIXELS_PER_WORD; x < de::min(result.getWidth(), (int)(wordNdx + 1) * ReferenceValues::PIXELS_PER_WORD); x++)
+				errorImage.setPixel(((errorBits >> (x % ReferenceValues::PIXELS_PER_WORD)) & 1ull) != 0 ? red : green, x, y);
 		}
-		else
-			errorImage.setPixel(green, x, y);
 	}
 
 	return ok;
@@ -4083,7 +4232,7 @@ std::unique_ptr<tcu::TextureLevel> renderColorImageForLog (const ConstPixelBuffe
 	return result;
 }
 
-std::unique_ptr<tcu::TextureLevel> renderColorImageForLog (const vector<PixelValue>& reference, const UVec2& targetSize, int numChannels)
+std::unique_ptr<tcu::TextureLevel> renderColorImageForLog (const ReferenceValues& reference, const UVec2& targetSize, int numChannels)
 {
 	const tcu::TextureFormat			loggableFormat	{tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8};
 	const int							width			= static_cast<int>(targetSize.x());
@@ -4095,10 +4244,9 @@ std::unique_ptr<tcu::TextureLevel> renderColorImageForLog (const vector<PixelVal
 	for (int x = 0; x < width; ++x)
 	for (int y = 0; y < height; ++y)
 	{
-		const int index = x + y * width;
 		for (int c = 0; c < numChannels; ++c)
 		{
-			const auto maybeValue = reference[index].getValue(c);
+			const auto maybeValue = reference.getValue(x, y, c);
 			if (maybeValue)
 				outColor[c] = ((*maybeValue) ? kTrueComponent : kFalseComponent);
 			else
@@ -4110,7 +4258,7 @@ std::unique_ptr<tcu::TextureLevel> renderColorImageForLog (const vector<PixelVal
 	return result;
 }
 
-bool verifyDepthAttachment (const vector<PixelValue>&		reference,
+bool verifyDepthAttachment (const ReferenceValues&			reference,
 							const ConstPixelBufferAccess&	result,
 							const PixelBufferAccess&		errorImage,
 							const DepthValuesArray&			depthValues,
@@ -4120,7 +4268,7 @@ bool verifyDepthAttachment (const vector<PixelValue>&		reference,
 	const Vec4	green	(0.0f, 1.0f, 0.0f, 1.0f);
 	bool		ok		= true;
 
-	DE_ASSERT(result.getWidth() * result.getHeight() == (int)reference.size());
+	DE_ASSERT(reference.getSize() == UVec2(result.getWidth(), result.getHeight()));
 	DE_ASSERT(result.getWidth() == errorImage.getWidth());
 	DE_ASSERT(result.getHeight() == errorImage.getHeight());
 
@@ -4130,8 +4278,7 @@ bool verifyDepthAttachment (const vector<PixelValue>&		reference,
 		bool pixelOk = true;
 
 		const float			resultDepth		= result.getPixDepth(x, y);
-		const PixelValue&	referenceValue	= reference[x + y * result.getWidth()];
-		const Maybe<bool>	maybeValue		= referenceValue.getValue(0);
+		const Maybe<bool>	maybeValue		= reference.getValue(x, y, 0);
 
 		if (maybeValue)
 		{
@@ -4154,7 +4301,7 @@ bool verifyDepthAttachment (const vector<PixelValue>&		reference,
 	return ok;
 }
 
-bool verifyStencilAttachment (const vector<PixelValue>&		reference,
+bool verifyStencilAttachment (const ReferenceValues&			reference,
 							  const ConstPixelBufferAccess&	result,
 							  const PixelBufferAccess&		errorImage)
 {
@@ -4162,7 +4309,7 @@ bool verifyStencilAttachment (const vector<PixelValue>&		reference,
 	const Vec4	green	(0.0f, 1.0f, 0.0f, 1.0f);
 	bool		ok		= true;
 
-	DE_ASSERT(result.getWidth() * result.getHeight() == (int)reference.size());
+	DE_ASSERT(reference.getSize() == UVec2(result.getWidth(), result.getHeight()));
 	DE_ASSERT(result.getWidth() == errorImage.getWidth());
 	DE_ASSERT(result.getHeight() == errorImage.getHeight());
 
@@ -4172,8 +4319,7 @@ bool verifyStencilAttachment (const vector<PixelValue>&		reference,
 		bool pixelOk = true;
 
 		const deUint32		resultStencil	= result.getPixStencil(x, y);
-		const PixelValue&	referenceValue	= reference[x + y * result.getWidth()];
-		const Maybe<bool>	maybeValue		= referenceValue.getValue(1);
+		const Maybe<bool>	maybeValue		= reference.getValue(x, y, 1);
 
 		if (maybeValue)
 		{
@@ -4208,7 +4354,7 @@ bool logAndVerifyImages (TestLog&											log,
 						 const UVec2&										targetSize,
 						 const TestConfig&									config)
 {
-	vector<vector<PixelValue> >	referenceValues;
+	vector<ReferenceValues>		referenceValues;
 	vector<tcu::TextureLevel>	referenceAttachments;
 	bool						isOk					= true;
 
@@ -44,6 +44,7 @@
 #include "deStringUtil.hpp"
 #include "deUniquePtr.hpp"
 #include "deMath.h"
+#include "deFloat16.h"
 
 #include "vktSpvAsmComputeShaderCase.hpp"
 #include "vktSpvAsmComputeShaderTestUtil.hpp"
@@ -110,6 +111,86 @@ bool compare16Bit (deInt16 original, deInt16 returned, RoundingModeFlags flags,
 	return (returned == original);
 }
 
+// Batch version of compare16BitFloat() for strided 32-bit originals.
+//
+// Expected values for all selected rounding modes are converted in bulk, and returned values
+// matching any of them bit exactly are accepted without further checks. Only the remaining
+// values go through compare16BitFloat(), which accepts the relaxed cases (flushed denormals,
+// NaN bit patterns, zero signs) and logs the mismatch.
+bool compare16BitFloats (const float* original, deUint32 inputStride, const deUint16* returned, deUint32 count, RoundingModeFlags flags, tcu::TestLog& log)
+{
+	if (count == 0)
+		return true;
+
+	vector<float>		packed		(count);
+	vector<deFloat16>	expected[2];
+
+	for (deUint32 numNdx = 0; numNdx < count; ++numNdx)
+		packed[numNdx] = original[numNdx * inputStride];
+
+	for (int bitNdx = 0; bitNdx < 2; ++bitNdx)
+	{
+		if ((flags & (1u << bitNdx)) == 0)
+			continue;
+
+		expected[bitNdx].resize(count);
+		deFloat32To16RoundArray(&expected[bitNdx][0], &packed[0], count, deRoundingMode(bitNdx));
+	}
+
+	for (deUint32 numNdx = 0; numNdx < count; ++numNdx)
+	{
+		if ((!expected[0].empty() && expected[0][numNdx] == returned[numNdx]) ||
+			(!expected[1].empty() && expected[1][numNdx] == returned[numNdx]))
+			continue;
+
+		if (!compare16BitFloat(packed[numNdx], returned[numNdx], flags, log))
+			return false;
+	}
+
+	return true;
+}
+
+// Batch versions of compare16Bit(). Exact matches are accepted in bulk, the rest are compared
+// per element with logging.
+bool compare16BitArray (const vector<float>& original, const vector<deUint16>& returned, RoundingModeFlags flags, tcu::TestLog& log)
+{
+	DE_ASSERT(original.size() == returned.size());
+
+	if (original.empty())
+		return true;
+
+	return compare16BitFloats(&original[0], 1u, &returned[0], static_cast<deUint32>(original.size()), flags, log);
+}
+
+bool compare16BitArray (const vector<deUint16>& original, const vector<float>& returned, RoundingModeFlags flags, tcu::TestLog& log)
+{
+	DE_ASSERT(original.size() == returned.size());
+
+	if (original.empty())
+		return true;
+
+	vector<float> expected (original.size());
+	deFloat16To32Array(&expected[0], &original[0], original.size());
+
+	for (size_t ndx = 0; ndx < original.size(); ++ndx)
+	{
+		if (tcu::Float32(expected[ndx]).bits() == tcu::Float32(returned[ndx]).bits())
+			continue;
+
+		if (!compare16Bit(original[ndx], returned[ndx], flags, log))
+			return false;
+	}
+
+	return true;
+}
+
+bool compare16BitArray (const vector<deInt16>& original, const vector<deInt16>& returned, RoundingModeFlags flags, tcu::TestLog& log)
+{
+	DE_UNREF(flags);
+	DE_UNREF(log);
+	return (returned == original);
+}
+
 struct StructTestData
 {
 	const int structArraySize; //Size of Struct Array
@@ -207,9 +288,8 @@ bool graphicsCheck16BitFloats (const std::vector<Resource>&	originalFloats,
 		const deUint32	count		= static_cast<deUint32>(expectedOutputs[outputNdx].getByteSize() / sizeof(deUint16));
 		const deUint32	inputStride	= static_cast<deUint32>(originalBytes.size() / sizeof(float)) / count;
 
-		for (deUint32 numNdx = 0; numNdx < count; ++numNdx)
-			if (!compare16BitFloat(original[numNdx * inputStride], returned[numNdx], RoundingMode, log))
-				return false;
+		if (!compare16BitFloats(original, inputStride, returned, count, RoundingMode, log))
+			return false;
 	}
 
 	return true;
@@ -285,9 +365,8 @@ bool computeCheck16BitFloats (const std::vector<Resource>&	originalFloats,
 		const deUint32	count		= static_cast<deUint32>(expectedOutputs[outputNdx].getByteSize() / sizeof(deUint16));
 		const deUint32	inputStride	= static_cast<deUint32>(originalBytes.size() / sizeof(float)) / count;
 
-		for (deUint32 numNdx = 0; numNdx < count; ++numNdx)
-			if (!compare16BitFloat(original[numNdx * inputStride], returned[numNdx], RoundingMode, log))
-				return false;
+		if (!compare16BitFloats(original, inputStride, returned, count, RoundingMode, log))
+			return false;
 	}
 
 	return true;
@@ -887,12 +966,7 @@ bool compareStruct(const resultType* returned, const originType* original, tcu::
 
 		//Different offset but that same amount of data
 		DE_ASSERT(originToCompare.size() == resultToCompare.size());
-		for (unsigned int ndx = 0; ndx < static_cast<unsigned int>(originToCompare.size()); ++ndx)
-		{
-			if (!compare16Bit(originToCompare[ndx], resultToCompare[ndx], RoundingModeFlags(ROUNDINGMODE_RTE | ROUNDINGMODE_RTZ), log))
-				return false;
-		}
-		return true;
+		return compare16BitArray(originToCompare, resultToCompare, RoundingModeFlags(ROUNDINGMODE_RTE | ROUNDINGMODE_RTZ), log);
 }
 
 template<typename originType, typename resultType, ShaderTemplate funcOrigin, ShaderTemplate funcResult>
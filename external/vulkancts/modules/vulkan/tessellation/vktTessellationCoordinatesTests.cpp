@@ -25,6 +25,7 @@
 #include "vktTessellationCoordinatesTests.hpp"
 #include "vktTestCaseUtil.hpp"
 #include "vktTessellationUtil.hpp"
+#include "vktTessellationSpatialHash.hpp"
 
 #include "tcuTestLog.hpp"
 #include "tcuRGBA.hpp"
@@ -261,20 +262,6 @@ void drawTessCoordVisualization (tcu::Surface& dst, const TessPrimitiveType prim
 		drawTessCoordPoint(dst, primitiveType, coords[i], tcu::RGBA::white(), 2);
 }
 
-inline bool vec3XLessThan (const tcu::Vec3& a, const tcu::Vec3& b)
-{
-	return a.x() < b.x();
-}
-
-int binarySearchFirstVec3WithXAtLeast (const std::vector<tcu::Vec3>& sorted, float x)
-{
-	const tcu::Vec3 ref(x, 0.0f, 0.0f);
-	const std::vector<tcu::Vec3>::const_iterator first = std::lower_bound(sorted.begin(), sorted.end(), ref, vec3XLessThan);
-	if (first == sorted.end())
-		return -1;
-	return static_cast<int>(std::distance(sorted.begin(), first));
-}
-
 // Check that all points in subset are (approximately) present also in superset.
 bool oneWayComparePointSets (tcu::TestLog&					log,
 							 tcu::Surface&					errorDst,
@@ -285,50 +272,22 @@ bool oneWayComparePointSets (tcu::TestLog&					log,
 							 const char*					supersetName,
 							 const tcu::RGBA&				errorColor)
 {
-	const std::vector<tcu::Vec3> supersetSorted		 = sorted(superset, vec3XLessThan);
-	const float					 epsilon			 = 0.01f;
-	const int					 maxNumFailurePrints = 5;
-	int							 numFailuresDetected = 0;
+	const float					epsilon				= 0.01f;
+	const int					maxNumFailurePrints	= 5;
+	const TessCoordGrid			supersetGrid		(superset, epsilon);
+	const std::vector<int>		missing				= supersetGrid.findMissing(subset);
+	const int					numFailuresDetected	= static_cast<int>(missing.size());
 
-	for (int subNdx = 0; subNdx < static_cast<int>(subset.size()); ++subNdx)
+	for (int failureNdx = 0; failureNdx < numFailuresDetected; ++failureNdx)
 	{
-		const tcu::Vec3& subPt = subset[subNdx];
-
-		bool matchFound = false;
+		const tcu::Vec3& subPt = subset[missing[failureNdx]];
 
-		{
-			// Binary search the index of the first point in supersetSorted with x in the [subPt.x() - epsilon, subPt.x() + epsilon] range.
-			const tcu::Vec3	matchMin			= subPt - epsilon;
-			const tcu::Vec3	matchMax			= subPt + epsilon;
-			const int		firstCandidateNdx	= binarySearchFirstVec3WithXAtLeast(supersetSorted, matchMin.x());
+		if (failureNdx + 1 < maxNumFailurePrints)
+			log << tcu::TestLog::Message << "Failure: no matching " << supersetName << " point found for " << subsetName << " point " << subPt << tcu::TestLog::EndMessage;
+		else if (failureNdx + 1 == maxNumFailurePrints)
+			log << tcu::TestLog::Message << "Note: More errors follow" << tcu::TestLog::EndMessage;
 
-			if (firstCandidateNdx >= 0)
-			{
-				// Compare subPt to all points in supersetSorted with x in the [subPt.x() - epsilon, subPt.x() + epsilon] range.
-				for (int superNdx = firstCandidateNdx; superNdx < static_cast<int>(supersetSorted.size()) && supersetSorted[superNdx].x() <= matchMax.x(); ++superNdx)
-				{
-					const tcu::Vec3& superPt = supersetSorted[superNdx];
-
-					if (tcu::boolAll(tcu::greaterThanEqual	(superPt, matchMin)) &&
-						tcu::boolAll(tcu::lessThanEqual		(superPt, matchMax)))
-					{
-						matchFound = true;
-						break;
-					}
-				}
-			}
-		}
-
-		if (!matchFound)
-		{
-			++numFailuresDetected;
-			if (numFailuresDetected < maxNumFailurePrints)
-				log << tcu::TestLog::Message << "Failure: no matching " << supersetName << " point found for " << subsetName << " point " << subPt << tcu::TestLog::EndMessage;
-			else if (numFailuresDetected == maxNumFailurePrints)
-				log << tcu::TestLog::Message << "Note: More errors follow" << tcu::TestLog::EndMessage;
-
-			drawTessCoordPoint(errorDst, primitiveType, subPt, errorColor, 4);
-		}
+		drawTessCoordPoint(errorDst, primitiveType, subPt, errorColor, 4);
 	}
 
 	return numFailuresDetected == 0;
@@ -25,6 +25,7 @@
 #include "vktTessellationInvarianceTests.hpp"
 #include "vktTestCaseUtil.hpp"
 #include "vktTessellationUtil.hpp"
+#include "vktTessellationSpatialHash.hpp"
 
 #include "tcuTestLog.hpp"
 #include "tcuVectorUtil.hpp"
@@ -46,7 +47,6 @@
 
 #include <string>
 #include <vector>
-#include <set>
 
 namespace vkt
 {
@@ -199,12 +199,6 @@ inline tcu::Vector<bool, Size> singleTrueMask (int index)
 	return result;
 }
 
-template <typename ContainerT, typename T>
-inline bool contains (const ContainerT& c, const T& key)
-{
-	return c.find(key) != c.end();
-}
-
 template <typename SeqT, int Size, typename Pred>
 class LexCompare
 {
@@ -477,7 +471,7 @@ struct CaseDefinition
 	bool				usePointMode;
 };
 
-typedef std::set<tcu::Vec3, VecLexLessThan<3> > Vec3Set;
+typedef TessHashSet<tcu::Vec3> Vec3Set;
 
 std::vector<float> generateRandomPatchTessLevels (const int numPatches, const int constantOuterLevelIndex, const float constantOuterLevel, de::Random& rnd)
 {
@@ -791,8 +785,8 @@ tcu::TestStatus OuterEdgeDivisionTestInstance::iterate (void)
 
 					log << tcu::TestLog::Message
 						<< "Note: resulting vertices for the edge for the cases were:\n"
-						<< "  - case A: " << containerStr(firstOuterEdgeVertices, 5, 14) << "\n"
-						<< "  - case B: " << containerStr(outerEdgeVertices, 5, 14)
+						<< "  - case A: " << containerStr(sorted(firstOuterEdgeVertices.getElements(), VecLexLessThan<3>()), 5, 14) << "\n"
+						<< "  - case B: " << containerStr(sorted(outerEdgeVertices.getElements(), VecLexLessThan<3>()), 5, 14)
 						<< tcu::TestLog::EndMessage;
 
 					return tcu::TestStatus::fail("Invalid set of vertices");
@@ -886,8 +880,8 @@ tcu::TestStatus OuterEdgeIndexIndependenceTestInstance::iterate (void)
 
 					log << tcu::TestLog::Message
 						<< "Note: set of vertices on " << edgeDesc.description() << " edge, components swizzled like " << swizzleDesc
-						<< " to match component order on first edge:\n" << containerStr(currentEdgeVertices, 5)
-						<< "\non " << m_edgeDescriptions[0].description() << " edge:\n" << containerStr(firstEdgeVertices, 5)
+						<< " to match component order on first edge:\n" << containerStr(sorted(currentEdgeVertices.getElements(), VecLexLessThan<3>()), 5)
+						<< "\non " << m_edgeDescriptions[0].description() << " edge:\n" << containerStr(sorted(firstEdgeVertices.getElements(), VecLexLessThan<3>()), 5)
 						<< tcu::TestLog::EndMessage;
 
 					return tcu::TestStatus::fail("Invalid set of vertices");
@@ -983,13 +977,13 @@ tcu::TestStatus SymmetricOuterEdgeTestInstance::iterate (void)
 			else
 				DE_ASSERT(false);
 
-			if (!contains(nonMirroredEdgeVertices, endpointA) ||
-				!contains(nonMirroredEdgeVertices, endpointB))
+			if (!nonMirroredEdgeVertices.contains(endpointA) ||
+				!nonMirroredEdgeVertices.contains(endpointB))
 			{
 				m_context.getTestContext().getLog()
 					<< tcu::TestLog::Message << "Failure: edge doesn't contain both endpoints, " << endpointA << " and " << endpointB << tcu::TestLog::EndMessage
-					<< tcu::TestLog::Message << "Note: non-mirrored vertices:\n" << containerStr(nonMirroredEdgeVertices, 5)
-											 << "\nmirrored vertices:\n" << containerStr(mirroredEdgeVertices, 5) << tcu::TestLog::EndMessage;
+					<< tcu::TestLog::Message << "Note: non-mirrored vertices:\n" << containerStr(sorted(nonMirroredEdgeVertices.getElements(), VecLexLessThan<3>()), 5)
+											 << "\nmirrored vertices:\n" << containerStr(sorted(mirroredEdgeVertices.getElements(), VecLexLessThan<3>()), 5) << tcu::TestLog::EndMessage;
 
 				return tcu::TestStatus::fail("Invalid set of vertices");
 			}
@@ -1001,8 +995,8 @@ tcu::TestStatus SymmetricOuterEdgeTestInstance::iterate (void)
 		{
 			m_context.getTestContext().getLog()
 				<< tcu::TestLog::Message << "Failure: the set of mirrored edges isn't equal to the set of non-mirrored edges (ignoring endpoints and possible middle)" << tcu::TestLog::EndMessage
-				<< tcu::TestLog::Message << "Note: non-mirrored vertices:\n" << containerStr(nonMirroredEdgeVertices, 5)
-										 << "\nmirrored vertices:\n" << containerStr(mirroredEdgeVertices, 5) << tcu::TestLog::EndMessage;
+				<< tcu::TestLog::Message << "Note: non-mirrored vertices:\n" << containerStr(sorted(nonMirroredEdgeVertices.getElements(), VecLexLessThan<3>()), 5)
+										 << "\nmirrored vertices:\n" << containerStr(sorted(mirroredEdgeVertices.getElements(), VecLexLessThan<3>()), 5) << tcu::TestLog::EndMessage;
 
 			return tcu::TestStatus::fail("Invalid set of vertices");
 		}
@@ -1167,8 +1161,7 @@ bool compareTriangleSets (const PerPrimitiveVec&		primitivesA,
 						  const IsTriangleRelevantT&	isTriangleRelevant,
 						  const char*					ignoredTriangleDescription = DE_NULL)
 {
-	typedef LexCompare<Triangle, 3, VecLexLessThan<3> >		TriangleLexLessThan;
-	typedef std::set<Triangle, TriangleLexLessThan>			TriangleSet;
+	typedef TessHashSet<Triangle>	TriangleSet;
 
 	const int		numTrianglesA = static_cast<int>(primitivesA.size());
 	const int		numTrianglesB = static_cast<int>(primitivesB.size());
@@ -1192,34 +1185,35 @@ bool compareTriangleSets (const PerPrimitiveVec&		primitivesA,
 			}
 		}
 	}
+
+	if (trianglesA != trianglesB)
 	{
-		TriangleSet::const_iterator aIt = trianglesA.begin();
-		TriangleSet::const_iterator bIt = trianglesB.begin();
+		typedef LexCompare<Triangle, 3, VecLexLessThan<3> > TriangleLexLessThan;
 
-		while (aIt != trianglesA.end() || bIt != trianglesB.end())
+		log << tcu::TestLog::Message << "Failure: triangle sets in two cases are not equal (when ignoring triangle and vertex order"
+			<< (ignoredTriangleDescription == DE_NULL ? "" : std::string() + ", and " + ignoredTriangleDescription) << ")" << tcu::TestLog::EndMessage;
+
+		// Report the lexicographically first triangle missing from either set.
+		for (int aOrB = 0; aOrB < 2; ++aOrB)
 		{
-			const bool aEnd = aIt == trianglesA.end();
-			const bool bEnd = bIt == trianglesB.end();
+			const TriangleSet&			triangles	= aOrB == 0 ? trianglesA : trianglesB;
+			const TriangleSet&			others		= aOrB == 0 ? trianglesB : trianglesA;
+			const std::vector<Triangle>	elements	= sorted(triangles.getElements(), TriangleLexLessThan());
 
-			if (aEnd || bEnd || *aIt != *bIt)
+			for (std::vector<Triangle>::const_iterator triIt = elements.begin(); triIt != elements.end(); ++triIt)
 			{
-				log << tcu::TestLog::Message << "Failure: triangle sets in two cases are not equal (when ignoring triangle and vertex order"
-					<< (ignoredTriangleDescription == DE_NULL ? "" : std::string() + ", and " + ignoredTriangleDescription) << ")" << tcu::TestLog::EndMessage;
-
-				if (!aEnd && (bEnd || TriangleLexLessThan()(*aIt, *bIt)))
-					log << tcu::TestLog::Message << "Note: e.g. triangle " << *aIt << " exists for first case but not for second" << tcu::TestLog::EndMessage;
-				else
-					log << tcu::TestLog::Message << "Note: e.g. triangle " << *bIt << " exists for second case but not for first" << tcu::TestLog::EndMessage;
-
-				return false;
+				if (!others.contains(*triIt))
+				{
+					log << tcu::TestLog::Message << "Note: e.g. triangle " << *triIt << " exists for " << (aOrB == 0 ? "first case but not for second" : "second case but not for first") << tcu::TestLog::EndMessage;
+					return false;
+				}
 			}
-
-			++aIt;
-			++bIt;
 		}
 
-		return true;
+		return false;
 	}
+
+	return true;
 }
 
 template <typename ArgT, bool res>
@@ -0,0 +1,218 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Hashed tessellation coordinate and primitive sets
+ *//*--------------------------------------------------------------------*/
+
+#include "vktTessellationSpatialHash.hpp"
+
+#include "tcuVectorUtil.hpp"
+
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
+#include "deMath.h"
+
+namespace vkt
+{
+namespace tessellation
+{
+namespace
+{
+
+enum
+{
+	MIN_ITEMS_PER_THREAD	= 1<<14,
+	MAX_CHECK_THREADS		= 16
+};
+
+class RangeCheckThread : public de::Thread
+{
+public:
+					RangeCheckThread	(const RangeCheck& rangeCheck, int begin, int end)
+						: m_rangeCheck	(rangeCheck)
+						, m_begin		(begin)
+						, m_end			(end)
+						, m_result		(false)
+					{
+					}
+
+	void			run					(void)			{ m_result = m_rangeCheck.check(m_begin, m_end); }
+	bool			getResult			(void) const	{ return m_result; }
+
+private:
+	const RangeCheck&	m_rangeCheck;
+	const int			m_begin;
+	const int			m_end;
+	bool				m_result;
+};
+
+class MissingCoordCheck : public RangeCheck
+{
+public:
+					MissingCoordCheck	(const TessCoordGrid& grid, const std::vector<tcu::Vec3>& queries, std::vector<deUint8>& found)
+						: m_grid	(grid)
+						, m_queries	(queries)
+						, m_found	(found)
+					{
+					}
+
+	bool check (int begin, int end) const
+	{
+		bool allFound = true;
+
+		for (int ndx = begin; ndx < end; ++ndx)
+		{
+			m_found[ndx]	= m_grid.containsNear(m_queries[ndx]) ? 1u : 0u;
+			allFound		= allFound && m_found[ndx] != 0;
+		}
+
+		return allFound;
+	}
+
+private:
+	const TessCoordGrid&			m_grid;
+	const std::vector<tcu::Vec3>&	m_queries;
+	std::vector<deUint8>&			m_found;
+};
+
+int getBucketCount (int numPoints)
+{
+	int numBuckets = 16;
+	while (numBuckets < numPoints)
+		numBuckets *= 2;
+	return numBuckets;
+}
+
+} // anonymous
+
+bool runRangeCheck (const RangeCheck& rangeCheck, int numItems)
+{
+	const int numThreads = de::clamp(de::min((int)deGetNumAvailableLogicalCores(), numItems / MIN_ITEMS_PER_THREAD), 1, (int)MAX_CHECK_THREADS);
+
+	if (numThreads == 1)
+		return rangeCheck.check(0, numItems);
+
+	std::vector<de::SharedPtr<RangeCheckThread> >	threads;
+	const int										chunkSize	= (numItems + numThreads - 1) / numThreads;
+	bool											allOk		= true;
+
+	for (int begin = 0; begin < numItems; begin += chunkSize)
+	{
+		threads.push_back(de::SharedPtr<RangeCheckThread>(new RangeCheckThread(rangeCheck, begin, de::min(begin + chunkSize, numItems))));
+		threads.back()->start();
+	}
+
+	for (size_t threadNdx = 0; threadNdx < threads.size(); ++threadNdx)
+	{
+		threads[threadNdx]->join();
+		allOk = allOk && threads[threadNdx]->getResult();
+	}
+
+	return allOk;
+}
+
+TessCoordGrid::TessCoordGrid (const std::vector<tcu::Vec3>& points, float epsilon)
+	: m_points	(points)
+	, m_epsilon	(epsilon)
+	, m_cellSize(2.0f * epsilon)
+	, m_buckets	(getBucketCount((int)points.size()) + 1, 0)
+	, m_order	(points.size())
+{
+	DE_ASSERT(epsilon > 0.0f);
+
+	std::vector<deUint32> pointBuckets (points.size());
+
+	// Counting sort of points by bucket.
+	for (size_t ndx = 0; ndx < points.size(); ++ndx)
+	{
+		pointBuckets[ndx] = getBucket(getCell(points[ndx]));
+		m_buckets[pointBuckets[ndx] + 1] += 1;
+	}
+
+	for (size_t bucket = 1; bucket < m_buckets.size(); ++bucket)
+		m_buckets[bucket] += m_buckets[bucket - 1];
+
+	{
+		std::vector<int> writePos (m_buckets.begin(), m_buckets.end() - 1);
+
+		for (size_t ndx = 0; ndx < points.size(); ++ndx)
+			m_order[writePos[pointBuckets[ndx]]++] = (int)ndx;
+	}
+}
+
+tcu::IVec3 TessCoordGrid::getCell (const tcu::Vec3& coord) const
+{
+	return tcu::IVec3(deFloorFloatToInt32(coord.x() / m_cellSize),
+					  deFloorFloatToInt32(coord.y() / m_cellSize),
+					  deFloorFloatToInt32(coord.z() / m_cellSize));
+}
+
+deUint32 TessCoordGrid::getBucket (const tcu::IVec3& cell) const
+{
+	deUint32 hash = 0;
+	for (int i = 0; i < 3; ++i)
+		hash = combineTessHash(hash, (deUint32)cell[i]);
+	return hash & (deUint32)(m_buckets.size() - 2);
+}
+
+bool TessCoordGrid::containsNear (const tcu::Vec3& coord) const
+{
+	const tcu::Vec3		matchMin	= coord - m_epsilon;
+	const tcu::Vec3		matchMax	= coord + m_epsilon;
+	const tcu::IVec3	center		= getCell(coord);
+
+	for (int dz = -1; dz <= 1; ++dz)
+	for (int dy = -1; dy <= 1; ++dy)
+	for (int dx = -1; dx <= 1; ++dx)
+	{
+		const deUint32 bucket = getBucket(center + tcu::IVec3(dx, dy, dz));
+
+		for (int orderNdx = m_buckets[bucket]; orderNdx < m_buckets[bucket + 1]; ++orderNdx)
+		{
+			const tcu::Vec3& point = m_points[m_order[orderNdx]];
+
+			if (tcu::boolAll(tcu::greaterThanEqual	(point, matchMin)) &&
+				tcu::boolAll(tcu::lessThanEqual		(point, matchMax)))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+std::vector<int> TessCoordGrid::findMissing (const std::vector<tcu::Vec3>& queries) const
+{
+	std::vector<deUint8>	found	(queries.size(), 0u);
+	std::vector<int>		missing;
+
+	if (!runRangeCheck(MissingCoordCheck(*this, queries, found), (int)queries.size()))
+	{
+		for (size_t ndx = 0; ndx < queries.size(); ++ndx)
+		{
+			if (!found[ndx])
+				missing.push_back((int)ndx);
+		}
+	}
+
+	return missing;
+}
+
+} // tessellation
+} // vkt
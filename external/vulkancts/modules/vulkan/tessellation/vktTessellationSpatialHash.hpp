@@ -0,0 +1,301 @@
+#ifndef _VKTTESSELLATIONSPATIALHASH_HPP
+#define _VKTTESSELLATIONSPATIALHASH_HPP
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Hashed tessellation coordinate and primitive sets
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuVector.hpp"
+#include "deInt32.h"
+#include "deMemory.h"
+
+#include <vector>
+
+namespace vkt
+{
+namespace tessellation
+{
+
+//! Hash of a float, -0.0 and 0.0 hash identically to match operator==.
+inline deUint32 hashTessFloat (float f)
+{
+	const float	canonical	= f + 0.0f;
+	deUint32	bits;
+
+	deMemcpy(&bits, &canonical, sizeof(bits));
+	return bits;
+}
+
+inline deUint32 combineTessHash (deUint32 hash, deUint32 value)
+{
+	return deUint32Hash(value ^ (hash * 0x9e3779b1u + 0x7f4a7c15u));
+}
+
+template <int Size>
+inline deUint32 hashTessElement (const tcu::Vector<float, Size>& v)
+{
+	deUint32 hash = 0;
+	for (int i = 0; i < Size; ++i)
+		hash = combineTessHash(hash, hashTessFloat(v[i]));
+	return hash;
+}
+
+//! Primitives, e.g. triangles as tcu::Vector<tcu::Vec3, 3>. Vertex order must be canonicalized by caller.
+template <int Size>
+inline deUint32 hashTessElement (const tcu::Vector<tcu::Vector<float, 3>, Size>& primitive)
+{
+	deUint32 hash = 0;
+	for (int i = 0; i < Size; ++i)
+		hash = combineTessHash(hash, hashTessElement(primitive[i]));
+	return hash;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Run check over index range split into chunks on available cores
+ *
+ * Small ranges are checked on the calling thread. Returns true if all
+ * chunks pass. Chunks are disjoint, so per-index output written by the
+ * check does not need synchronization.
+ *//*--------------------------------------------------------------------*/
+class RangeCheck
+{
+public:
+	virtual			~RangeCheck		(void) {}
+	virtual bool	check			(int begin, int end) const = 0;
+};
+
+bool runRangeCheck (const RangeCheck& rangeCheck, int numItems);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Set of exactly matching coordinates or primitives
+ *
+ * Replacement for std::set with lexicographic compare when only
+ * membership and equality are needed. Insert and lookup are O(1) and set
+ * comparison is linear. Iteration order is insertion order.
+ *//*--------------------------------------------------------------------*/
+template <typename T>
+class TessHashSet
+{
+public:
+							TessHashSet		(void);
+
+	//! Returns false if element was already present.
+	bool					insert			(const T& elem);
+	bool					erase			(const T& elem);
+	bool					contains		(const T& elem) const	{ return find(elem, hashTessElement(elem)) >= 0;	}
+
+	int						size			(void) const			{ return m_numElements;								}
+	bool					empty			(void) const			{ return m_numElements == 0;						}
+
+	bool					isSubsetOf		(const TessHashSet& other) const;
+	bool					operator==		(const TessHashSet& other) const	{ return size() == other.size() && isSubsetOf(other);	}
+	bool					operator!=		(const TessHashSet& other) const	{ return !(*this == other);								}
+
+	std::vector<T>			getElements		(void) const;
+
+private:
+	class SubsetCheck;
+
+	int						find			(const T& elem, deUint32 hash) const;
+	void					rehash			(int numBuckets);
+
+	std::vector<T>			m_elements;		//!< Erased elements stay here until next rehash.
+	std::vector<deUint32>	m_hashes;
+	std::vector<int>		m_next;			//!< Next element in bucket chain, -1 terminates. -2 marks erased element.
+	std::vector<int>		m_buckets;
+	int						m_numElements;
+};
+
+template <typename T>
+class TessHashSet<T>::SubsetCheck : public RangeCheck
+{
+public:
+					SubsetCheck		(const TessHashSet& subset, const TessHashSet& superset) : m_subset(subset), m_superset(superset) {}
+
+	bool check (int begin, int end) const
+	{
+		for (int ndx = begin; ndx < end; ++ndx)
+		{
+			if (m_subset.m_next[ndx] != -2 && m_superset.find(m_subset.m_elements[ndx], m_subset.m_hashes[ndx]) < 0)
+				return false;
+		}
+		return true;
+	}
+
+private:
+	const TessHashSet&	m_subset;
+	const TessHashSet&	m_superset;
+};
+
+template <typename T>
+TessHashSet<T>::TessHashSet (void)
+	: m_buckets		(16, -1)
+	, m_numElements	(0)
+{
+}
+
+template <typename T>
+int TessHashSet<T>::find (const T& elem, deUint32 hash) const
+{
+	for (int ndx = m_buckets[hash & (deUint32)(m_buckets.size()-1)]; ndx >= 0; ndx = m_next[ndx])
+	{
+		if (m_hashes[ndx] == hash && m_elements[ndx] == elem)
+			return ndx;
+	}
+	return -1;
+}
+
+template <typename T>
+void TessHashSet<T>::rehash (int numBuckets)
+{
+	std::vector<T>			elements;
+	std::vector<deUint32>	hashes;
+
+	elements.reserve(m_numElements);
+	hashes.reserve(m_numElements);
+
+	for (size_t ndx = 0; ndx < m_elements.size(); ++ndx)
+	{
+		if (m_next[ndx] != -2)
+		{
+			elements.push_back(m_elements[ndx]);
+			hashes.push_back(m_hashes[ndx]);
+		}
+	}
+
+	m_elements.swap(elements);
+	m_hashes.swap(hashes);
+	m_next.assign(m_elements.size(), -1);
+	m_buckets.assign(numBuckets, -1);
+
+	for (int ndx = 0; ndx < (int)m_elements.size(); ++ndx)
+	{
+		const deUint32 bucket = m_hashes[ndx] & (deUint32)(numBuckets-1);
+		m_next[ndx]		= m_buckets[bucket];
+		m_buckets[bucket]	= ndx;
+	}
+}
+
+template <typename T>
+bool TessHashSet<T>::insert (const T& elem)
+{
+	const deUint32 hash = hashTessElement(elem);
+
+	if (find(elem, hash) >= 0)
+		return false;
+
+	if (m_elements.size() >= m_buckets.size())
+		rehash((int)m_buckets.size() * (m_numElements*2 >= (int)m_buckets.size() ? 2 : 1));
+
+	{
+		const deUint32	bucket	= hash & (deUint32)(m_buckets.size()-1);
+		const int		ndx		= (int)m_elements.size();
+
+		m_elements.push_back(elem);
+		m_hashes.push_back(hash);
+		m_next.push_back(m_buckets[bucket]);
+		m_buckets[bucket] = ndx;
+		m_numElements += 1;
+	}
+
+	return true;
+}
+
+template <typename T>
+bool TessHashSet<T>::erase (const T& elem)
+{
+	const deUint32	hash	= hashTessElement(elem);
+	int*			link	= &m_buckets[hash & (deUint32)(m_buckets.size()-1)];
+
+	for (; *link >= 0; link = &m_next[*link])
+	{
+		const int ndx = *link;
+
+		if (m_hashes[ndx] == hash && m_elements[ndx] == elem)
+		{
+			*link			= m_next[ndx];
+			m_next[ndx]		= -2;
+			m_numElements	-= 1;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+template <typename T>
+bool TessHashSet<T>::isSubsetOf (const TessHashSet& other) const
+{
+	if (size() > other.size())
+		return false;
+
+	return runRangeCheck(SubsetCheck(*this, other), (int)m_elements.size());
+}
+
+template <typename T>
+std::vector<T> TessHashSet<T>::getElements (void) const
+{
+	std::vector<T> elements;
+
+	elements.reserve(m_numElements);
+	for (size_t ndx = 0; ndx < m_elements.size(); ++ndx)
+	{
+		if (m_next[ndx] != -2)
+			elements.push_back(m_elements[ndx]);
+	}
+
+	return elements;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Uniform grid for approximate coordinate lookups
+ *
+ * Points are binned into cells of size 2*epsilon, so all points within
+ * epsilon (per component) of a query are found in the 27 cells around
+ * the query, with margin for rounding.
+ *//*--------------------------------------------------------------------*/
+class TessCoordGrid
+{
+public:
+							TessCoordGrid	(const std::vector<tcu::Vec3>& points, float epsilon);
+
+	//! True if a point within epsilon of coord, per component, exists.
+	bool					containsNear	(const tcu::Vec3& coord) const;
+
+	//! Indices of queries with no point within epsilon, in ascending order. Large query sets are processed in parallel.
+	std::vector<int>		findMissing		(const std::vector<tcu::Vec3>& queries) const;
+
+private:
+	tcu::IVec3				getCell			(const tcu::Vec3& coord) const;
+	deUint32				getBucket		(const tcu::IVec3& cell) const;
+
+	const std::vector<tcu::Vec3>&	m_points;
+	const float						m_epsilon;
+	const float						m_cellSize;
+	std::vector<int>				m_buckets;	//!< First point index of each bucket in m_order, bucket b spans [m_buckets[b], m_buckets[b+1]).
+	std::vector<int>				m_order;	//!< Point indices sorted by bucket.
+};
+
+} // tessellation
+} // vkt
+
+#endif // _VKTTESSELLATIONSPATIALHASH_HPP
@@ -564,6 +564,8 @@ DE_DECLARE_COMMAND_LINE_OPT(VulkanVersion,			deUint32);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCache,			bool);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheFilename,	std::string);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheTruncate,	bool);
+DE_DECLARE_COMMAND_LINE_OPT(SpirvAsmCache,			bool);
+DE_DECLARE_COMMAND_LINE_OPT(SpirvAsmCacheFilename,	std::string);
 DE_DECLARE_COMMAND_LINE_OPT(SpirvOptimize,			bool);
 DE_DECLARE_COMMAND_LINE_OPT(SpirvOptimizationRecipe,std::string);
 DE_DECLARE_COMMAND_LINE_OPT(SpirvAllow14,			bool);
@@ -596,6 +598,8 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<opt::ShaderCache>("s", "shadercache", "Enable or disable shader cache", s_enableNames, "enable")
 		<< Option<opt::ShaderCacheFilename>("r", "shadercache-filename", "Write shader cache to given file", "shadercache.bin")
 		<< Option<opt::ShaderCacheTruncate>("x", "shadercache-truncate", "Truncate shader cache before running", s_enableNames, "enable")
+		<< Option<opt::SpirvAsmCache>("a", "spirv-asm-cache", "Enable or disable SPIR-V assembly result cache", s_enableNames, "enable")
+		<< Option<opt::SpirvAsmCacheFilename>("b", "spirv-asm-cache-filename", "Store SPIR-V assembly results to given file", "spirvasmcache.bin")
 		<< Option<opt::SpirvOptimize>("o", "deqp-optimize-spirv", "Enable optimization for SPIR-V", s_enableNames, "disable")
 		<< Option<opt::SpirvOptimizationRecipe>("p","deqp-optimization-recipe", "Shader optimization recipe")
 		<< Option<opt::SpirvAllow14>("e","allow-spirv-14", "Allow SPIR-V 1.4 with Vulkan 1.1");
@@ -653,6 +657,21 @@ int main (int argc, const char* argv[])
 				deqpArgv.push_back("disable");
 		}
 
+		if (cmdLine.hasOption<opt::SpirvAsmCache>())
+		{
+			deqpArgv.push_back("--deqp-spirv-asm-cache");
+			if (cmdLine.getOption<opt::SpirvAsmCache>())
+				deqpArgv.push_back("enable");
+			else
+				deqpArgv.push_back("disable");
+		}
+
+		if (cmdLine.hasOption<opt::SpirvAsmCacheFilename>())
+		{
+			deqpArgv.push_back("--deqp-spirv-asm-cache-filename");
+			deqpArgv.push_back(cmdLine.getOption<opt::SpirvAsmCacheFilename>().c_str());
+		}
+
 		if (cmdLine.hasOption<opt::SpirvOptimize>())
 		{
 			deqpArgv.push_back("--deqp-optimize-spirv");
@@ -697,6 +716,14 @@ int main (int argc, const char* argv[])
 
 		tcu::print("DONE: %d passed, %d failed, %d not supported\n", stats.numSucceeded, stats.numFailed, stats.notSupported);
 
+		if (deqpCmdLine.isSpirvAsmCacheEnabled())
+		{
+			const vk::SpirVAsmCacheStats	asmCacheStats	= vk::getSpirVAsmCacheStats();
+
+			tcu::print("SPIR-V assembly cache: %d memory hits, %d file hits, %d misses\n",
+					   (int)asmCacheStats.numMemoryHits, (int)asmCacheStats.numFileHits, (int)asmCacheStats.numMisses);
+		}
+
 		return stats.numFailed == 0 ? 0 : -1;
 	}
 	catch (const std::exception& e)
@@ -37,6 +37,7 @@
 #include "vkSafetyCriticalUtil.hpp"
 #include "vkAppParamsUtil.hpp"
 #endif // CTS_USES_VULKANSC
+#include "vkProfilingDriver.hpp"
 
 #include "tcuCommandLine.hpp"
 #include "tcuTestLog.hpp"
@@ -380,7 +381,11 @@ public:
 																	~DefaultDevice							(void);
 
 	VkInstance														getInstance								(void) const { return *m_instance;											}
+#ifndef CTS_USES_VULKANSC
+	const InstanceInterface&										getInstanceInterface					(void) const { return m_profilingInstanceInterface ? static_cast<const InstanceInterface&>(*m_profilingInstanceInterface) : m_instanceInterface;	}
+#else
 	const InstanceInterface&										getInstanceInterface					(void) const { return m_instanceInterface;									}
+#endif // CTS_USES_VULKANSC
 	deUint32														getMaximumFrameworkVulkanVersion		(void) const { return m_maximumFrameworkVulkanVersion;						}
 	deUint32														getAvailableInstanceVersion				(void) const { return m_availableInstanceVersion;							}
 	deUint32														getUsedInstanceVersion					(void) const { return m_usedInstanceVersion;								}
@@ -415,7 +420,11 @@ public:
 #include "vkDevicePropertiesForDefaultDeviceDefs.inl"
 
 	VkDevice														getDevice								(void) const { return *m_device;											}
+#ifndef CTS_USES_VULKANSC
+	const DeviceInterface&											getDeviceInterface						(void) const { return m_profilingDeviceInterface ? static_cast<const DeviceInterface&>(*m_profilingDeviceInterface) : *m_deviceInterface;	}
+#else
 	const DeviceInterface&											getDeviceInterface						(void) const { return *m_deviceInterface;									}
+#endif // CTS_USES_VULKANSC
 	const vector<string>&											getDeviceExtensions						(void) const { return m_deviceExtensions;									}
 	deUint32														getUsedApiVersion						(void) const { return m_usedApiVersion;										}
 	deUint32														getUniversalQueueFamilyIndex			(void) const { return m_universalQueueFamilyIndex;							}
@@ -426,6 +435,7 @@ public:
 #ifndef CTS_USES_VULKANSC
 	bool															hasDebugReportRecorder					(void) const { return m_debugReportRecorder.get() != nullptr;				}
 	vk::DebugReportRecorder&										getDebugReportRecorder					(void) const { return *m_debugReportRecorder.get();							}
+	vk::ApiCallProfile*												getApiCallProfile						(void) const { return m_apiCallProfile.get();								}
 #endif // CTS_USES_VULKANSC
 
 private:
@@ -464,6 +474,13 @@ private:
 
 	const Unique<VkDevice>				m_device;
 	const de::MovePtr<DeviceDriver>		m_deviceInterface;
+
+#ifndef CTS_USES_VULKANSC
+	// Wrap the default instance and device interfaces when --deqp-vk-api-profile is enabled
+	const de::UniquePtr<ApiCallProfile>				m_apiCallProfile;
+	const de::UniquePtr<ProfilingInstanceDriver>	m_profilingInstanceInterface;
+	const de::UniquePtr<ProfilingDeviceDriver>		m_profilingDeviceInterface;
+#endif // CTS_USES_VULKANSC
 };
 
 namespace
@@ -535,6 +552,11 @@ DefaultDevice::DefaultDevice (const PlatformInterface& vkPlatform, const tcu::Co
 #else
 	, m_deviceInterface					(de::MovePtr<DeviceDriverSC>(new DeviceDriverSC(vkPlatform, *m_instance, *m_device, cmdLine, resourceInterface, getDeviceVulkanSC10Properties(), getDeviceProperties())))
 #endif // CTS_USES_VULKANSC
+#ifndef CTS_USES_VULKANSC
+	, m_apiCallProfile					(cmdLine.isVKApiProfileEnabled() ? new ApiCallProfile() : DE_NULL)
+	, m_profilingInstanceInterface		(m_apiCallProfile ? new ProfilingInstanceDriver(m_instanceInterface, *m_apiCallProfile) : DE_NULL)
+	, m_profilingDeviceInterface		(m_apiCallProfile ? new ProfilingDeviceDriver(*m_deviceInterface, *m_apiCallProfile) : DE_NULL)
+#endif // CTS_USES_VULKANSC
 {
 #ifndef CTS_USES_VULKANSC
 	DE_UNREF(resourceInterface);
@@ -997,6 +1019,11 @@ vk::DebugReportRecorder& Context::getDebugReportRecorder () const
 	return m_device->getDebugReportRecorder();
 }
 
+vk::ApiCallProfile* Context::getApiCallProfile () const
+{
+	return m_device->getApiCallProfile();
+}
+
 #endif // CTS_USES_VULKANSC
 
 void Context::resetCommandPoolForVKSC	(const VkDevice					device,
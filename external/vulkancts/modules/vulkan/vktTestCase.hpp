@@ -46,6 +46,7 @@ namespace vk
 {
 class PlatformInterface;
 class Allocator;
+class ApiCallProfile;
 struct SourceCollections;
 }
 
@@ -139,6 +140,8 @@ public:
 #ifndef CTS_USES_VULKANSC
 	bool										hasDebugReportRecorder			() const;
 	vk::DebugReportRecorder&					getDebugReportRecorder			() const;
+	//! Profile of default instance and device API calls, or null if --deqp-vk-api-profile is disabled
+	vk::ApiCallProfile*							getApiCallProfile				() const;
 #endif // CTS_USES_VULKANSC
 
 	void checkPipelineLibraryRequirements (const vk::PipelineConstructionType		pipelineConstructionType);
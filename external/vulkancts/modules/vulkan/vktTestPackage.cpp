@@ -31,6 +31,7 @@
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
 #include "tcuWaiverUtil.hpp"
+#include "tcuHarnessProfile.hpp"
 
 #include "vkPlatform.hpp"
 #include "vkPrograms.hpp"
@@ -41,6 +42,7 @@
 #include "vkApiVersion.hpp"
 #include "vkRenderDocUtil.hpp"
 #include "vkResourceInterface.hpp"
+#include "vkProfilingDriver.hpp"
 
 #include "deUniquePtr.hpp"
 #include "deSharedPtr.hpp"
@@ -112,11 +114,13 @@
 #include "vktModifiersTests.hpp"
 #include "vktRayTracingTests.hpp"
 #include "vktRayQueryTests.hpp"
+#include "vktRayQueryReferenceTracerTests.hpp"
 #include "vktPostmortemTests.hpp"
 #include "vktFragmentShadingRateTests.hpp"
 #include "vktReconvergenceTests.hpp"
 #include "vktMeshShaderTests.hpp"
 #include "vktFragmentShadingBarycentricTests.hpp"
+#include "vktPerformanceTests.hpp"
 #ifdef CTS_USES_VULKANSC
 #include "vktSafetyCriticalTests.hpp"
 #endif // CTS_USES_VULKANSC
@@ -414,67 +418,80 @@ void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePat
 	if (m_waiverMechanism.isOnWaiverList(casePath))
 		throw tcu::TestException("Waived test", QP_TEST_RESULT_WAIVER);
 
-	vktCase->checkSupport(*m_context);
+#ifndef CTS_USES_VULKANSC
+	// Only count calls made by this case
+	if (vk::ApiCallProfile* const apiCallProfile = m_context->getApiCallProfile())
+		apiCallProfile->reset();
+#endif // CTS_USES_VULKANSC
 
-	vktCase->delayedInit();
+	{
+		const tcu::HarnessPhaseScope phaseScope (tcu::HARNESS_PHASE_CONTEXT_SETUP);
+		vktCase->checkSupport(*m_context);
+	}
 
-	m_progCollection.clear();
-	vktCase->initPrograms(sourceProgs);
+	vktCase->delayedInit();
 
-	for (vk::GlslSourceCollection::Iterator progIter = sourceProgs.glslSources.begin(); progIter != sourceProgs.glslSources.end(); ++progIter)
 	{
-		if (!spirvVersionSupported(progIter.getProgram().buildOptions.targetVersion))
-			TCU_THROW(NotSupportedError, "Shader requires SPIR-V higher than available");
+		const tcu::HarnessPhaseScope phaseScope (tcu::HARNESS_PHASE_PROGRAMS);
 
-		const vk::ProgramBinary* const binProg = m_resourceInterface->buildProgram<glu::ShaderProgramInfo, vk::GlslSourceCollection::Iterator>(casePath, progIter, m_prebuiltBinRegistry, &m_progCollection);
+		m_progCollection.clear();
+		vktCase->initPrograms(sourceProgs);
 
-		if (doShaderLog)
+		for (vk::GlslSourceCollection::Iterator progIter = sourceProgs.glslSources.begin(); progIter != sourceProgs.glslSources.end(); ++progIter)
 		{
-			try
-			{
-				std::ostringstream disasm;
+			if (!spirvVersionSupported(progIter.getProgram().buildOptions.targetVersion))
+				TCU_THROW(NotSupportedError, "Shader requires SPIR-V higher than available");
 
-				vk::disassembleProgram(*binProg, &disasm);
+			const vk::ProgramBinary* const binProg = m_resourceInterface->buildProgram<glu::ShaderProgramInfo, vk::GlslSourceCollection::Iterator>(casePath, progIter, m_prebuiltBinRegistry, &m_progCollection);
 
-				log << vk::SpirVAsmSource(disasm.str());
-			}
-			catch (const tcu::NotSupportedError& err)
+			if (doShaderLog)
 			{
-				log << err;
+				try
+				{
+					std::ostringstream disasm;
+
+					vk::disassembleProgram(*binProg, &disasm);
+
+					log << vk::SpirVAsmSource(disasm.str());
+				}
+				catch (const tcu::NotSupportedError& err)
+				{
+					log << err;
+				}
 			}
 		}
-	}
 
-	for (vk::HlslSourceCollection::Iterator progIter = sourceProgs.hlslSources.begin(); progIter != sourceProgs.hlslSources.end(); ++progIter)
-	{
-		if (!spirvVersionSupported(progIter.getProgram().buildOptions.targetVersion))
-			TCU_THROW(NotSupportedError, "Shader requires SPIR-V higher than available");
+		for (vk::HlslSourceCollection::Iterator progIter = sourceProgs.hlslSources.begin(); progIter != sourceProgs.hlslSources.end(); ++progIter)
+		{
+			if (!spirvVersionSupported(progIter.getProgram().buildOptions.targetVersion))
+				TCU_THROW(NotSupportedError, "Shader requires SPIR-V higher than available");
 
-		const vk::ProgramBinary* const binProg = m_resourceInterface->buildProgram<glu::ShaderProgramInfo, vk::HlslSourceCollection::Iterator>(casePath, progIter, m_prebuiltBinRegistry, &m_progCollection);
+			const vk::ProgramBinary* const binProg = m_resourceInterface->buildProgram<glu::ShaderProgramInfo, vk::HlslSourceCollection::Iterator>(casePath, progIter, m_prebuiltBinRegistry, &m_progCollection);
 
-		if (doShaderLog)
-		{
-			try
+			if (doShaderLog)
 			{
-				std::ostringstream disasm;
+				try
+				{
+					std::ostringstream disasm;
 
-				vk::disassembleProgram(*binProg, &disasm);
+					vk::disassembleProgram(*binProg, &disasm);
 
-				log << vk::SpirVAsmSource(disasm.str());
-			}
-			catch (const tcu::NotSupportedError& err)
-			{
-				log << err;
+					log << vk::SpirVAsmSource(disasm.str());
+				}
+				catch (const tcu::NotSupportedError& err)
+				{
+					log << err;
+				}
 			}
 		}
-	}
 
-	for (vk::SpirVAsmCollection::Iterator asmIterator = sourceProgs.spirvAsmSources.begin(); asmIterator != sourceProgs.spirvAsmSources.end(); ++asmIterator)
-	{
-		if (!spirvVersionSupported(asmIterator.getProgram().buildOptions.targetVersion))
-			TCU_THROW(NotSupportedError, "Shader requires SPIR-V higher than available");
+		for (vk::SpirVAsmCollection::Iterator asmIterator = sourceProgs.spirvAsmSources.begin(); asmIterator != sourceProgs.spirvAsmSources.end(); ++asmIterator)
+		{
+			if (!spirvVersionSupported(asmIterator.getProgram().buildOptions.targetVersion))
+				TCU_THROW(NotSupportedError, "Shader requires SPIR-V higher than available");
 
-		m_resourceInterface->buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, asmIterator, m_prebuiltBinRegistry, &m_progCollection);
+			m_resourceInterface->buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, asmIterator, m_prebuiltBinRegistry, &m_progCollection);
+		}
 	}
 
 	if (m_renderDoc) m_renderDoc->startFrame(m_context->getInstance());
@@ -500,6 +517,14 @@ void TestCaseExecutor::deinit (tcu::TestCase* testCase)
 	if (testCase != DE_NULL)
 		logUnusedShaders(testCase);
 
+#ifndef CTS_USES_VULKANSC
+	if (vk::ApiCallProfile* const apiCallProfile = m_context->getApiCallProfile())
+	{
+		apiCallProfile->log(m_context->getTestContext().getLog(), (size_t)de::max(m_context->getTestContext().getCommandLine().getVKApiProfileTopN(), 0));
+		apiCallProfile->reset();
+	}
+#endif // CTS_USES_VULKANSC
+
 #ifdef CTS_USES_VULKANSC
 	if (!m_context->getTestContext().getCommandLine().isSubProcess())
 	{
@@ -1138,6 +1163,8 @@ void ExperimentalTestPackage::init (void)
 {
 	addChild(postmortem::createTests			(m_testCtx));
 	addChild(Reconvergence::createTests			(m_testCtx, true));
+	addChild(performance::createTests			(m_testCtx));
+	addChild(RayQuery::createReferenceTracerTests	(m_testCtx));
 }
 
 #endif
@@ -154,6 +154,10 @@ App::App (Platform& platform, Archive& archive, TestLog& log, const CommandLine&
 		if (cmdLine.isCrashHandlingEnabled())
 			TCU_CHECK_INTERNAL(m_crashHandler = qpCrashHandler_create(onCrash, this));
 
+		// Write images into content-addressed store instead of inline
+		if (cmdLine.getLogImageStoreDir()[0] != 0)
+			log.setImageStore(cmdLine.getLogImageStoreDir());
+
 		// Create test context
 		m_testCtx = new TestContext(m_platform, archive, log, cmdLine, m_watchDog);
 
@@ -252,6 +256,8 @@ bool App::iterate (void)
 				print("  Not supported: %d/%d (%.1f%%)\n", result.numNotSupported,	result.numExecuted, (result.numExecuted > 0 ? (100.0f * (float)result.numNotSupported	/ (float)result.numExecuted) : 0.0f));
 				print("  Warnings:      %d/%d (%.1f%%)\n", result.numWarnings,		result.numExecuted, (result.numExecuted > 0 ? (100.0f * (float)result.numWarnings		/ (float)result.numExecuted) : 0.0f));
 				print("  Waived:        %d/%d (%.1f%%)\n", result.numWaived,		result.numExecuted, (result.numExecuted > 0 ? (100.0f * (float)result.numWaived			/ (float)result.numExecuted) : 0.0f));
+				if (m_testCtx->getCommandLine().isHarnessProfileEnabled())
+					print("  Failures are expected when profiling the harness and do not fail the run\n");
 				if (!result.isComplete)
 					print("Test run was ABORTED!\n");
 			}
@@ -22,11 +22,17 @@
  *//*--------------------------------------------------------------------*/
 
 #include "tcuCPUWarmup.hpp"
+#include "tcuTestLog.hpp"
 #include "deDefs.hpp"
 #include "deMath.h"
 #include "deClock.h"
+#include "deThread.h"
+#include "deStringUtil.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
 
 namespace tcu
 {
@@ -38,6 +44,10 @@ volatile Unused g_unused;
 
 }
 
+// Counted so that MeasurementEnvironment can report warmups done during a case.
+static std::atomic<int> s_numWarmups			(0);
+static std::atomic<int> s_numUnstableWarmups	(0);
+
 template <typename T, int Size>
 static inline float floatMedian (const T (&v)[Size])
 {
@@ -82,10 +92,11 @@ static inline float unusedComputation (float initial, int numIterations)
 	return a + (float)b;
 }
 
-void warmupCPU (void)
+CPUWarmupResult warmupCPU (void)
 {
-	float	unused				= *warmupCPUInternal::g_unused.m_v;
-	int		computationSize		= 1;
+	float			unused				= *warmupCPUInternal::g_unused.m_v;
+	int				computationSize		= 1;
+	CPUWarmupResult	result;
 
 	// Do a rough calibration for computationSize to get unusedComputation's running time above a certain threshold.
 	while (computationSize < 1<<30) // \note This condition is unlikely to be met. The "real" loop exit is the break below.
@@ -113,8 +124,9 @@ void warmupCPU (void)
 		const int			numConsecutiveMeasurementsRequired			= 5;
 		const float			relativeMedianAbsoluteDeviationThreshold	= 0.05f;
 		deInt64				latestTimes[numConsecutiveMeasurementsRequired];
+		int					measurementNdx;
 
-		for (int measurementNdx = 0;
+		for (measurementNdx = 0;
 
 			 measurementNdx < maxNumMeasurements &&
 			 (measurementNdx < numConsecutiveMeasurementsRequired ||
@@ -126,9 +138,201 @@ void warmupCPU (void)
 			unused = unusedComputation(unused, computationSize);
 			latestTimes[measurementNdx % numConsecutiveMeasurementsRequired] = (deInt64)(deGetMicroseconds() - startTime);
 		}
+
+		result.numMeasurements	= measurementNdx;
+		result.relativeMAD		= floatRelativeMedianAbsoluteDeviation(latestTimes);
+		result.isStable			= result.relativeMAD <= relativeMedianAbsoluteDeviationThreshold;
 	}
 
 	*warmupCPUInternal::g_unused.m_v = unused;
+
+	s_numWarmups.fetch_add(1);
+	if (!result.isStable)
+		s_numUnstableWarmups.fetch_add(1);
+
+	return result;
+}
+
+TimerProperties measureTimerProperties (void)
+{
+	const int		numOverheadCalls	= 10000;
+	const int		numResolutionSteps	= 16;
+	const int		maxResolutionCalls	= 1000000;
+	TimerProperties	properties;
+
+	// Average cost of a call
+	{
+		deUint64		accum		= 0;
+		const deUint64	startTime	= deGetMicroseconds();
+
+		for (int callNdx = 0; callNdx < numOverheadCalls; callNdx++)
+			accum ^= deGetMicroseconds();
+
+		properties.overheadNs = (float)(deGetMicroseconds() - startTime) * 1000.0f / (float)numOverheadCalls;
+
+		// Keep the loop from being optimized away
+		*warmupCPUInternal::g_unused.m_v += (float)(accum & 1u);
+	}
+
+	// Smallest observed non-zero step
+	{
+		deUint64	prevTime	= deGetMicroseconds();
+		deUint64	minStep		= ~(deUint64)0;
+		int			numSteps	= 0;
+
+		for (int callNdx = 0; callNdx < maxResolutionCalls && numSteps < numResolutionSteps; callNdx++)
+		{
+			const deUint64 curTime = deGetMicroseconds();
+
+			if (curTime != prevTime)
+			{
+				minStep		= de::min(minStep, curTime - prevTime);
+				prevTime	= curTime;
+				numSteps	+= 1;
+			}
+		}
+
+		properties.resolutionUs = numSteps > 0 ? (float)minStep : 0.0f;
+	}
+
+	return properties;
+}
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID)
+
+static bool readSysfsString (const std::string& path, std::string& dst)
+{
+	std::ifstream file (path.c_str());
+
+	if (!file)
+		return false;
+
+	std::getline(file, dst);
+
+	return !file.fail();
+}
+
+static deInt64 readSysfsInt (const std::string& path)
+{
+	std::string	str;
+	deInt64		value	= -1;
+
+	if (readSysfsString(path, str))
+	{
+		std::istringstream stream (str);
+
+		if (!(stream >> value))
+			value = -1;
+	}
+
+	return value;
+}
+
+CPUFrequencyState getCPUFrequencyState (int coreNdx)
+{
+	const std::string	cpuPath			= "/sys/devices/system/cpu/cpu" + de::toString(coreNdx);
+	const deInt64		coreThrottles	= readSysfsInt(cpuPath + "/thermal_throttle/core_throttle_count");
+	const deInt64		pkgThrottles	= readSysfsInt(cpuPath + "/thermal_throttle/package_throttle_count");
+	CPUFrequencyState	state;
+
+	readSysfsString(cpuPath + "/cpufreq/scaling_governor", state.governor);
+
+	state.curFreqKHz	= (int)readSysfsInt(cpuPath + "/cpufreq/scaling_cur_freq");
+	state.maxFreqKHz	= (int)readSysfsInt(cpuPath + "/cpufreq/cpuinfo_max_freq");
+
+	if (coreThrottles >= 0 || pkgThrottles >= 0)
+		state.throttleCount = de::max<deInt64>(coreThrottles, 0) + de::max<deInt64>(pkgThrottles, 0);
+
+	return state;
+}
+
+#else
+
+CPUFrequencyState getCPUFrequencyState (int coreNdx)
+{
+	DE_UNREF(coreNdx);
+	return CPUFrequencyState();
+}
+
+#endif // DE_OS
+
+// MeasurementEnvironment
+
+MeasurementEnvironment::MeasurementEnvironment (int pinnedCore)
+	: m_pinnedCore					(pinnedCore)
+	, m_isPinned					(false)
+	, m_prevAffinity				(0)
+	, m_initialNumWarmups			(0)
+	, m_initialNumUnstableWarmups	(0)
+{
+	if (m_pinnedCore >= 0 && m_pinnedCore < 64 && deGetCurrentThreadAffinity(&m_prevAffinity))
+		m_isPinned = deSetCurrentThreadAffinity((deUint64)1u << m_pinnedCore) == DE_TRUE;
+
+	m_timer				= measureTimerProperties();
+	m_initialState		= getCPUFrequencyState(getMonitoredCore());
+
+	m_initialNumWarmups			= s_numWarmups.load();
+	m_initialNumUnstableWarmups	= s_numUnstableWarmups.load();
+}
+
+MeasurementEnvironment::~MeasurementEnvironment (void)
+{
+	if (m_isPinned)
+		deSetCurrentThreadAffinity(m_prevAffinity);
+}
+
+bool MeasurementEnvironment::isNoisy (void) const
+{
+	const CPUFrequencyState	state	= getCPUFrequencyState(getMonitoredCore());
+
+	if (!state.governor.empty() && state.governor != "performance")
+		return true;
+
+	if (state.throttleCount > m_initialState.throttleCount && m_initialState.throttleCount >= 0)
+		return true;
+
+	return s_numUnstableWarmups.load() != m_initialNumUnstableWarmups;
+}
+
+void MeasurementEnvironment::logReport (TestLog& log) const
+{
+	const CPUFrequencyState	state		= getCPUFrequencyState(getMonitoredCore());
+	const int				coreNdx		= getMonitoredCore();
+
+	log << TestLog::Section("MeasurementEnvironment", "Measurement environment");
+
+	if (m_isPinned)
+		log << TestLog::Message << "Measuring thread pinned to CPU " << m_pinnedCore << TestLog::EndMessage;
+	else if (m_pinnedCore >= 0)
+		log << TestLog::Message << "Failed to pin measuring thread to CPU " << m_pinnedCore << TestLog::EndMessage;
+	else
+		log << TestLog::Message << "Measuring thread not pinned" << TestLog::EndMessage;
+
+	log << TestLog::Message << "Timer resolution " << m_timer.resolutionUs << " us, overhead " << m_timer.overheadNs << " ns per call" << TestLog::EndMessage
+		<< TestLog::Float("TimerResolution", "Timer resolution", "us", QP_KEY_TAG_TIME, m_timer.resolutionUs)
+		<< TestLog::Float("TimerOverhead", "Timer call overhead", "ns", QP_KEY_TAG_TIME, m_timer.overheadNs);
+
+	if (!state.governor.empty())
+		log << TestLog::Message << "CPU " << coreNdx << " frequency governor: " << state.governor << TestLog::EndMessage;
+
+	if (state.curFreqKHz >= 0 && state.maxFreqKHz > 0)
+		log << TestLog::Message << "CPU " << coreNdx << " frequency: " << state.curFreqKHz << " kHz (" << deRoundFloatToInt32(100.0f * (float)state.curFreqKHz / (float)state.maxFreqKHz) << "% of " << state.maxFreqKHz << " kHz maximum)" << TestLog::EndMessage;
+
+	if (state.throttleCount >= 0 && m_initialState.throttleCount >= 0)
+		log << TestLog::Message << "Thermal throttle events during measurement: " << (state.throttleCount - m_initialState.throttleCount) << TestLog::EndMessage;
+
+	if (state.governor.empty() && state.curFreqKHz < 0 && state.throttleCount < 0)
+		log << TestLog::Message << "CPU frequency state not available" << TestLog::EndMessage;
+
+	log << TestLog::Message << "CPU warmups: " << (s_numWarmups.load() - m_initialNumWarmups)
+							<< ", did not stabilize: " << (s_numUnstableWarmups.load() - m_initialNumUnstableWarmups) << TestLog::EndMessage;
+
+	if (isNoisy())
+		log << TestLog::Message << "Note: Frequency scaling, throttling or unstable warmup detected, results may not be reproducible" << TestLog::EndMessage;
+	else
+		log << TestLog::Message << "No measurement noise sources detected" << TestLog::EndMessage;
+
+	log << TestLog::EndSection;
 }
 
 } // tcu
@@ -23,11 +23,91 @@
  * \brief CPU warm-up utility, used to counteract CPU throttling.
  *//*--------------------------------------------------------------------*/
 
+#include "tcuDefs.hpp"
+
+#include <string>
+
 namespace tcu
 {
 
+class TestLog;
+
+struct CPUWarmupResult
+{
+	int			numMeasurements;	//!< Timed computations run after calibration.
+	float		relativeMAD;		//!< Relative median absolute deviation of the last timings.
+	bool		isStable;			//!< Did relativeMAD settle below threshold before giving up?
+
+	CPUWarmupResult (void) : numMeasurements(0), relativeMAD(0.0f), isStable(false) {}
+};
+
 //! Does some unused calculations to try and get the CPU working at full speed.
-void warmupCPU (void);
+CPUWarmupResult warmupCPU (void);
+
+struct TimerProperties
+{
+	float		resolutionUs;		//!< Smallest non-zero step observed in deGetMicroseconds().
+	float		overheadNs;			//!< Average cost of one deGetMicroseconds() call.
+
+	TimerProperties (void) : resolutionUs(0.0f), overheadNs(0.0f) {}
+};
+
+TimerProperties measureTimerProperties (void);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief CPU frequency scaling state of a core
+ *
+ * Read from cpufreq and thermal_throttle sysfs nodes on Linux. Unknown
+ * values are left empty or negative.
+ *//*--------------------------------------------------------------------*/
+struct CPUFrequencyState
+{
+	std::string	governor;
+	int			curFreqKHz;
+	int			maxFreqKHz;
+	deInt64		throttleCount;		//!< Core and package throttle events since boot.
+
+	CPUFrequencyState (void) : curFreqKHz(-1), maxFreqKHz(-1), throttleCount(-1) {}
+};
+
+CPUFrequencyState getCPUFrequencyState (int coreNdx);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Controlled environment for a performance measurement
+ *
+ * Optionally pins the calling thread to a single core for the lifetime of
+ * the object, records timer properties and CPU frequency state, and counts
+ * warmupCPU() calls made in between. logReport() writes what was observed
+ * so that noisy results can be told apart from real regressions.
+ *//*--------------------------------------------------------------------*/
+class MeasurementEnvironment
+{
+public:
+	explicit				MeasurementEnvironment		(int pinnedCore = -1);
+							~MeasurementEnvironment		(void);
+
+	bool					isPinned					(void) const { return m_isPinned;	}
+	const TimerProperties&	getTimerProperties			(void) const { return m_timer;		}
+
+	//! True if frequency scaling or throttling may have affected results so far.
+	bool					isNoisy						(void) const;
+
+	void					logReport					(TestLog& log) const;
+
+private:
+							MeasurementEnvironment		(const MeasurementEnvironment&);
+	MeasurementEnvironment&	operator=					(const MeasurementEnvironment&);
+
+	int						getMonitoredCore			(void) const { return m_pinnedCore >= 0 ? m_pinnedCore : 0; }
+
+	const int				m_pinnedCore;
+	bool					m_isPinned;
+	deUint64				m_prevAffinity;
+	TimerProperties			m_timer;
+	CPUFrequencyState		m_initialState;
+	int						m_initialNumWarmups;
+	int						m_initialNumUnstableWarmups;
+};
 
 namespace warmupCPUInternal
 {
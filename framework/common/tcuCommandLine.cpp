@@ -85,10 +85,12 @@ DE_DECLARE_COMMAND_LINE_OPT(EGLWindowType,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(EGLPixmapType,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(LogImages,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(LogShaderSources,			bool);
+DE_DECLARE_COMMAND_LINE_OPT(LogImageStore,				std::string);
 DE_DECLARE_COMMAND_LINE_OPT(LogDecompiledSpirv,			bool);
 DE_DECLARE_COMMAND_LINE_OPT(LogEmptyLoginfo,			bool);
 DE_DECLARE_COMMAND_LINE_OPT(TestOOM,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(ArchiveDir,					std::string);
+DE_DECLARE_COMMAND_LINE_OPT(ArchivePack,					std::string);
 DE_DECLARE_COMMAND_LINE_OPT(VKDeviceID,					int);
 DE_DECLARE_COMMAND_LINE_OPT(VKDeviceGroupID,			int);
 DE_DECLARE_COMMAND_LINE_OPT(LogFlush,					bool);
@@ -100,7 +102,17 @@ DE_DECLARE_COMMAND_LINE_OPT(Optimization,				int);
 DE_DECLARE_COMMAND_LINE_OPT(OptimizeSpirv,				bool);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheTruncate,		bool);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheIPC,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(SpirvAsmCache,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(SpirvAsmCacheFilename,		std::string);
 DE_DECLARE_COMMAND_LINE_OPT(RenderDoc,					bool);
+DE_DECLARE_COMMAND_LINE_OPT(VKApiProfile,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(VKApiProfileTopN,			int);
+DE_DECLARE_COMMAND_LINE_OPT(PerfCPUAffinity,			int);
+DE_DECLARE_COMMAND_LINE_OPT(PerfGPUTimer,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(HarnessProfile,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(HarnessProfileOutput,		std::string);
+DE_DECLARE_COMMAND_LINE_OPT(HarnessProfileBaseline,		std::string);
+DE_DECLARE_COMMAND_LINE_OPT(HarnessProfileThreshold,	int);
 DE_DECLARE_COMMAND_LINE_OPT(CaseFraction,				std::vector<int>);
 DE_DECLARE_COMMAND_LINE_OPT(CaseFractionMandatoryTests,	std::string);
 DE_DECLARE_COMMAND_LINE_OPT(WaiverFile,					std::string);
@@ -216,10 +228,12 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<VKDeviceGroupID>				(DE_NULL,	"deqp-vk-device-group-id",					"Vulkan device Group ID (IDs start from 1)",							"1")
 		<< Option<LogImages>					(DE_NULL,	"deqp-log-images",							"Enable or disable logging of result images",		s_enableNames,		"enable")
 		<< Option<LogShaderSources>				(DE_NULL,	"deqp-log-shader-sources",					"Enable or disable logging of shader sources",		s_enableNames,		"enable")
+		<< Option<LogImageStore>				(DE_NULL,	"deqp-log-image-store",						"Write PNG images into given directory keyed by content hash, log only the hash",	"")
 		<< Option<LogDecompiledSpirv>			(DE_NULL,	"deqp-log-decompiled-spirv",				"Enable or disable logging of decompiled spir-v",	s_enableNames,		"enable")
 		<< Option<LogEmptyLoginfo>				(DE_NULL,	"deqp-log-empty-loginfo",					"Logging of empty shader compile/link log info",	s_enableNames,		"enable")
 		<< Option<TestOOM>						(DE_NULL,	"deqp-test-oom",							"Run tests that exhaust memory on purpose",			s_enableNames,		TEST_OOM_DEFAULT)
 		<< Option<ArchiveDir>					(DE_NULL,	"deqp-archive-dir",							"Path to test resource files",											".")
+		<< Option<ArchivePack>					(DE_NULL,	"deqp-archive-pack",						"Resource pack file, missing resources are read from archive dir",	"")
 		<< Option<LogFlush>						(DE_NULL,	"deqp-log-flush",							"Enable or disable log file fflush",				s_enableNames,		"enable")
 		<< Option<Validation>					(DE_NULL,	"deqp-validation",							"Enable or disable test case validation",			s_enableNames,		"disable")
 		<< Option<PrintValidationErrors>		(DE_NULL,	"deqp-print-validation-errors",				"Print validation errors to standard error")
@@ -229,7 +243,17 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<ShaderCacheFilename>			(DE_NULL,	"deqp-shadercache-filename",				"Write shader cache to given file",										"shadercache.bin")
 		<< Option<ShaderCacheTruncate>			(DE_NULL,	"deqp-shadercache-truncate",				"Truncate shader cache before running tests",		s_enableNames,		"enable")
 		<< Option<ShaderCacheIPC>				(DE_NULL,	"deqp-shadercache-ipc",						"Should shader cache use inter process comms",		s_enableNames,		"disable")
+		<< Option<SpirvAsmCache>				(DE_NULL,	"deqp-spirv-asm-cache",						"Enable or disable SPIR-V assembly result cache",	s_enableNames,		"enable")
+		<< Option<SpirvAsmCacheFilename>		(DE_NULL,	"deqp-spirv-asm-cache-filename",			"Store SPIR-V assembly results to given file (empty = memory only)",	"")
 		<< Option<RenderDoc>					(DE_NULL,	"deqp-renderdoc",							"Enable RenderDoc frame markers",					s_enableNames,		"disable")
+		<< Option<VKApiProfile>					(DE_NULL,	"deqp-vk-api-profile",						"Log per-case Vulkan API call counts and times",	s_enableNames,		"disable")
+		<< Option<VKApiProfileTopN>				(DE_NULL,	"deqp-vk-api-profile-top-n",				"Number of entry points logged by --deqp-vk-api-profile",				"10")
+		<< Option<PerfCPUAffinity>				(DE_NULL,	"deqp-perf-cpu-affinity",					"Pin performance measurements to given CPU core (-1 = no pinning)",	"-1")
+		<< Option<PerfGPUTimer>					(DE_NULL,	"deqp-perf-gpu-timer",						"Time GL performance cases with GPU timer queries",	s_enableNames,		"disable")
+		<< Option<HarnessProfile>				(DE_NULL,	"deqp-harness-profile",						"Profile harness CPU time and allocations per phase, failures do not fail the run. Each log write adds the cost of reading the clocks twice to the Logging phase",	s_enableNames,	"disable")
+		<< Option<HarnessProfileOutput>			(DE_NULL,	"deqp-harness-profile-output",				"Write harness profile totals to given file",							"")
+		<< Option<HarnessProfileBaseline>		(DE_NULL,	"deqp-harness-profile-baseline",			"Compare harness profile to totals in given file",						"")
+		<< Option<HarnessProfileThreshold>		(DE_NULL,	"deqp-harness-profile-threshold",			"Per case growth over baseline reported as regression, in percent",	"10")
 		<< Option<CaseFraction>					(DE_NULL,	"deqp-fraction",							"Run a fraction of the test cases (e.g. N,M means run group%M==N)",	parseIntList,	"")
 		<< Option<CaseFractionMandatoryTests>	(DE_NULL,	"deqp-fraction-mandatory-caselist-file",	"Case list file that must be run for each fraction",					"")
 		<< Option<WaiverFile>					(DE_NULL,	"deqp-waiver-file",							"Read waived tests from given file",									"")
@@ -945,6 +969,7 @@ bool CommandLine::parse (const std::string& cmdLine)
 
 const char*				CommandLine::getLogFileName					(void) const	{ return m_cmdLine.getOption<opt::LogFilename>().c_str();					}
 deUint32				CommandLine::getLogFlags					(void) const	{ return m_logFlags;														}
+const char*				CommandLine::getLogImageStoreDir			(void) const	{ return m_cmdLine.getOption<opt::LogImageStore>().c_str();					}
 RunMode					CommandLine::getRunMode						(void) const	{ return m_cmdLine.getOption<opt::RunMode>();								}
 const char*				CommandLine::getCaseListExportFile			(void) const	{ return m_cmdLine.getOption<opt::ExportFilenamePattern>().c_str();			}
 WindowVisibility		CommandLine::getVisibility					(void) const	{ return m_cmdLine.getOption<opt::Visibility>();							}
@@ -969,13 +994,24 @@ bool					CommandLine::isShadercacheEnabled			(void) const	{ return m_cmdLine.get
 const char*				CommandLine::getShaderCacheFilename			(void) const	{ return m_cmdLine.getOption<opt::ShaderCacheFilename>().c_str();			}
 bool					CommandLine::isShaderCacheTruncateEnabled	(void) const	{ return m_cmdLine.getOption<opt::ShaderCacheTruncate>();					}
 bool					CommandLine::isShaderCacheIPCEnabled		(void) const	{ return m_cmdLine.getOption<opt::ShaderCacheIPC>();						}
+bool					CommandLine::isSpirvAsmCacheEnabled			(void) const	{ return m_cmdLine.getOption<opt::SpirvAsmCache>();							}
+const char*				CommandLine::getSpirvAsmCacheFilename		(void) const	{ return m_cmdLine.getOption<opt::SpirvAsmCacheFilename>().c_str();		}
 int						CommandLine::getOptimizationRecipe			(void) const	{ return m_cmdLine.getOption<opt::Optimization>();							}
 bool					CommandLine::isSpirvOptimizationEnabled		(void) const	{ return m_cmdLine.getOption<opt::OptimizeSpirv>();							}
 bool					CommandLine::isRenderDocEnabled				(void) const	{ return m_cmdLine.getOption<opt::RenderDoc>();								}
+bool					CommandLine::isVKApiProfileEnabled			(void) const	{ return m_cmdLine.getOption<opt::VKApiProfile>();							}
+int						CommandLine::getVKApiProfileTopN			(void) const	{ return m_cmdLine.getOption<opt::VKApiProfileTopN>();						}
+int						CommandLine::getPerfCPUAffinity				(void) const	{ return m_cmdLine.getOption<opt::PerfCPUAffinity>();						}
+bool					CommandLine::isPerfGPUTimerEnabled			(void) const	{ return m_cmdLine.getOption<opt::PerfGPUTimer>();							}
+bool					CommandLine::isHarnessProfileEnabled		(void) const	{ return m_cmdLine.getOption<opt::HarnessProfile>();						}
+const char*				CommandLine::getHarnessProfileOutput		(void) const	{ return m_cmdLine.getOption<opt::HarnessProfileOutput>().c_str();			}
+const char*				CommandLine::getHarnessProfileBaseline		(void) const	{ return m_cmdLine.getOption<opt::HarnessProfileBaseline>().c_str();		}
+int						CommandLine::getHarnessProfileThreshold		(void) const	{ return m_cmdLine.getOption<opt::HarnessProfileThreshold>();				}
 const char*				CommandLine::getWaiverFileName				(void) const	{ return m_cmdLine.getOption<opt::WaiverFile>().c_str();					}
 const std::vector<int>&	CommandLine::getCaseFraction				(void) const	{ return m_cmdLine.getOption<opt::CaseFraction>();							}
 const char*				CommandLine::getCaseFractionMandatoryTests	(void) const	{ return m_cmdLine.getOption<opt::CaseFractionMandatoryTests>().c_str();	}
 const char*				CommandLine::getArchiveDir					(void) const	{ return m_cmdLine.getOption<opt::ArchiveDir>().c_str();					}
+const char*				CommandLine::getArchivePack					(void) const	{ return m_cmdLine.getOption<opt::ArchivePack>().empty() ? DE_NULL : m_cmdLine.getOption<opt::ArchivePack>().c_str();	}
 tcu::TestRunnerType		CommandLine::getRunnerType					(void) const	{ return m_cmdLine.getOption<opt::RunnerType>();							}
 bool					CommandLine::isTerminateOnFailEnabled		(void) const	{ return m_cmdLine.getOption<opt::TerminateOnFail>();						}
 bool					CommandLine::isSubProcess					(void) const	{ return m_cmdLine.getOption<opt::SubProcess>();							}
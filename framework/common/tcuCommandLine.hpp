@@ -156,6 +156,9 @@ public:
 	//! Get logging flags
 	deUint32						getLogFlags						(void) const;
 
+	//! Get content-addressed image store directory (--deqp-log-image-store)
+	const char*						getLogImageStoreDir				(void) const;
+
 	//! Get run mode (--deqp-runmode)
 	RunMode							getRunMode						(void) const;
 
@@ -250,6 +253,12 @@ public:
 	//! Should the shader cache use inter process communication (IPC) (--deqp-shadercache-ipc)
 	bool							isShaderCacheIPCEnabled	(void) const;
 
+	//! Should SPIR-V assembly results be cached (--deqp-spirv-asm-cache)
+	bool							isSpirvAsmCacheEnabled		(void) const;
+
+	//! Get the filename for SPIR-V assembly cache, empty if cache is in memory only (--deqp-spirv-asm-cache-filename)
+	const char*						getSpirvAsmCacheFilename	(void) const;
+
 	//! Get shader optimization recipe (--deqp-optimization-recipe)
 	int								getOptimizationRecipe		(void) const;
 
@@ -259,6 +268,30 @@ public:
 	//! Enable RenderDoc frame markers (--deqp-renderdoc)
 	bool							isRenderDocEnabled			(void) const;
 
+	//! Log per-case Vulkan API call profile (--deqp-vk-api-profile)
+	bool							isVKApiProfileEnabled		(void) const;
+
+	//! Get number of entry points in the Vulkan API call profile (--deqp-vk-api-profile-top-n)
+	int								getVKApiProfileTopN			(void) const;
+
+	//! Get CPU core performance measurements are pinned to, -1 if none (--deqp-perf-cpu-affinity)
+	int								getPerfCPUAffinity			(void) const;
+
+	//! Should GL performance cases be timed with GPU timer queries when available (--deqp-perf-gpu-timer)
+	bool							isPerfGPUTimerEnabled		(void) const;
+
+	//! Profile harness CPU time and allocations per phase (--deqp-harness-profile)
+	bool							isHarnessProfileEnabled		(void) const;
+
+	//! Get harness profile output file, empty if none (--deqp-harness-profile-output)
+	const char*						getHarnessProfileOutput		(void) const;
+
+	//! Get harness profile baseline file, empty if none (--deqp-harness-profile-baseline)
+	const char*						getHarnessProfileBaseline	(void) const;
+
+	//! Get harness profile regression threshold in percent (--deqp-harness-profile-threshold)
+	int								getHarnessProfileThreshold	(void) const;
+
 	//! Get waiver file name (--deqp-waiver-file)
 	const char*						getWaiverFileName			(void) const;
 
@@ -271,6 +304,9 @@ public:
 	//! Get archive directory path
 	const char*						getArchiveDir				(void) const;
 
+	//! Get resource pack path, null if not set (--deqp-archive-pack)
+	const char*						getArchivePack				(void) const;
+
 	//! Get runner type (--deqp-runner-type)
 	tcu::TestRunnerType				getRunnerType				(void) const;
 
@@ -0,0 +1,362 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Per-phase CPU time and allocation profile of the test harness.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuHarnessProfile.hpp"
+
+#include "deClock.h"
+
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace tcu
+{
+
+namespace
+{
+
+struct ProfileState
+{
+	std::atomic<bool>	isActive;			//!< Written with release, read with acquire, so that other fields are visible when set.
+	std::thread::id		threadId;
+	HarnessPhase		curPhase;
+	deUint64			lastCpuTimeUs;
+	deUint64			lastWallTimeUs;
+	deUint64			lastNumAllocations;
+	HarnessProfile		profile;
+
+	ProfileState (void)
+		: isActive				(false)
+		, curPhase				(HARNESS_PHASE_OTHER)
+		, lastCpuTimeUs			(0)
+		, lastWallTimeUs		(0)
+		, lastNumAllocations	(0)
+	{
+	}
+};
+
+ProfileState				s_state;
+HarnessAllocationCountFunc	s_allocationCountFunc	= DE_NULL;
+
+inline bool isProfiledThread (void)
+{
+	return s_state.isActive.load(std::memory_order_acquire) && std::this_thread::get_id() == s_state.threadId;
+}
+
+deUint64 getNumAllocations (void)
+{
+	return s_allocationCountFunc ? s_allocationCountFunc() : 0u;
+}
+
+//! Add time and allocations since the last call to the current phase.
+void accumulate (void)
+{
+	const deUint64		cpuTimeUs		= deGetThreadCpuMicroseconds();
+	const deUint64		wallTimeUs		= deGetMicroseconds();
+	const deUint64		numAllocations	= getNumAllocations();
+	HarnessPhaseStats&	stats			= s_state.profile.phases[s_state.curPhase];
+
+	stats.cpuTimeUs				+= cpuTimeUs - s_state.lastCpuTimeUs;
+	stats.wallTimeUs			+= wallTimeUs - s_state.lastWallTimeUs;
+	stats.numAllocations		+= numAllocations - s_state.lastNumAllocations;
+
+	s_state.lastCpuTimeUs		= cpuTimeUs;
+	s_state.lastWallTimeUs		= wallTimeUs;
+	s_state.lastNumAllocations	= numAllocations;
+}
+
+double perCase (deUint64 value, int numCases)
+{
+	return (double)value / (double)de::max(numCases, 1);
+}
+
+std::string formatChange (double value, double baseline)
+{
+	if (baseline <= 0.0)
+		return "n/a";
+
+	std::ostringstream str;
+	str.setf(std::ios::fixed);
+	str.precision(1);
+	str << (value >= baseline ? "+" : "") << 100.0 * (value / baseline - 1.0) << "%";
+	return str.str();
+}
+
+bool isRegression (double value, double baseline, double threshold, double noiseFloor)
+{
+	return value - baseline > de::max(baseline * threshold, noiseFloor);
+}
+
+const char* const s_fileHeader = "#HarnessProfile 1";
+
+} // anonymous
+
+const char* getHarnessPhaseName (HarnessPhase phase)
+{
+	switch (phase)
+	{
+		case HARNESS_PHASE_HIERARCHY:		return "Hierarchy";
+		case HARNESS_PHASE_CONTEXT_SETUP:	return "ContextSetup";
+		case HARNESS_PHASE_PROGRAMS:		return "Programs";
+		case HARNESS_PHASE_LOGGING:			return "Logging";
+		case HARNESS_PHASE_IMAGE_COMPARE:	return "ImageCompare";
+		case HARNESS_PHASE_CASE:			return "Case";
+		case HARNESS_PHASE_OTHER:			return "Other";
+		default:
+			DE_ASSERT(false);
+			return DE_NULL;
+	}
+}
+
+HarnessPhaseStats HarnessProfile::getTotal (void) const
+{
+	HarnessPhaseStats total;
+
+	for (int phaseNdx = 0; phaseNdx < HARNESS_PHASE_LAST; ++phaseNdx)
+	{
+		total.cpuTimeUs			+= phases[phaseNdx].cpuTimeUs;
+		total.wallTimeUs		+= phases[phaseNdx].wallTimeUs;
+		total.numAllocations	+= phases[phaseNdx].numAllocations;
+		total.numEntries		+= phases[phaseNdx].numEntries;
+	}
+
+	return total;
+}
+
+void setHarnessAllocationCounter (HarnessAllocationCountFunc func)
+{
+	s_allocationCountFunc = func;
+}
+
+void beginHarnessProfile (void)
+{
+	DE_ASSERT(!s_state.isActive.load(std::memory_order_acquire));
+
+	s_state.profile						= HarnessProfile();
+	s_state.profile.hasAllocationCounts	= s_allocationCountFunc != DE_NULL;
+	s_state.threadId					= std::this_thread::get_id();
+	s_state.curPhase					= HARNESS_PHASE_OTHER;
+	s_state.lastCpuTimeUs				= deGetThreadCpuMicroseconds();
+	s_state.lastWallTimeUs				= deGetMicroseconds();
+	s_state.lastNumAllocations			= getNumAllocations();
+	s_state.isActive.store(true, std::memory_order_release);
+}
+
+void endHarnessProfile (void)
+{
+	if (!isProfiledThread())
+		return;
+
+	accumulate();
+	s_state.isActive.store(false, std::memory_order_release);
+}
+
+bool isHarnessProfileActive (void)
+{
+	return s_state.isActive.load(std::memory_order_acquire);
+}
+
+void countHarnessProfileCase (void)
+{
+	if (isProfiledThread())
+		s_state.profile.numCases += 1;
+}
+
+HarnessProfile getHarnessProfile (void)
+{
+	if (isProfiledThread())
+		accumulate();
+
+	return s_state.profile;
+}
+
+HarnessPhaseScope::HarnessPhaseScope (HarnessPhase phase)
+	: m_prevPhase(HARNESS_PHASE_LAST)
+{
+	if (isProfiledThread() && s_state.curPhase != phase)
+	{
+		accumulate();
+
+		m_prevPhase									 = s_state.curPhase;
+		s_state.curPhase							 = phase;
+		s_state.profile.phases[phase].numEntries	+= 1;
+	}
+}
+
+HarnessPhaseScope::~HarnessPhaseScope (void)
+{
+	if (m_prevPhase != HARNESS_PHASE_LAST && isProfiledThread())
+	{
+		accumulate();
+		s_state.curPhase = m_prevPhase;
+	}
+}
+
+void writeHarnessProfile (const char* fileName, const HarnessProfile& profile)
+{
+	std::ofstream out (fileName, std::ios_base::out | std::ios_base::trunc);
+
+	if (!out.is_open())
+		throw ResourceError(std::string("Failed to open harness profile output file ") + fileName);
+
+	out << s_fileHeader << "\n"
+		<< "Cases " << profile.numCases << "\n"
+		<< "AllocationCounts " << (profile.hasAllocationCounts ? 1 : 0) << "\n";
+
+	for (int phaseNdx = 0; phaseNdx < HARNESS_PHASE_LAST; ++phaseNdx)
+	{
+		const HarnessPhaseStats& stats = profile.phases[phaseNdx];
+
+		out << getHarnessPhaseName((HarnessPhase)phaseNdx)
+			<< " " << stats.cpuTimeUs
+			<< " " << stats.wallTimeUs
+			<< " " << stats.numAllocations
+			<< " " << stats.numEntries << "\n";
+	}
+
+	if (!out.good())
+		throw ResourceError(std::string("Failed to write harness profile ") + fileName);
+}
+
+HarnessProfile readHarnessProfile (const char* fileName)
+{
+	std::ifstream	in		(fileName);
+	HarnessProfile	profile;
+	std::string		line;
+
+	if (!in.is_open())
+		throw ResourceError(std::string("Failed to open harness profile baseline ") + fileName);
+
+	if (!std::getline(in, line) || line != s_fileHeader)
+		throw ResourceError(std::string("Not a harness profile: ") + fileName);
+
+	while (std::getline(in, line))
+	{
+		std::istringstream	str		(line);
+		std::string			key;
+
+		if (!(str >> key))
+			continue;
+
+		if (key == "Cases")
+			str >> profile.numCases;
+		else if (key == "AllocationCounts")
+		{
+			int hasAllocationCounts = 0;
+			str >> hasAllocationCounts;
+			profile.hasAllocationCounts = hasAllocationCounts != 0;
+		}
+		else
+		{
+			HarnessPhaseStats stats;
+
+			str >> stats.cpuTimeUs >> stats.wallTimeUs >> stats.numAllocations >> stats.numEntries;
+
+			for (int phaseNdx = 0; phaseNdx < HARNESS_PHASE_LAST; ++phaseNdx)
+			{
+				if (key == getHarnessPhaseName((HarnessPhase)phaseNdx))
+				{
+					profile.phases[phaseNdx] = stats;
+					break;
+				}
+			}
+		}
+
+		if (str.fail())
+			throw ResourceError(std::string("Malformed line '") + line + "' in harness profile " + fileName);
+	}
+
+	return profile;
+}
+
+bool printHarnessProfileSummary (const HarnessProfile& profile, const HarnessProfile* baseline, int thresholdPercent)
+{
+	const bool					compareAllocations	= profile.hasAllocationCounts && baseline && baseline->hasAllocationCounts;
+	const double				threshold			= (double)de::max(thresholdPercent, 0) / 100.0;
+	const HarnessPhaseStats		total				= profile.getTotal();
+	const HarnessPhaseStats		baselineTotal		= baseline ? baseline->getTotal() : HarnessPhaseStats();
+	// Ignore changes below 1% of the baseline total; small phases are mostly timer noise
+	const double				timeNoiseFloor		= baseline ? 0.01 * perCase(baselineTotal.cpuTimeUs, baseline->numCases) : 0.0;
+	const double				allocNoiseFloor		= baseline ? de::max(1.0, 0.01 * perCase(baselineTotal.numAllocations, baseline->numCases)) : 0.0;
+	bool						isRegressed			= false;
+
+	print("\nHarness profile, %d cases:\n", profile.numCases);
+	print("  %-14s %10s %10s %12s %12s", "Phase", "CPU ms", "Wall ms", "CPU us/case", "Allocs/case");
+	if (baseline)
+		print(" %13s %8s", "Base us/case", "Change");
+	print("\n");
+
+	for (int phaseNdx = 0; phaseNdx <= HARNESS_PHASE_LAST; ++phaseNdx)
+	{
+		const bool					isTotal			= phaseNdx == HARNESS_PHASE_LAST;
+		const HarnessPhaseStats&	stats			= isTotal ? total : profile.phases[phaseNdx];
+		const double				cpuPerCase		= perCase(stats.cpuTimeUs, profile.numCases);
+		const double				allocPerCase	= perCase(stats.numAllocations, profile.numCases);
+
+		print("  %-14s %10.1f %10.1f %12.1f ",
+			  isTotal ? "Total" : getHarnessPhaseName((HarnessPhase)phaseNdx),
+			  (double)stats.cpuTimeUs / 1000.0,
+			  (double)stats.wallTimeUs / 1000.0,
+			  cpuPerCase);
+
+		if (profile.hasAllocationCounts)
+			print("%12.1f", allocPerCase);
+		else
+			print("%12s", "n/a");
+
+		if (baseline)
+		{
+			const HarnessPhaseStats&	baseStats			= isTotal ? baselineTotal : baseline->phases[phaseNdx];
+			const double				baseCpuPerCase		= perCase(baseStats.cpuTimeUs, baseline->numCases);
+			const double				baseAllocPerCase	= perCase(baseStats.numAllocations, baseline->numCases);
+			const bool					timeRegressed		= isRegression(cpuPerCase, baseCpuPerCase, threshold, timeNoiseFloor);
+			const bool					allocRegressed		= compareAllocations && isRegression(allocPerCase, baseAllocPerCase, threshold, allocNoiseFloor);
+
+			print(" %13.1f %8s", baseCpuPerCase, formatChange(cpuPerCase, baseCpuPerCase).c_str());
+
+			if (timeRegressed)
+				print("  TIME REGRESSION");
+
+			if (allocRegressed)
+				print("  ALLOCATION REGRESSION (%.1f/case in baseline)", baseAllocPerCase);
+
+			isRegressed = isRegressed || timeRegressed || allocRegressed;
+		}
+
+		print("\n");
+	}
+
+	if (baseline)
+	{
+		if (baseline->numCases != profile.numCases)
+			print("  Note: baseline has %d cases, comparison is per case average only\n", baseline->numCases);
+
+		print("  Compared to baseline with %d%% threshold: %s\n", thresholdPercent, isRegressed ? "REGRESSED" : "ok");
+	}
+
+	return isRegressed;
+}
+
+} // tcu
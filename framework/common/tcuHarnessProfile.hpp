@@ -0,0 +1,131 @@
+#ifndef _TCUHARNESSPROFILE_HPP
+#define _TCUHARNESSPROFILE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Per-phase CPU time and allocation profile of the test harness.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+
+namespace tcu
+{
+
+enum HarnessPhase
+{
+	HARNESS_PHASE_HIERARCHY = 0,	//!< Test hierarchy traversal, group init and deinit.
+	HARNESS_PHASE_CONTEXT_SETUP,	//!< Package executor setup and teardown, per case support checks.
+	HARNESS_PHASE_PROGRAMS,			//!< Program source generation, builds and binary lookups.
+	HARNESS_PHASE_LOGGING,			//!< Test log writes.
+	HARNESS_PHASE_IMAGE_COMPARE,	//!< Image comparison.
+	HARNESS_PHASE_CASE,				//!< Remaining case init, iterate and deinit time: case code and driver.
+	HARNESS_PHASE_OTHER,			//!< Session time outside all other phases.
+
+	HARNESS_PHASE_LAST
+};
+
+const char*		getHarnessPhaseName		(HarnessPhase phase);
+
+struct HarnessPhaseStats
+{
+	deUint64	cpuTimeUs;			//!< CPU time of the profiled thread.
+	deUint64	wallTimeUs;
+	deUint64	numAllocations;
+	deUint64	numEntries;			//!< Number of times the phase was entered from another phase.
+
+	HarnessPhaseStats (void) : cpuTimeUs(0), wallTimeUs(0), numAllocations(0), numEntries(0) {}
+};
+
+struct HarnessProfile
+{
+	HarnessPhaseStats	phases[HARNESS_PHASE_LAST];
+	int					numCases;
+	bool				hasAllocationCounts;
+
+						HarnessProfile	(void) : numCases(0), hasAllocationCounts(false) {}
+
+	HarnessPhaseStats	getTotal		(void) const;
+};
+
+typedef deUint64 (*HarnessAllocationCountFunc) (void);
+
+//! Register a process wide allocation counter. Platforms that replace global operator new use this to provide allocation counts.
+void			setHarnessAllocationCounter	(HarnessAllocationCountFunc func);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Start profiling on the calling thread
+ *
+ * Until endHarnessProfile(), time and allocations on the calling thread
+ * are attributed to the innermost active HarnessPhaseScope, or to
+ * HARNESS_PHASE_OTHER outside all scopes. Scopes on other threads are
+ * ignored, but allocations made by other threads are counted to the
+ * current phase of the profiled thread.
+ *//*--------------------------------------------------------------------*/
+void			beginHarnessProfile			(void);
+void			endHarnessProfile			(void);
+bool			isHarnessProfileActive		(void);
+void			countHarnessProfileCase		(void);
+HarnessProfile	getHarnessProfile			(void);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Attribute time until end of scope to given phase
+ *
+ * Entering and leaving a scope that switches phase both read the thread
+ * CPU clock, which is a system call on most platforms, and the wall clock.
+ * This overhead is not calibrated out and is charged mostly to the phase
+ * of the scope. Phases entered very often, such as HARNESS_PHASE_LOGGING
+ * on every log write, are inflated by about numEntries times the cost of
+ * two such reads, which is around 0.6 us on x86-64 Linux. Scopes that do
+ * not switch phase do not read the clocks.
+ *//*--------------------------------------------------------------------*/
+class HarnessPhaseScope
+{
+public:
+	explicit			HarnessPhaseScope	(HarnessPhase phase);
+						~HarnessPhaseScope	(void);
+
+private:
+						HarnessPhaseScope	(const HarnessPhaseScope&);
+	HarnessPhaseScope&	operator=			(const HarnessPhaseScope&);
+
+	HarnessPhase		m_prevPhase;		//!< HARNESS_PHASE_LAST if the scope did not switch phase.
+};
+
+//! Write profile totals as text. Throws ResourceError on failure.
+void			writeHarnessProfile			(const char* fileName, const HarnessProfile& profile);
+
+//! Read profile written by writeHarnessProfile(). Unknown phases are ignored. Throws ResourceError on failure.
+HarnessProfile	readHarnessProfile			(const char* fileName);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Print profile summary and compare to baseline
+ *
+ * Phases are compared by CPU time and allocation count per case, so that
+ * runs of different case lists can still be compared roughly. A phase
+ * regresses if its per case value grows more than thresholdPercent and
+ * the growth is not negligible compared to the baseline total.
+ *
+ * \return True if any phase or the total regressed.
+ *//*--------------------------------------------------------------------*/
+bool			printHarnessProfileSummary	(const HarnessProfile& profile, const HarnessProfile* baseline, int thresholdPercent);
+
+} // tcu
+
+#endif // _TCUHARNESSPROFILE_HPP
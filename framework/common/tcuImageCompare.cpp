@@ -32,6 +32,7 @@
 #include "tcuTexture.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuFloat.hpp"
+#include "tcuHarnessProfile.hpp"
 
 #include <string.h>
 
@@ -216,6 +217,8 @@ static int findNumPositionDeviationFailingPixels (const PixelBufferAccess& error
  *//*--------------------------------------------------------------------*/
 bool fuzzyCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, float threshold, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	FuzzyCompareParams	params;		// Use defaults.
 	TextureLevel		errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	float				difference		= fuzzyCompare(params, reference, result, errorMask.getAccess());
@@ -334,6 +337,8 @@ static deInt64 computeSquaredDiffSum (const ConstPixelBufferAccess& ref, const C
  *//*--------------------------------------------------------------------*/
 int measurePixelDiffAccuracy (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, int bestScoreDiff, int worstScoreDiff, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	TextureLevel	diffMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	int				diffFactor		= 8;
 	deInt64			squaredSum		= computeSquaredDiffSum(reference, result, diffMask.getAccess(), diffFactor);
@@ -487,6 +492,8 @@ static tcu::UVec4 computeFlushRelaxedULPDiff (const tcu::Vec4& a, const tcu::Vec
  *//*--------------------------------------------------------------------*/
 bool floatUlpThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -573,6 +580,8 @@ bool floatUlpThresholdCompare (TestLog& log, const char* imageSetName, const cha
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const Vec4& threshold, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -663,6 +672,8 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const Vec4& ignorekey, const Vec4& threshold, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	int					width = reference.getWidth();
 	int					height = reference.getHeight();
 	int					depth = reference.getDepth();
@@ -754,6 +765,8 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const Vec4& reference, const ConstPixelBufferAccess& result, const Vec4& threshold, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	const int			width				= result.getWidth();
 	const int			height				= result.getHeight();
 	const int			depth				= result.getDepth();
@@ -837,6 +850,8 @@ bool floatThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, CompareLogMode logMode, bool use64Bits)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	int					width				= reference.getWidth();
 	int					height				= reference.getHeight();
 	int					depth				= reference.getDepth();
@@ -934,6 +949,8 @@ bool intThresholdCompare (TestLog& log, const char* imageSetName, const char* im
  *//*--------------------------------------------------------------------*/
 bool dsThresholdCompare(TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const float threshold, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	int					width = reference.getWidth();
 	int					height = reference.getHeight();
 	int					depth = reference.getDepth();
@@ -1044,6 +1061,8 @@ bool dsThresholdCompare(TestLog& log, const char* imageSetName, const char* imag
  *//*--------------------------------------------------------------------*/
 bool intThresholdPositionDeviationCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	const int			width				= reference.getWidth();
 	const int			height				= reference.getHeight();
 	const int			depth				= reference.getDepth();
@@ -1123,6 +1142,8 @@ bool intThresholdPositionDeviationCompare (TestLog& log, const char* imageSetNam
  *//*--------------------------------------------------------------------*/
 bool intThresholdPositionDeviationErrorThresholdCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const UVec4& threshold, const tcu::IVec3& maxPositionDeviation, bool acceptOutOfBoundsAsAnyValue, int maxAllowedFailingPixels, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	const int			width				= reference.getWidth();
 	const int			height				= reference.getHeight();
 	const int			depth				= reference.getDepth();
@@ -1213,6 +1234,8 @@ bool pixelThresholdCompare (TestLog& log, const char* imageSetName, const char*
  *//*--------------------------------------------------------------------*/
 bool bilinearCompare (TestLog& log, const char* imageSetName, const char* imageSetDesc, const ConstPixelBufferAccess& reference, const ConstPixelBufferAccess& result, const RGBA threshold, CompareLogMode logMode)
 {
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_IMAGE_COMPARE);
+
 	TextureLevel		errorMask		(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(), reference.getHeight());
 	bool				isOk			= bilinearCompare(reference, result, errorMask, threshold);
 	Vec4				pixelBias		(0.0f, 0.0f, 0.0f, 0.0f);
@@ -0,0 +1,550 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Single-file resource archive.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuPackArchive.hpp"
+#include "deFilePath.hpp"
+#include "deDirectoryIterator.hpp"
+#include "deMemory.h"
+#include "deUniquePtr.hpp"
+
+#include <zlib.h>
+
+#include <cstring>
+#include <fstream>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX) || (DE_OS == DE_OS_FUCHSIA)
+#	define TCU_PACK_USE_MMAP 1
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#elif (DE_OS == DE_OS_WIN32)
+#	define TCU_PACK_USE_WIN32_MAPPING 1
+#	define VC_EXTRALEAN
+#	define WIN32_LEAN_AND_MEAN
+#	include <windows.h>
+#endif
+
+namespace tcu
+{
+
+namespace
+{
+
+static const char		s_packMagic[8]		= { 'd', 'E', 'Q', 'P', 'p', 'a', 'c', 'k' };
+
+enum
+{
+	PACK_VERSION		= 1,
+	PACK_HEADER_SIZE	= 16,
+	PACK_ENTRY_SIZE		= 24,
+	PACK_DATA_ALIGNMENT	= 16,
+
+	// Entry field offsets
+	ENTRY_NAME_OFFSET	= 0,
+	ENTRY_NAME_LENGTH	= 4,
+	ENTRY_DATA_OFFSET	= 8,
+	ENTRY_STORED_SIZE	= 12,
+	ENTRY_SIZE			= 16,
+	ENTRY_COMPRESSION	= 20,
+};
+
+inline deUint32 readUint32 (const deUint8* ptr)
+{
+	return (deUint32)ptr[0] | ((deUint32)ptr[1] << 8) | ((deUint32)ptr[2] << 16) | ((deUint32)ptr[3] << 24);
+}
+
+inline void writeUint32 (std::vector<deUint8>& dst, deUint32 value)
+{
+	dst.push_back((deUint8)(value & 0xFFu));
+	dst.push_back((deUint8)((value >> 8) & 0xFFu));
+	dst.push_back((deUint8)((value >> 16) & 0xFFu));
+	dst.push_back((deUint8)((value >> 24) & 0xFFu));
+}
+
+//! Resource served from memory, either from the pack mapping or from an owned decompressed copy.
+class PackResource : public Resource
+{
+public:
+						PackResource	(const std::string& name, const deUint8* data, int size)
+							: Resource		(name)
+							, m_data		(data)
+							, m_size		(size)
+							, m_position	(0)
+						{
+						}
+
+						PackResource	(const std::string& name, std::vector<deUint8>& ownedData)
+							: Resource		(name)
+							, m_data		(DE_NULL)
+							, m_size		((int)ownedData.size())
+							, m_position	(0)
+						{
+							m_ownedData.swap(ownedData);
+							m_data = m_ownedData.empty() ? DE_NULL : &m_ownedData[0];
+						}
+
+	void				read			(deUint8* dst, int numBytes)
+						{
+							TCU_CHECK(numBytes >= 0 && numBytes <= m_size - m_position);
+
+							if (numBytes > 0)
+								deMemcpy(dst, m_data + m_position, (size_t)numBytes);
+
+							m_position += numBytes;
+						}
+
+	int					getSize			(void) const		{ return m_size;		}
+	int					getPosition		(void) const		{ return m_position;	}
+	void				setPosition		(int position)		{ m_position = de::clamp(position, 0, m_size);	}
+
+private:
+	const deUint8*			m_data;
+	int						m_size;
+	int						m_position;
+	std::vector<deUint8>	m_ownedData;
+};
+
+int compareName (const deUint8* entryName, deUint32 entryNameLength, const char* name, size_t nameLength)
+{
+	const int result = deMemCmp(entryName, name, de::min((size_t)entryNameLength, nameLength));
+
+	if (result != 0)
+		return result;
+	else if ((size_t)entryNameLength == nameLength)
+		return 0;
+	else
+		return (size_t)entryNameLength < nameLength ? -1 : 1;
+}
+
+void readFile (const char* filename, std::vector<deUint8>& dst)
+{
+	FileResource	file	(filename);
+	const int		size	= file.getSize();
+
+	dst.resize((size_t)size);
+
+	if (size > 0)
+		file.read(&dst[0], size);
+}
+
+void addDirectoryRecursive (std::map<std::string, std::vector<deUint8> >& dst, const de::FilePath& dir, const std::string& prefix)
+{
+	for (de::DirectoryIterator iter (dir); iter.hasItem(); iter.next())
+	{
+		const de::FilePath	item	= iter.getItem();
+		const std::string	name	= prefix.empty() ? item.getBaseName() : prefix + "/" + item.getBaseName();
+
+		if (item.getType() == de::FilePath::TYPE_DIRECTORY)
+			addDirectoryRecursive(dst, item, name);
+		else if (item.getType() == de::FilePath::TYPE_FILE)
+			readFile(item.getPath(), dst[name]);
+	}
+}
+
+} // anonymous
+
+// PackArchive::MappedFile
+
+struct PackArchive::MappedFile
+{
+	const deUint8*			data;
+	size_t					size;
+
+#if defined(TCU_PACK_USE_WIN32_MAPPING)
+	HANDLE					file;
+	HANDLE					mapping;
+#elif !defined(TCU_PACK_USE_MMAP)
+	std::vector<deUint8>	buffer;
+#endif
+
+	MappedFile (const char* filename);
+	~MappedFile (void);
+};
+
+#if defined(TCU_PACK_USE_MMAP)
+
+PackArchive::MappedFile::MappedFile (const char* filename)
+	: data	(DE_NULL)
+	, size	(0)
+{
+	const int	fd	= open(filename, O_RDONLY);
+	struct stat	st;
+
+	if (fd < 0)
+		throw ResourceError("Failed to open resource pack", filename, __FILE__, __LINE__);
+
+	if (fstat(fd, &st) != 0 || st.st_size < PACK_HEADER_SIZE)
+	{
+		close(fd);
+		throw ResourceError("Invalid resource pack", filename, __FILE__, __LINE__);
+	}
+
+	void* const ptr = mmap(DE_NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// Mapping stays valid after the descriptor is closed
+	close(fd);
+
+	if (ptr == MAP_FAILED)
+		throw ResourceError("Failed to map resource pack", filename, __FILE__, __LINE__);
+
+	data	= (const deUint8*)ptr;
+	size	= (size_t)st.st_size;
+}
+
+PackArchive::MappedFile::~MappedFile (void)
+{
+	munmap(const_cast<deUint8*>(data), size);
+}
+
+#elif defined(TCU_PACK_USE_WIN32_MAPPING)
+
+PackArchive::MappedFile::MappedFile (const char* filename)
+	: data		(DE_NULL)
+	, size		(0)
+	, file		(INVALID_HANDLE_VALUE)
+	, mapping	(DE_NULL)
+{
+	LARGE_INTEGER	fileSize;
+
+	file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, DE_NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, DE_NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+		throw ResourceError("Failed to open resource pack", filename, __FILE__, __LINE__);
+
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < PACK_HEADER_SIZE)
+	{
+		CloseHandle(file);
+		throw ResourceError("Invalid resource pack", filename, __FILE__, __LINE__);
+	}
+
+	mapping = CreateFileMappingA(file, DE_NULL, PAGE_READONLY, 0, 0, DE_NULL);
+
+	if (mapping)
+		data = (const deUint8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+	if (!data)
+	{
+		if (mapping)
+			CloseHandle(mapping);
+		CloseHandle(file);
+		throw ResourceError("Failed to map resource pack", filename, __FILE__, __LINE__);
+	}
+
+	size = (size_t)fileSize.QuadPart;
+}
+
+PackArchive::MappedFile::~MappedFile (void)
+{
+	UnmapViewOfFile(data);
+	CloseHandle(mapping);
+	CloseHandle(file);
+}
+
+#else
+
+PackArchive::MappedFile::MappedFile (const char* filename)
+	: data	(DE_NULL)
+	, size	(0)
+{
+	// No mapping support, read whole file
+	readFile(filename, buffer);
+
+	if (buffer.size() < PACK_HEADER_SIZE)
+		throw ResourceError("Invalid resource pack", filename, __FILE__, __LINE__);
+
+	data	= &buffer[0];
+	size	= buffer.size();
+}
+
+PackArchive::MappedFile::~MappedFile (void)
+{
+}
+
+#endif
+
+// PackArchive
+
+PackArchive::PackArchive (const char* filename)
+	: m_file		(DE_NULL)
+	, m_numEntries	(0)
+{
+	de::MovePtr<MappedFile>		file	(new MappedFile(filename));
+	const deUint8* const		data	= file->data;
+
+	if (deMemCmp(data, s_packMagic, sizeof(s_packMagic)) != 0 || readUint32(data + 8) != PACK_VERSION)
+		throw ResourceError("Invalid resource pack", filename, __FILE__, __LINE__);
+
+	m_numEntries = readUint32(data + 12);
+
+	if ((deUint64)m_numEntries * PACK_ENTRY_SIZE > (deUint64)(file->size - PACK_HEADER_SIZE))
+		throw ResourceError("Truncated resource pack", filename, __FILE__, __LINE__);
+
+	// Validate entry table once so that lookups can trust it
+	for (deUint32 ndx = 0; ndx < m_numEntries; ndx++)
+	{
+		const deUint8* const	entry		= data + PACK_HEADER_SIZE + ndx * PACK_ENTRY_SIZE;
+		const deUint64			nameEnd		= (deUint64)readUint32(entry + ENTRY_NAME_OFFSET) + readUint32(entry + ENTRY_NAME_LENGTH);
+		const deUint64			dataEnd		= (deUint64)readUint32(entry + ENTRY_DATA_OFFSET) + readUint32(entry + ENTRY_STORED_SIZE);
+		const deUint32			compression	= readUint32(entry + ENTRY_COMPRESSION);
+
+		if (nameEnd > file->size || dataEnd > file->size || compression >= PACK_COMPRESSION_LAST ||
+			(compression == PACK_COMPRESSION_NONE && readUint32(entry + ENTRY_SIZE) != readUint32(entry + ENTRY_STORED_SIZE)) ||
+			readUint32(entry + ENTRY_SIZE) > (deUint32)0x7FFFFFFF)
+			throw ResourceError("Corrupted resource pack", filename, __FILE__, __LINE__);
+	}
+
+	m_file = file.release();
+}
+
+PackArchive::~PackArchive (void)
+{
+	delete m_file;
+}
+
+const deUint8* PackArchive::getEntry (int ndx) const
+{
+	DE_ASSERT(de::inBounds(ndx, 0, (int)m_numEntries));
+	return m_file->data + PACK_HEADER_SIZE + ndx * PACK_ENTRY_SIZE;
+}
+
+const deUint8* PackArchive::findEntry (const char* name) const
+{
+	const size_t	nameLength	= strlen(name);
+	int				lo			= 0;
+	int				hi			= (int)m_numEntries;
+
+	while (lo < hi)
+	{
+		const int				mid		= lo + (hi - lo) / 2;
+		const deUint8* const	entry	= getEntry(mid);
+		const int				cmp		= compareName(m_file->data + readUint32(entry + ENTRY_NAME_OFFSET), readUint32(entry + ENTRY_NAME_LENGTH), name, nameLength);
+
+		if (cmp == 0)
+			return entry;
+		else if (cmp < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return DE_NULL;
+}
+
+bool PackArchive::hasResource (const char* name) const
+{
+	return findEntry(name) != DE_NULL;
+}
+
+std::string PackArchive::getResourceName (int ndx) const
+{
+	const deUint8* const entry = getEntry(ndx);
+
+	return std::string((const char*)m_file->data + readUint32(entry + ENTRY_NAME_OFFSET), (size_t)readUint32(entry + ENTRY_NAME_LENGTH));
+}
+
+Resource* PackArchive::getResource (const char* name) const
+{
+	const deUint8* const	entry		= findEntry(name);
+
+	if (!entry)
+		throw ResourceError("Resource not found in pack", name, __FILE__, __LINE__);
+
+	const deUint8* const	payload		= m_file->data + readUint32(entry + ENTRY_DATA_OFFSET);
+	const deUint32			storedSize	= readUint32(entry + ENTRY_STORED_SIZE);
+	const deUint32			size		= readUint32(entry + ENTRY_SIZE);
+
+	if (readUint32(entry + ENTRY_COMPRESSION) == PACK_COMPRESSION_NONE)
+		return new PackResource(name, payload, (int)size);
+
+	{
+		std::vector<deUint8>	decompressed	(size);
+		uLongf					dstSize			= (uLongf)size;
+
+		if (size > 0 && (uncompress(&decompressed[0], &dstSize, payload, (uLong)storedSize) != Z_OK || dstSize != (uLongf)size))
+			throw ResourceError("Failed to decompress resource", name, __FILE__, __LINE__);
+
+		return new PackResource(name, decompressed);
+	}
+}
+
+// PackOverlayArchive
+
+PackOverlayArchive::PackOverlayArchive (const PackArchive& pack, const Archive& fallback)
+	: m_pack		(pack)
+	, m_fallback	(fallback)
+{
+}
+
+Resource* PackOverlayArchive::getResource (const char* name) const
+{
+	if (m_pack.hasResource(name))
+		return m_pack.getResource(name);
+	else
+		return m_fallback.getResource(name);
+}
+
+// PackArchiveWriter
+
+PackArchiveWriter::PackArchiveWriter (void)
+{
+}
+
+void PackArchiveWriter::addResource (const std::string& name, const std::vector<deUint8>& data)
+{
+	m_resources[name] = data;
+}
+
+void PackArchiveWriter::addFile (const char* srcFile, const std::string& name)
+{
+	readFile(srcFile, m_resources[name]);
+}
+
+void PackArchiveWriter::addDirectory (const char* srcDir, const char* prefix)
+{
+	const de::FilePath dir (srcDir);
+
+	if (dir.getType() != de::FilePath::TYPE_DIRECTORY)
+		throw ResourceError("Not a directory", srcDir, __FILE__, __LINE__);
+
+	addDirectoryRecursive(m_resources, dir, prefix);
+}
+
+void PackArchiveWriter::addArchive (const PackArchive& archive)
+{
+	for (int ndx = 0; ndx < archive.getNumResources(); ndx++)
+	{
+		const std::string					name		= archive.getResourceName(ndx);
+		const de::UniquePtr<Resource>		resource	(archive.getResource(name.c_str()));
+		std::vector<deUint8>&				dst			= m_resources[name];
+
+		dst.resize((size_t)resource->getSize());
+
+		if (!dst.empty())
+			resource->read(&dst[0], (int)dst.size());
+	}
+}
+
+void PackArchiveWriter::write (const char* filename, bool compress) const
+{
+	typedef std::map<std::string, std::vector<deUint8> >::const_iterator ResourceIter;
+
+	const deUint32						numEntries		= (deUint32)m_resources.size();
+	std::vector<std::vector<deUint8> >	compressed		(numEntries);
+	std::vector<deUint8>				header;
+	std::vector<deUint8>				names;
+	deUint64							dataOffset;
+
+	// Compress first so that data offsets are known when writing the entry table
+	if (compress)
+	{
+		deUint32 ndx = 0;
+
+		for (ResourceIter iter = m_resources.begin(); iter != m_resources.end(); ++iter, ++ndx)
+		{
+			const std::vector<deUint8>&	src		= iter->second;
+			uLongf						dstSize	= compressBound((uLong)src.size());
+
+			if (src.empty())
+				continue;
+
+			compressed[ndx].resize((size_t)dstSize);
+
+			// Keep only if it saves at least 1/8
+			if (compress2(&compressed[ndx][0], &dstSize, &src[0], (uLong)src.size(), Z_BEST_COMPRESSION) == Z_OK && (size_t)dstSize < src.size() - src.size() / 8)
+				compressed[ndx].resize((size_t)dstSize);
+			else
+				compressed[ndx].clear();
+		}
+	}
+
+	header.insert(header.end(), s_packMagic, s_packMagic + sizeof(s_packMagic));
+	writeUint32(header, PACK_VERSION);
+	writeUint32(header, numEntries);
+
+	for (ResourceIter iter = m_resources.begin(); iter != m_resources.end(); ++iter)
+	{
+		names.insert(names.end(), iter->first.begin(), iter->first.end());
+		names.push_back(0);
+	}
+
+	{
+		const deUint64	namesOffset	= PACK_HEADER_SIZE + (deUint64)numEntries * PACK_ENTRY_SIZE;
+		deUint64		nameOffset	= namesOffset;
+		deUint32		ndx			= 0;
+
+		dataOffset = deAlign64(namesOffset + names.size(), PACK_DATA_ALIGNMENT);
+
+		for (ResourceIter iter = m_resources.begin(); iter != m_resources.end(); ++iter, ++ndx)
+		{
+			const bool		isCompressed	= !compressed[ndx].empty();
+			const size_t	storedSize		= isCompressed ? compressed[ndx].size() : iter->second.size();
+
+			if (dataOffset + storedSize > (deUint64)0xFFFFFFFFu || iter->second.size() > (size_t)0x7FFFFFFF)
+				throw ResourceError("Resource pack too large", filename, __FILE__, __LINE__);
+
+			writeUint32(header, (deUint32)nameOffset);
+			writeUint32(header, (deUint32)iter->first.size());
+			writeUint32(header, (deUint32)dataOffset);
+			writeUint32(header, (deUint32)storedSize);
+			writeUint32(header, (deUint32)iter->second.size());
+			writeUint32(header, isCompressed ? PackArchive::PACK_COMPRESSION_ZLIB : PackArchive::PACK_COMPRESSION_NONE);
+
+			nameOffset	+= iter->first.size() + 1;
+			dataOffset	= deAlign64(dataOffset + storedSize, PACK_DATA_ALIGNMENT);
+		}
+	}
+
+	{
+		std::ofstream		out			(filename, std::ios_base::binary | std::ios_base::trunc);
+		const char			padding[PACK_DATA_ALIGNMENT]	= { 0 };
+		deUint64			offset		= header.size() + names.size();
+		deUint32			ndx			= 0;
+
+		if (!out)
+			throw ResourceError("Failed to create resource pack", filename, __FILE__, __LINE__);
+
+		out.write((const char*)&header[0], (std::streamsize)header.size());
+
+		if (!names.empty())
+			out.write((const char*)&names[0], (std::streamsize)names.size());
+
+		for (ResourceIter iter = m_resources.begin(); iter != m_resources.end(); ++iter, ++ndx)
+		{
+			const std::vector<deUint8>&	payload		= compressed[ndx].empty() ? iter->second : compressed[ndx];
+			const deUint64				aligned		= deAlign64(offset, PACK_DATA_ALIGNMENT);
+
+			out.write(padding, (std::streamsize)(aligned - offset));
+
+			if (!payload.empty())
+				out.write((const char*)&payload[0], (std::streamsize)payload.size());
+
+			offset = aligned + payload.size();
+		}
+
+		if (!out)
+			throw ResourceError("Failed to write resource pack", filename, __FILE__, __LINE__);
+	}
+}
+
+} // tcu
@@ -0,0 +1,135 @@
+#ifndef _TCUPACKARCHIVE_HPP
+#define _TCUPACKARCHIVE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Single-file resource archive.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuResource.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Archive backed by a single memory-mapped pack file
+ *
+ * Pack file layout (all integers are little-endian deUint32):
+ *
+ *  header:		"dEQPpack", version, numEntries
+ *  entries:	numEntries x { nameOffset, nameLength, dataOffset,
+ *				storedSize, size, compression }, sorted by name
+ *  names:		NUL-terminated resource paths
+ *  data:		entry payloads, each aligned to 16 bytes
+ *
+ * Offsets are relative to the start of the file. Compression is either
+ * PACK_COMPRESSION_NONE or PACK_COMPRESSION_ZLIB.
+ *
+ * Lookups are binary searches over the mapped entry table. Uncompressed
+ * resources are served directly from the mapping without copying.
+ *//*--------------------------------------------------------------------*/
+class PackArchive : public Archive
+{
+public:
+	enum Compression
+	{
+		PACK_COMPRESSION_NONE	= 0,
+		PACK_COMPRESSION_ZLIB	= 1,
+
+		PACK_COMPRESSION_LAST
+	};
+
+	explicit				PackArchive			(const char* filename);
+							~PackArchive		(void);
+
+	Resource*				getResource			(const char* name) const;
+	bool					hasResource			(const char* name) const;
+
+	int						getNumResources		(void) const { return (int)m_numEntries; }
+	std::string				getResourceName		(int ndx) const;
+
+private:
+	struct MappedFile;
+
+							PackArchive			(const PackArchive& other);
+	PackArchive&			operator=			(const PackArchive& other);
+
+	const deUint8*			getEntry			(int ndx) const;
+	const deUint8*			findEntry			(const char* name) const;
+
+	MappedFile*				m_file;
+	deUint32				m_numEntries;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Serves resources from a pack, falling back to another archive
+ *
+ * Used when only part of the data, for example the copied data
+ * directories, has been packed.
+ *//*--------------------------------------------------------------------*/
+class PackOverlayArchive : public Archive
+{
+public:
+							PackOverlayArchive	(const PackArchive& pack, const Archive& fallback);
+
+	Resource*				getResource			(const char* name) const;
+
+private:
+	const PackArchive&		m_pack;
+	const Archive&			m_fallback;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Builds pack files read by PackArchive
+ *//*--------------------------------------------------------------------*/
+class PackArchiveWriter
+{
+public:
+							PackArchiveWriter	(void);
+
+	//! Add or replace a single resource.
+	void					addResource			(const std::string& name, const std::vector<deUint8>& data);
+
+	//! Add a single file from filesystem.
+	void					addFile				(const char* srcFile, const std::string& name);
+
+	//! Add all files under srcDir recursively, named prefix/relative/path.
+	void					addDirectory		(const char* srcDir, const char* prefix);
+
+	//! Add all resources from an existing pack.
+	void					addArchive			(const PackArchive& archive);
+
+	int						getNumResources		(void) const { return (int)m_resources.size(); }
+
+	//! Write pack. Resources that zlib shrinks are stored compressed if compress is set.
+	void					write				(const char* filename, bool compress) const;
+
+private:
+	std::map<std::string, std::vector<deUint8> >	m_resources;
+};
+
+} // tcu
+
+#endif // _TCUPACKARCHIVE_HPP
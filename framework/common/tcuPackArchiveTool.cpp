@@ -0,0 +1,131 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Pack data directories into a resource pack file.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuPackArchive.hpp"
+#include "deFilePath.hpp"
+#include "deString.h"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+using std::string;
+
+struct CommandLine
+{
+	CommandLine (void)
+		: append	(false)
+		, compress	(true)
+	{
+	}
+
+	string		dstFilename;
+	string		srcPath;
+	string		prefix;
+	bool		append;
+	bool		compress;
+};
+
+static void printHelp (const char* binName)
+{
+	printf("%s: [options] [pack file] [source dir or file] [resource path prefix]\n", binName);
+	printf("  --append            Add to existing pack file, replacing resources with same name.\n");
+	printf("  --no-compress       Store all resources uncompressed.\n");
+}
+
+static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
+{
+	int numPositional = 0;
+
+	for (int argNdx = 1; argNdx < argc; argNdx++)
+	{
+		const char* arg = argv[argNdx];
+
+		if (deStringEqual(arg, "--append"))
+			cmdLine.append = true;
+		else if (deStringEqual(arg, "--no-compress"))
+			cmdLine.compress = false;
+		else if (deStringBeginsWith(arg, "--"))
+			return false;
+		else if (numPositional == 0)
+			cmdLine.dstFilename = arg;
+		else if (numPositional == 1)
+			cmdLine.srcPath = arg;
+		else if (numPositional == 2)
+			cmdLine.prefix = arg;
+		else
+			return false;
+
+		if (!deStringBeginsWith(arg, "--"))
+			numPositional += 1;
+	}
+
+	return numPositional >= 2;
+}
+
+static void packResources (const CommandLine& cmdLine)
+{
+	const de::FilePath			dstPath		(cmdLine.dstFilename);
+	const de::FilePath			srcPath		(cmdLine.srcPath);
+	tcu::PackArchiveWriter		writer;
+
+	if (cmdLine.append && dstPath.exists())
+	{
+		const tcu::PackArchive existing (cmdLine.dstFilename.c_str());
+		writer.addArchive(existing);
+	}
+
+	if (srcPath.getType() == de::FilePath::TYPE_DIRECTORY)
+		writer.addDirectory(cmdLine.srcPath.c_str(), cmdLine.prefix.c_str());
+	else if (srcPath.getType() == de::FilePath::TYPE_FILE)
+		writer.addFile(cmdLine.srcPath.c_str(), cmdLine.prefix.empty() ? srcPath.getBaseName() : cmdLine.prefix);
+	else
+		throw std::runtime_error("'" + cmdLine.srcPath + "' not found");
+
+	writer.write(cmdLine.dstFilename.c_str(), cmdLine.compress);
+
+	printf("Wrote %d resources to %s\n", writer.getNumResources(), cmdLine.dstFilename.c_str());
+}
+
+int main (int argc, const char* const* argv)
+{
+	try
+	{
+		CommandLine cmdLine;
+
+		if (!parseCommandLine(cmdLine, argc, argv))
+		{
+			printHelp(argv[0]);
+			return -1;
+		}
+
+		packResources(cmdLine);
+	}
+	catch (const std::exception& e)
+	{
+		printf("FATAL ERROR: %s\n", e.what());
+		return -1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,370 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief API independent performance measurement utilities.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuPerfMeasurement.hpp"
+#include "tcuTestLog.hpp"
+#include "tcuVectorUtil.hpp"
+#include "deClock.h"
+#include "deMath.h"
+#include "deStringUtil.hpp"
+
+#include <algorithm>
+
+using std::vector;
+
+namespace tcu
+{
+
+namespace
+{
+
+// Reorders input arbitrarily, linear complexity and no allocations
+template<typename T>
+float destructiveMedian (vector<T>& data)
+{
+	const typename vector<T>::iterator mid = data.begin()+data.size()/2;
+
+	std::nth_element(data.begin(), mid, data.end());
+
+	if (data.size()%2 == 0) // Even number of elements, need average of two centermost elements
+		return (*mid + *std::max_element(data.begin(), mid))*0.5f; // Data is partially sorted around mid, mid is half an item after center
+	else
+		return *mid;
+}
+
+} // anonymous
+
+LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints)
+{
+	const float		epsilon					= 1e-6f;
+
+	const int		numDataPoints			= (int)dataPoints.size();
+	vector<float>	pairwiseCoefficients;
+	vector<float>	pointwiseOffsets;
+	LineParameters	result					(0.0f, 0.0f);
+
+	// Compute the pairwise coefficients.
+	for (int i = 0; i < numDataPoints; i++)
+	{
+		const Vec2& ptA = dataPoints[i];
+
+		for (int j = 0; j < i; j++)
+		{
+			const Vec2& ptB = dataPoints[j];
+
+			if (de::abs(ptA.x() - ptB.x()) > epsilon)
+				pairwiseCoefficients.push_back((ptA.y() - ptB.y()) / (ptA.x() - ptB.x()));
+		}
+	}
+
+	// Find the median of the pairwise coefficients.
+	// \note If there are no data point pairs with differing x values, the coefficient variable will stay zero as initialized.
+	if (!pairwiseCoefficients.empty())
+		result.coefficient = destructiveMedian(pairwiseCoefficients);
+
+	// Compute the offsets corresponding to the median coefficient, for all data points.
+	for (int i = 0; i < numDataPoints; i++)
+		pointwiseOffsets.push_back(dataPoints[i].y() - result.coefficient*dataPoints[i].x());
+
+	// Find the median of the offsets.
+	// \note If there are no data points, the offset variable will stay zero as initialized.
+	if (!pointwiseOffsets.empty())
+		result.offset = destructiveMedian(pointwiseOffsets);
+
+	return result;
+}
+
+float linearSample (const std::vector<float>& values, float position)
+{
+	DE_ASSERT(position >= 0.0f);
+	DE_ASSERT(position <= 1.0f);
+
+	const int	maxNdx				= (int)values.size() - 1;
+	const float	floatNdx			= (float)maxNdx * position;
+	const int	lowerNdx			= (int)deFloatFloor(floatNdx);
+	const int	higherNdx			= lowerNdx + (lowerNdx == maxNdx ? 0 : 1); // Use only last element if position is 1.0
+	const float	interpolationFactor = floatNdx - (float)lowerNdx;
+
+	DE_ASSERT(lowerNdx >= 0 && lowerNdx < (int)values.size());
+	DE_ASSERT(higherNdx >= 0 && higherNdx < (int)values.size());
+	DE_ASSERT(interpolationFactor >= 0 && interpolationFactor < 1.0f);
+
+	return tcu::mix(values[lowerNdx], values[higherNdx], interpolationFactor);
+}
+
+LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence)
+{
+	DE_ASSERT(!dataPoints.empty());
+
+	// Siegel's variation
+
+	const float						epsilon				= 1e-6f;
+	const int						numDataPoints		= (int)dataPoints.size();
+	std::vector<float>				medianSlopes;
+	std::vector<float>				pointwiseOffsets;
+	LineParametersWithConfidence	result;
+
+	// Compute the median slope via each element
+	for (int i = 0; i < numDataPoints; i++)
+	{
+		const tcu::Vec2&	ptA		= dataPoints[i];
+		std::vector<float>	slopes;
+
+		slopes.reserve(numDataPoints);
+
+		for (int j = 0; j < numDataPoints; j++)
+		{
+			const tcu::Vec2& ptB = dataPoints[j];
+
+			if (de::abs(ptA.x() - ptB.x()) > epsilon)
+				slopes.push_back((ptA.y() - ptB.y()) / (ptA.x() - ptB.x()));
+		}
+
+		// Add median of slopes through point i
+		// \note Points that share their x value with all other points have no slopes through them.
+		if (!slopes.empty())
+			medianSlopes.push_back(destructiveMedian(slopes));
+	}
+
+	// \note If there are no data point pairs with differing x values, the coefficient is zero as in theilSenLinearRegression().
+	if (medianSlopes.empty())
+		medianSlopes.push_back(0.0f);
+
+	// Find the median of the pairwise coefficients.
+	std::sort(medianSlopes.begin(), medianSlopes.end());
+	result.coefficient = linearSample(medianSlopes, 0.5f);
+
+	// Compute the offsets corresponding to the median coefficient, for all data points.
+	for (int i = 0; i < numDataPoints; i++)
+		pointwiseOffsets.push_back(dataPoints[i].y() - result.coefficient*dataPoints[i].x());
+
+	// Find the median of the offsets.
+	std::sort(pointwiseOffsets.begin(), pointwiseOffsets.end());
+	result.offset = linearSample(pointwiseOffsets, 0.5f);
+
+	// calculate confidence intervals
+	result.coefficientConfidenceLower = linearSample(medianSlopes, 0.5f - reportedConfidence*0.5f);
+	result.coefficientConfidenceUpper = linearSample(medianSlopes, 0.5f + reportedConfidence*0.5f);
+
+	result.offsetConfidenceLower = linearSample(pointwiseOffsets, 0.5f - reportedConfidence*0.5f);
+	result.offsetConfidenceUpper = linearSample(pointwiseOffsets, 0.5f + reportedConfidence*0.5f);
+
+	result.confidence = reportedConfidence;
+
+	return result;
+}
+
+void WallClockTimer::begin (void)
+{
+	m_startTime = deGetMicroseconds();
+}
+
+void WallClockTimer::end (void)
+{
+	m_endTime = deGetMicroseconds();
+}
+
+bool WallClockTimer::getDurationUs (double& durationUs)
+{
+	durationUs = (double)(m_endTime - m_startTime);
+	return true;
+}
+
+namespace
+{
+
+bool runSample (PerfWorkload& workload, PerfTimer& timer, int workSize, float& durationUs)
+{
+	double duration = 0.0;
+
+	workload.run(workSize, timer);
+
+	if (!timer.getDurationUs(duration))
+		return false;
+
+	durationUs = (float)duration;
+	return true;
+}
+
+LineParametersWithConfidence fitSamples (const vector<PerfSample>& samples, float confidence)
+{
+	vector<Vec2> dataPoints;
+
+	for (size_t sampleNdx = 0; sampleNdx < samples.size(); ++sampleNdx)
+	{
+		if (!samples[sampleNdx].isOutlier)
+			dataPoints.push_back(Vec2((float)samples[sampleNdx].workSize, samples[sampleNdx].durationUs));
+	}
+
+	return theilSenSiegelLinearRegression(dataPoints, confidence);
+}
+
+float getFitResidual (const PerfSample& sample, const LineParametersWithConfidence& fit)
+{
+	return sample.durationUs - (fit.offset + fit.coefficient * (float)sample.workSize);
+}
+
+// Mark samples whose residual is far from the median residual, measured in median absolute deviations.
+int markOutliers (vector<PerfSample>& samples, const LineParametersWithConfidence& fit, float threshold)
+{
+	vector<float>	residuals;
+	vector<float>	deviations;
+	float			medianResidual;
+	float			mad;
+	int				numOutliers	= 0;
+
+	for (size_t sampleNdx = 0; sampleNdx < samples.size(); ++sampleNdx)
+		residuals.push_back(getFitResidual(samples[sampleNdx], fit));
+
+	std::sort(residuals.begin(), residuals.end());
+	medianResidual = linearSample(residuals, 0.5f);
+
+	for (size_t ndx = 0; ndx < residuals.size(); ++ndx)
+		deviations.push_back(de::abs(residuals[ndx] - medianResidual));
+
+	std::sort(deviations.begin(), deviations.end());
+	mad = linearSample(deviations, 0.5f);
+
+	// \note Timer quantization can make most residuals equal, nothing is considered an outlier then.
+	if (mad <= 0.0f)
+		return 0;
+
+	for (size_t sampleNdx = 0; sampleNdx < samples.size(); ++sampleNdx)
+	{
+		samples[sampleNdx].isOutlier = de::abs(getFitResidual(samples[sampleNdx], fit) - medianResidual) > threshold * mad;
+
+		if (samples[sampleNdx].isOutlier)
+			numOutliers += 1;
+	}
+
+	return numOutliers;
+}
+
+} // anonymous
+
+PerfMeasureResult measurePerformance (PerfWorkload& workload, PerfTimer& timer, const PerfMeasureParams& params)
+{
+	PerfMeasureResult	result;
+	vector<int>			workSizes;
+
+	DE_ASSERT(params.minWorkSize > 0 && params.minWorkSize <= params.maxWorkSize);
+
+	result.timerName	= timer.getName();
+	result.maxWorkSize	= params.maxWorkSize;
+	result.numInvalid	= 0;
+	result.numOutliers	= 0;
+
+	if (params.targetDurationUs > 0.0f)
+	{
+		for (int workSize = params.minWorkSize; workSize <= params.maxWorkSize; workSize *= 2)
+		{
+			float durationUs = 0.0f;
+
+			result.maxWorkSize = workSize;
+
+			if (runSample(workload, timer, workSize, durationUs) && durationUs >= params.targetDurationUs)
+				break;
+		}
+	}
+
+	for (int workSize = params.minWorkSize; workSize <= result.maxWorkSize; workSize *= 2)
+		workSizes.push_back(workSize);
+
+	// Untimed run to get lazily initialized state out of the way.
+	{
+		float durationUs = 0.0f;
+		runSample(workload, timer, workSizes.back(), durationUs);
+	}
+
+	for (int repeatNdx = 0; repeatNdx < params.numRepeats; ++repeatNdx)
+	for (size_t sizeNdx = 0; sizeNdx < workSizes.size(); ++sizeNdx)
+	{
+		float durationUs = 0.0f;
+
+		if (runSample(workload, timer, workSizes[sizeNdx], durationUs))
+			result.samples.push_back(PerfSample(workSizes[sizeNdx], durationUs));
+		else
+			result.numInvalid += 1;
+	}
+
+	if (result.samples.empty())
+	{
+		deMemset(&result.fit, 0, sizeof(result.fit));
+		return result;
+	}
+
+	result.fit = fitSamples(result.samples, params.confidence);
+
+	if (params.outlierThreshold > 0.0f)
+	{
+		result.numOutliers = markOutliers(result.samples, result.fit, params.outlierThreshold);
+
+		if (result.numOutliers > 0 && result.numOutliers < (int)result.samples.size())
+			result.fit = fitSamples(result.samples, params.confidence);
+	}
+
+	return result;
+}
+
+void logPerfSamples (TestLog& log, const std::string& name, const std::string& description, const PerfMeasureResult& result)
+{
+	log << TestLog::SampleList(name, description)
+		<< TestLog::SampleInfo
+		<< TestLog::ValueInfo("WorkSize",		"Work size",			"",		QP_SAMPLE_VALUE_TAG_PREDICTOR)
+		<< TestLog::ValueInfo("Duration",		"Duration",				"us",	QP_SAMPLE_VALUE_TAG_RESPONSE)
+		<< TestLog::ValueInfo("FitResidual",	"Fit residual",			"us",	QP_SAMPLE_VALUE_TAG_RESPONSE)
+		<< TestLog::ValueInfo("Outlier",		"Excluded from fit",	"",		QP_SAMPLE_VALUE_TAG_RESPONSE)
+		<< TestLog::EndSampleInfo;
+
+	for (size_t sampleNdx = 0; sampleNdx < result.samples.size(); ++sampleNdx)
+	{
+		const PerfSample& sample = result.samples[sampleNdx];
+
+		log << TestLog::Sample
+			<< sample.workSize
+			<< sample.durationUs
+			<< getFitResidual(sample, result.fit)
+			<< (sample.isOutlier ? 1 : 0)
+			<< TestLog::EndSample;
+	}
+
+	log << TestLog::EndSampleList;
+}
+
+void logPerfResult (TestLog& log, const PerfMeasureResult& result, const std::string& workUnit)
+{
+	const std::string	confidence	= de::toString(deRoundFloatToInt32(100.0f * result.fit.confidence)) + "% CI";
+	const float			perWorkNs	= result.getPerWorkNs();
+
+	log << TestLog::Message << "Timer: " << result.timerName << ", largest work size: " << result.maxWorkSize << TestLog::EndMessage
+		<< TestLog::Float("PerWorkTime",		"Time per " + workUnit,									"ns",	QP_KEY_TAG_TIME,	perWorkNs)
+		<< TestLog::Float("PerWorkTimeLower",	"Time per " + workUnit + ", " + confidence + " lower bound",	"ns",	QP_KEY_TAG_TIME,	1000.0f * result.fit.coefficientConfidenceLower)
+		<< TestLog::Float("PerWorkTimeUpper",	"Time per " + workUnit + ", " + confidence + " upper bound",	"ns",	QP_KEY_TAG_TIME,	1000.0f * result.fit.coefficientConfidenceUpper)
+		<< TestLog::Float("FixedOverhead",		"Fixed overhead",										"us",	QP_KEY_TAG_TIME,	result.fit.offset)
+		<< TestLog::Float("WorkRate",			workUnit + "s per second",								"1/s",	QP_KEY_TAG_NONE,	perWorkNs > 0.0f ? 1.0e9f / perWorkNs : 0.0f)
+		<< TestLog::Integer("NumOutliers",		"Samples excluded from fit",							"",		QP_KEY_TAG_NONE,	result.numOutliers)
+		<< TestLog::Integer("NumInvalid",		"Samples discarded by timer",							"",		QP_KEY_TAG_NONE,	result.numInvalid);
+}
+
+
+} // tcu
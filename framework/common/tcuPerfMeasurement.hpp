@@ -0,0 +1,178 @@
+#ifndef _TCUPERFMEASUREMENT_HPP
+#define _TCUPERFMEASUREMENT_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief API independent performance measurement utilities.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuVector.hpp"
+
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+
+class TestLog;
+
+struct LineParameters
+{
+	float offset;
+	float coefficient;
+
+	LineParameters (float offset_, float coefficient_) : offset(offset_), coefficient(coefficient_) {}
+};
+
+// Basic Theil-Sen linear estimate. Calculates median of all possible slope coefficients through two of the data points
+// and median of offsets corresponding with the median slope
+LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints);
+
+struct LineParametersWithConfidence
+{
+	float offset;
+	float offsetConfidenceUpper;
+	float offsetConfidenceLower;
+
+	float coefficient;
+	float coefficientConfidenceUpper;
+	float coefficientConfidenceLower;
+
+	float confidence;
+};
+
+// Median-of-medians version of Theil-Sen estimate. Calculates median of medians of slopes through a point and all other points.
+// Confidence interval is given as the range that contains the given fraction of all slopes/offsets
+LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence);
+
+//! Sample sorted values with linear interpolation as if they were laid to range [0, 1].
+float linearSample (const std::vector<float>& sortedValues, float position);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Timing backend
+ *
+ * Workloads call begin() and end() around the part that should be
+ * measured. Backends that time API side work (for example GPU timestamps)
+ * may need additional calls from the workload to record the timing
+ * commands; begin() and end() are then CPU side bookkeeping only.
+ *//*--------------------------------------------------------------------*/
+class PerfTimer
+{
+public:
+	virtual				~PerfTimer		(void) {}
+
+	virtual const char*	getName			(void) const = 0;
+
+	virtual void		begin			(void) = 0;
+	virtual void		end				(void) = 0;
+
+	//! Duration of the last begin()-end() interval. False if the measurement is unreliable and should be discarded.
+	virtual bool		getDurationUs	(double& durationUs) = 0;
+};
+
+//! deGetMicroseconds() based timer.
+class WallClockTimer : public PerfTimer
+{
+public:
+						WallClockTimer	(void) : m_startTime(0), m_endTime(0) {}
+
+	const char*			getName			(void) const { return "WallClock"; }
+
+	void				begin			(void);
+	void				end				(void);
+	bool				getDurationUs	(double& durationUs);
+
+private:
+	deUint64			m_startTime;
+	deUint64			m_endTime;
+};
+
+class PerfWorkload
+{
+public:
+	virtual				~PerfWorkload	(void) {}
+
+	//! Run workSize units of work, calling timer.begin() and timer.end() around the measured part.
+	virtual void		run				(int workSize, PerfTimer& timer) = 0;
+};
+
+struct PerfMeasureParams
+{
+	int		minWorkSize;
+	int		maxWorkSize;
+	float	targetDurationUs;	//!< If non-zero, largest work size is calibrated down to the first that takes at least this long.
+	int		numRepeats;			//!< Samples per work size.
+	float	outlierThreshold;	//!< Samples further than this many MADs from the median fit residual are outliers. Zero disables.
+	float	confidence;			//!< Fraction of slopes contained in the reported confidence interval.
+
+	PerfMeasureParams (int minWorkSize_, int maxWorkSize_)
+		: minWorkSize		(minWorkSize_)
+		, maxWorkSize		(maxWorkSize_)
+		, targetDurationUs	(0.0f)
+		, numRepeats		(8)
+		, outlierThreshold	(3.0f)
+		, confidence		(0.6f)
+	{
+	}
+};
+
+struct PerfSample
+{
+	int		workSize;
+	float	durationUs;
+	bool	isOutlier;
+
+	PerfSample (int workSize_, float durationUs_) : workSize(workSize_), durationUs(durationUs_), isOutlier(false) {}
+};
+
+struct PerfMeasureResult
+{
+	std::vector<PerfSample>			samples;
+	LineParametersWithConfidence	fit;				//!< Duration in microseconds as a function of work size, outliers excluded.
+	std::string						timerName;
+	int								maxWorkSize;		//!< Largest work size used, after calibration.
+	int								numInvalid;			//!< Samples discarded by the timer.
+	int								numOutliers;
+
+	//! Time per unit of work in nanoseconds.
+	float							getPerWorkNs		(void) const { return 1000.0f * fit.coefficient; }
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Measure duration of a workload as a function of work size
+ *
+ * Work sizes double from minWorkSize to maxWorkSize (optionally
+ * calibrated). One untimed run is made first, and work sizes are then
+ * interleaved in each repeat so that slow drifts affect all of them
+ * evenly. A line is fitted to the samples with Theil-Sen estimator, and
+ * fitted again without outliers if any are found.
+ *//*--------------------------------------------------------------------*/
+PerfMeasureResult	measurePerformance		(PerfWorkload& workload, PerfTimer& timer, const PerfMeasureParams& params);
+
+//! Log samples as a sample list with WorkSize, Duration, FitResidual and Outlier values.
+void				logPerfSamples			(TestLog& log, const std::string& name, const std::string& description, const PerfMeasureResult& result);
+
+//! Log fitted per work time, its confidence bounds, fixed overhead, rate and discarded sample counts. workUnit is used in descriptions only.
+void				logPerfResult			(TestLog& log, const PerfMeasureResult& result, const std::string& workUnit);
+
+} // tcu
+
+#endif // _TCUPERFMEASUREMENT_HPP
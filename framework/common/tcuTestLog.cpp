@@ -25,6 +25,7 @@
 #include "tcuTestLog.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuSurface.hpp"
+#include "tcuHarnessProfile.hpp"
 #include "deMath.h"
 
 #include <limits>
@@ -193,6 +194,12 @@ void TestLog::writeSessionInfo(std::string additionalInfo)
 	qpTestLog_beginSession(m_log, additionalInfo.c_str());
 }
 
+void TestLog::setImageStore (const char* dirName)
+{
+	if (qpTestLog_setImageStore(m_log, dirName) == DE_FALSE)
+		throw ResourceError(std::string("Failed to set test log image store '") + dirName + "'");
+}
+
 TestLog::~TestLog (void)
 {
 	qpTestLog_destroy(m_log);
@@ -201,6 +208,7 @@ TestLog::~TestLog (void)
 void TestLog::writeMessage (const char* msgStr)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeText(m_log, DE_NULL, DE_NULL, QP_KEY_TAG_NONE, msgStr) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -208,6 +216,7 @@ void TestLog::writeMessage (const char* msgStr)
 void TestLog::startImageSet (const char* name, const char* description)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startImageSet(m_log, name, description) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -215,6 +224,7 @@ void TestLog::startImageSet (const char* name, const char* description)
 void TestLog::endImageSet (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endImageSet(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -245,6 +255,7 @@ static Vector<int, Size> computeScaledSize (const Vector<int, Size>& imageSize,
 void TestLog::writeImage (const char* name, const char* description, const ConstPixelBufferAccess& access, const Vec4& pixelScale, const Vec4& pixelBias, qpImageCompressionMode compressionMode)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	const TextureFormat&	format		= access.getFormat();
 	int						width		= access.getWidth();
 	int						height		= access.getHeight();
@@ -370,6 +381,7 @@ void TestLog::writeImage (const char* name, const char* description, const Const
 void TestLog::writeImage (const char* name, const char* description, qpImageCompressionMode compressionMode, qpImageFormat format, int width, int height, int stride, const void* data)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeImage(m_log, name, description, compressionMode, format, width, height, stride, data) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -377,6 +389,7 @@ void TestLog::writeImage (const char* name, const char* description, qpImageComp
 void TestLog::startSection (const char* name, const char* description)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startSection(m_log, name, description) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -384,6 +397,7 @@ void TestLog::startSection (const char* name, const char* description)
 void TestLog::endSection (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endSection(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -391,6 +405,7 @@ void TestLog::endSection (void)
 void TestLog::startShaderProgram (bool linkOk, const char* linkInfoLog)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startShaderProgram(m_log, linkOk?DE_TRUE:DE_FALSE, linkInfoLog) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -398,6 +413,7 @@ void TestLog::startShaderProgram (bool linkOk, const char* linkInfoLog)
 void TestLog::endShaderProgram (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endShaderProgram(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -405,6 +421,7 @@ void TestLog::endShaderProgram (void)
 void TestLog::writeShader (qpShaderType type, const char* source, bool compileOk, const char* infoLog)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeShader(m_log, type, source, compileOk?DE_TRUE:DE_FALSE, infoLog) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -412,6 +429,7 @@ void TestLog::writeShader (qpShaderType type, const char* source, bool compileOk
 void TestLog::writeSpirVAssemblySource (const char* source)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeSpirVAssemblySource(m_log, source) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -419,6 +437,7 @@ void TestLog::writeSpirVAssemblySource (const char* source)
 void TestLog::writeKernelSource (const char* source)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeKernelSource(m_log, source) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -426,6 +445,7 @@ void TestLog::writeKernelSource (const char* source)
 void TestLog::writeCompileInfo (const char* name, const char* description, bool compileOk, const char* infoLog)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeCompileInfo(m_log, name, description, compileOk ? DE_TRUE : DE_FALSE, infoLog) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -433,6 +453,7 @@ void TestLog::writeCompileInfo (const char* name, const char* description, bool
 void TestLog::writeFloat (const char* name, const char* description, const char* unit, qpKeyValueTag tag, float value)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeFloat(m_log, name, description, unit, tag, value) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -440,6 +461,7 @@ void TestLog::writeFloat (const char* name, const char* description, const char*
 void TestLog::writeInteger (const char* name, const char* description, const char* unit, qpKeyValueTag tag, deInt64 value)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeInteger(m_log, name, description, unit, tag, value) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -447,6 +469,7 @@ void TestLog::writeInteger (const char* name, const char* description, const cha
 void TestLog::startEglConfigSet (const char* name, const char* description)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startEglConfigSet(m_log, name, description) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -454,6 +477,7 @@ void TestLog::startEglConfigSet (const char* name, const char* description)
 void TestLog::writeEglConfig (const qpEglConfigInfo* config)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeEglConfig(m_log, config) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -461,6 +485,7 @@ void TestLog::writeEglConfig (const qpEglConfigInfo* config)
 void TestLog::endEglConfigSet (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endEglConfigSet(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -468,6 +493,7 @@ void TestLog::endEglConfigSet (void)
 void TestLog::startCase (const char* testCasePath, qpTestCaseType testCaseType)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startCase(m_log, testCasePath, testCaseType) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -475,6 +501,7 @@ void TestLog::startCase (const char* testCasePath, qpTestCaseType testCaseType)
 void TestLog::endCase (qpTestResult result, const char* description)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endCase(m_log, result, description) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -482,6 +509,7 @@ void TestLog::endCase (qpTestResult result, const char* description)
 void TestLog::terminateCase (qpTestResult result)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_terminateCase(m_log, result) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -489,6 +517,7 @@ void TestLog::terminateCase (qpTestResult result)
 void TestLog::startTestsCasesTime (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startTestsCasesTime(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -496,6 +525,7 @@ void TestLog::startTestsCasesTime (void)
 void TestLog::endTestsCasesTime (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endTestsCasesTime(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -503,6 +533,7 @@ void TestLog::endTestsCasesTime (void)
 void TestLog::startSampleList (const std::string& name, const std::string& description)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startSampleList(m_log, name.c_str(), description.c_str()) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -510,6 +541,7 @@ void TestLog::startSampleList (const std::string& name, const std::string& descr
 void TestLog::startSampleInfo (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startSampleInfo(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -517,6 +549,7 @@ void TestLog::startSampleInfo (void)
 void TestLog::writeValueInfo (const std::string& name, const std::string& description, const std::string& unit, qpSampleValueTag tag)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeValueInfo(m_log, name.c_str(), description.c_str(), unit.empty() ? DE_NULL : unit.c_str(), tag) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -524,6 +557,7 @@ void TestLog::writeValueInfo (const std::string& name, const std::string& descri
 void TestLog::endSampleInfo (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endSampleInfo(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -531,6 +565,7 @@ void TestLog::endSampleInfo (void)
 void TestLog::startSample (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_startSample(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -538,6 +573,7 @@ void TestLog::startSample (void)
 void TestLog::writeSampleValue (double value)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeValueFloat(m_log, value) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -545,6 +581,7 @@ void TestLog::writeSampleValue (double value)
 void TestLog::writeSampleValue (deInt64 value)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_writeValueInteger(m_log, value) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -552,6 +589,7 @@ void TestLog::writeSampleValue (deInt64 value)
 void TestLog::endSample (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endSample(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -559,6 +597,7 @@ void TestLog::endSample (void)
 void TestLog::endSampleList (void)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	if (qpTestLog_endSampleList(m_log) == DE_FALSE)
 		throw LogWriteFailedError();
 }
@@ -566,6 +605,7 @@ void TestLog::endSampleList (void)
 void TestLog::writeRaw(const char* rawContents)
 {
 	if (m_logSupressed) return;
+	const HarnessPhaseScope phaseScope (HARNESS_PHASE_LOGGING);
 	qpTestLog_writeRaw(m_log, rawContents);
 }
 
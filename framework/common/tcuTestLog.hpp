@@ -106,6 +106,7 @@ public:
 						~TestLog				(void);
 
 	void				writeSessionInfo		(std::string additionalInfo = "");
+	void				setImageStore			(const char* dirName);
 
 	MessageBuilder		operator<<				(const BeginMessageToken&);
 	MessageBuilder		message					(void);
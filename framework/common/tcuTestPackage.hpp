@@ -45,6 +45,7 @@ public:
 		numWarnings		= 0;
 		numWaived		= 0;
 		isComplete		= false;
+		isHarnessProfileRegressed	= false;
 	}
 
 	int		numExecuted;		//!< Total number of cases executed.
@@ -54,6 +55,7 @@ public:
 	int		numWarnings;		//!< Number of QualityWarning / CompatibilityWarning results.
 	int		numWaived;			//!< Number of waived tests.
 	bool	isComplete;			//!< Is run complete.
+	bool	isHarnessProfileRegressed;	//!< Did harness profile exceed baseline (--deqp-harness-profile-baseline).
 };
 
 
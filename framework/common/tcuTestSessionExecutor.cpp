@@ -57,10 +57,23 @@ TestSessionExecutor::TestSessionExecutor (TestPackageRoot& root, TestContext& te
 	, m_testStartTime		(0)
 	, m_packageStartTime	(0)
 {
+	const CommandLine& cmdLine = testCtx.getCommandLine();
+
+	if (cmdLine.isHarnessProfileEnabled())
+	{
+		// Read baseline up front so that a bad path fails before the run
+		if (cmdLine.getHarnessProfileBaseline()[0] != 0)
+			m_harnessProfileBaseline = de::MovePtr<HarnessProfile>(new HarnessProfile(readHarnessProfile(cmdLine.getHarnessProfileBaseline())));
+
+		beginHarnessProfile();
+	}
 }
 
 TestSessionExecutor::~TestSessionExecutor (void)
 {
+	// Session was not finished, discard partial profile
+	if (isHarnessProfileActive())
+		endHarnessProfile();
 }
 
 bool TestSessionExecutor::iterate (void)
@@ -119,13 +132,17 @@ bool TestSessionExecutor::iterate (void)
 							break;
 					}
 
-					m_iterator.next();
+					{
+						const HarnessPhaseScope phaseScope (HARNESS_PHASE_HIERARCHY);
+						m_iterator.next();
+					}
 					break;
 				}
 				else
 				{
 					DE_ASSERT(hierIterState == TestHierarchyIterator::STATE_FINISHED);
 					m_status.isComplete = true;
+					finishHarnessProfile();
 					return false;
 				}
 			}
@@ -150,6 +167,7 @@ bool TestSessionExecutor::iterate (void)
 		}
 	}
 
+	finishHarnessProfile();
 	return false;
 }
 
@@ -157,14 +175,20 @@ void TestSessionExecutor::enterTestPackage (TestPackage* testPackage)
 {
 	// Create test case wrapper
 	DE_ASSERT(!m_caseExecutor);
-	m_caseExecutor = de::MovePtr<TestCaseExecutor>(testPackage->createExecutor());
+	{
+		const HarnessPhaseScope phaseScope (HARNESS_PHASE_CONTEXT_SETUP);
+		m_caseExecutor = de::MovePtr<TestCaseExecutor>(testPackage->createExecutor());
+	}
 	m_packageStartTime	= deGetMicroseconds();
 }
 
 void TestSessionExecutor::leaveTestPackage (TestPackage* testPackage)
 {
 	DE_UNREF(testPackage);
-	m_caseExecutor->deinitTestPackage(m_testCtx);
+	{
+		const HarnessPhaseScope phaseScope (HARNESS_PHASE_CONTEXT_SETUP);
+		m_caseExecutor->deinitTestPackage(m_testCtx);
+	}
 	// If m_caseExecutor uses local status then it may perform some tests in deinitTestPackage(). We have to update TestSessionExecutor::m_status
 	if (m_caseExecutor->usesLocalStatus())
 		m_caseExecutor->updateGlobalStatus(m_status);
@@ -175,7 +199,10 @@ void TestSessionExecutor::leaveTestPackage (TestPackage* testPackage)
 	if (!std::string(m_testCtx.getCommandLine().getServerAddress()).empty())
 		m_caseExecutor->reportDurations(m_testCtx, std::string(testPackage->getName()), duration, m_groupsDurationTime);
 
-	m_caseExecutor.clear();
+	{
+		const HarnessPhaseScope phaseScope (HARNESS_PHASE_CONTEXT_SETUP);
+		m_caseExecutor.clear();
+	}
 
 	if (!std::string(m_testCtx.getCommandLine().getServerAddress()).empty())
 	{
@@ -221,6 +248,7 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 
 	try
 	{
+		const HarnessPhaseScope phaseScope (HARNESS_PHASE_CASE);
 		m_caseExecutor->init(testCase, casePath);
 		initOk = true;
 	}
@@ -257,6 +285,7 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 	// De-init case.
 	try
 	{
+		const HarnessPhaseScope phaseScope (HARNESS_PHASE_CASE);
 		m_caseExecutor->deinit(testCase);
 	}
 	catch (const tcu::Exception& e)
@@ -311,9 +340,12 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 			m_caseExecutor->updateGlobalStatus(m_status);
 		}
 
-		// terminateAfter, Resource error or any error in deinit means that execution should end
+		countHarnessProfileCase();
+
+		// terminateAfter, Resource error or any error in deinit means that execution should end.
+		// Failures are expected when profiling the harness on a null driver, so they never terminate a profiling run.
 		if (terminateAfter || testResult == QP_TEST_RESULT_RESOURCE_ERROR ||
-			(m_status.numFailed > 0 && m_testCtx.getCommandLine().isTerminateOnFailEnabled()))
+			(m_status.numFailed > 0 && m_testCtx.getCommandLine().isTerminateOnFailEnabled() && !m_testCtx.getCommandLine().isHarnessProfileEnabled()))
 
 			m_abortSession = true;
 	}
@@ -331,6 +363,7 @@ TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase
 
 	try
 	{
+		const HarnessPhaseScope phaseScope (HARNESS_PHASE_CASE);
 		iterateResult = m_caseExecutor->iterate(testCase);
 	}
 	catch (const std::bad_alloc&)
@@ -353,4 +386,20 @@ TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase
 	return iterateResult;
 }
 
+void TestSessionExecutor::finishHarnessProfile (void)
+{
+	if (!isHarnessProfileActive())
+		return;
+
+	endHarnessProfile();
+
+	const CommandLine&		cmdLine		= m_testCtx.getCommandLine();
+	const HarnessProfile	profile		= getHarnessProfile();
+
+	if (cmdLine.getHarnessProfileOutput()[0] != 0)
+		writeHarnessProfile(cmdLine.getHarnessProfileOutput(), profile);
+
+	m_status.isHarnessProfileRegressed = printHarnessProfileSummary(profile, m_harnessProfileBaseline.get(), cmdLine.getHarnessProfileThreshold());
+}
+
 } // tcu
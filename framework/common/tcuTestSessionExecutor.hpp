@@ -28,6 +28,7 @@
 #include "tcuTestCase.hpp"
 #include "tcuTestPackage.hpp"
 #include "tcuTestHierarchyIterator.hpp"
+#include "tcuHarnessProfile.hpp"
 #include "deUniquePtr.hpp"
 #include <map>
 
@@ -56,6 +57,8 @@ private:
 	TestCase::IterateResult			iterateTestCase				(TestCase* testCase);
 	void							leaveTestCase				(TestCase* testCase);
 
+	void							finishHarnessProfile		(void);
+
 	enum State
 	{
 		STATE_TRAVERSE_HIERARCHY = 0,
@@ -78,6 +81,7 @@ private:
 	deUint64						m_testStartTime;
 	deUint64						m_packageStartTime;
 	std::map<std::string, deUint64>	m_groupsDurationTime;
+	de::MovePtr<HarnessProfile>		m_harnessProfileBaseline;
 };
 
 } // tcu
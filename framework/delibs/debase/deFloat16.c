@@ -23,6 +23,15 @@
 
 #include "deFloat16.h"
 
+/* \todo [2026-10-18] NEON path is opt-in with DE_FLOAT16_ENABLE_NEON until deFloat16_selfTest() has been run with it on ARM. */
+#if (DE_CPU == DE_CPU_X86_64) || ((DE_CPU == DE_CPU_X86) && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#	define DE_FLOAT16_USE_SSE2 1
+#	include <emmintrin.h>
+#elif defined(DE_FLOAT16_ENABLE_NEON) && ((DE_CPU == DE_CPU_ARM_64) || ((DE_CPU == DE_CPU_ARM) && defined(__ARM_NEON)))
+#	define DE_FLOAT16_USE_NEON 1
+#	include <arm_neon.h>
+#endif
+
 DE_BEGIN_EXTERN_C
 
 deFloat16 deFloat32To16 (float val32)
@@ -329,6 +338,100 @@ deFloat16 deFloat32To16Round (float val32, deRoundingMode mode)
 	return (deFloat16) 0;
 }
 
+/* Vector paths for array conversions use integer arithmetic only, so that
+ * the results do not depend on the FP environment (DAZ/FTZ, default NaN)
+ * and stay bit exact with the scalar functions. Hardware half conversion
+ * instructions (F16C, NEON FCVT) quiet signaling NaNs and are not used.
+ */
+
+#if defined(DE_FLOAT16_USE_SSE2)
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Convert four floats to 16 bit if all of them are zero or in the
+ *        normalized 16-bit range.
+ * \return DE_FALSE if any element needs the scalar path; dst is not written then.
+ *//*--------------------------------------------------------------------*/
+static deBool float32To16x4 (deFloat16* dst, const float* src, deBool roundToZero)
+{
+	const __m128i	bits		= _mm_loadu_si128((const __m128i*)src);
+	const __m128i	absBits		= _mm_and_si128(bits, _mm_set1_epi32(0x7fffffff));
+	const __m128i	sign		= _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+	const __m128i	isZero		= _mm_cmpeq_epi32(absBits, _mm_setzero_si128());
+	/* 32-bit exponent in [113, 142], i.e. 16-bit exponent in [1, 30]. */
+	const __m128i	inRange		= _mm_andnot_si128(_mm_cmplt_epi32(absBits, _mm_set1_epi32(113 << 23)), _mm_cmplt_epi32(absBits, _mm_set1_epi32(143 << 23)));
+	__m128i			rebiased;
+	__m128i			result;
+
+	if (_mm_movemask_epi8(_mm_or_si128(isZero, inRange)) != 0xffff)
+		return DE_FALSE;
+
+	rebiased = _mm_sub_epi32(absBits, _mm_set1_epi32(112 << 23));
+
+	/* Same as roundToNearestEven(); carry into exponent turns the largest values into Inf. */
+	if (!roundToZero)
+		rebiased = _mm_add_epi32(rebiased, _mm_add_epi32(_mm_set1_epi32(0xfff), _mm_and_si128(_mm_srli_epi32(absBits, 13), _mm_set1_epi32(1))));
+
+	result = _mm_or_si128(_mm_andnot_si128(isZero, _mm_srli_epi32(rebiased, 13)), sign);
+
+	/* Pack unsigned 16-bit values with signed saturating pack by moving them to signed range and back. */
+	result = _mm_packs_epi32(_mm_sub_epi32(result, _mm_set1_epi32(0x8000)), _mm_setzero_si128());
+	result = _mm_xor_si128(result, _mm_set1_epi16((short)0x8000));
+
+	_mm_storel_epi64((__m128i*)dst, result);
+	return DE_TRUE;
+}
+
+#elif defined(DE_FLOAT16_USE_NEON)
+
+static deBool float32To16x4 (deFloat16* dst, const float* src, deBool roundToZero)
+{
+	const uint32x4_t	bits		= vld1q_u32((const deUint32*)src);
+	const uint32x4_t	absBits		= vandq_u32(bits, vdupq_n_u32(0x7fffffffu));
+	const uint32x4_t	sign		= vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(0x8000u));
+	const uint32x4_t	isZero		= vceqq_u32(absBits, vdupq_n_u32(0u));
+	const uint32x4_t	inRange		= vandq_u32(vcgeq_u32(absBits, vdupq_n_u32(113u << 23)), vcltq_u32(absBits, vdupq_n_u32(143u << 23)));
+	const uint32x4_t	isFast		= vorrq_u32(isZero, inRange);
+	const uint32x2_t	isFast2		= vand_u32(vget_low_u32(isFast), vget_high_u32(isFast));
+	uint32x4_t			rebiased;
+
+	if ((vget_lane_u32(isFast2, 0) & vget_lane_u32(isFast2, 1)) == 0u)
+		return DE_FALSE;
+
+	rebiased = vsubq_u32(absBits, vdupq_n_u32(112u << 23));
+
+	if (!roundToZero)
+		rebiased = vaddq_u32(rebiased, vaddq_u32(vdupq_n_u32(0xfffu), vandq_u32(vshrq_n_u32(absBits, 13), vdupq_n_u32(1u))));
+
+	vst1_u16(dst, vmovn_u32(vorrq_u32(vbicq_u32(vshrq_n_u32(rebiased, 13), isZero), sign)));
+	return DE_TRUE;
+}
+
+#endif
+
+void deFloat32To16RoundArray (deFloat16* dst, const float* src, size_t count, deRoundingMode mode)
+{
+	size_t ndx = 0;
+
+	DE_ASSERT(mode == DE_ROUNDINGMODE_TO_ZERO || mode == DE_ROUNDINGMODE_TO_NEAREST_EVEN);
+
+#if defined(DE_FLOAT16_USE_SSE2) || defined(DE_FLOAT16_USE_NEON)
+	for (; ndx + 4 <= count; ndx += 4)
+	{
+		if (!float32To16x4(dst + ndx, src + ndx, mode == DE_ROUNDINGMODE_TO_ZERO))
+		{
+			size_t laneNdx;
+
+			/* Zeros, denormals, Inf, NaN, overflow or underflow in this group. */
+			for (laneNdx = ndx; laneNdx < ndx + 4; laneNdx++)
+				dst[laneNdx] = deFloat32To16Round(src[laneNdx], mode);
+		}
+	}
+#endif
+
+	for (; ndx < count; ndx++)
+		dst[ndx] = deFloat32To16Round(src[ndx], mode);
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Round the given number `val` to nearest even by discarding
  *        the last `numBitsToDiscard` bits.
@@ -548,6 +651,71 @@ float deFloat16To32 (deFloat16 val16)
 	return x.f;
 }
 
+/* All 16-bit values are handled by the vector paths:
+ * * Normalized values and Inf/NaN are shifted in place and rebiased, Inf/NaN twice to move exponent 0x1f to 0xff.
+ * * Denormalized values are normalized 32-bit floats. Value is computed exactly as
+ *   2^-14 * (1 + m / 1024) - 2^-14, where both operands and the result are normalized floats.
+ * * Zeros are masked to keep the result independent of the current rounding mode.
+ */
+
+#if defined(DE_FLOAT16_USE_SSE2)
+
+static void float16To32x4 (float* dst, const deFloat16* src)
+{
+	const __m128i	halfs		= _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)src), _mm_setzero_si128());
+	const __m128i	sign		= _mm_slli_epi32(_mm_and_si128(halfs, _mm_set1_epi32(0x8000)), 16);
+	const __m128i	expMant		= _mm_and_si128(halfs, _mm_set1_epi32(0x7fff));
+	const __m128i	exponent	= _mm_and_si128(halfs, _mm_set1_epi32(0x7c00));
+	const __m128i	isInfNan	= _mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x7c00));
+	const __m128i	isDenorm	= _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+	const __m128i	isZero		= _mm_cmpeq_epi32(expMant, _mm_setzero_si128());
+	__m128i			bits		= _mm_add_epi32(_mm_slli_epi32(expMant, 13), _mm_set1_epi32(112 << 23));
+	__m128i			denorm;
+
+	bits	= _mm_add_epi32(bits, _mm_and_si128(isInfNan, _mm_set1_epi32(112 << 23)));
+	denorm	= _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))), _mm_castsi128_ps(_mm_set1_epi32(113 << 23))));
+	bits	= _mm_or_si128(_mm_and_si128(isDenorm, denorm), _mm_andnot_si128(isDenorm, bits));
+	bits	= _mm_andnot_si128(isZero, bits);
+
+	_mm_storeu_si128((__m128i*)dst, _mm_or_si128(bits, sign));
+}
+
+#elif defined(DE_FLOAT16_USE_NEON)
+
+static void float16To32x4 (float* dst, const deFloat16* src)
+{
+	const uint32x4_t	halfs		= vmovl_u16(vld1_u16(src));
+	const uint32x4_t	sign		= vshlq_n_u32(vandq_u32(halfs, vdupq_n_u32(0x8000u)), 16);
+	const uint32x4_t	expMant		= vandq_u32(halfs, vdupq_n_u32(0x7fffu));
+	const uint32x4_t	exponent	= vandq_u32(halfs, vdupq_n_u32(0x7c00u));
+	const uint32x4_t	isInfNan	= vceqq_u32(exponent, vdupq_n_u32(0x7c00u));
+	const uint32x4_t	isDenorm	= vceqq_u32(exponent, vdupq_n_u32(0u));
+	const uint32x4_t	isZero		= vceqq_u32(expMant, vdupq_n_u32(0u));
+	uint32x4_t			bits		= vaddq_u32(vshlq_n_u32(expMant, 13), vdupq_n_u32(112u << 23));
+	uint32x4_t			denorm;
+
+	bits	= vaddq_u32(bits, vandq_u32(isInfNan, vdupq_n_u32(112u << 23)));
+	denorm	= vreinterpretq_u32_f32(vsubq_f32(vreinterpretq_f32_u32(vaddq_u32(bits, vdupq_n_u32(1u << 23))), vreinterpretq_f32_u32(vdupq_n_u32(113u << 23))));
+	bits	= vbicq_u32(vbslq_u32(isDenorm, denorm, bits), isZero);
+
+	vst1q_u32((deUint32*)dst, vorrq_u32(bits, sign));
+}
+
+#endif
+
+void deFloat16To32Array (float* dst, const deFloat16* src, size_t count)
+{
+	size_t ndx = 0;
+
+#if defined(DE_FLOAT16_USE_SSE2) || defined(DE_FLOAT16_USE_NEON)
+	for (; ndx + 4 <= count; ndx += 4)
+		float16To32x4(dst + ndx, src + ndx);
+#endif
+
+	for (; ndx < count; ndx++)
+		dst[ndx] = deFloat16To32(src[ndx]);
+}
+
 double deFloat16To64 (deFloat16 val16)
 {
 	deUint64 sign;
@@ -43,6 +43,17 @@ deFloat16	deFloat32To16				(float val32);
 deFloat16	deFloat32To16Round			(float val32, deRoundingMode mode);
 void		deFloat16_selfTest			(void);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Convert array of 32-bit floating point numbers to 16 bit.
+ * \param dst	Output array of count elements.
+ * \param src	Input array of count elements.
+ * \param count	Number of elements.
+ * \param mode	Rounding mode, as in deFloat32To16Round().
+ *
+ * Result is bit exact with calling deFloat32To16Round() for each element.
+ *//*--------------------------------------------------------------------*/
+void		deFloat32To16RoundArray		(deFloat16* dst, const float* src, size_t count, deRoundingMode mode);
+
 deFloat16	deFloat64To16				(double val64);
 deFloat16	deFloat64To16Round			(double val64, deRoundingMode mode);
 
@@ -53,6 +64,16 @@ deFloat16	deFloat64To16Round			(double val64, deRoundingMode mode);
  *//*--------------------------------------------------------------------*/
 float		deFloat16To32		(deFloat16 val16);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Convert array of 16-bit floating point numbers to 32 bit.
+ * \param dst	Output array of count elements.
+ * \param src	Input array of count elements.
+ * \param count	Number of elements.
+ *
+ * Result is bit exact with calling deFloat16To32() for each element.
+ *//*--------------------------------------------------------------------*/
+void		deFloat16To32Array	(float* dst, const deFloat16* src, size_t count);
+
 /*--------------------------------------------------------------------*//*!
  * \brief Convert 16-bit floating point number to 64 bit.
  * \param val16	Input value.
@@ -23,6 +23,7 @@
 
 #include "deFloat16.h"
 #include "deRandom.h"
+#include "deInt32.h"
 
 DE_BEGIN_EXTERN_C
 
@@ -55,6 +56,78 @@ static deFloat16 deFloat32To16RTE (float val32)
 	return deFloat32To16Round(val32, DE_ROUNDINGMODE_TO_NEAREST_EVEN);
 }
 
+static deUint32 getFloat32Bits (float val32)
+{
+	union
+	{
+		float		f;
+		deUint32	u;
+	} x;
+
+	x.f = val32;
+
+	return x.u;
+}
+
+static void testArrayConversions (deRandom* rnd)
+{
+	enum
+	{
+		ARRAY_SIZE	= 64 + 3	/* Not a multiple of vector width */
+	};
+
+	float		floats[ARRAY_SIZE];
+	deFloat16	halfs[ARRAY_SIZE];
+	deUint32	halfBits;
+	int			iter;
+	int			ndx;
+
+	/* 16-bit to 32-bit: all values. */
+	for (halfBits = 0; halfBits <= 0xffffu; halfBits += ARRAY_SIZE)
+	{
+		const int count = deMin32(ARRAY_SIZE, (int)(0x10000u - halfBits));
+
+		for (ndx = 0; ndx < count; ++ndx)
+			halfs[ndx] = (deFloat16)(halfBits + (deUint32)ndx);
+
+		deFloat16To32Array(floats, halfs, (size_t)count);
+
+		for (ndx = 0; ndx < count; ++ndx)
+			DE_TEST_ASSERT(getFloat32Bits(floats[ndx]) == getFloat32Bits(deFloat16To32(halfs[ndx])));
+	}
+
+	/* 32-bit to 16-bit: mostly values in 16-bit range, with zeros, denormals, Inf, NaN and out of range values mixed in. */
+	for (iter = 0; iter < 256; ++iter)
+	{
+		for (ndx = 0; ndx < ARRAY_SIZE; ++ndx)
+		{
+			const deUint32	sign		= deRandom_getUint32(rnd) & 1u;
+			const deUint32	mantissa	= deRandom_getUint32(rnd) & 0x7fffffu;
+			const deUint32	choice		= deRandom_getUint32(rnd) % 16u;
+			deUint32		exponent;
+
+			if (choice == 0)
+				exponent = 0;
+			else if (choice == 1)
+				exponent = 0xff;
+			else if (choice == 2)
+				exponent = deRandom_getUint32(rnd) % 0xff;
+			else
+				exponent = 127 - 26 + deRandom_getUint32(rnd) % (26 + 17);	/* Around the 16-bit range, including both edges */
+
+			floats[ndx] = getFloat32(sign, exponent, (choice == 3) ? 0u : mantissa);
+		}
+
+		deFloat32To16RoundArray(halfs, floats, ARRAY_SIZE, DE_ROUNDINGMODE_TO_ZERO);
+		for (ndx = 0; ndx < ARRAY_SIZE; ++ndx)
+			DE_TEST_ASSERT(halfs[ndx] == deFloat32To16RTZ(floats[ndx]));
+
+		deFloat32To16RoundArray(halfs, floats, ARRAY_SIZE, DE_ROUNDINGMODE_TO_NEAREST_EVEN);
+		for (ndx = 0; ndx < ARRAY_SIZE; ++ndx)
+			DE_TEST_ASSERT(halfs[ndx] == deFloat32To16RTE(floats[ndx]));
+	}
+}
+
 void deFloat16_selfTest (void)
 {
 	/* 16-bit: 1	5 (0x00--0x1f)	10 (0x000--0x3ff)
@@ -330,6 +403,8 @@ void deFloat16_selfTest (void)
 		DE_TEST_ASSERT(deFloat32To16RTE(getFloat32(0, exponent, mantissa)) == getFloat16(0, 0x1f, 0));
 		DE_TEST_ASSERT(deFloat32To16RTE(getFloat32(1, exponent, mantissa)) == getFloat16(1, 0x1f, 0));
 	}
+
+	testArrayConversions(&rnd);
 }
 
 DE_END_EXTERN_C
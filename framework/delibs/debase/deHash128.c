@@ -0,0 +1,534 @@
+/*-------------------------------------------------------------------------
+ * drawElements Base Portability Library
+ * -------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Fast non-cryptographic 128-bit hash.
+ *//*--------------------------------------------------------------------*/
+
+#include "deHash128.h"
+
+#include "deMemory.h"
+
+#include <string.h>
+
+#if ((DE_CPU == DE_CPU_X86_64) && (defined(__SSE2__) || defined(_M_X64))) || ((DE_CPU == DE_CPU_X86) && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#	define DE_HASH128_USE_SSE2 1
+#	include <emmintrin.h>
+#endif
+
+DE_BEGIN_EXTERN_C
+
+enum
+{
+	STRIPES_PER_BLOCK	= 16,
+	NUM_KEYS			= STRIPES_PER_BLOCK + DE_HASH128_NUM_LANES
+};
+
+#define PRIME32_1	0x9E3779B1u
+#define PRIME64_1	0x9E3779B185EBCA87u
+#define PRIME64_2	0xC2B2AE3D27D4EB4Fu
+#define AVALANCHE	0x165667919E3779F9u
+
+/* Stripe n of a block uses keys [n, n + 8). Generated with splitmix64. */
+static const deUint64 s_keys[NUM_KEYS] =
+{
+	0x1ac046dda8e86e2au, 0xbe2c3b00b1d348c8u, 0x9b1a66a95412ff75u, 0xc448c2b1f05f7e4cu,
+	0xc111ca6b8f6e73c4u, 0xb54861920d05b01du, 0x8d61500f4a7bbe16u, 0x5e0c25471f89e02eu,
+	0x48105a3d28f0e221u, 0x2169f8846b637746u, 0x3d628782e0c0d863u, 0xa5ddb2216078aa40u,
+	0xc8119d17f0571101u, 0x98e2e2eb8f33280fu, 0x8cd1e28860679cc4u, 0x9dca6189c923aef3u,
+	0x9d8d3071ba4f04c4u, 0x5d395ada34220c26u, 0xe6de42a441a1e28eu, 0x308fbf68cc864f59u,
+	0x216a3c81332862f9u, 0xbaceca0a77f3132eu, 0xdf2a2215339ca69cu, 0x3e4c11a103a5d859u,
+};
+
+static const deUint64 s_initialAcc[DE_HASH128_NUM_LANES] =
+{
+	0x00000000C2B2AE3Du, 0x9E3779B185EBCA87u, 0xC2B2AE3D27D4EB4Fu, 0x165667B19E3779F9u,
+	0x85EBCA77C2B2AE63u, 0x0000000085EBCA77u, 0x27D4EB2F165667C5u, 0x000000009E3779B1u,
+};
+
+/* Fold 128-bit product of a and b to 64 bits. */
+static deUint64 mulFold64 (deUint64 a, deUint64 b)
+{
+#if defined(__SIZEOF_INT128__)
+	const unsigned __int128 product = (unsigned __int128)a * b;
+	return (deUint64)product ^ (deUint64)(product >> 64);
+#else
+	const deUint64	aLo		= a & 0xFFFFFFFFu;
+	const deUint64	aHi		= a >> 32;
+	const deUint64	bLo		= b & 0xFFFFFFFFu;
+	const deUint64	bHi		= b >> 32;
+	const deUint64	loLo	= aLo * bLo;
+	const deUint64	hiLo	= aHi * bLo;
+	const deUint64	loHi	= aLo * bHi;
+	const deUint64	hiHi	= aHi * bHi;
+	const deUint64	cross	= (loLo >> 32) + (hiLo & 0xFFFFFFFFu) + loHi;
+	const deUint64	upper	= (hiLo >> 32) + (cross >> 32) + hiHi;
+	const deUint64	lower	= (cross << 32) | (loLo & 0xFFFFFFFFu);
+
+	return lower ^ upper;
+#endif
+}
+
+static deUint64 avalanche (deUint64 h)
+{
+	h ^= h >> 37;
+	h *= AVALANCHE;
+	h ^= h >> 32;
+	return h;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Accumulate consecutive stripes
+ *
+ * For each lane: acc[n^1] += data[n], acc[n] += lo32(data[n]^key[n]) * hi32(data[n]^key[n])
+ *//*--------------------------------------------------------------------*/
+#if defined(DE_HASH128_USE_SSE2)
+
+static void accumulateStripes (deUint64* acc, const deUint8* data, deUint32 firstStripe, deUint32 numStripes)
+{
+	__m128i		vacc[DE_HASH128_NUM_LANES / 2];
+	deUint32	stripeNdx;
+	int			ndx;
+
+	for (ndx = 0; ndx < DE_HASH128_NUM_LANES / 2; ndx++)
+		vacc[ndx] = _mm_loadu_si128((const __m128i*)(acc + 2 * ndx));
+
+	for (stripeNdx = 0; stripeNdx < numStripes; stripeNdx++)
+	{
+		const deUint8* const	stripe	= data + stripeNdx * DE_HASH128_STRIPE_SIZE;
+		const deUint64* const	keys	= s_keys + firstStripe + stripeNdx;
+
+		for (ndx = 0; ndx < DE_HASH128_NUM_LANES / 2; ndx++)
+		{
+			const __m128i	value		= _mm_loadu_si128((const __m128i*)(stripe + 16 * ndx));
+			const __m128i	keyed		= _mm_xor_si128(value, _mm_loadu_si128((const __m128i*)(keys + 2 * ndx)));
+			const __m128i	keyedHigh	= _mm_shuffle_epi32(keyed, _MM_SHUFFLE(3, 3, 1, 1));
+			const __m128i	product		= _mm_mul_epu32(keyed, keyedHigh);
+			const __m128i	swapped		= _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+
+			vacc[ndx] = _mm_add_epi64(vacc[ndx], _mm_add_epi64(product, swapped));
+		}
+	}
+
+	for (ndx = 0; ndx < DE_HASH128_NUM_LANES / 2; ndx++)
+		_mm_storeu_si128((__m128i*)(acc + 2 * ndx), vacc[ndx]);
+}
+
+#else
+
+static deUint64 readUint64 (const deUint8* ptr)
+{
+#if (DE_ENDIANNESS == DE_LITTLE_ENDIAN)
+	deUint64 value;
+	memcpy(&value, ptr, sizeof(value));
+	return value;
+#else
+	return (deUint64)ptr[0]			| ((deUint64)ptr[1] << 8)	| ((deUint64)ptr[2] << 16)	| ((deUint64)ptr[3] << 24) |
+		   ((deUint64)ptr[4] << 32)	| ((deUint64)ptr[5] << 40)	| ((deUint64)ptr[6] << 48)	| ((deUint64)ptr[7] << 56);
+#endif
+}
+
+static void accumulateStripes (deUint64* acc, const deUint8* data, deUint32 firstStripe, deUint32 numStripes)
+{
+	deUint32 stripeNdx;
+
+	for (stripeNdx = 0; stripeNdx < numStripes; stripeNdx++)
+	{
+		const deUint8* const	stripe	= data + stripeNdx * DE_HASH128_STRIPE_SIZE;
+		const deUint64* const	keys	= s_keys + firstStripe + stripeNdx;
+		int						ndx;
+
+		for (ndx = 0; ndx < DE_HASH128_NUM_LANES; ndx++)
+		{
+			const deUint64	value	= readUint64(stripe + 8 * ndx);
+			const deUint64	keyed	= value ^ keys[ndx];
+
+			acc[ndx ^ 1]	+= value;
+			acc[ndx]		+= (keyed & 0xFFFFFFFFu) * (keyed >> 32);
+		}
+	}
+}
+
+#endif
+
+static void scramble (deUint64* acc)
+{
+	int ndx;
+
+	for (ndx = 0; ndx < DE_HASH128_NUM_LANES; ndx++)
+	{
+		deUint64 a = acc[ndx];
+
+		a ^= a >> 47;
+		a ^= s_keys[STRIPES_PER_BLOCK + ndx];
+		a *= PRIME32_1;
+
+		acc[ndx] = a;
+	}
+}
+
+/* Accumulate whole stripes, scrambling at block boundaries. */
+static void consumeStripes (deUint64* acc, deUint32* numStripesInBlock, const deUint8* data, size_t numStripes)
+{
+	while (numStripes > 0)
+	{
+		const size_t	blockSpace	= (size_t)(STRIPES_PER_BLOCK - *numStripesInBlock);
+		const deUint32	count		= (deUint32)(numStripes < blockSpace ? numStripes : blockSpace);
+
+		accumulateStripes(acc, data, *numStripesInBlock, count);
+
+		data				+= count * DE_HASH128_STRIPE_SIZE;
+		numStripes			-= count;
+		*numStripesInBlock	+= count;
+
+		if (*numStripesInBlock == STRIPES_PER_BLOCK)
+		{
+			scramble(acc);
+			*numStripesInBlock = 0;
+		}
+	}
+}
+
+void deHash128Stream_init (deHash128Stream* stream)
+{
+	deHash128Stream_initWithSeed(stream, 0);
+}
+
+void deHash128Stream_initWithSeed (deHash128Stream* stream, deUint64 seed)
+{
+	int ndx;
+
+	for (ndx = 0; ndx < DE_HASH128_NUM_LANES; ndx++)
+		stream->acc[ndx] = (ndx % 2 == 0) ? s_initialAcc[ndx] + seed : s_initialAcc[ndx] - seed;
+
+	stream->size		= 0;
+	stream->numStripes	= 0;
+	stream->bufferSize	= 0;
+}
+
+void deHash128Stream_process (deHash128Stream* stream, size_t size, const void* data_)
+{
+	const deUint8* data = (const deUint8*)data_;
+
+	stream->size += size;
+
+	while (size > 0)
+	{
+		if (stream->bufferSize == 0 && size >= DE_HASH128_STRIPE_SIZE)
+		{
+			/* Whole stripes directly from input. */
+			const size_t numStripes = size / DE_HASH128_STRIPE_SIZE;
+
+			consumeStripes(stream->acc, &stream->numStripes, data, numStripes);
+
+			data	+= numStripes * DE_HASH128_STRIPE_SIZE;
+			size	-= numStripes * DE_HASH128_STRIPE_SIZE;
+		}
+		else
+		{
+			const size_t spaceLeft	= (size_t)(DE_HASH128_STRIPE_SIZE - stream->bufferSize);
+			const size_t count		= size < spaceLeft ? size : spaceLeft;
+
+			deMemcpy(stream->buffer + stream->bufferSize, data, count);
+
+			stream->bufferSize	+= (deUint32)count;
+			data				+= count;
+			size				-= count;
+
+			if (stream->bufferSize == DE_HASH128_STRIPE_SIZE)
+			{
+				consumeStripes(stream->acc, &stream->numStripes, stream->buffer, 1);
+				stream->bufferSize = 0;
+			}
+		}
+	}
+}
+
+void deHash128Stream_finalize (const deHash128Stream* stream, deHash128* hash)
+{
+	deUint64	acc[DE_HASH128_NUM_LANES];
+	deUint32	numStripes	= stream->numStripes;
+	deUint64	low			= stream->size * PRIME64_1;
+	deUint64	high		= ~(stream->size * PRIME64_2);
+	int			ndx;
+
+	deMemcpy(acc, stream->acc, sizeof(acc));
+
+	/* Partial last stripe is zero-padded, length is mixed in below. */
+	if (stream->bufferSize > 0)
+	{
+		deUint8 lastStripe[DE_HASH128_STRIPE_SIZE];
+
+		deMemset(lastStripe, 0, sizeof(lastStripe));
+		deMemcpy(lastStripe, stream->buffer, stream->bufferSize);
+
+		consumeStripes(acc, &numStripes, lastStripe, 1);
+	}
+
+	for (ndx = 0; ndx < DE_HASH128_NUM_LANES; ndx += 2)
+	{
+		low		+= mulFold64(acc[ndx] ^ s_keys[ndx], acc[ndx + 1] ^ s_keys[ndx + 1]);
+		high	+= mulFold64(acc[ndx + 1] ^ s_keys[ndx + 9], acc[(ndx + 2) % DE_HASH128_NUM_LANES] ^ s_keys[ndx + 10]);
+	}
+
+	hash->low	= avalanche(low);
+	hash->high	= avalanche(high ^ (low >> 29));
+}
+
+void deHash128_compute (deHash128* hash, size_t size, const void* data)
+{
+	deHash128Stream stream;
+
+	deHash128Stream_init(&stream);
+	deHash128Stream_process(&stream, size, data);
+	deHash128Stream_finalize(&stream, hash);
+}
+
+void deHash128_render (const deHash128* hash, char* buffer)
+{
+	int charNdx;
+
+	for (charNdx = 0; charNdx < 32; charNdx++)
+	{
+		const deUint64	val64	= charNdx < 16 ? hash->high : hash->low;
+		const deUint8	val4	= (deUint8)(0x0fu & (val64 >> (4 * (16 - 1 - (charNdx % 16)))));
+
+		if (val4 < 10)
+			buffer[charNdx] = (char)('0' + val4);
+		else
+			buffer[charNdx] = (char)('a' + val4 - 10);
+	}
+}
+
+deBool deHash128_parse (deHash128* hash, const char* buffer)
+{
+	int charNdx;
+
+	hash->low	= 0;
+	hash->high	= 0;
+
+	for (charNdx = 0; charNdx < 32; charNdx++)
+	{
+		deUint64 val4;
+
+		if (buffer[charNdx] >= '0' && buffer[charNdx] <= '9')
+			val4 = (deUint64)(buffer[charNdx] - '0');
+		else if (buffer[charNdx] >= 'a' && buffer[charNdx] <= 'f')
+			val4 = (deUint64)(10 + (buffer[charNdx] - 'a'));
+		else if (buffer[charNdx] >= 'A' && buffer[charNdx] <= 'F')
+			val4 = (deUint64)(10 + (buffer[charNdx] - 'A'));
+		else
+			return DE_FALSE;
+
+		if (charNdx < 16)
+			hash->high |= val4 << (4 * (16 - 1 - charNdx));
+		else
+			hash->low |= val4 << (4 * (16 - 1 - (charNdx - 16)));
+	}
+
+	return DE_TRUE;
+}
+
+deBool deHash128_equal (const deHash128* a, const deHash128* b)
+{
+	return a->low == b->low && a->high == b->high;
+}
+
+static void fillTestData (deUint8* dst, size_t size)
+{
+	size_t ndx;
+
+	for (ndx = 0; ndx < size; ndx++)
+		dst[ndx] = (deUint8)(ndx * 31u + 7u);
+}
+
+void deHash128_selfTest (void)
+{
+	const char* const invalidHashStrings[] =
+	{
+		" a54e335926f48aafabb400f153ba83d",
+		"ca54e335926f48aaxabb400f153ba83d",
+		"ca54e335926f48aafabb400f153ba83 ",
+		"ca54e335926f48a\0fabb400f153ba83d",
+	};
+
+	const struct
+	{
+		const char* const	hash;
+		const char* const	data;
+	} stringHashPairs[] =
+	{
+		{ "22d158d29950049a6a0e967cc6d42f17", "" },
+		{ "84f0d36212eb90e7dd758c3520c96d0e", "a" },
+		{ "ca54e335926f48aafabb400f153ba83d", "hello" },
+		{ "2b6d3d403370be0435ecae20ed033171", "This message has exactly 56 characters and that's tricky" },
+	};
+
+	/* Sizes around stripe and block boundaries, data from fillTestData(). */
+	const struct
+	{
+		const char* const	hash;
+		size_t				size;
+	} sizeHashPairs[] =
+	{
+		{ "e75591dfd6f2ad33000c363cd442d7c8", 64 },
+		{ "7def9c554249564053d94563d83be22b", 65 },
+		{ "455c6db97c10bb774e4ba8459d700f1c", 1024 },
+		{ "0b55a95d3a0ffdd12ed980910b79d8b7", 1025 },
+		{ "da4fd38f0c4d54c8481c078ddcaa92c1", 5000 },
+	};
+
+	deUint8 data[5000];
+
+	fillTestData(data, sizeof(data));
+
+	/* Test parsing invalid hash strings. */
+	{
+		size_t stringNdx;
+
+		for (stringNdx = 0; stringNdx < DE_LENGTH_OF_ARRAY(invalidHashStrings); stringNdx++)
+		{
+			deHash128 hash;
+			DE_TEST_ASSERT(!deHash128_parse(&hash, invalidHashStrings[stringNdx]));
+		}
+	}
+
+	/* Test hash and render against pre-computed strings. */
+	{
+		size_t ndx;
+
+		for (ndx = 0; ndx < DE_LENGTH_OF_ARRAY(stringHashPairs); ndx++)
+		{
+			deHash128	result;
+			deHash128	reference;
+			char		rendered[32];
+
+			deHash128_compute(&result, strlen(stringHashPairs[ndx].data), stringHashPairs[ndx].data);
+			DE_TEST_ASSERT(deHash128_parse(&reference, stringHashPairs[ndx].hash));
+			DE_TEST_ASSERT(deHash128_equal(&reference, &result));
+
+			deHash128_render(&result, rendered);
+			DE_TEST_ASSERT(strncmp(rendered, stringHashPairs[ndx].hash, 32) == 0);
+		}
+
+		for (ndx = 0; ndx < DE_LENGTH_OF_ARRAY(sizeHashPairs); ndx++)
+		{
+			deHash128 result;
+			deHash128 reference;
+
+			deHash128_compute(&result, sizeHashPairs[ndx].size, data);
+			DE_TEST_ASSERT(deHash128_parse(&reference, sizeHashPairs[ndx].hash));
+			DE_TEST_ASSERT(deHash128_equal(&reference, &result));
+		}
+	}
+
+	/* Streaming with different chunk sizes must match single call. */
+	{
+		const size_t	chunkSizes[]	= { 1, 3, 63, 64, 65, 1000, 1024 };
+		deHash128		reference;
+		size_t			chunkNdx;
+
+		deHash128_compute(&reference, sizeof(data), data);
+
+		for (chunkNdx = 0; chunkNdx < DE_LENGTH_OF_ARRAY(chunkSizes); chunkNdx++)
+		{
+			deHash128Stream	stream;
+			deHash128		result;
+			size_t			offset;
+
+			deHash128Stream_init(&stream);
+
+			for (offset = 0; offset < sizeof(data); offset += chunkSizes[chunkNdx])
+			{
+				const size_t left = sizeof(data) - offset;
+				deHash128Stream_process(&stream, left < chunkSizes[chunkNdx] ? left : chunkSizes[chunkNdx], data + offset);
+			}
+
+			deHash128Stream_finalize(&stream, &result);
+			DE_TEST_ASSERT(deHash128_equal(&reference, &result));
+		}
+	}
+
+	/* Finalize doesn't modify stream. */
+	{
+		deHash128Stream	stream;
+		deHash128		partial;
+		deHash128		partialReference;
+		deHash128		result;
+		deHash128		reference;
+
+		deHash128_compute(&partialReference, 100, data);
+		deHash128_compute(&reference, sizeof(data), data);
+
+		deHash128Stream_init(&stream);
+		deHash128Stream_process(&stream, 100, data);
+		deHash128Stream_finalize(&stream, &partial);
+		deHash128Stream_process(&stream, sizeof(data) - 100, data + 100);
+		deHash128Stream_finalize(&stream, &result);
+
+		DE_TEST_ASSERT(deHash128_equal(&partialReference, &partial));
+		DE_TEST_ASSERT(deHash128_equal(&reference, &result));
+	}
+
+	/* Seeds. */
+	{
+		deHash128Stream	stream;
+		deHash128		unseeded;
+		deHash128		zeroSeed;
+		deHash128		seeded;
+		deHash128		reference;
+
+		DE_TEST_ASSERT(deHash128_parse(&reference, "97f32c1c0b6e1576e24c368ceb1818db"));
+
+		deHash128_compute(&unseeded, 5, "hello");
+
+		deHash128Stream_initWithSeed(&stream, 0);
+		deHash128Stream_process(&stream, 5, "hello");
+		deHash128Stream_finalize(&stream, &zeroSeed);
+
+		deHash128Stream_initWithSeed(&stream, 1);
+		deHash128Stream_process(&stream, 5, "hello");
+		deHash128Stream_finalize(&stream, &seeded);
+
+		DE_TEST_ASSERT(deHash128_equal(&unseeded, &zeroSeed));
+		DE_TEST_ASSERT(!deHash128_equal(&unseeded, &seeded));
+		DE_TEST_ASSERT(deHash128_equal(&reference, &seeded));
+	}
+
+	/* Single bit flips change hash. */
+	{
+		deHash128	reference;
+		size_t		bitNdx;
+
+		deHash128_compute(&reference, 200, data);
+
+		for (bitNdx = 0; bitNdx < 200 * 8; bitNdx++)
+		{
+			deHash128 result;
+
+			data[bitNdx / 8] ^= (deUint8)(1u << (bitNdx % 8));
+			deHash128_compute(&result, 200, data);
+			data[bitNdx / 8] ^= (deUint8)(1u << (bitNdx % 8));
+
+			DE_TEST_ASSERT(!deHash128_equal(&reference, &result));
+		}
+	}
+}
+
+DE_END_EXTERN_C
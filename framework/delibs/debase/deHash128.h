@@ -0,0 +1,84 @@
+#ifndef _DEHASH128_H
+#define _DEHASH128_H
+/*-------------------------------------------------------------------------
+ * drawElements Base Portability Library
+ * -------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Fast non-cryptographic 128-bit hash.
+ *
+ * Input is consumed in 64-byte stripes by eight 64-bit multiply-accumulate
+ * lanes, with SSE2 used where available. Results do not depend on the code
+ * path, host endianness or how the input is split between process calls.
+ * Not suitable for security purposes.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.h"
+
+DE_BEGIN_EXTERN_C
+
+enum
+{
+	DE_HASH128_STRIPE_SIZE	= 64,
+	DE_HASH128_NUM_LANES	= 8
+};
+
+typedef struct deHash128Stream_s
+{
+	deUint64	acc[DE_HASH128_NUM_LANES];
+	deUint64	size;
+	deUint32	numStripes;		/* Stripes accumulated since last scramble. */
+	deUint32	bufferSize;
+	deUint8		buffer[DE_HASH128_STRIPE_SIZE];
+} deHash128Stream;
+
+typedef struct deHash128_s
+{
+	deUint64	low;
+	deUint64	high;
+} deHash128;
+
+/* Initialize hash stream. */
+void	deHash128Stream_init			(deHash128Stream* stream);
+
+/* Initialize hash stream with seed, zero seed is same as deHash128Stream_init(). */
+void	deHash128Stream_initWithSeed	(deHash128Stream* stream, deUint64 seed);
+
+/* Add data to stream. */
+void	deHash128Stream_process			(deHash128Stream* stream, size_t size, const void* data);
+
+/* Output hash of data processed so far. Stream is not modified and can be continued. */
+void	deHash128Stream_finalize		(const deHash128Stream* stream, deHash128* hash);
+
+/* Compute hash from data. */
+void	deHash128_compute				(deHash128* hash, size_t size, const void* data);
+
+/* Render hash as 32 digit hex string, high bits first. */
+void	deHash128_render				(const deHash128* hash, char* buffer);
+
+/* Parse hash from 32 digit hex string. */
+deBool	deHash128_parse					(deHash128* hash, const char* buffer);
+
+/* Compare hashes for equality. */
+deBool	deHash128_equal					(const deHash128* a, const deHash128* b);
+
+void	deHash128_selfTest				(void);
+
+DE_END_EXTERN_C
+
+#endif /* _DEHASH128_H */
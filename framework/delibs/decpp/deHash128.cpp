@@ -0,0 +1,73 @@
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Fast non-cryptographic 128-bit hash
+ *//*--------------------------------------------------------------------*/
+
+#include "deHash128.hpp"
+
+namespace de
+{
+
+Hash128 Hash128::parse (const std::string& str)
+{
+	deHash128 hash;
+
+	DE_CHECK_RUNTIME_ERR_MSG(str.size() >= 32, "Failed to parse Hash128. String is too short.");
+	DE_CHECK_RUNTIME_ERR_MSG(deHash128_parse(&hash, str.c_str()), "Failed to parse Hash128. Invalid characters.");
+
+	return Hash128(hash);
+}
+
+Hash128 Hash128::compute (size_t size, const void* data)
+{
+	deHash128 hash;
+
+	deHash128_compute(&hash, size, data);
+	return Hash128(hash);
+}
+
+std::string Hash128::toString (void) const
+{
+	char buffer[32];
+
+	deHash128_render(&m_hash, buffer);
+	return std::string(buffer, buffer + sizeof(buffer));
+}
+
+Hash128Stream::Hash128Stream (deUint64 seed)
+{
+	deHash128Stream_initWithSeed(&m_stream, seed);
+}
+
+void Hash128Stream::process (size_t size, const void* data)
+{
+	deHash128Stream_process(&m_stream, size, data);
+}
+
+Hash128 Hash128Stream::finalize (void) const
+{
+	deHash128 hash;
+	deHash128Stream_finalize(&m_stream, &hash);
+
+	return Hash128(hash);
+}
+
+} // de
@@ -0,0 +1,131 @@
+#ifndef _DEHASH128_HPP
+#define _DEHASH128_HPP
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Fast non-cryptographic 128-bit hash
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.hpp"
+
+#include "deHash128.h"
+
+#include <string>
+#include <vector>
+
+namespace de
+{
+
+class Hash128
+{
+public:
+					Hash128		(const deHash128& hash) : m_hash(hash) {}
+
+	static Hash128	parse		(const std::string& str);
+	static Hash128	compute		(size_t size, const void* data);
+
+	deUint64		getLow		(void) const { return m_hash.low;	}
+	deUint64		getHigh		(void) const { return m_hash.high;	}
+
+	//! 32 digit hex string, high bits first.
+	std::string		toString	(void) const;
+
+	bool			operator==	(const Hash128& other) const { return deHash128_equal(&m_hash, &other.m_hash) == DE_TRUE; }
+	bool			operator!=	(const Hash128& other) const { return !(*this == other); }
+	bool			operator<	(const Hash128& other) const { return m_hash.high != other.m_hash.high ? m_hash.high < other.m_hash.high : m_hash.low < other.m_hash.low; }
+
+private:
+	deHash128		m_hash;
+};
+
+class Hash128Stream
+{
+public:
+						Hash128Stream	(deUint64 seed = 0);
+	void				process			(size_t size, const void* data);
+
+	//! Hash of data processed so far, stream can be continued.
+	Hash128				finalize		(void) const;
+
+private:
+	deHash128Stream		m_stream;
+};
+
+// Utility functions for building hash from values.
+// \note Same rules as for Sha1Stream: values are serialized in fixed byte
+//       order and vectors and strings include their size.
+
+inline Hash128Stream& operator<< (Hash128Stream& stream, bool b)
+{
+	const deUint8 value = b ? 1 : 0;
+	stream.process(sizeof(value), &value);
+	return stream;
+}
+
+inline Hash128Stream& operator<< (Hash128Stream& stream, deUint32 value)
+{
+	const deUint8 data[] =
+	{
+		(deUint8)(0xFFu & (value >> 0)),
+		(deUint8)(0xFFu & (value >> 8)),
+		(deUint8)(0xFFu & (value >> 16)),
+		(deUint8)(0xFFu & (value >> 24))
+	};
+
+	stream.process(sizeof(data), data);
+	return stream;
+}
+
+inline Hash128Stream& operator<< (Hash128Stream& stream, deInt32 value)
+{
+	return stream << (deUint32)value;
+}
+
+inline Hash128Stream& operator<< (Hash128Stream& stream, deUint64 value)
+{
+	return stream << (deUint32)(value & 0xFFFFFFFFu) << (deUint32)(value >> 32);
+}
+
+inline Hash128Stream& operator<< (Hash128Stream& stream, deInt64 value)
+{
+	return stream << (deUint64)value;
+}
+
+template<typename T>
+inline Hash128Stream& operator<< (Hash128Stream& stream, const std::vector<T>& values)
+{
+	stream << (deUint64)values.size();
+
+	for (size_t ndx = 0; ndx < values.size(); ndx++)
+		stream << values[ndx];
+
+	return stream;
+}
+
+inline Hash128Stream& operator<< (Hash128Stream& stream, const std::string& str)
+{
+	stream << (deUint64)str.size();
+	stream.process(str.size(), str.c_str());
+	return stream;
+}
+
+} // de
+
+#endif // _DEHASH128_HPP
@@ -64,6 +64,10 @@ deUint32		deGetNumTotalPhysicalCores		(void);
 deUint32		deGetNumTotalLogicalCores		(void);
 deUint32		deGetNumAvailableLogicalCores	(void);
 
+/* Logical cores the calling thread may run on, one bit per core. Only the first 64 cores are representable. */
+deBool			deGetCurrentThreadAffinity		(deUint64* coreMask);
+deBool			deSetCurrentThreadAffinity		(deUint64 coreMask);
+
 DE_END_EXTERN_C
 
 #endif /* _DETHREAD_H */
@@ -234,4 +234,49 @@ deUint32 deGetNumTotalPhysicalCores (void)
 	return deGetNumTotalLogicalCores();
 }
 
+#if ((DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID)) && !defined(__FreeBSD__)
+
+deBool deGetCurrentThreadAffinity (deUint64* coreMask)
+{
+	unsigned long	mask	= 0;
+	long			ret;
+
+	DE_STATIC_ASSERT(sizeof(mask) <= sizeof(deUint64));
+
+	/* Raw syscall operates on the calling thread and returns the number of bytes written. */
+	ret = syscall(__NR_sched_getaffinity, 0, sizeof(mask), &mask);
+
+	if (ret <= 0)
+		return DE_FALSE;
+
+	*coreMask = (deUint64)mask;
+	return DE_TRUE;
+}
+
+deBool deSetCurrentThreadAffinity (deUint64 coreMask)
+{
+	const unsigned long	mask	= (unsigned long)coreMask;
+
+	if (mask == 0 || (deUint64)mask != coreMask)
+		return DE_FALSE;
+
+	return syscall(__NR_sched_setaffinity, 0, sizeof(mask), &mask) == 0 ? DE_TRUE : DE_FALSE;
+}
+
+#else
+
+deBool deGetCurrentThreadAffinity (deUint64* coreMask)
+{
+	DE_UNREF(coreMask);
+	return DE_FALSE;
+}
+
+deBool deSetCurrentThreadAffinity (deUint64 coreMask)
+{
+	DE_UNREF(coreMask);
+	return DE_FALSE;
+}
+
+#endif
+
 #endif /* DE_OS */
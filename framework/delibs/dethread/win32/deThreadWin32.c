@@ -216,4 +216,34 @@ deUint32 deGetNumAvailableLogicalCores (void)
 	return deGetNumTotalLogicalCores();
 }
 
+deBool deGetCurrentThreadAffinity (deUint64* coreMask)
+{
+	DWORD_PTR	processMask;
+	DWORD_PTR	systemMask;
+	DWORD_PTR	prevMask;
+
+	/* There is no query for thread affinity, swap in the process mask and restore. */
+	if (!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+		return DE_FALSE;
+
+	prevMask = SetThreadAffinityMask(GetCurrentThread(), processMask);
+	if (prevMask == 0)
+		return DE_FALSE;
+
+	SetThreadAffinityMask(GetCurrentThread(), prevMask);
+
+	*coreMask = (deUint64)prevMask;
+	return DE_TRUE;
+}
+
+deBool deSetCurrentThreadAffinity (deUint64 coreMask)
+{
+	const DWORD_PTR mask = (DWORD_PTR)coreMask;
+
+	if (mask == 0 || (deUint64)mask != coreMask)
+		return DE_FALSE;
+
+	return SetThreadAffinityMask(GetCurrentThread(), mask) != 0 ? DE_TRUE : DE_FALSE;
+}
+
 #endif /* DE_OS */
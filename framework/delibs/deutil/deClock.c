@@ -77,6 +77,38 @@ deUint64 deGetMicroseconds (void)
 #endif
 }
 
+deUint64 deGetThreadCpuMicroseconds (void)
+{
+#if (DE_OS == DE_OS_WIN32)
+	FILETIME		creationTime;
+	FILETIME		exitTime;
+	FILETIME		kernelTime;
+	FILETIME		userTime;
+	ULARGE_INTEGER	kernel;
+	ULARGE_INTEGER	user;
+
+	if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+		return deGetMicroseconds();
+
+	kernel.LowPart	= kernelTime.dwLowDateTime;
+	kernel.HighPart	= kernelTime.dwHighDateTime;
+	user.LowPart	= userTime.dwLowDateTime;
+	user.HighPart	= userTime.dwHighDateTime;
+
+	/* FILETIME is in 100ns units. */
+	return (kernel.QuadPart + user.QuadPart) / 10;
+
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+	struct timespec currTime;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &currTime) != 0)
+		return deGetMicroseconds();
+	return (deUint64)currTime.tv_sec*1000000 + ((deUint64)currTime.tv_nsec/1000);
+
+#else
+	return deGetMicroseconds();
+#endif
+}
+
 deUint64 deGetTime (void)
 {
 	return (deUint64)time(DE_NULL);
@@ -37,6 +37,15 @@ DE_BEGIN_EXTERN_C
  *//*--------------------------------------------------------------------*/
 deUint64		deGetMicroseconds		(void);
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Get CPU time used by the calling thread in microseconds.
+ * \return CPU time (user and system) consumed by the calling thread.
+ *
+ * \note Falls back to deGetMicroseconds() on platforms that do not
+ *       provide per-thread CPU time.
+ *//*--------------------------------------------------------------------*/
+deUint64		deGetThreadCpuMicroseconds	(void);
+
 /*--------------------------------------------------------------------*//*!
  * \brief Get time in seconds since the epoch.
  * \return Current time in seconds since the epoch.
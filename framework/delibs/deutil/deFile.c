@@ -79,10 +79,12 @@ static int mapOpenMode (deFileMode mode)
 	/* Require write and open when using truncate */
 	DE_ASSERT(!(mode & DE_FILEMODE_TRUNCATE) || ((mode & DE_FILEMODE_WRITE) && (mode & DE_FILEMODE_OPEN)));
 
-	if (mode & DE_FILEMODE_READ)
+	/* O_RDONLY and O_WRONLY are not bit flags, O_RDONLY|O_WRONLY is not O_RDWR. */
+	if ((mode & DE_FILEMODE_READ) && (mode & DE_FILEMODE_WRITE))
+		flag |= O_RDWR;
+	else if (mode & DE_FILEMODE_READ)
 		flag |= O_RDONLY;
-
-	if (mode & DE_FILEMODE_WRITE)
+	else if (mode & DE_FILEMODE_WRITE)
 		flag |= O_WRONLY;
 
 	if (mode & DE_FILEMODE_TRUNCATE)
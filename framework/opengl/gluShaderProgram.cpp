@@ -76,6 +76,12 @@ void Shader::setSources (int numSourceStrings, const char* const* sourceStrings,
 }
 
 void Shader::compile (void)
+{
+	submitCompile();
+	queryCompileStatus();
+}
+
+void Shader::submitCompile (void)
 {
 	m_info.compileOk		= false;
 	m_info.compileTimeUs	= 0;
@@ -88,7 +94,24 @@ void Shader::compile (void)
 	}
 
 	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glCompileShader()");
+}
+
+bool Shader::isCompileComplete (void) const
+{
+	// Without GL_KHR_parallel_shader_compile status queries simply block
+	if (!m_gl.maxShaderCompilerThreadsKHR)
+		return true;
+
+	int completionStatus = GL_FALSE;
+
+	m_gl.getShaderiv(m_shader, GL_COMPLETION_STATUS_KHR, &completionStatus);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGetShaderiv()");
+
+	return completionStatus != GL_FALSE;
+}
 
+void Shader::queryCompileStatus (void)
+{
 	// Query status
 	{
 		int compileStatus = 0;
@@ -285,6 +308,12 @@ void Program::transformFeedbackVaryings (int count, const char* const* varyings,
 }
 
 void Program::link (void)
+{
+	submitLink();
+	queryLinkStatus();
+}
+
+void Program::submitLink (void)
 {
 	m_info.linkOk		= false;
 	m_info.linkTimeUs	= 0;
@@ -296,7 +325,23 @@ void Program::link (void)
 		m_info.linkTimeUs = deGetMicroseconds() - linkStart;
 	}
 	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glLinkProgram()");
+}
 
+bool Program::isLinkComplete (void) const
+{
+	if (!m_gl.maxShaderCompilerThreadsKHR)
+		return true;
+
+	int completionStatus = GL_FALSE;
+
+	m_gl.getProgramiv(m_program, GL_COMPLETION_STATUS_KHR, &completionStatus);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGetProgramiv()");
+
+	return completionStatus != GL_FALSE;
+}
+
+void Program::queryLinkStatus (void)
+{
 	m_info.linkOk	= getProgramLinkStatus(m_gl, m_program);
 	m_info.infoLog	= getProgramInfoLog(m_gl, m_program);
 }
@@ -389,61 +434,99 @@ ShaderProgram::ShaderProgram (const glw::Functions& gl, const ProgramBinaries& b
 	init(gl, binaries);
 }
 
+ShaderProgram::ShaderProgram (const glw::Functions& gl)
+	: m_program(gl)
+{
+}
+
 void ShaderProgram::init (const glw::Functions& gl, const ProgramSources& sources)
 {
 	try
 	{
-		bool shadersOk = true;
+		submitShaders(gl, sources);
 
-		for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+		if (queryShaderStatus())
 		{
-			for (int shaderNdx = 0; shaderNdx < (int)sources.sources[shaderType].size(); ++shaderNdx)
-			{
-				const char* source	= sources.sources[shaderType][shaderNdx].c_str();
-				const int	length	= (int)sources.sources[shaderType][shaderNdx].size();
-
-				m_shaders[shaderType].reserve(m_shaders[shaderType].size() + 1);
-
-				m_shaders[shaderType].push_back(new Shader(gl, ShaderType(shaderType)));
-				m_shaders[shaderType].back()->setSources(1, &source, &length);
-				m_shaders[shaderType].back()->compile();
-
-				shadersOk = shadersOk && m_shaders[shaderType].back()->getCompileStatus();
-			}
+			submitLink(sources);
+			m_program.queryLinkStatus();
 		}
+	}
+	catch (...)
+	{
+		for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+			for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
+				delete m_shaders[shaderType][shaderNdx];
+		throw;
+	}
+}
 
-		if (shadersOk)
+void ShaderProgram::submitShaders (const glw::Functions& gl, const ProgramSources& sources)
+{
+	for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+	{
+		for (int shaderNdx = 0; shaderNdx < (int)sources.sources[shaderType].size(); ++shaderNdx)
 		{
-			for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
-				for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
-					m_program.attachShader(m_shaders[shaderType][shaderNdx]->getShader());
+			const char* source	= sources.sources[shaderType][shaderNdx].c_str();
+			const int	length	= (int)sources.sources[shaderType][shaderNdx].size();
 
-			for (std::vector<AttribLocationBinding>::const_iterator binding = sources.attribLocationBindings.begin(); binding != sources.attribLocationBindings.end(); ++binding)
-				m_program.bindAttribLocation(binding->location, binding->name.c_str());
+			m_shaders[shaderType].reserve(m_shaders[shaderType].size() + 1);
 
-			DE_ASSERT((sources.transformFeedbackBufferMode == GL_NONE) == sources.transformFeedbackVaryings.empty());
-			if (sources.transformFeedbackBufferMode != GL_NONE)
-			{
-				std::vector<const char*> tfVaryings(sources.transformFeedbackVaryings.size());
-				for (int ndx = 0; ndx < (int)tfVaryings.size(); ndx++)
-					tfVaryings[ndx] = sources.transformFeedbackVaryings[ndx].c_str();
+			m_shaders[shaderType].push_back(new Shader(gl, ShaderType(shaderType)));
+			m_shaders[shaderType].back()->setSources(1, &source, &length);
+			m_shaders[shaderType].back()->submitCompile();
+		}
+	}
+}
 
-				m_program.transformFeedbackVaryings((int)tfVaryings.size(), &tfVaryings[0], sources.transformFeedbackBufferMode);
-			}
+bool ShaderProgram::isCompileComplete (void) const
+{
+	for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+		for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
+			if (!m_shaders[shaderType][shaderNdx]->isCompileComplete())
+				return false;
 
-			if (sources.separable)
-				m_program.setSeparable(true);
+	return true;
+}
 
-			m_program.link();
+bool ShaderProgram::queryShaderStatus (void)
+{
+	bool shadersOk = true;
+
+	for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+	{
+		for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
+		{
+			m_shaders[shaderType][shaderNdx]->queryCompileStatus();
+			shadersOk = shadersOk && m_shaders[shaderType][shaderNdx]->getCompileStatus();
 		}
 	}
-	catch (...)
+
+	return shadersOk;
+}
+
+void ShaderProgram::submitLink (const ProgramSources& sources)
+{
+	for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+		for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
+			m_program.attachShader(m_shaders[shaderType][shaderNdx]->getShader());
+
+	for (std::vector<AttribLocationBinding>::const_iterator binding = sources.attribLocationBindings.begin(); binding != sources.attribLocationBindings.end(); ++binding)
+		m_program.bindAttribLocation(binding->location, binding->name.c_str());
+
+	DE_ASSERT((sources.transformFeedbackBufferMode == GL_NONE) == sources.transformFeedbackVaryings.empty());
+	if (sources.transformFeedbackBufferMode != GL_NONE)
 	{
-		for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
-			for (int shaderNdx = 0; shaderNdx < (int)m_shaders[shaderType].size(); ++shaderNdx)
-				delete m_shaders[shaderType][shaderNdx];
-		throw;
+		std::vector<const char*> tfVaryings(sources.transformFeedbackVaryings.size());
+		for (int ndx = 0; ndx < (int)tfVaryings.size(); ndx++)
+			tfVaryings[ndx] = sources.transformFeedbackVaryings[ndx].c_str();
+
+		m_program.transformFeedbackVaryings((int)tfVaryings.size(), &tfVaryings[0], sources.transformFeedbackBufferMode);
 	}
+
+	if (sources.separable)
+		m_program.setSeparable(true);
+
+	m_program.submitLink();
 }
 
 void ShaderProgram::init (const glw::Functions& gl, const ProgramBinaries& binaries)
@@ -532,6 +615,157 @@ ShaderProgram::~ShaderProgram (void)
 			delete m_shaders[shaderType][shaderNdx];
 }
 
+// ShaderProgramBatch
+
+ShaderProgramBatch::ShaderProgramBatch (const glw::Functions& gl)
+	: m_gl				(gl)
+	, m_isParallel		(gl.maxShaderCompilerThreadsKHR != DE_NULL)
+	, m_prevMaxThreads	(0)
+	, m_numPending		(0)
+{
+	init();
+}
+
+ShaderProgramBatch::ShaderProgramBatch (const RenderContext& renderCtx)
+	: m_gl				(renderCtx.getFunctions())
+	, m_isParallel		(m_gl.maxShaderCompilerThreadsKHR != DE_NULL)
+	, m_prevMaxThreads	(0)
+	, m_numPending		(0)
+{
+	init();
+}
+
+void ShaderProgramBatch::init (void)
+{
+	if (m_isParallel)
+	{
+		m_gl.getIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &m_prevMaxThreads);
+		GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR)");
+
+		// 0xFFFFFFFF lets the implementation pick its maximum
+		m_gl.maxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+		GLU_EXPECT_NO_ERROR(m_gl.getError(), "glMaxShaderCompilerThreadsKHR()");
+	}
+}
+
+ShaderProgramBatch::~ShaderProgramBatch (void)
+{
+	clear();
+
+	if (m_isParallel)
+		m_gl.maxShaderCompilerThreadsKHR((deUint32)m_prevMaxThreads);
+}
+
+int ShaderProgramBatch::add (const ProgramSources& sources)
+{
+	const int		ndx		= (int)m_programs.size();
+
+	m_programs.reserve(m_programs.size() + 1);
+	m_sources.reserve(m_sources.size() + 1);
+	m_states.reserve(m_states.size() + 1);
+
+	m_programs.push_back(new ShaderProgram(m_gl));
+	m_sources.push_back(sources);
+	m_states.push_back(BUILDSTATE_COMPILING);
+	m_numPending += 1;
+
+	m_programs.back()->submitShaders(m_gl, sources);
+
+	return ndx;
+}
+
+bool ShaderProgramBatch::advance (int ndx, bool wait)
+{
+	ShaderProgram&	program	= *m_programs[ndx];
+
+	switch (m_states[ndx])
+	{
+		case BUILDSTATE_COMPILING:
+			if (!wait && !program.isCompileComplete())
+				return false;
+
+			if (program.queryShaderStatus())
+			{
+				program.submitLink(m_sources[ndx]);
+				m_states[ndx] = BUILDSTATE_LINKING;
+			}
+			else
+			{
+				m_states[ndx] = BUILDSTATE_DONE;
+				m_numPending -= 1;
+			}
+			return true;
+
+		case BUILDSTATE_LINKING:
+			if (!wait && !program.m_program.isLinkComplete())
+				return false;
+
+			program.m_program.queryLinkStatus();
+			m_states[ndx] = BUILDSTATE_DONE;
+			m_numPending -= 1;
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+void ShaderProgramBatch::build (void)
+{
+	// Without completion status queries, resolve in submission order. Links
+	// are still submitted before any link status is queried.
+	while (m_numPending > 0)
+	{
+		bool progress = false;
+
+		for (int ndx = 0; ndx < (int)m_programs.size(); ++ndx)
+			progress = advance(ndx, !m_isParallel) || progress;
+
+		if (!progress)
+		{
+			// Nothing has finished yet, block on the oldest pending program
+			for (int ndx = 0; ndx < (int)m_programs.size(); ++ndx)
+			{
+				if (m_states[ndx] != BUILDSTATE_DONE)
+				{
+					advance(ndx, true);
+					break;
+				}
+			}
+		}
+	}
+}
+
+void ShaderProgramBatch::clear (void)
+{
+	for (int ndx = 0; ndx < (int)m_programs.size(); ++ndx)
+		delete m_programs[ndx];
+
+	m_programs.clear();
+	m_sources.clear();
+	m_states.clear();
+	m_numPending = 0;
+}
+
+const ShaderProgram& ShaderProgramBatch::getProgram (int ndx) const
+{
+	DE_ASSERT(de::inBounds(ndx, 0, (int)m_programs.size()));
+	DE_ASSERT(m_programs[ndx] && m_states[ndx] == BUILDSTATE_DONE);
+
+	return *m_programs[ndx];
+}
+
+ShaderProgram* ShaderProgramBatch::release (int ndx)
+{
+	ShaderProgram* const program = m_programs[ndx];
+
+	DE_ASSERT(program && m_states[ndx] == BUILDSTATE_DONE);
+
+	m_programs[ndx] = DE_NULL;
+
+	return program;
+}
+
 // Utilities
 
 deUint32 getGLShaderType (ShaderType shaderType)
@@ -90,6 +90,9 @@ public:
 
 	void					setSources			(int numSourceStrings, const char* const* sourceStrings, const int* lengths);
 	void					compile				(void);
+	void					submitCompile		(void);
+	bool					isCompileComplete	(void) const;
+	void					queryCompileStatus	(void);
 	void					specialize			(const char* entryPoint, glw::GLuint numSpecializationConstants,
 												 const glw::GLuint* constantIndex, const glw::GLuint* constantValue);
 
@@ -130,6 +133,9 @@ public:
 	void					transformFeedbackVaryings	(int count, const char* const* varyings, deUint32 bufferMode);
 
 	void					link						(void);
+	void					submitLink					(void);
+	bool					isLinkComplete				(void) const;
+	void					queryLinkStatus				(void);
 
 	deUint32				getProgram					(void) const { return m_program;			}
 	const ProgramInfo&		getInfo						(void) const { return m_info;				}
@@ -205,9 +211,16 @@ public:
 	const ProgramInfo&		getProgramInfo				(void) const											{ return m_program.getInfo();							}
 
 private:
+	friend class ShaderProgramBatch;
+
+							ShaderProgram				(const glw::Functions& gl);
 							ShaderProgram				(const ShaderProgram& other);
 	ShaderProgram&			operator=					(const ShaderProgram& other);
 	void					init						(const glw::Functions& gl, const ProgramSources& sources);
+	void					submitShaders				(const glw::Functions& gl, const ProgramSources& sources);
+	bool					isCompileComplete			(void) const;
+	bool					queryShaderStatus			(void);
+	void					submitLink					(const ProgramSources& sources);
 	void					init						(const glw::Functions& gl, const ProgramBinaries& binaries);
 	void					setBinary					(const glw::Functions& gl, std::vector<Shader*>& shaders, glw::GLenum binaryFormat, const void* binaryData, const int length);
 
@@ -215,6 +228,61 @@ private:
 	Program					m_program;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Set of shader programs compiled and linked together.
+ *
+ * Shaders of every program are submitted for compilation when the program
+ * is added, and status queries are deferred until build(). Programs are
+ * linked as soon as their shaders are compiled. If GL_KHR_parallel_shader_compile
+ * is supported, the driver is allowed to use all of its compiler threads
+ * and completion is polled with GL_COMPLETION_STATUS_KHR.
+ *
+ * The resulting programs are identical to ones created with the
+ * ShaderProgram constructors.
+ *//*--------------------------------------------------------------------*/
+class ShaderProgramBatch
+{
+public:
+							ShaderProgramBatch			(const glw::Functions& gl);
+							ShaderProgramBatch			(const RenderContext& renderCtx);
+							~ShaderProgramBatch			(void);
+
+	int						add							(const ProgramSources& sources);
+	void					build						(void);
+	void					clear						(void);
+
+	int						getNumPrograms				(void) const		{ return (int)m_programs.size();	}
+	bool					isBuilt						(void) const		{ return m_numPending == 0;			}
+	const ShaderProgram&	getProgram					(int ndx) const;
+
+	//! Transfer ownership of a built program to caller.
+	ShaderProgram*			release						(int ndx);
+
+private:
+							ShaderProgramBatch			(const ShaderProgramBatch& other);
+	ShaderProgramBatch&		operator=					(const ShaderProgramBatch& other);
+
+	enum BuildState
+	{
+		BUILDSTATE_COMPILING = 0,
+		BUILDSTATE_LINKING,
+		BUILDSTATE_DONE,
+
+		BUILDSTATE_LAST
+	};
+
+	void					init						(void);
+	bool					advance						(int ndx, bool wait);
+
+	const glw::Functions&			m_gl;
+	const bool						m_isParallel;
+	int								m_prevMaxThreads;
+	std::vector<ShaderProgram*>		m_programs;
+	std::vector<ProgramSources>		m_sources;
+	std::vector<BuildState>			m_states;
+	int								m_numPending;
+};
+
 // Utilities.
 
 deUint32		getGLShaderType		(ShaderType shaderType);
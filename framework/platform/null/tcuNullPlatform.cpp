@@ -28,12 +28,24 @@
 #include "eglwLibrary.hpp"
 #include "eglwEnums.hpp"
 #include "vkNullDriver.hpp"
+#include "tcuHarnessProfile.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
 
 namespace tcu
 {
 namespace null
 {
 
+static std::atomic<deUint64> s_numAllocations (0);
+
+static deUint64 getNumAllocations (void)
+{
+	return s_numAllocations.load(std::memory_order_relaxed);
+}
+
 class NullEGLDisplay : public eglu::NativeDisplay
 {
 public:
@@ -75,6 +87,8 @@ Platform::Platform (void)
 {
 	m_contextFactoryRegistry.registerFactory(new NullGLContextFactory());
 	m_nativeDisplayFactoryRegistry.registerFactory(new NullEGLDisplayFactory());
+
+	setHarnessAllocationCounter(getNumAllocations);
 }
 
 Platform::~Platform (void)
@@ -104,3 +118,33 @@ tcu::Platform* createPlatform (void)
 {
 	return new tcu::null::Platform();
 }
+
+// Global allocations are counted for harness profiling (--deqp-harness-profile). The null
+// platform runs no real driver, so a relaxed atomic increment per allocation is affordable.
+// Array and nothrow forms forward to these.
+
+void* operator new (std::size_t size)
+{
+	tcu::null::s_numAllocations.fetch_add(1, std::memory_order_relaxed);
+
+	for (;;)
+	{
+		if (void* const ptr = std::malloc(size != 0 ? size : 1))
+			return ptr;
+
+		if (const std::new_handler handler = std::get_new_handler())
+			handler();
+		else
+			throw std::bad_alloc();
+	}
+}
+
+void operator delete (void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete (void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
@@ -26,6 +26,7 @@
 #include "tcuPlatform.hpp"
 #include "tcuApp.hpp"
 #include "tcuResource.hpp"
+#include "tcuPackArchive.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuTestSessionExecutor.hpp"
 #include "deUniquePtr.hpp"
@@ -47,7 +48,10 @@ int main (int argc, char** argv)
 	try
 	{
 		tcu::CommandLine				cmdLine		(argc, argv);
-		tcu::DirArchive					archive		(cmdLine.getArchiveDir());
+		tcu::DirArchive					dirArchive	(cmdLine.getArchiveDir());
+		de::UniquePtr<tcu::PackArchive>	pack		(cmdLine.getArchivePack() ? new tcu::PackArchive(cmdLine.getArchivePack()) : DE_NULL);
+		de::UniquePtr<tcu::Archive>		packOverlay	(pack ? new tcu::PackOverlayArchive(*pack, dirArchive) : DE_NULL);
+		tcu::Archive&					archive		= packOverlay ? *packOverlay : static_cast<tcu::Archive&>(dirArchive);
 		tcu::TestLog					log			(cmdLine.getLogFileName(), cmdLine.getLogFlags());
 		de::UniquePtr<tcu::Platform>	platform	(createPlatform());
 		de::UniquePtr<tcu::App>			app			(new tcu::App(*platform, archive, log, cmdLine));
@@ -57,10 +61,14 @@ int main (int argc, char** argv)
 		{
 			if (!app->iterate())
 			{
-				if (cmdLine.getRunMode() == tcu::RUNMODE_EXECUTE &&
-					(!app->getResult().isComplete || app->getResult().numFailed))
+				if (cmdLine.getRunMode() == tcu::RUNMODE_EXECUTE)
 				{
-					exitStatus = EXIT_FAILURE;
+					const tcu::TestRunStatus&	result	= app->getResult();
+					// Results on a null driver are meaningless when profiling the harness, only regressions count
+					const bool					failed	= cmdLine.isHarnessProfileEnabled() ? result.isHarnessProfileRegressed : result.numFailed != 0;
+
+					if (!result.isComplete || failed)
+						exitStatus = EXIT_FAILURE;
 				}
 
 				break;
@@ -29,8 +29,10 @@
 #include "deMemory.h"
 #include "deInt32.h"
 #include "deString.h"
+#include "deSha1.h"
 
 #include "deMutex.h"
+#include "deClock.h"
 
 #if defined(QP_SUPPORT_PNG)
 #	include <png.h>
@@ -132,6 +134,8 @@ struct qpTestLog_s
 	deBool					isSessionOpen;
 	deBool					isCaseOpen;
 
+	char*					imageStoreDir;		/*!< Image store directory, or DE_NULL if images are written inline. */
+
 #if defined(DE_DEBUG)
 	ContainerStack			containerStack;		/*!< For container usage verification.	*/
 #endif
@@ -349,6 +353,7 @@ qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
 	log->lock			= deMutex_create(DE_NULL);
 	log->isSessionOpen	= DE_FALSE;
 	log->isCaseOpen		= DE_FALSE;
+	log->imageStoreDir	= DE_NULL;
 
 	if (!log->writer)
 	{
@@ -417,9 +422,44 @@ void qpTestLog_destroy (qpTestLog* log)
 	if (log->lock)
 		deMutex_destroy(log->lock);
 
+	deFree(log->imageStoreDir);
 	deFree(log);
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Set content-addressed image store
+ *
+ * When an image store directory is set, PNG-compressed images are
+ * written into the directory as <hash>.png, keyed by a SHA-1 of their
+ * format, size and pixel contents. Only the hash is written into the
+ * log in the StoreHash attribute of the <Image> element. Images already
+ * present in the store are not compressed or written again.
+ *
+ * \param log		qpTestLog instance
+ * \param dirName	Existing directory, or DE_NULL to write images inline
+ * \return true if ok, false otherwise
+ *//*--------------------------------------------------------------------*/
+deBool qpTestLog_setImageStore (qpTestLog* log, const char* dirName)
+{
+	char* newDir = DE_NULL;
+
+	DE_ASSERT(log);
+
+	if (dirName && dirName[0])
+	{
+		newDir = deStrdup(dirName);
+		if (!newDir)
+			return DE_FALSE;
+	}
+
+	deMutex_lock(log->lock);
+	deFree(log->imageStoreDir);
+	log->imageStoreDir = newDir;
+	deMutex_unlock(log->lock);
+
+	return DE_TRUE;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Log start of test case
  * \param log qpTestLog instance
@@ -804,6 +844,91 @@ static deBool compressImagePNG (Buffer* buffer, qpImageFormat imageFormat, int w
 	deFree(rowPointers);
 	return compressOk;
 }
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Compute image store key from image format, size and pixels
+ * \note Row padding does not affect the key.
+ *//*--------------------------------------------------------------------*/
+static void computeImageStoreHash (char hashStr[41], qpImageFormat imageFormat, int width, int height, int rowStride, const void* data)
+{
+	const int		pixelSize	= imageFormat == QP_IMAGE_FORMAT_RGB888 ? 3 : 4;
+	const deUint32	header[]	= { (deUint32)imageFormat, (deUint32)width, (deUint32)height };
+	deSha1Stream	stream;
+	deSha1			hash;
+	int				row;
+
+	deSha1Stream_init(&stream);
+	deSha1Stream_process(&stream, sizeof(header), header);
+
+	for (row = 0; row < height; row++)
+		deSha1Stream_process(&stream, (size_t)(pixelSize*width), (const deUint8*)data + row*rowStride);
+
+	deSha1Stream_finalize(&stream, &hash);
+	deSha1_render(&hash, hashStr);
+	hashStr[40] = 0;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Write image into content-addressed store unless already present
+ *
+ * Image is first written into a temporary file which is then renamed,
+ * so that concurrent writers never expose partially written files.
+ *//*--------------------------------------------------------------------*/
+static deBool storeImagePNG (const char* storeDir, const char* hashStr, qpImageFormat imageFormat, int width, int height, int rowStride, const void* data)
+{
+	char	path[1024];
+	char	tmpPath[1024+32];
+	FILE*	file;
+	Buffer	compressedBuffer;
+	deBool	writeOk;
+
+	deSprintf(path, sizeof(path), "%s/%s.png", storeDir, hashStr);
+
+	/* Already stored? */
+	file = fopen(path, "rb");
+	if (file)
+	{
+		fclose(file);
+		return DE_TRUE;
+	}
+
+	Buffer_init(&compressedBuffer);
+
+	if (!compressImagePNG(&compressedBuffer, imageFormat, width, height, rowStride, data))
+	{
+		Buffer_deinit(&compressedBuffer);
+		return DE_FALSE;
+	}
+
+	deSprintf(tmpPath, sizeof(tmpPath), "%s.%llx.%p.tmp", path, (unsigned long long)deGetMicroseconds(), (const void*)&compressedBuffer);
+
+	file = fopen(tmpPath, "wb");
+	if (!file)
+	{
+		qpPrintf("ERROR: Unable to open image store file '%s'.\n", tmpPath);
+		Buffer_deinit(&compressedBuffer);
+		return DE_FALSE;
+	}
+
+	writeOk = fwrite(compressedBuffer.data, 1, compressedBuffer.size, file) == compressedBuffer.size;
+	writeOk = (fclose(file) == 0) && writeOk;
+
+	Buffer_deinit(&compressedBuffer);
+
+	if (writeOk && rename(tmpPath, path) != 0)
+	{
+		/* Another writer may have stored the same image in the meantime. */
+		file = fopen(path, "rb");
+		if (file)
+			fclose(file);
+		else
+			writeOk = DE_FALSE;
+	}
+
+	remove(tmpPath);
+
+	return writeOk;
+}
 #endif /* QP_SUPPORT_PNG */
 
 /*--------------------------------------------------------------------*//*!
@@ -863,6 +988,40 @@ deBool qpTestLog_endImageSet (qpTestLog* log)
 	return DE_TRUE;
 }
 
+#if defined(QP_SUPPORT_PNG)
+static deBool writeStoredImage (qpTestLog* log, const char* name, const char* description, qpImageFormat imageFormat, int width, int height, const char* hashStr)
+{
+	char			widthStr[32];
+	char			heightStr[32];
+	qpXmlAttribute	attribs[8];
+	int				numAttribs			= 0;
+
+	int32ToString(width, widthStr);
+	int32ToString(height, heightStr);
+	attribs[numAttribs++] = qpSetStringAttrib("Name", name);
+	attribs[numAttribs++] = qpSetStringAttrib("Width", widthStr);
+	attribs[numAttribs++] = qpSetStringAttrib("Height", heightStr);
+	attribs[numAttribs++] = qpSetStringAttrib("Format", QP_LOOKUP_STRING(s_qpImageFormatMap, imageFormat));
+	attribs[numAttribs++] = qpSetStringAttrib("CompressionMode", QP_LOOKUP_STRING(s_qpImageCompressionModeMap, QP_IMAGE_COMPRESSION_MODE_PNG));
+	attribs[numAttribs++] = qpSetStringAttrib("StoreHash", hashStr);
+	if (description) attribs[numAttribs++] = qpSetStringAttrib("Description", description);
+
+	deMutex_lock(log->lock);
+
+	/* <Image Name="Foobar" Width="640" Height="480" Format="RGB888" CompressionMode="PNG" StoreHash="<sha1>"></Image> */
+	if (!qpXmlWriter_startElement(log->writer, "Image", numAttribs, attribs) ||
+		!qpXmlWriter_endElement(log->writer, "Image"))
+	{
+		qpPrintf("qpTestLog_writeImage(): Writing XML failed\n");
+		deMutex_unlock(log->lock);
+		return DE_FALSE;
+	}
+
+	deMutex_unlock(log->lock);
+	return DE_TRUE;
+}
+#endif /* QP_SUPPORT_PNG */
+
 /*--------------------------------------------------------------------*//*!
  * \brief Write base64 encoded raw image data into log
  * \param log				qpTestLog instance
@@ -916,6 +1075,34 @@ deBool qpTestLog_writeImage	(
 	}
 
 #if defined(QP_SUPPORT_PNG)
+	/* Try writing into image store. */
+	if (compressionMode == QP_IMAGE_COMPRESSION_MODE_PNG)
+	{
+		/* \note Store directory is copied, as qpTestLog_setImageStore() may free it while the image is stored. */
+		char* storeDir = DE_NULL;
+
+		deMutex_lock(log->lock);
+		if (log->imageStoreDir)
+			storeDir = deStrdup(log->imageStoreDir);
+		deMutex_unlock(log->lock);
+
+		if (storeDir)
+		{
+			char	hashStr[41];
+			deBool	storeOk;
+
+			computeImageStoreHash(hashStr, imageFormat, width, height, stride, data);
+
+			storeOk = storeImagePNG(storeDir, hashStr, imageFormat, width, height, stride, data);
+			deFree(storeDir);
+
+			if (storeOk)
+				return writeStoredImage(log, name, description, imageFormat, width, height, hashStr);
+
+			qpPrintf("WARNING: Writing image into store failed -- storing image inline.\n");
+		}
+	}
+
 	/* Try storing with PNG compression. */
 	if (compressionMode == QP_IMAGE_COMPRESSION_MODE_PNG)
 	{
@@ -220,6 +220,7 @@ deBool			qpTestLog_writeFloat			(qpTestLog* log, const char* name, const char* d
 deBool			qpTestLog_startImageSet			(qpTestLog* log, const char* name, const char* description);
 deBool			qpTestLog_endImageSet			(qpTestLog* log);
 deBool			qpTestLog_writeImage			(qpTestLog* log, const char* name, const char* description, qpImageCompressionMode compressionMode, qpImageFormat format, int width, int height, int stride, const void* data);
+deBool			qpTestLog_setImageStore			(qpTestLog* log, const char* dirName);
 
 deBool			qpTestLog_startEglConfigSet		(qpTestLog* log, const char* key, const char* description);
 deBool			qpTestLog_writeEglConfig		(qpTestLog* log, const qpEglConfigInfo* config);
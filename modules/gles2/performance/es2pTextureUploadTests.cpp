@@ -31,15 +31,19 @@
 #include "tcuTextureUtil.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuSurface.hpp"
+#include "tcuPerfMeasurement.hpp"
+#include "tcuCommandLine.hpp"
 #include "gluTextureUtil.hpp"
 #include "gluShaderProgram.hpp"
 #include "gluPixelTransfer.hpp"
 #include "deStringUtil.hpp"
 #include "deRandom.hpp"
+#include "deUniquePtr.hpp"
 #include "deClock.h"
 #include "deString.h"
 
 #include "glsCalibration.hpp"
+#include "glsGpuTimer.hpp"
 
 #include "glwEnums.hpp"
 #include "glwFunctions.hpp"
@@ -289,7 +293,7 @@ void TextureUploadCase::logResults (void)
 
 // Texture upload call case
 
-class TextureUploadCallCase : public TextureUploadCase
+class TextureUploadCallCase : public TextureUploadCase, private tcu::PerfWorkload
 {
 public:
 							TextureUploadCallCase	(Context& context, const char* name, const char* description, UploadFunction uploadFunction, deUint32 format, deUint32 type, int texSize);
@@ -297,6 +301,14 @@ public:
 
 	IterateResult			iterate					(void);
 	void					render					(void);
+
+private:
+	enum
+	{
+		MAX_UPLOAD_CALLS	= 1 << 16
+	};
+
+	void					run						(int numCalls, tcu::PerfTimer& timer);
 };
 
 TextureUploadCallCase::TextureUploadCallCase (Context& context, const char* name, const char* description, UploadFunction uploadFunction, deUint32 format, deUint32 type, int texSize)
@@ -328,6 +340,27 @@ void TextureUploadCallCase::render (void)
 	}
 }
 
+void TextureUploadCallCase::run (int numCalls, tcu::PerfTimer& timer)
+{
+	const glw::Functions& gl = m_context.getRenderContext().getFunctions();
+
+	timer.begin();
+
+	for (int i = 0; i < numCalls; i++)
+		render();
+
+	gl.finish();
+
+	timer.end();
+
+	// Touch watchdog between iterations to avoid timeout.
+	{
+		qpWatchDog* dog = m_testCtx.getWatchDog();
+		if (dog)
+			qpWatchDog_touch(dog);
+	}
+}
+
 tcu::TestNode::IterateResult TextureUploadCallCase::iterate (void)
 {
 	const glw::Functions& gl = m_context.getRenderContext().getFunctions();
@@ -341,18 +374,13 @@ tcu::TestNode::IterateResult TextureUploadCallCase::iterate (void)
 
 		if (state == gls::TheilSenCalibrator::STATE_MEASURE)
 		{
-			int			numCalls	= m_calibrator.getCallCount();
-			deUint64	startTime	= deGetMicroseconds();
+			tcu::WallClockTimer	timer;
+			double				duration	= 0.0;
 
-			for (int i = 0; i < numCalls; i++)
-				render();
+			run(m_calibrator.getCallCount(), timer);
+			timer.getDurationUs(duration);
 
-			gl.finish();
-
-			deUint64	endTime		= deGetMicroseconds();
-			deUint64	duration	= endTime-startTime;
-
-			m_calibrator.recordIteration(duration);
+			m_calibrator.recordIteration((deUint64)duration);
 		}
 		else if (state == gls::TheilSenCalibrator::STATE_RECOMPUTE_PARAMS)
 		{
@@ -363,17 +391,44 @@ tcu::TestNode::IterateResult TextureUploadCallCase::iterate (void)
 			DE_ASSERT(state == gls::TheilSenCalibrator::STATE_FINISHED);
 			break;
 		}
+	}
+
+	GLU_EXPECT_NO_ERROR(gl.getError(), "iterate");
+	logResults();
+
+	// Per upload cost fitted over varying upload counts. Logged in addition to the calibrated frame averages, which remain the case result.
+	{
+		tcu::WallClockTimer				wallClockTimer;
+		de::MovePtr<gls::GpuPerfTimer>	gpuTimer;
+		tcu::PerfMeasureParams			params			(1, MAX_UPLOAD_CALLS);
 
-		// Touch watchdog between iterations to avoid timeout.
+		if (m_testCtx.getCommandLine().isPerfGPUTimerEnabled())
 		{
-			qpWatchDog* dog = m_testCtx.getWatchDog();
-			if (dog)
-				qpWatchDog_touch(dog);
+			if (gls::GpuTimer::isSupported(m_context.getRenderContext()))
+				gpuTimer = de::MovePtr<gls::GpuPerfTimer>(new gls::GpuPerfTimer(m_context.getRenderContext()));
+			else
+				m_log << TestLog::Message << "GPU timer queries not supported, using CPU time only" << TestLog::EndMessage;
 		}
+
+		tcu::PerfTimer&					timer			= gpuTimer ? static_cast<tcu::PerfTimer&>(*gpuTimer) : static_cast<tcu::PerfTimer&>(wallClockTimer);
+
+		// Largest upload count is the first one that takes at least a 30 fps frame
+		params.targetDurationUs = 1000000.0f / 30.0f;
+
+		const tcu::PerfMeasureResult	result			= tcu::measurePerformance(*this, timer, params);
+		const float						perUploadNs		= result.getPerWorkNs();
+		const float						mTexelsPerSec	= perUploadNs > 0.0f ? (float)(m_texSize*m_texSize) * 1000.0f / perUploadNs : 0.0f;
+
+		GLU_EXPECT_NO_ERROR(gl.getError(), "iterate");
+
+		m_log << TestLog::Section("UploadCostFit", "Per upload cost fitted over upload counts");
+		m_log << TestLog::Message << "1 to " << result.maxWorkSize << " upload calls / iteration" << TestLog::EndMessage;
+		tcu::logPerfSamples(m_log, "Samples", "Samples", result);
+		tcu::logPerfResult(m_log, result, "upload");
+		m_log << TestLog::Float("TexelPerf", "Fitted texel upload performance", "MTex/s", QP_KEY_TAG_PERFORMANCE, mTexelsPerSec);
+		m_log << TestLog::EndSection;
 	}
 
-	GLU_EXPECT_NO_ERROR(gl.getError(), "iterate");
-	logResults();
 	return STOP;
 }
 
@@ -28,6 +28,7 @@
 #include "tcuSurface.hpp"
 #include "tcuCPUWarmup.hpp"
 #include "tcuRenderTarget.hpp"
+#include "tcuCommandLine.hpp"
 #include "gluRenderContext.hpp"
 #include "gluShaderProgram.hpp"
 #include "gluStrUtil.hpp"
@@ -1921,6 +1922,8 @@ private:
 
 	bool					m_useGL;
 	int						m_bufferRandomizerTimer;
+
+	tcu::MeasurementEnvironment*	m_environment;
 };
 
 template <typename SampleType>
@@ -1938,6 +1941,7 @@ BasicBufferCase<SampleType>::BasicBufferCase (Context& context, const char* name
 	, m_results					(numSamples)
 	, m_useGL					(true)
 	, m_bufferRandomizerTimer	(0)
+	, m_environment				(DE_NULL)
 {
 	// "randomize" iteration order. Deterministic, patternless
 	generateTwoPassRandomIterationOrder(m_iterationOrder, m_numSamples);
@@ -1966,6 +1970,8 @@ void BasicBufferCase<SampleType>::init (void)
 {
 	const glw::Functions& gl = m_context.getRenderContext().getFunctions();
 
+	m_environment = new tcu::MeasurementEnvironment(m_testCtx.getCommandLine().getPerfCPUAffinity());
+
 	if (!m_useGL)
 		return;
 
@@ -1996,6 +2002,9 @@ void BasicBufferCase<SampleType>::deinit (void)
 
 	delete m_minimalProgram;
 	m_minimalProgram = DE_NULL;
+
+	delete m_environment;
+	m_environment = DE_NULL;
 }
 
 template <typename SampleType>
@@ -2144,6 +2153,7 @@ TestCase::IterateResult BasicBufferCase<SampleType>::iterate (void)
 
 		if (++m_iteration >= m_numSamples)
 		{
+			m_environment->logReport(m_testCtx.getLog());
 			logAndSetTestResult(m_results);
 			return STOP;
 		}
@@ -349,6 +349,35 @@ void LongRunningTests::init (void)
 															 GL_STATIC_DRAW, GL_STATIC_DRAW));
 			}
 		}
+
+		{
+			std::vector<gls::ProgramContext> contexts;
+			contexts.push_back(progLib.generateFragmentPointLightContext(512, 512));
+			contexts.push_back(progLib.generateVertexUniformLoopLightContext(512, 512));
+			mixedGroup->addChild(new gls::LongStressCase(m_context.getTestContext(), m_context.getRenderContext(),
+														 "random_4_threads",
+														 "Highly random behavior in 4 threads, each using its own shared context",
+														 64*Mi, 64*Mi,
+														 1 /* draw calls per iteration */, 10000 /* tris per call */,
+														 contexts,
+														 Probs()
+														 .pRebuildProgram				(0.3f)
+														 .pReuploadTexture				(0.3f)
+														 .pReuploadWithTexImage			(0.3f)
+														 .pReuploadBuffer				(0.3f)
+														 .pReuploadWithBufferData		(0.3f)
+														 .pDeleteTexture				(0.2f)
+														 .pDeleteBuffer					(0.2f)
+														 .pWastefulTextureMemoryUsage	(0.3f)
+														 .pWastefulBufferMemoryUsage	(0.3f)
+														 .pSeparateAttribBuffers		(0.4f)
+														 .pUseDrawArrays				(0.4f)
+														 .pRandomBufferUploadTarget		(1.0f)
+														 .pRandomBufferUsage			(1.0f),
+														 GL_STATIC_DRAW, GL_STATIC_DRAW,
+														 1 /* redundant buffer factor */, false /* show debug info */,
+														 4 /* threads */));
+		}
 	}
 }
 
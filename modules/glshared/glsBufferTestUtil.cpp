@@ -81,6 +81,10 @@ bool compareByteArrays (tcu::TestLog& log, const deUint8* resPtr, const deUint8*
 
 	log << TestLog::Section("Verify", "Verification result");
 
+	// Matching data is the common case, look for difference spans only if needed
+	if (deMemCmp(resPtr, refPtr, (size_t)numBytes) == 0)
+		ndx = numBytes;
+
 	for (;ndx < numBytes; ndx++)
 	{
 		if (resPtr[ndx] != refPtr[ndx])
@@ -412,6 +416,39 @@ bool BufferMapVerifier::verify (deUint32 buffer, const deUint8* reference, int o
 	return isOk;
 }
 
+// Asynchronous readback helpers
+
+static void readPixelsToBuffer (glu::CallLogWrapper& gl, deUint32 buffer, int width, int height)
+{
+	glw::GLint prevPackAlignment = 4;
+
+	gl.glGetIntegerv	(GL_PACK_ALIGNMENT, &prevPackAlignment);
+	gl.glBindBuffer		(GL_PIXEL_PACK_BUFFER, buffer);
+	gl.glBufferData		(GL_PIXEL_PACK_BUFFER, (glw::GLsizeiptr)(width*height*4), DE_NULL, GL_STREAM_READ);
+	gl.glPixelStorei	(GL_PACK_ALIGNMENT, 4);
+	gl.glReadPixels		(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, DE_NULL);
+	gl.glPixelStorei	(GL_PACK_ALIGNMENT, prevPackAlignment);
+	gl.glBindBuffer		(GL_PIXEL_PACK_BUFFER, 0);
+	GLU_EXPECT_NO_ERROR(gl.glGetError(), "Readback to pixel pack buffer failed");
+}
+
+static void mapReadbackBuffer (glu::CallLogWrapper& gl, deUint32 buffer, tcu::Surface& dst)
+{
+	const int		numBytes	= dst.getWidth()*dst.getHeight()*4;
+	const void*		mapPtr		= DE_NULL;
+
+	gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+	mapPtr = gl.glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, numBytes, GL_MAP_READ_BIT);
+	GLU_EXPECT_NO_ERROR(gl.glGetError(), "glMapBufferRange");
+	TCU_CHECK(mapPtr);
+
+	tcu::copy(dst.getAccess(), tcu::ConstPixelBufferAccess(tcu::TextureFormat(tcu::TextureFormat::RGBA, tcu::TextureFormat::UNORM_INT8), dst.getWidth(), dst.getHeight(), 1, mapPtr));
+
+	gl.glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	GLU_EXPECT_NO_ERROR(gl.glGetError(), "glUnmapBuffer");
+}
+
 // VertexArrayVerifier
 
 VertexArrayVerifier::VertexArrayVerifier (glu::RenderContext& renderCtx, tcu::TestLog& log)
@@ -420,7 +457,11 @@ VertexArrayVerifier::VertexArrayVerifier (glu::RenderContext& renderCtx, tcu::Te
 	, m_posLoc				(0)
 	, m_byteVecLoc			(0)
 	, m_vao					(0)
+	, m_positionBuf			(0)
+	, m_indexBuf			(0)
 {
+	std::fill(DE_ARRAY_BEGIN(m_readbackBufs), DE_ARRAY_END(m_readbackBufs), 0u);
+
 	const glu::ContextType	ctxType		= renderCtx.getType();
 	const glu::GLSLVersion	glslVersion	= glu::isContextTypeES(ctxType) ? glu::GLSL_VERSION_300_ES : glu::GLSL_VERSION_330;
 
@@ -459,6 +500,7 @@ VertexArrayVerifier::VertexArrayVerifier (glu::RenderContext& renderCtx, tcu::Te
 	gl.genVertexArrays(1, &m_vao);
 	gl.genBuffers(1, &m_positionBuf);
 	gl.genBuffers(1, &m_indexBuf);
+	gl.genBuffers(DE_LENGTH_OF_ARRAY(m_readbackBufs), &m_readbackBufs[0]);
 	GLU_EXPECT_NO_ERROR(gl.getError(), "Initialization failed");
 }
 
@@ -470,6 +512,8 @@ VertexArrayVerifier::~VertexArrayVerifier (void)
 	if (m_positionBuf)	gl.deleteBuffers(1, &m_positionBuf);
 	if (m_indexBuf)		gl.deleteBuffers(1, &m_indexBuf);
 
+	gl.deleteBuffers(DE_LENGTH_OF_ARRAY(m_readbackBufs), &m_readbackBufs[0]);
+
 	delete m_program;
 }
 
@@ -582,7 +626,9 @@ bool VertexArrayVerifier::verify (deUint32 buffer, const deUint8* refPtr, int of
 	vector<deUint16>			indices;
 
 	tcu::Surface				rendered;
-	tcu::Surface				reference;
+	tcu::Surface				reference[2];
+	string						imageSetDesc[2];
+	int							batchNdx			= 0;
 
 	DE_ASSERT(numBytes >= numBytesInQuad); // Can't render full quad with smaller buffers.
 
@@ -611,38 +657,60 @@ bool VertexArrayVerifier::verify (deUint32 buffer, const deUint8* refPtr, int of
 	glEnableVertexAttribArray	(m_byteVecLoc);
 	glBindBuffer				(GL_ARRAY_BUFFER, buffer);
 
-	while (numVerified < numBytes)
+	// Batches are pipelined: while batch N is being rendered and read back
+	// asynchronously, reference for it is computed and batch N-1 is compared.
+	while (isOk && numVerified < numBytes)
 	{
-		int		numRemaining		= numBytes-numVerified;
-		bool	isLeftoverBatch		= numRemaining < numBytesInQuad;
-		int		numBytesToVerify	= isLeftoverBatch ? numBytesInQuad				: de::min(maxQuadsPerBatch*numBytesInQuad, numRemaining - numRemaining%numBytesInQuad);
-		int		curOffset			= isLeftoverBatch ? (numBytes-numBytesInQuad)	: numVerified;
-		int		numQuads			= numBytesToVerify/numBytesInQuad;
-		int		numCols				= de::min(maxQuadsX, numQuads);
-		int		numRows				= numQuads/maxQuadsX + (numQuads%maxQuadsX != 0 ? 1 : 0);
-		string	imageSetDesc		= string("Bytes ") + de::toString(offset+curOffset) + " to " + de::toString(offset+curOffset+numBytesToVerify-1);
+		const int	slot				= batchNdx % 2;
+		int			numRemaining		= numBytes-numVerified;
+		bool		isLeftoverBatch		= numRemaining < numBytesInQuad;
+		int			numBytesToVerify	= isLeftoverBatch ? numBytesInQuad				: de::min(maxQuadsPerBatch*numBytesInQuad, numRemaining - numRemaining%numBytesInQuad);
+		int			curOffset			= isLeftoverBatch ? (numBytes-numBytesInQuad)	: numVerified;
+		int			numQuads			= numBytesToVerify/numBytesInQuad;
+		int			numCols				= de::min(maxQuadsX, numQuads);
+		int			numRows				= numQuads/maxQuadsX + (numQuads%maxQuadsX != 0 ? 1 : 0);
 
 		DE_ASSERT(numBytesToVerify > 0 && numBytesToVerify%numBytesInQuad == 0);
 		DE_ASSERT(de::inBounds(curOffset, 0, numBytes));
 		DE_ASSERT(de::inRange(curOffset+numBytesToVerify, curOffset, numBytes));
 
+		imageSetDesc[slot] = string("Bytes ") + de::toString(offset+curOffset) + " to " + de::toString(offset+curOffset+numBytesToVerify-1);
+
 		// Render batch.
 		glClear					(GL_COLOR_BUFFER_BIT);
 		glVertexAttribPointer	(m_byteVecLoc, 3, GL_UNSIGNED_BYTE, GL_TRUE, 0, (const glw::GLvoid*)(deUintptr)(offset + curOffset));
 		glDrawElements			(GL_TRIANGLES, numQuads*6, GL_UNSIGNED_SHORT, DE_NULL);
 
-		renderQuadGridReference(reference,  numQuads, numCols, refPtr + offset + curOffset);
+		readPixelsToBuffer(*this, m_readbackBufs[slot], numCols*VERIFY_QUAD_SIZE, numRows*VERIFY_QUAD_SIZE);
 
-		rendered.setSize(numCols*VERIFY_QUAD_SIZE, numRows*VERIFY_QUAD_SIZE);
-		glu::readPixels(m_renderCtx, 0, 0, rendered.getAccess());
+		renderQuadGridReference(reference[slot], numQuads, numCols, refPtr + offset + curOffset);
 
-		if (!tcu::pixelThresholdCompare(m_log, "RenderResult", imageSetDesc.c_str(), reference, rendered, threshold, tcu::COMPARE_LOG_RESULT))
+		// Verify previous batch.
+		if (batchNdx > 0)
 		{
-			isOk = false;
-			break;
+			const int prevSlot = 1 - slot;
+
+			rendered.setSize(reference[prevSlot].getWidth(), reference[prevSlot].getHeight());
+			mapReadbackBuffer(*this, m_readbackBufs[prevSlot], rendered);
+
+			isOk = tcu::pixelThresholdCompare(m_log, "RenderResult", imageSetDesc[prevSlot].c_str(), reference[prevSlot], rendered, threshold, tcu::COMPARE_LOG_RESULT);
 		}
 
-		numVerified += isLeftoverBatch ? numRemaining : numBytesToVerify;
+		numVerified	+= isLeftoverBatch ? numRemaining : numBytesToVerify;
+		batchNdx	+= 1;
+	}
+
+	// Verify last batch.
+	if (isOk)
+	{
+		const int lastSlot = (batchNdx - 1) % 2;
+
+		DE_ASSERT(batchNdx > 0);
+
+		rendered.setSize(reference[lastSlot].getWidth(), reference[lastSlot].getHeight());
+		mapReadbackBuffer(*this, m_readbackBufs[lastSlot], rendered);
+
+		isOk = tcu::pixelThresholdCompare(m_log, "RenderResult", imageSetDesc[lastSlot].c_str(), reference[lastSlot], rendered, threshold, tcu::COMPARE_LOG_RESULT);
 	}
 
 	glBindVertexArray(0);
@@ -657,7 +725,13 @@ IndexArrayVerifier::IndexArrayVerifier (glu::RenderContext& renderCtx, tcu::Test
 	, m_program				(DE_NULL)
 	, m_posLoc				(0)
 	, m_colorLoc			(0)
+	, m_vao					(0)
+	, m_positionBuf			(0)
+	, m_colorBuf			(0)
+	, m_fetchedPositionBuf	(0)
+	, m_fetchedColorBuf		(0)
 {
+	std::fill(DE_ARRAY_BEGIN(m_readbackBufs), DE_ARRAY_END(m_readbackBufs), 0u);
 
 	const glu::ContextType	ctxType		= renderCtx.getType();
 	const glu::GLSLVersion	glslVersion	= glu::isContextTypeES(ctxType) ? glu::GLSL_VERSION_300_ES : glu::GLSL_VERSION_330;
@@ -697,6 +771,9 @@ IndexArrayVerifier::IndexArrayVerifier (glu::RenderContext& renderCtx, tcu::Test
 	gl.genVertexArrays(1, &m_vao);
 	gl.genBuffers(1, &m_positionBuf);
 	gl.genBuffers(1, &m_colorBuf);
+	gl.genBuffers(1, &m_fetchedPositionBuf);
+	gl.genBuffers(1, &m_fetchedColorBuf);
+	gl.genBuffers(DE_LENGTH_OF_ARRAY(m_readbackBufs), &m_readbackBufs[0]);
 	GLU_EXPECT_NO_ERROR(gl.getError(), "Initialization failed");
 }
 
@@ -708,6 +785,11 @@ IndexArrayVerifier::~IndexArrayVerifier (void)
 	if (m_positionBuf)	gl.deleteBuffers(1, &m_positionBuf);
 	if (m_colorBuf)		gl.deleteBuffers(1, &m_colorBuf);
 
+	if (m_fetchedPositionBuf)	gl.deleteBuffers(1, &m_fetchedPositionBuf);
+	if (m_fetchedColorBuf)		gl.deleteBuffers(1, &m_fetchedColorBuf);
+
+	gl.deleteBuffers(DE_LENGTH_OF_ARRAY(m_readbackBufs), &m_readbackBufs[0]);
+
 	delete m_program;
 }
 
@@ -770,8 +852,10 @@ bool IndexArrayVerifier::verify (deUint32 buffer, const deUint8* refPtr, int off
 
 	tcu::Surface				indexBufferImg		(viewportW, viewportH);
 	tcu::Surface				referenceImg		(viewportW, viewportH);
+	string						imageSetDesc[2];
 
 	int							numVerified			= 0;
+	int							batchNdx			= 0;
 	bool						isOk				= true;
 
 	DE_STATIC_ASSERT(sizeof(tcu::Vec2) == sizeof(float)*2);
@@ -795,27 +879,34 @@ bool IndexArrayVerifier::verify (deUint32 buffer, const deUint8* refPtr, int off
 	glBlendFunc					(GL_ONE, GL_ONE);
 	glBlendEquation				(GL_FUNC_ADD);
 
-	while (numVerified < numBytes)
+	// Vertex data for the indexed draws is the same for all batches.
+	glBindBuffer				(GL_ARRAY_BUFFER, m_positionBuf);
+	glBufferData				(GL_ARRAY_BUFFER, (glw::GLsizeiptr)(positions.size()*sizeof(positions[0])), &positions[0], GL_STATIC_DRAW);
+	glBindBuffer				(GL_ARRAY_BUFFER, m_colorBuf);
+	glBufferData				(GL_ARRAY_BUFFER, (glw::GLsizeiptr)(colors.size()*sizeof(colors[0])), &colors[0], GL_STATIC_DRAW);
+
+	// Both images of batch N are read back asynchronously while batch N-1 is compared.
+	while (isOk && numVerified < numBytes)
 	{
-		int		numRemaining		= numBytes-numVerified;
-		bool	isLeftoverBatch		= numRemaining < minBytesPerBatch;
-		int		numBytesToVerify	= isLeftoverBatch ? minBytesPerBatch			: de::min(MAX_LINES_PER_INDEX_ARRAY_DRAW+1, numRemaining);
-		int		curOffset			= isLeftoverBatch ? (numBytes-minBytesPerBatch)	: numVerified;
-		string	imageSetDesc		= string("Bytes ") + de::toString(offset+curOffset) + " to " + de::toString(offset+curOffset+numBytesToVerify-1);
+		const int	slot				= batchNdx % 2;
+		int			numRemaining		= numBytes-numVerified;
+		bool		isLeftoverBatch		= numRemaining < minBytesPerBatch;
+		int			numBytesToVerify	= isLeftoverBatch ? minBytesPerBatch			: de::min(MAX_LINES_PER_INDEX_ARRAY_DRAW+1, numRemaining);
+		int			curOffset			= isLeftoverBatch ? (numBytes-minBytesPerBatch)	: numVerified;
+
+		imageSetDesc[slot] = string("Bytes ") + de::toString(offset+curOffset) + " to " + de::toString(offset+curOffset+numBytesToVerify-1);
 
 		// Step 1: Render using index buffer.
 		glClear					(GL_COLOR_BUFFER_BIT);
 
 		glBindBuffer			(GL_ARRAY_BUFFER, m_positionBuf);
-		glBufferData			(GL_ARRAY_BUFFER, (glw::GLsizeiptr)(positions.size()*sizeof(positions[0])), &positions[0], GL_STREAM_DRAW);
 		glVertexAttribPointer	(m_posLoc, 2, GL_FLOAT, GL_FALSE, 0, DE_NULL);
 
 		glBindBuffer			(GL_ARRAY_BUFFER, m_colorBuf);
-		glBufferData			(GL_ARRAY_BUFFER, (glw::GLsizeiptr)(colors.size()*sizeof(colors[0])), &colors[0], GL_STREAM_DRAW);
 		glVertexAttribPointer	(m_colorLoc, 3, GL_FLOAT, GL_FALSE, 0, DE_NULL);
 
 		glDrawElements			(GL_LINE_STRIP, numBytesToVerify, GL_UNSIGNED_BYTE, (void*)(deUintptr)(offset+curOffset));
-		glu::readPixels			(m_renderCtx, 0, 0, indexBufferImg.getAccess());
+		readPixelsToBuffer		(*this, m_readbackBufs[slot*2 + 0], viewportW, viewportH);
 
 		// Step 2: Do manual fetch and render without index buffer.
 		execVertexFetch(&fetchedPos[0], &positions[0], refPtr+offset+curOffset, numBytesToVerify);
@@ -823,24 +914,43 @@ bool IndexArrayVerifier::verify (deUint32 buffer, const deUint8* refPtr, int off
 
 		glClear					(GL_COLOR_BUFFER_BIT);
 
-		glBindBuffer			(GL_ARRAY_BUFFER, m_positionBuf);
+		glBindBuffer			(GL_ARRAY_BUFFER, m_fetchedPositionBuf);
 		glBufferData			(GL_ARRAY_BUFFER, (glw::GLsizeiptr)(fetchedPos.size()*sizeof(fetchedPos[0])), &fetchedPos[0], GL_STREAM_DRAW);
 		glVertexAttribPointer	(m_posLoc, 2, GL_FLOAT, GL_FALSE, 0, DE_NULL);
 
-		glBindBuffer			(GL_ARRAY_BUFFER, m_colorBuf);
+		glBindBuffer			(GL_ARRAY_BUFFER, m_fetchedColorBuf);
 		glBufferData			(GL_ARRAY_BUFFER, (glw::GLsizeiptr)(fetchedColor.size()*sizeof(fetchedColor[0])), &fetchedColor[0], GL_STREAM_DRAW);
 		glVertexAttribPointer	(m_colorLoc, 3, GL_FLOAT, GL_FALSE, 0, DE_NULL);
 
 		glDrawArrays			(GL_LINE_STRIP, 0, numBytesToVerify);
-		glu::readPixels			(m_renderCtx, 0, 0, referenceImg.getAccess());
+		readPixelsToBuffer		(*this, m_readbackBufs[slot*2 + 1], viewportW, viewportH);
 
-		if (!tcu::pixelThresholdCompare(m_log, "RenderResult", imageSetDesc.c_str(), referenceImg, indexBufferImg, threshold, tcu::COMPARE_LOG_RESULT))
+		// Step 3: Compare previous batch.
+		if (batchNdx > 0)
 		{
-			isOk = false;
-			break;
+			const int prevSlot = 1 - slot;
+
+			mapReadbackBuffer(*this, m_readbackBufs[prevSlot*2 + 0], indexBufferImg);
+			mapReadbackBuffer(*this, m_readbackBufs[prevSlot*2 + 1], referenceImg);
+
+			isOk = tcu::pixelThresholdCompare(m_log, "RenderResult", imageSetDesc[prevSlot].c_str(), referenceImg, indexBufferImg, threshold, tcu::COMPARE_LOG_RESULT);
 		}
 
-		numVerified += isLeftoverBatch ? numRemaining : numBytesToVerify;
+		numVerified	+= isLeftoverBatch ? numRemaining : numBytesToVerify;
+		batchNdx	+= 1;
+	}
+
+	// Compare last batch.
+	if (isOk)
+	{
+		const int lastSlot = (batchNdx - 1) % 2;
+
+		DE_ASSERT(batchNdx > 0);
+
+		mapReadbackBuffer(*this, m_readbackBufs[lastSlot*2 + 0], indexBufferImg);
+		mapReadbackBuffer(*this, m_readbackBufs[lastSlot*2 + 1], referenceImg);
+
+		isOk = tcu::pixelThresholdCompare(m_log, "RenderResult", imageSetDesc[lastSlot].c_str(), referenceImg, indexBufferImg, threshold, tcu::COMPARE_LOG_RESULT);
 	}
 
 	glBindVertexArray(0);
@@ -258,6 +258,7 @@ private:
 	deUint32			m_vao;
 	deUint32			m_positionBuf;
 	deUint32			m_indexBuf;
+	deUint32			m_readbackBufs[2];		//!< Double-buffered pixel pack buffers
 };
 
 class IndexArrayVerifier : public BufferVerifierBase
@@ -278,6 +279,9 @@ private:
 	deUint32			m_vao;
 	deUint32			m_positionBuf;
 	deUint32			m_colorBuf;
+	deUint32			m_fetchedPositionBuf;
+	deUint32			m_fetchedColorBuf;
+	deUint32			m_readbackBufs[4];		//!< Result and reference pixel pack buffers for two batches
 };
 
 } // BufferTestUtil
@@ -26,6 +26,7 @@
 #include "tcuDefs.hpp"
 #include "tcuTestCase.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuPerfMeasurement.hpp"
 #include "tcuVector.hpp"
 #include "gluRenderContext.hpp"
 
@@ -36,34 +37,11 @@ namespace deqp
 namespace gls
 {
 
-struct LineParameters
-{
-	float offset;
-	float coefficient;
-
-	LineParameters (float offset_, float coefficient_) : offset(offset_), coefficient(coefficient_) {}
-};
-
-// Basic Theil-Sen linear estimate. Calculates median of all possible slope coefficients through two of the data points
-// and median of offsets corresponding with the median slope
-LineParameters theilSenLinearRegression (const std::vector<tcu::Vec2>& dataPoints);
-
-struct LineParametersWithConfidence
-{
-	float offset;
-	float offsetConfidenceUpper;
-	float offsetConfidenceLower;
-
-	float coefficient;
-	float coefficientConfidenceUpper;
-	float coefficientConfidenceLower;
-
-	float confidence;
-};
-
-// Median-of-medians version of Theil-Sen estimate. Calculates median of medians of slopes through a point and all other points.
-// Confidence interval is given as the range that contains the given fraction of all slopes/offsets
-LineParametersWithConfidence theilSenSiegelLinearRegression (const std::vector<tcu::Vec2>& dataPoints, float reportedConfidence);
+// Regression utilities live in tcu, names are kept here for existing users.
+using tcu::LineParameters;
+using tcu::LineParametersWithConfidence;
+using tcu::theilSenLinearRegression;
+using tcu::theilSenSiegelLinearRegression;
 
 struct MeasureState
 {
@@ -30,6 +30,10 @@
 #include "deFloat16.h"
 #include "deUniquePtr.hpp"
 #include "deArrayUtil.hpp"
+#include "deSharedPtr.hpp"
+#include "deThread.hpp"
+#include "deSemaphore.hpp"
+#include "deAtomic.h"
 
 #include "tcuTestLog.hpp"
 #include "tcuPixelFormat.hpp"
@@ -386,183 +390,9 @@ IterationLogSectionEmitter::~IterationLogSectionEmitter (void)
 		m_log << tcu::TestLog::EndSection;
 }
 
-// GLValue
+// Attribute component traits
 
-class GLValue
-{
-public:
-
-	template<class Type>
-	class WrappedType
-	{
-	public:
-		static WrappedType<Type>	create			(Type value)							{ WrappedType<Type> v; v.m_value = value; return v; }
-		inline Type					getValue		(void) const							{ return m_value; }
-
-		inline WrappedType<Type>	operator+		(const WrappedType<Type>& other) const	{ return WrappedType<Type>::create((Type)(m_value + other.getValue())); }
-		inline WrappedType<Type>	operator*		(const WrappedType<Type>& other) const	{ return WrappedType<Type>::create((Type)(m_value * other.getValue())); }
-		inline WrappedType<Type>	operator/		(const WrappedType<Type>& other) const	{ return WrappedType<Type>::create((Type)(m_value / other.getValue())); }
-		inline WrappedType<Type>	operator-		(const WrappedType<Type>& other) const	{ return WrappedType<Type>::create((Type)(m_value - other.getValue())); }
-
-		inline WrappedType<Type>&	operator+=		(const WrappedType<Type>& other)		{ m_value += other.getValue(); return *this; }
-		inline WrappedType<Type>&	operator*=		(const WrappedType<Type>& other)		{ m_value *= other.getValue(); return *this; }
-		inline WrappedType<Type>&	operator/=		(const WrappedType<Type>& other)		{ m_value /= other.getValue(); return *this; }
-		inline WrappedType<Type>&	operator-=		(const WrappedType<Type>& other)		{ m_value -= other.getValue(); return *this; }
-
-		inline bool					operator==		(const WrappedType<Type>& other) const	{ return m_value == other.m_value; }
-		inline bool					operator!=		(const WrappedType<Type>& other) const	{ return m_value != other.m_value; }
-		inline bool					operator<		(const WrappedType<Type>& other) const	{ return m_value < other.m_value; }
-		inline bool					operator>		(const WrappedType<Type>& other) const	{ return m_value > other.m_value; }
-		inline bool					operator<=		(const WrappedType<Type>& other) const	{ return m_value <= other.m_value; }
-		inline bool					operator>=		(const WrappedType<Type>& other) const	{ return m_value >= other.m_value; }
-
-		inline						operator Type	(void) const							{ return m_value; }
-		template<class T>
-		inline T					to				(void) const							{ return (T)m_value; }
-	private:
-		Type	m_value;
-	};
-
-	typedef WrappedType<deInt16>	Short;
-	typedef WrappedType<deUint16>	Ushort;
-
-	typedef WrappedType<deInt8>		Byte;
-	typedef WrappedType<deUint8>	Ubyte;
-
-	typedef WrappedType<float>		Float;
-	typedef WrappedType<double>		Double;
-
-	typedef WrappedType<deUint32>	Uint;
-
-	// All operations are calculated using 64bit values to avoid signed integer overflow which is undefined.
-	class Int
-	{
-	public:
-		static Int		create				(deInt32 value)				{ Int v; v.m_value = value; return v; }
-		inline deInt32	getValue			(void) const				{ return m_value; }
-
-		inline Int		operator+			(const Int& other) const	{ return Int::create((deInt32)((deInt64)m_value + (deInt64)other.getValue())); }
-		inline Int		operator*			(const Int& other) const	{ return Int::create((deInt32)((deInt64)m_value * (deInt64)other.getValue())); }
-		inline Int		operator/			(const Int& other) const	{ return Int::create((deInt32)((deInt64)m_value / (deInt64)other.getValue())); }
-		inline Int		operator-			(const Int& other) const	{ return Int::create((deInt32)((deInt64)m_value - (deInt64)other.getValue())); }
-
-		inline Int&		operator+=			(const Int& other)			{ m_value = (deInt32)((deInt64)m_value + (deInt64)other.getValue()); return *this; }
-		inline Int&		operator*=			(const Int& other)			{ m_value = (deInt32)((deInt64)m_value * (deInt64)other.getValue()); return *this; }
-		inline Int&		operator/=			(const Int& other)			{ m_value = (deInt32)((deInt64)m_value / (deInt64)other.getValue()); return *this; }
-		inline Int&		operator-=			(const Int& other)			{ m_value = (deInt32)((deInt64)m_value - (deInt64)other.getValue()); return *this; }
-
-		inline bool		operator==			(const Int& other) const	{ return m_value == other.m_value; }
-		inline bool		operator!=			(const Int& other) const	{ return m_value != other.m_value; }
-		inline bool		operator<			(const Int& other) const	{ return m_value < other.m_value; }
-		inline bool		operator>			(const Int& other) const	{ return m_value > other.m_value; }
-		inline bool		operator<=			(const Int& other) const	{ return m_value <= other.m_value; }
-		inline bool		operator>=			(const Int& other) const	{ return m_value >= other.m_value; }
-
-		inline			operator deInt32	(void) const				{ return m_value; }
-		template<class T>
-		inline T		to					(void) const				{ return (T)m_value; }
-	private:
-		deInt32	m_value;
-	};
-
-	class Half
-	{
-	public:
-		static Half			create			(float value)				{ Half h; h.m_value = floatToHalf(value); return h; }
-		inline deFloat16	getValue		(void) const				{ return m_value; }
-
-		inline Half			operator+		(const Half& other) const	{ return create(halfToFloat(m_value) + halfToFloat(other.getValue())); }
-		inline Half			operator*		(const Half& other) const	{ return create(halfToFloat(m_value) * halfToFloat(other.getValue())); }
-		inline Half			operator/		(const Half& other) const	{ return create(halfToFloat(m_value) / halfToFloat(other.getValue())); }
-		inline Half			operator-		(const Half& other) const	{ return create(halfToFloat(m_value) - halfToFloat(other.getValue())); }
-
-		inline Half&		operator+=		(const Half& other)			{ m_value = floatToHalf(halfToFloat(other.getValue()) + halfToFloat(m_value)); return *this; }
-		inline Half&		operator*=		(const Half& other)			{ m_value = floatToHalf(halfToFloat(other.getValue()) * halfToFloat(m_value)); return *this; }
-		inline Half&		operator/=		(const Half& other)			{ m_value = floatToHalf(halfToFloat(other.getValue()) / halfToFloat(m_value)); return *this; }
-		inline Half&		operator-=		(const Half& other)			{ m_value = floatToHalf(halfToFloat(other.getValue()) - halfToFloat(m_value)); return *this; }
-
-		inline bool			operator==		(const Half& other) const	{ return m_value == other.m_value; }
-		inline bool			operator!=		(const Half& other) const	{ return m_value != other.m_value; }
-		inline bool			operator<		(const Half& other) const	{ return halfToFloat(m_value) < halfToFloat(other.m_value); }
-		inline bool			operator>		(const Half& other) const	{ return halfToFloat(m_value) > halfToFloat(other.m_value); }
-		inline bool			operator<=		(const Half& other) const	{ return halfToFloat(m_value) <= halfToFloat(other.m_value); }
-		inline bool			operator>=		(const Half& other) const	{ return halfToFloat(m_value) >= halfToFloat(other.m_value); }
-
-		template<class T>
-		inline T			to				(void) const				{ return (T)halfToFloat(m_value); }
-
-		inline static deFloat16	floatToHalf		(float f);
-		inline static float		halfToFloat		(deFloat16 h);
-	private:
-		deFloat16 m_value;
-	};
-
-	class Fixed
-	{
-	public:
-		static Fixed		create			(deInt32 value)				{ Fixed v; v.m_value = value; return v; }
-		inline deInt32		getValue		(void) const				{ return m_value; }
-
-		inline Fixed		operator+		(const Fixed& other) const	{ return create(m_value + other.getValue()); }
-		inline Fixed		operator*		(const Fixed& other) const	{ return create(m_value * other.getValue()); }
-		inline Fixed		operator/		(const Fixed& other) const	{ return create(m_value / other.getValue()); }
-		inline Fixed		operator-		(const Fixed& other) const	{ return create(m_value - other.getValue()); }
-
-		inline Fixed&		operator+=		(const Fixed& other)		{ m_value += other.getValue(); return *this; }
-		inline Fixed&		operator*=		(const Fixed& other)		{ m_value *= other.getValue(); return *this; }
-		inline Fixed&		operator/=		(const Fixed& other)		{ m_value /= other.getValue(); return *this; }
-		inline Fixed&		operator-=		(const Fixed& other)		{ m_value -= other.getValue(); return *this; }
-
-		inline bool			operator==		(const Fixed& other) const	{ return m_value == other.m_value; }
-		inline bool			operator!=		(const Fixed& other) const	{ return m_value != other.m_value; }
-		inline bool			operator<		(const Fixed& other) const	{ return m_value < other.m_value; }
-		inline bool			operator>		(const Fixed& other) const	{ return m_value > other.m_value; }
-		inline bool			operator<=		(const Fixed& other) const	{ return m_value <= other.m_value; }
-		inline bool			operator>=		(const Fixed& other) const	{ return m_value >= other.m_value; }
-
-		inline				operator deInt32 (void) const				{ return m_value; }
-		template<class T>
-		inline T			to				(void) const				{ return (T)m_value; }
-	private:
-		deInt32				m_value;
-	};
-
-	// \todo [mika] This is pretty messy
-						GLValue			(void)			: type(DrawTestSpec::INPUTTYPE_LAST) {}
-	explicit			GLValue			(Float value)	: type(DrawTestSpec::INPUTTYPE_FLOAT),				fl(value)	{}
-	explicit			GLValue			(Fixed value)	: type(DrawTestSpec::INPUTTYPE_FIXED),				fi(value)	{}
-	explicit			GLValue			(Byte value)	: type(DrawTestSpec::INPUTTYPE_BYTE),				b(value)	{}
-	explicit			GLValue			(Ubyte value)	: type(DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE),		ub(value)	{}
-	explicit			GLValue			(Short value)	: type(DrawTestSpec::INPUTTYPE_SHORT),				s(value)	{}
-	explicit			GLValue			(Ushort value)	: type(DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT),		us(value)	{}
-	explicit			GLValue			(Int value)		: type(DrawTestSpec::INPUTTYPE_INT),				i(value)	{}
-	explicit			GLValue			(Uint value)	: type(DrawTestSpec::INPUTTYPE_UNSIGNED_INT),		ui(value)	{}
-	explicit			GLValue			(Half value)	: type(DrawTestSpec::INPUTTYPE_HALF),				h(value)	{}
-	explicit			GLValue			(Double value)	: type(DrawTestSpec::INPUTTYPE_DOUBLE),				d(value)	{}
-
-	float				toFloat			(void) const;
-
-	static GLValue		getMaxValue		(DrawTestSpec::InputType type);
-	static GLValue		getMinValue		(DrawTestSpec::InputType type);
-
-	DrawTestSpec::InputType	type;
-
-	union
-	{
-		Float		fl;
-		Fixed		fi;
-		Double		d;
-		Byte		b;
-		Ubyte		ub;
-		Short		s;
-		Ushort		us;
-		Int			i;
-		Uint		ui;
-		Half		h;
-	};
-};
-
-inline deFloat16 GLValue::Half::floatToHalf (float f)
+inline deFloat16 floatToHalf (float f)
 {
 	// No denorm support.
 	tcu::Float<deUint16, 5, 10, 15, tcu::FLOAT_HAS_SIGN> v(f);
@@ -570,339 +400,107 @@ inline deFloat16 GLValue::Half::floatToHalf (float f)
 	return v.bits();
 }
 
-inline float GLValue::Half::halfToFloat (deFloat16 h)
+inline float halfToFloat (deFloat16 h)
 {
 	return tcu::Float16((deUint16)h).asFloat();
 }
 
-float GLValue::toFloat (void) const
-{
-	switch (type)
-	{
-		case DrawTestSpec::INPUTTYPE_FLOAT:
-			return fl.getValue();
-
-		case DrawTestSpec::INPUTTYPE_BYTE:
-			return b.getValue();
-
-		case DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE:
-			return ub.getValue();
-
-		case DrawTestSpec::INPUTTYPE_SHORT:
-			return s.getValue();
-
-		case DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT:
-			return us.getValue();
-
-		case DrawTestSpec::INPUTTYPE_FIXED:
-		{
-			int maxValue = 65536;
-			return (float)(double(2 * fi.getValue() + 1) / (maxValue - 1));
-		}
-
-		case DrawTestSpec::INPUTTYPE_UNSIGNED_INT:
-			return (float)ui.getValue();
-
-		case DrawTestSpec::INPUTTYPE_INT:
-			return (float)i.getValue();
-
-		case DrawTestSpec::INPUTTYPE_HALF:
-			return h.to<float>();
-
-		case DrawTestSpec::INPUTTYPE_DOUBLE:
-			return d.to<float>();
-
-		default:
-			DE_ASSERT(false);
-			return 0.0f;
-	}
-}
-
-GLValue GLValue::getMaxValue (DrawTestSpec::InputType type)
-{
-	GLValue rangesHi[(int)DrawTestSpec::INPUTTYPE_LAST];
-
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_FLOAT]			= GLValue(Float::create(127.0f));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_DOUBLE]			= GLValue(Double::create(127.0f));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_BYTE]				= GLValue(Byte::create(127));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE]	= GLValue(Ubyte::create(255));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT]	= GLValue(Ushort::create(65530));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_SHORT]			= GLValue(Short::create(32760));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_FIXED]			= GLValue(Fixed::create(32760));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_INT]				= GLValue(Int::create(2147483647));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_UNSIGNED_INT]		= GLValue(Uint::create(4294967295u));
-	rangesHi[(int)DrawTestSpec::INPUTTYPE_HALF]				= GLValue(Half::create(256.0f));
-
-	return rangesHi[(int)type];
-}
-
-GLValue GLValue::getMinValue (DrawTestSpec::InputType type)
-{
-	GLValue rangesLo[(int)DrawTestSpec::INPUTTYPE_LAST];
-
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_FLOAT]			= GLValue(Float::create(-127.0f));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_DOUBLE]			= GLValue(Double::create(-127.0f));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_BYTE]				= GLValue(Byte::create(-127));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE]	= GLValue(Ubyte::create(0));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT]	= GLValue(Ushort::create(0));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_SHORT]			= GLValue(Short::create(-32760));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_FIXED]			= GLValue(Fixed::create(-32760));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_INT]				= GLValue(Int::create(-2147483647));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_UNSIGNED_INT]		= GLValue(Uint::create(0));
-	rangesLo[(int)DrawTestSpec::INPUTTYPE_HALF]				= GLValue(Half::create(-256.0f));
-
-	return rangesLo[(int)type];
-}
-
-template<typename T>
-struct GLValueTypeTraits;
-
-template<> struct GLValueTypeTraits<GLValue::Float>	 { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_FLOAT;			};
-template<> struct GLValueTypeTraits<GLValue::Double> { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_DOUBLE;			};
-template<> struct GLValueTypeTraits<GLValue::Byte>	 { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_BYTE;			};
-template<> struct GLValueTypeTraits<GLValue::Ubyte>	 { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE;	};
-template<> struct GLValueTypeTraits<GLValue::Ushort> { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT;	};
-template<> struct GLValueTypeTraits<GLValue::Short>	 { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_SHORT;			};
-template<> struct GLValueTypeTraits<GLValue::Fixed>	 { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_FIXED;			};
-template<> struct GLValueTypeTraits<GLValue::Int>	 { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_INT;			};
-template<> struct GLValueTypeTraits<GLValue::Uint>	 { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_UNSIGNED_INT;	};
-template<> struct GLValueTypeTraits<GLValue::Half>	 { static const DrawTestSpec::InputType Type = DrawTestSpec::INPUTTYPE_HALF;			};
-
-template<typename T>
-inline T extractGLValue (const GLValue& v);
-
-template<> GLValue::Float	inline extractGLValue<GLValue::Float>		(const GLValue& v) { return v.fl; }
-template<> GLValue::Double	inline extractGLValue<GLValue::Double>		(const GLValue& v) { return v.d; }
-template<> GLValue::Byte	inline extractGLValue<GLValue::Byte>		(const GLValue& v) { return v.b; }
-template<> GLValue::Ubyte	inline extractGLValue<GLValue::Ubyte>		(const GLValue& v) { return v.ub; }
-template<> GLValue::Ushort	inline extractGLValue<GLValue::Ushort>		(const GLValue& v) { return v.us; }
-template<> GLValue::Short	inline extractGLValue<GLValue::Short>		(const GLValue& v) { return v.s; }
-template<> GLValue::Fixed	inline extractGLValue<GLValue::Fixed>		(const GLValue& v) { return v.fi; }
-template<> GLValue::Int		inline extractGLValue<GLValue::Int>			(const GLValue& v) { return v.i; }
-template<> GLValue::Uint	inline extractGLValue<GLValue::Uint>		(const GLValue& v) { return v.ui; }
-template<> GLValue::Half	inline extractGLValue<GLValue::Half>		(const GLValue& v) { return v.h; }
-
-template<class T>
-inline T getRandom (deRandom& rnd, T min, T max);
-
-template<>
-inline GLValue::Float getRandom (deRandom& rnd, GLValue::Float min, GLValue::Float max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Float::create(min + deRandom_getFloat(&rnd) * (max.to<float>() - min.to<float>()));
-}
-
-template<>
-inline GLValue::Double getRandom (deRandom& rnd, GLValue::Double min, GLValue::Double max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Double::create(min + deRandom_getFloat(&rnd) * (max.to<float>() - min.to<float>()));
-}
-
-template<>
-inline GLValue::Short getRandom (deRandom& rnd, GLValue::Short min, GLValue::Short max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Short::create((min == max ? min : (deInt16)(min + (deRandom_getUint32(&rnd) % (max.to<int>() - min.to<int>())))));
-}
-
-template<>
-inline GLValue::Ushort getRandom (deRandom& rnd, GLValue::Ushort min, GLValue::Ushort max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Ushort::create((min == max ? min : (deUint16)(min + (deRandom_getUint32(&rnd) % (max.to<int>() - min.to<int>())))));
-}
-
-template<>
-inline GLValue::Byte getRandom (deRandom& rnd, GLValue::Byte min, GLValue::Byte max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Byte::create((min == max ? min : (deInt8)(min + (deRandom_getUint32(&rnd) % (max.to<int>() - min.to<int>())))));
-}
-
-template<>
-inline GLValue::Ubyte getRandom (deRandom& rnd, GLValue::Ubyte min, GLValue::Ubyte max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Ubyte::create((min == max ? min : (deUint8)(min + (deRandom_getUint32(&rnd) % (max.to<int>() - min.to<int>())))));
-}
-
-template<>
-inline GLValue::Fixed getRandom (deRandom& rnd, GLValue::Fixed min, GLValue::Fixed max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Fixed::create((min == max ? min : min + (deRandom_getUint32(&rnd) % (max.to<deUint32>() - min.to<deUint32>()))));
-}
-
-template<>
-inline GLValue::Half getRandom (deRandom& rnd, GLValue::Half min, GLValue::Half max)
-{
-	if (max < min)
-		return min;
-
-	float fMax = max.to<float>();
-	float fMin = min.to<float>();
-	GLValue::Half h = GLValue::Half::create(fMin + deRandom_getFloat(&rnd) * (fMax - fMin));
-	return h;
-}
-
-template<>
-inline GLValue::Int getRandom (deRandom& rnd, GLValue::Int min, GLValue::Int max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Int::create((min == max ? min : min + (deRandom_getUint32(&rnd) % (max.to<deUint32>() - min.to<deUint32>()))));
-}
-
-template<>
-inline GLValue::Uint getRandom (deRandom& rnd, GLValue::Uint min, GLValue::Uint max)
-{
-	if (max < min)
-		return min;
-
-	return GLValue::Uint::create((min == max ? min : min + (deRandom_getUint32(&rnd) % (max.to<deUint32>() - min.to<deUint32>()))));
-}
-
-// Minimum difference required between coordinates
-template<class T>
-inline T minValue (void);
-
-template<>
-inline GLValue::Float minValue (void)
-{
-	return GLValue::Float::create(4 * 1.0f);
-}
-
-template<>
-inline GLValue::Double minValue (void)
-{
-	return GLValue::Double::create(4 * 1.0f);
-}
-
-template<>
-inline GLValue::Short minValue (void)
-{
-	return GLValue::Short::create(4 * 256);
-}
-
-template<>
-inline GLValue::Ushort minValue (void)
-{
-	return GLValue::Ushort::create(4 * 256);
-}
-
-template<>
-inline GLValue::Byte minValue (void)
-{
-	return GLValue::Byte::create(4 * 1);
-}
-
-template<>
-inline GLValue::Ubyte minValue (void)
-{
-	return GLValue::Ubyte::create(4 * 2);
-}
-
-template<>
-inline GLValue::Fixed minValue (void)
-{
-	return GLValue::Fixed::create(4 * 1);
-}
-
-template<>
-inline GLValue::Int minValue (void)
+/*--------------------------------------------------------------------*//*!
+ * \brief Value range and generation rules of an attribute input type
+ *
+ * Components are generated directly in their storage type. Differences
+ * between successive values wrap around in the storage type and are
+ * compared with the sign bit masked off, so that isNear() rejects the
+ * same values as the generic value arithmetic did before.
+ *//*--------------------------------------------------------------------*/
+template<typename T, deInt64 Min, deInt64 Max, deUint32 AbsMask, deUint32 MinDiff>
+struct IntegerComponentTraits
 {
-	return GLValue::Int::create(4 * 16777216);
-}
+	typedef T Type;
 
-template<>
-inline GLValue::Uint minValue (void)
-{
-	return GLValue::Uint::create(4 * 16777216);
-}
+	static Type		getMin		(void)				{ return (Type)Min;																												}
+	static Type		getMax		(void)				{ return (Type)Max;																												}
+	static float	toFloat		(Type v)			{ return (float)v;																												}
+	static Type		getRandom	(deRandom& rnd)		{ return (Type)((deUint32)getMin() + deRandom_getUint32(&rnd) % ((deUint32)getMax() - (deUint32)getMin()));					}
+	static bool		isNear		(Type a, Type b)	{ return ((deUint32)(Type)((deUint32)a - (deUint32)b) & AbsMask) < MinDiff;													}
+};
 
-template<>
-inline GLValue::Half minValue (void)
+struct FixedComponentTraits : public IntegerComponentTraits<deInt32, -32760, 32760, 0x7FFFu, 4>
 {
-	return GLValue::Half::create(4 * 1.0f);
-}
-
-template<class T>
-inline T abs (T val);
+	static float	toFloat		(Type v)			{ return (float)(double(2 * v + 1) / (65536 - 1));																				}
+};
 
-template<>
-inline GLValue::Fixed abs (GLValue::Fixed val)
+struct FloatComponentTraits
 {
-	return GLValue::Fixed::create(0x7FFFu & val.getValue());
-}
+	typedef float Type;
 
-template<>
-inline GLValue::Ubyte abs (GLValue::Ubyte val)
-{
-	return val;
-}
+	static Type		getMin		(void)				{ return -127.0f;																												}
+	static Type		getMax		(void)				{ return 127.0f;																												}
+	static float	toFloat		(Type v)			{ return v;																														}
+	static Type		getRandom	(deRandom& rnd)		{ return getMin() + deRandom_getFloat(&rnd) * (getMax() - getMin());															}
+	static bool		isNear		(Type a, Type b)	{ return std::fabs(a - b) < 4.0f;																								}
+};
 
-template<>
-inline GLValue::Byte abs (GLValue::Byte val)
+struct DoubleComponentTraits
 {
-	return GLValue::Byte::create(0x7Fu & val.getValue());
-}
+	typedef double Type;
 
-template<>
-inline GLValue::Ushort abs (GLValue::Ushort val)
-{
-	return val;
-}
+	static Type		getMin		(void)				{ return -127.0;																												}
+	static Type		getMax		(void)				{ return 127.0;																													}
+	static float	toFloat		(Type v)			{ return (float)v;																												}
+	static Type		getRandom	(deRandom& rnd)		{ return getMin() + deRandom_getFloat(&rnd) * ((float)getMax() - (float)getMin());												}
+	static bool		isNear		(Type a, Type b)	{ return std::fabs((float)(a - b)) < 4.0f;																						}
+};
 
-template<>
-inline GLValue::Short abs (GLValue::Short val)
+struct HalfComponentTraits
 {
-	return GLValue::Short::create(0x7FFFu & val.getValue());
-}
+	typedef deFloat16 Type;
 
-template<>
-inline GLValue::Float abs (GLValue::Float val)
-{
-	return GLValue::Float::create(std::fabs(val.to<float>()));
-}
+	static Type		getMin		(void)				{ return floatToHalf(-256.0f);																									}
+	static Type		getMax		(void)				{ return floatToHalf(256.0f);																									}
+	static float	toFloat		(Type v)			{ return halfToFloat(v);																										}
+	static Type		getRandom	(deRandom& rnd)		{ return floatToHalf(toFloat(getMin()) + deRandom_getFloat(&rnd) * (toFloat(getMax()) - toFloat(getMin())));					}
+	static bool		isNear		(Type a, Type b)	{ return std::fabs(halfToFloat(floatToHalf(halfToFloat(a) - halfToFloat(b)))) < 4.0f;											}
+};
 
-template<>
-inline GLValue::Double abs (GLValue::Double val)
-{
-	return GLValue::Double::create(std::fabs(val.to<float>()));
-}
+template<DrawTestSpec::InputType Type>
+struct ComponentTraits;
 
-template<>
-inline GLValue::Uint abs (GLValue::Uint val)
-{
-	return val;
-}
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_FLOAT>			: public FloatComponentTraits																	{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_DOUBLE>			: public DoubleComponentTraits																	{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_HALF>				: public HalfComponentTraits																	{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_FIXED>			: public FixedComponentTraits																	{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_BYTE>				: public IntegerComponentTraits<deInt8,		-127,			127,			0x7Fu,			4 * 1>			{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE>	: public IntegerComponentTraits<deUint8,	0,				255,			0xFFu,			4 * 2>			{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_SHORT>			: public IntegerComponentTraits<deInt16,	-32760,			32760,			0x7FFFu,		4 * 256>		{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT>	: public IntegerComponentTraits<deUint16,	0,				65530,			0xFFFFu,		4 * 256>		{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_INT>				: public IntegerComponentTraits<deInt32,	-2147483647,	2147483647,		0x7FFFFFFFu,	4 * 16777216>	{};
+template<> struct ComponentTraits<DrawTestSpec::INPUTTYPE_UNSIGNED_INT>		: public IntegerComponentTraits<deUint32,	0,				4294967295ll,	0xFFFFFFFFu,	4 * 16777216>	{};
 
-template<>
-inline GLValue::Int abs (GLValue::Int val)
+template<DrawTestSpec::InputType Type>
+inline float getMaxValueAsFloat (void)
 {
-	return GLValue::Int::create(0x7FFFFFFFu & val.getValue());
+	return ComponentTraits<Type>::toFloat(ComponentTraits<Type>::getMax());
 }
 
-template<>
-inline GLValue::Half abs (GLValue::Half val)
+static float getInputTypeMaxValue (DrawTestSpec::InputType type)
 {
-	return GLValue::Half::create(std::fabs(val.to<float>()));
+	switch (type)
+	{
+		case DrawTestSpec::INPUTTYPE_FLOAT:				return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_FLOAT>();
+		case DrawTestSpec::INPUTTYPE_DOUBLE:			return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_DOUBLE>();
+		case DrawTestSpec::INPUTTYPE_HALF:				return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_HALF>();
+		case DrawTestSpec::INPUTTYPE_FIXED:				return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_FIXED>();
+		case DrawTestSpec::INPUTTYPE_BYTE:				return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_BYTE>();
+		case DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE:		return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE>();
+		case DrawTestSpec::INPUTTYPE_SHORT:				return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_SHORT>();
+		case DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT:	return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT>();
+		case DrawTestSpec::INPUTTYPE_INT:				return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_INT>();
+		case DrawTestSpec::INPUTTYPE_UNSIGNED_INT:		return getMaxValueAsFloat<DrawTestSpec::INPUTTYPE_UNSIGNED_INT>();
+		default:
+			DE_ASSERT(false);
+			return 0.0f;
+	}
 }
 
 // AttributeArray
@@ -1539,7 +1137,7 @@ private:
 	static char*			createIndices			(int seed, int elementCount, int offset, int min, int max, int indexBase);
 
 	static char*			generateBasicArray		(int seed, int elementCount, int componentCount, int offset, int stride, DrawTestSpec::InputType type);
-	template<typename T, typename GLType>
+	template<DrawTestSpec::InputType Type>
 	static char*			createBasicArray		(int seed, int elementCount, int componentCount, int offset, int stride);
 	static char*			generatePackedArray		(int seed, int elementCount, int componentCount, int offset, int stride);
 };
@@ -1556,16 +1154,16 @@ char* RandomArrayGenerator::generateBasicArray (int seed, int elementCount, int
 {
 	switch (type)
 	{
-		case DrawTestSpec::INPUTTYPE_FLOAT:				return createBasicArray<float,		GLValue::Float>	(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_DOUBLE:			return createBasicArray<double,		GLValue::Double>(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_SHORT:				return createBasicArray<deInt16,	GLValue::Short>	(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT:	return createBasicArray<deUint16,	GLValue::Ushort>(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_BYTE:				return createBasicArray<deInt8,		GLValue::Byte>	(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE:		return createBasicArray<deUint8,	GLValue::Ubyte>	(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_FIXED:				return createBasicArray<deInt32,	GLValue::Fixed>	(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_INT:				return createBasicArray<deInt32,	GLValue::Int>	(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_UNSIGNED_INT:		return createBasicArray<deUint32,	GLValue::Uint>	(seed, elementCount, componentCount, offset, stride);
-		case DrawTestSpec::INPUTTYPE_HALF:				return createBasicArray<deFloat16,	GLValue::Half>	(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_FLOAT:				return createBasicArray<DrawTestSpec::INPUTTYPE_FLOAT>			(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_DOUBLE:			return createBasicArray<DrawTestSpec::INPUTTYPE_DOUBLE>			(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_SHORT:				return createBasicArray<DrawTestSpec::INPUTTYPE_SHORT>			(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT:	return createBasicArray<DrawTestSpec::INPUTTYPE_UNSIGNED_SHORT>	(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_BYTE:				return createBasicArray<DrawTestSpec::INPUTTYPE_BYTE>			(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE:		return createBasicArray<DrawTestSpec::INPUTTYPE_UNSIGNED_BYTE>	(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_FIXED:				return createBasicArray<DrawTestSpec::INPUTTYPE_FIXED>			(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_INT:				return createBasicArray<DrawTestSpec::INPUTTYPE_INT>			(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_UNSIGNED_INT:		return createBasicArray<DrawTestSpec::INPUTTYPE_UNSIGNED_INT>	(seed, elementCount, componentCount, offset, stride);
+		case DrawTestSpec::INPUTTYPE_HALF:				return createBasicArray<DrawTestSpec::INPUTTYPE_HALF>			(seed, elementCount, componentCount, offset, stride);
 		default:
 			DE_ASSERT(false);
 			break;
@@ -1573,23 +1171,13 @@ char* RandomArrayGenerator::generateBasicArray (int seed, int elementCount, int
 	return DE_NULL;
 }
 
-#if (DE_COMPILER == DE_COMPILER_GCC) && (__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)
-	// GCC 4.8/4.9 incorrectly emits array-bounds warning from createBasicArray()
-#	define GCC_ARRAY_BOUNDS_FALSE_NEGATIVE 1
-#endif
-
-#if defined(GCC_ARRAY_BOUNDS_FALSE_NEGATIVE)
-#	pragma GCC diagnostic push
-#	pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-
-template<typename T, typename GLType>
+template<DrawTestSpec::InputType Type>
 char* RandomArrayGenerator::createBasicArray (int seed, int elementCount, int componentCount, int offset, int stride)
 {
 	DE_ASSERT(componentCount >= 1 && componentCount <= 4);
 
-	const GLType min = extractGLValue<GLType>(GLValue::getMinValue(GLValueTypeTraits<GLType>::Type));
-	const GLType max = extractGLValue<GLType>(GLValue::getMaxValue(GLValueTypeTraits<GLType>::Type));
+	typedef ComponentTraits<Type>		Traits;
+	typedef typename Traits::Type		T;
 
 	const size_t componentSize	= sizeof(T);
 	const size_t elementSize	= componentSize * componentCount;
@@ -1598,43 +1186,29 @@ char* RandomArrayGenerator::createBasicArray (int seed, int elementCount, int co
 	char* data = new char[bufferSize];
 	char* writePtr = data + offset;
 
-	GLType previousComponents[4];
+	T components[4];
 
 	deRandom rnd;
 	deRandom_init(&rnd, seed);
 
 	for (int vertexNdx = 0; vertexNdx < elementCount; vertexNdx++)
 	{
-		GLType components[4];
-
 		for (int componentNdx = 0; componentNdx < componentCount; componentNdx++)
 		{
-			components[componentNdx] = getRandom<GLType>(rnd, min, max);
+			const T value = Traits::getRandom(rnd);
 
-			// Try to not create vertex near previous
-			if (vertexNdx != 0 && abs(components[componentNdx] - previousComponents[componentNdx]) < minValue<GLType>())
-			{
-				// Too close, try again (but only once)
-				components[componentNdx] = getRandom<GLType>(rnd, min, max);
-			}
+			// Try to not create vertex near previous, too close values are regenerated (but only once)
+			components[componentNdx] = (vertexNdx != 0 && Traits::isNear(value, components[componentNdx])) ? Traits::getRandom(rnd) : value;
 		}
 
-		for (int componentNdx = 0; componentNdx < componentCount; componentNdx++)
-			previousComponents[componentNdx] = components[componentNdx];
-
-		for (int componentNdx = 0; componentNdx < componentCount; componentNdx++)
-			alignmentSafeAssignment(writePtr + componentNdx*componentSize, components[componentNdx].getValue());
-
+		// Element may be unaligned within the buffer
+		deMemcpy(writePtr, components, elementSize);
 		writePtr += stride;
 	}
 
 	return data;
 }
 
-#if defined(GCC_ARRAY_BOUNDS_FALSE_NEGATIVE)
-#	pragma GCC diagnostic pop
-#endif
-
 char* RandomArrayGenerator::generatePackedArray (int seed, int elementCount, int componentCount, int offset, int stride)
 {
 	DE_ASSERT(componentCount == 4);
@@ -1716,7 +1290,7 @@ char* RandomArrayGenerator::createIndices (int seed, int elementCount, int offse
 
 	for (int elementNdx = 0; elementNdx < elementCount; ++elementNdx)
 	{
-		deUint32 ndx = getRandom(rnd, GLValue::Uint::create(min), GLValue::Uint::create(max)).getValue();
+		deUint32 ndx = (min == max) ? (deUint32)min : (deUint32)min + deRandom_getUint32(&rnd) % (deUint32)(max - min);
 
 		// Try not to generate same index as any of previous two. This prevents
 		// generation of degenerate triangles and lines. If [min, max] is too
@@ -2897,11 +2471,11 @@ bool DrawTestSpec::valid (void) const
 	{
 		deUint32 maxIndexValue = 0;
 		if (indexType == INDEXTYPE_BYTE)
-			maxIndexValue = GLValue::getMaxValue(INPUTTYPE_UNSIGNED_BYTE).ub.getValue();
+			maxIndexValue = ComponentTraits<INPUTTYPE_UNSIGNED_BYTE>::getMax();
 		else if (indexType == INDEXTYPE_SHORT)
-			maxIndexValue = GLValue::getMaxValue(INPUTTYPE_UNSIGNED_SHORT).us.getValue();
+			maxIndexValue = ComponentTraits<INPUTTYPE_UNSIGNED_SHORT>::getMax();
 		else if (indexType == INDEXTYPE_INT)
-			maxIndexValue = GLValue::getMaxValue(INPUTTYPE_UNSIGNED_INT).ui.getValue();
+			maxIndexValue = ComponentTraits<INPUTTYPE_UNSIGNED_INT>::getMax();
 		else
 			DE_ASSERT(DE_FALSE);
 
@@ -3050,17 +2624,362 @@ static bool containsLineCases (const std::vector<DrawTestSpec>& m_specs)
 	return false;
 }
 
+struct DrawParameters
+{
+	size_t	primitiveElementCount;	// !< elements to be drawn
+	size_t	elementCount;			// !< elements in buffer (buffer should have at least primitiveElementCount ACCESSIBLE (index range, first) elements)
+	int		indexMin;
+	int		indexMax;
+	int		indexBase;
+};
+
+static DrawParameters getDrawParameters (const DrawTestSpec& spec)
+{
+	const MethodInfo	methodInfo				= getMethodInfo(spec.drawMethod);
+	const bool			ranged					= methodInfo.ranged;
+	const bool			hasFirst				= methodInfo.first;
+	const bool			hasBaseVtx				= methodInfo.baseVertex;
+
+	const size_t		primitiveElementCount	= getElementCount(spec.primitive, spec.primitiveCount);
+	const int			indexMin				= (ranged) ? (spec.indexMin) : (0);
+	const int			firstAddition			= (hasFirst) ? (spec.first) : (0);
+	const int			baseVertexAddition		= (hasBaseVtx && spec.baseVertex > 0) ? ( spec.baseVertex) : (0);			// spec.baseVertex > 0 => Create bigger attribute buffer
+	const int			indexBase				= (hasBaseVtx && spec.baseVertex < 0) ? (-spec.baseVertex) : (0);			// spec.baseVertex < 0 => Create bigger indices
+	const int			maxElementIndex			= (int)primitiveElementCount + indexMin + firstAddition - 1;
+	DrawParameters		params;
+
+	params.primitiveElementCount	= primitiveElementCount;
+	params.elementCount				= primitiveElementCount + indexMin + firstAddition + baseVertexAddition;
+	params.indexMin					= indexMin;
+	params.indexMax					= de::max(0, (ranged) ? (de::clamp<int>(spec.indexMax, 0, maxElementIndex)) : (maxElementIndex));
+	params.indexBase				= indexBase;
+
+	return params;
+}
+
+static void setupAttributeArrays (AttributePack& pack, const DrawTestSpec& spec, const DrawParameters& params)
+{
+	const MethodInfo	methodInfo		= getMethodInfo(spec.drawMethod);
+	const bool			instanced		= methodInfo.instanced;
+	const bool			ranged			= methodInfo.ranged;
+	rr::GenericVec4		nullAttribValue;
+
+	pack.clearArrays();
+
+	for (int attribNdx = 0; attribNdx < (int)spec.attribs.size(); attribNdx++)
+	{
+		DrawTestSpec::AttributeSpec attribSpec		= spec.attribs[attribNdx];
+		const bool					isPositionAttr	= (attribNdx == 0) || (attribSpec.additionalPositionAttribute);
+
+		if (attribSpec.useDefaultAttribute)
+		{
+			const int		seed		= 10 * attribSpec.hash() + 100 * spec.hash() + attribNdx;
+			rr::GenericVec4 attribValue = RandomArrayGenerator::generateAttributeValue(seed, attribSpec.inputType);
+
+			pack.newArray(DrawTestSpec::STORAGE_USER);
+			pack.getArray(attribNdx)->setupArray(false, 0, attribSpec.componentCount, attribSpec.inputType, attribSpec.outputType, false, 0, 0, attribValue, isPositionAttr, false);
+		}
+		else
+		{
+			const int					seed					= attribSpec.hash() + 100 * spec.hash() + attribNdx;
+			const size_t				elementSize				= attribSpec.componentCount * DrawTestSpec::inputTypeSize(attribSpec.inputType);
+			const size_t				stride					= (attribSpec.stride == 0) ? (elementSize) : (attribSpec.stride);
+			const size_t				evaluatedElementCount	= (instanced && attribSpec.instanceDivisor > 0) ? (spec.instanceCount / attribSpec.instanceDivisor + 1) : (params.elementCount);
+			const size_t				referencedElementCount	= (ranged) ? (de::max<size_t>(evaluatedElementCount, spec.indexMax + 1)) : (evaluatedElementCount);
+			const size_t				bufferSize				= attribSpec.offset + stride * (referencedElementCount - 1) + elementSize;
+			const char*					data					= RandomArrayGenerator::generateArray(seed, (int)referencedElementCount, attribSpec.componentCount, attribSpec.offset, (int)stride, attribSpec.inputType);
+
+			try
+			{
+				pack.newArray(attribSpec.storage);
+				pack.getArray(attribNdx)->data(DrawTestSpec::TARGET_ARRAY, bufferSize, data, attribSpec.usage);
+				pack.getArray(attribNdx)->setupArray(true, attribSpec.offset, attribSpec.componentCount, attribSpec.inputType, attribSpec.outputType, attribSpec.normalize, attribSpec.stride, attribSpec.instanceDivisor, nullAttribValue, isPositionAttr, attribSpec.bgraComponentOrder);
+
+				delete [] data;
+				data = NULL;
+			}
+			catch (...)
+			{
+				delete [] data;
+				throw;
+			}
+		}
+	}
+}
+
+static void drawAttributePack (AttributePack& pack, sglr::Context& ctx, const DrawTestSpec& spec, const DrawParameters& params, float coordScale, float colorScale)
+{
+	if (getMethodInfo(spec.drawMethod).indexed)
+	{
+		const int		seed				= spec.hash();
+		const size_t	indexElementSize	= DrawTestSpec::indexTypeSize(spec.indexType);
+		const size_t	indexArraySize		= spec.indexPointerOffset + indexElementSize * params.elementCount;
+		const char*		indexArray			= RandomArrayGenerator::generateIndices(seed, (int)params.elementCount, spec.indexType, spec.indexPointerOffset, params.indexMin, params.indexMax, params.indexBase);
+		const char*		indexPointerBase	= (spec.indexStorage == DrawTestSpec::STORAGE_USER) ? (indexArray) : ((char*)DE_NULL);
+		const char*		indexPointer		= indexPointerBase + spec.indexPointerOffset;
+
+		try
+		{
+			de::UniquePtr<AttributeArray> array (new AttributeArray(spec.indexStorage, ctx));
+
+			array->data(DrawTestSpec::TARGET_ELEMENT_ARRAY, indexArraySize, indexArray, DrawTestSpec::USAGE_STATIC_DRAW);
+			pack.render(spec.primitive, spec.drawMethod, 0, (int)params.primitiveElementCount, spec.indexType, indexPointer, spec.indexMin, spec.indexMax, spec.instanceCount, spec.indirectOffset, spec.baseVertex, coordScale, colorScale, array.get());
+
+			delete [] indexArray;
+			indexArray = NULL;
+		}
+		catch (...)
+		{
+			delete [] indexArray;
+			throw;
+		}
+	}
+	else
+		pack.render(spec.primitive, spec.drawMethod, spec.first, (int)params.primitiveElementCount, DrawTestSpec::INDEXTYPE_LAST, DE_NULL, 0, 0, spec.instanceCount, spec.indirectOffset, 0, coordScale, colorScale, DE_NULL);
+}
+
+// ReferenceRenderPool
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Renders reference images of all iterations on worker threads
+ *
+ * Each worker owns a separate reference context and regenerates the
+ * attribute data from the spec seeds, so results are identical to
+ * rendering them on the test thread. Workers run at most a fixed number
+ * of iterations ahead of the consumer to bound memory use.
+ *//*--------------------------------------------------------------------*/
+class ReferenceRenderPool
+{
+public:
+	struct Job
+	{
+							Job			(const DrawTestSpec& spec_, float coordScale_, float colorScale_)
+								: spec			(spec_)
+								, coordScale	(coordScale_)
+								, colorScale	(colorScale_)
+								, isGLError		(false)
+								, done			(0)
+							{
+							}
+
+		const DrawTestSpec	spec;
+		const float			coordScale;
+		const float			colorScale;
+
+		tcu::Surface		result;
+		std::string			error;
+		bool				isGLError;
+		de::Semaphore		done;
+	};
+
+	struct TargetParams
+	{
+		sglr::ReferenceContextLimits	limits;
+		tcu::PixelFormat				pixelFormat;
+		tcu::UVec2						size;
+		int								numSamples;
+		bool							useVao;
+
+		TargetParams (const sglr::ReferenceContextLimits& limits_, const tcu::PixelFormat& pixelFormat_, const tcu::UVec2& size_, int numSamples_, bool useVao_)
+			: limits		(limits_)
+			, pixelFormat	(pixelFormat_)
+			, size			(size_)
+			, numSamples	(numSamples_)
+			, useVao		(useVao_)
+		{
+		}
+	};
+
+								ReferenceRenderPool		(tcu::TestContext& testCtx, glu::RenderContext& renderCtx, const TargetParams& targetParams, const std::vector<de::SharedPtr<Job> >& jobs);
+								~ReferenceRenderPool	(void);
+
+	const Job&					waitResult				(int jobNdx);
+	void						releaseResult			(int jobNdx);
+
+private:
+	class WorkerThread;
+
+	enum
+	{
+		MAX_THREADS				= 16,
+		MAX_PENDING_PER_THREAD	= 2
+	};
+
+								ReferenceRenderPool		(const ReferenceRenderPool&); // not allowed!
+	ReferenceRenderPool&		operator=				(const ReferenceRenderPool&); // not allowed!
+
+	Job*						acquireJob				(void);
+	void						renderJob				(sglr::Context& ctx, AttributePack& pack, Job& job);
+
+	tcu::TestContext&			m_testCtx;
+	glu::RenderContext&			m_renderCtx;
+	const TargetParams			m_targetParams;
+	const std::vector<de::SharedPtr<Job> >	m_jobs;
+
+	de::Semaphore				m_freeSlots;
+	volatile deInt32			m_nextJobNdx;
+	volatile deUint32			m_abort;
+	std::vector<de::SharedPtr<WorkerThread> >	m_threads;
+};
+
+class ReferenceRenderPool::WorkerThread : public de::Thread
+{
+public:
+						WorkerThread	(ReferenceRenderPool& pool) : m_pool(pool) {}
+	void				run				(void);
+
+private:
+	ReferenceRenderPool&	m_pool;
+};
+
+void ReferenceRenderPool::WorkerThread::run (void)
+{
+	const TargetParams&								params		= m_pool.m_targetParams;
+	de::MovePtr<sglr::ReferenceContextBuffers>		buffers;
+	de::MovePtr<sglr::ReferenceContext>				context;
+	de::MovePtr<AttributePack>						pack;
+	std::string										setupError;
+
+	try
+	{
+		buffers	= de::MovePtr<sglr::ReferenceContextBuffers>(new sglr::ReferenceContextBuffers(params.pixelFormat, 0, 0, params.size.x(), params.size.y(), params.numSamples));
+		context	= de::MovePtr<sglr::ReferenceContext>(new sglr::ReferenceContext(params.limits, buffers->getColorbuffer(), buffers->getDepthbuffer(), buffers->getStencilbuffer()));
+		pack	= de::MovePtr<AttributePack>(new AttributePack(m_pool.m_testCtx, m_pool.m_renderCtx, *context, params.size, params.useVao, false));
+	}
+	catch (const std::exception& e)
+	{
+		setupError = e.what();
+	}
+
+	while (Job* const job = m_pool.acquireJob())
+	{
+		if (!pack)
+			job->error = "Failed to create reference context: " + setupError;
+		else
+		{
+			try
+			{
+				m_pool.renderJob(*context, *pack, *job);
+			}
+			catch (const glu::Error& e)
+			{
+				job->error		= e.what();
+				job->isGLError	= true;
+			}
+			catch (const std::exception& e)
+			{
+				job->error		= e.what();
+			}
+		}
+
+		job->done.increment();
+	}
+}
+
+ReferenceRenderPool::ReferenceRenderPool (tcu::TestContext& testCtx, glu::RenderContext& renderCtx, const TargetParams& targetParams, const std::vector<de::SharedPtr<Job> >& jobs)
+	: m_testCtx			(testCtx)
+	, m_renderCtx		(renderCtx)
+	, m_targetParams	(targetParams)
+	, m_jobs			(jobs)
+	, m_freeSlots		(0)
+	, m_nextJobNdx		(0)
+	, m_abort			(0)
+{
+	const int numThreads = de::clamp((int)deGetNumAvailableLogicalCores(), 1, de::min((int)MAX_THREADS, (int)m_jobs.size()));
+
+	for (int ndx = 0; ndx < numThreads * MAX_PENDING_PER_THREAD; ++ndx)
+		m_freeSlots.increment();
+
+	try
+	{
+		for (int ndx = 0; ndx < numThreads; ++ndx)
+		{
+			m_threads.push_back(de::SharedPtr<WorkerThread>(new WorkerThread(*this)));
+			m_threads.back()->start();
+		}
+	}
+	catch (...)
+	{
+		m_abort = 1;
+
+		for (int ndx = 0; ndx < (int)m_threads.size(); ++ndx)
+			m_freeSlots.increment();
+
+		for (int ndx = 0; ndx < (int)m_threads.size(); ++ndx)
+			if (m_threads[ndx]->isStarted())
+				m_threads[ndx]->join();
+
+		throw;
+	}
+}
+
+ReferenceRenderPool::~ReferenceRenderPool (void)
+{
+	m_abort = 1;
+
+	// Wake up workers waiting for a free slot
+	for (int ndx = 0; ndx < (int)m_threads.size(); ++ndx)
+		m_freeSlots.increment();
+
+	for (int ndx = 0; ndx < (int)m_threads.size(); ++ndx)
+		m_threads[ndx]->join();
+}
+
+ReferenceRenderPool::Job* ReferenceRenderPool::acquireJob (void)
+{
+	m_freeSlots.decrement();
+
+	if (!m_abort)
+	{
+		const int jobNdx = deAtomicIncrement32(&m_nextJobNdx) - 1;
+
+		if (jobNdx < (int)m_jobs.size())
+			return m_jobs[jobNdx].get();
+	}
+
+	// Let the other workers see the end too
+	m_freeSlots.increment();
+	return DE_NULL;
+}
+
+void ReferenceRenderPool::renderJob (sglr::Context& ctx, AttributePack& pack, Job& job)
+{
+	const DrawParameters params = getDrawParameters(job.spec);
+
+	setupAttributeArrays(pack, job.spec, params);
+	pack.updateProgram();
+	drawAttributePack(pack, ctx, job.spec, params, job.coordScale, job.colorScale);
+
+	job.result.setSize(pack.getSurface().getWidth(), pack.getSurface().getHeight());
+	tcu::copy(job.result.getAccess(), pack.getSurface().getAccess());
+}
+
+const ReferenceRenderPool::Job& ReferenceRenderPool::waitResult (int jobNdx)
+{
+	Job& job = *m_jobs[jobNdx];
+
+	job.done.decrement();
+	// Keep the result readable for subsequent waits
+	job.done.increment();
+
+	return job;
+}
+
+void ReferenceRenderPool::releaseResult (int jobNdx)
+{
+	m_jobs[jobNdx]->result.setSize(0, 0);
+	m_freeSlots.increment();
+}
+
 // DrawTest
 
 DrawTest::DrawTest (tcu::TestContext& testCtx, glu::RenderContext& renderCtx, const DrawTestSpec& spec, const char* name, const char* desc)
 	: TestCase			(testCtx, name, desc)
 	, m_renderCtx		(renderCtx)
 	, m_contextInfo		(DE_NULL)
-	, m_refBuffers		(DE_NULL)
-	, m_refContext		(DE_NULL)
 	, m_glesContext		(DE_NULL)
 	, m_glArrayPack		(DE_NULL)
-	, m_rrArrayPack		(DE_NULL)
+	, m_refRenderPool	(DE_NULL)
 	, m_maxDiffRed		(-1)
 	, m_maxDiffGreen	(-1)
 	, m_maxDiffBlue		(-1)
@@ -3074,11 +2993,9 @@ DrawTest::DrawTest (tcu::TestContext& testCtx, glu::RenderContext& renderCtx, co
 	: TestCase			(testCtx, name, desc)
 	, m_renderCtx		(renderCtx)
 	, m_contextInfo		(DE_NULL)
-	, m_refBuffers		(DE_NULL)
-	, m_refContext		(DE_NULL)
 	, m_glesContext		(DE_NULL)
 	, m_glArrayPack		(DE_NULL)
-	, m_rrArrayPack		(DE_NULL)
+	, m_refRenderPool	(DE_NULL)
 	, m_maxDiffRed		(-1)
 	, m_maxDiffGreen	(-1)
 	, m_maxDiffBlue		(-1)
@@ -3144,11 +3061,18 @@ void DrawTest::init (void)
 	else
 		DE_FATAL("Unknown context type");
 
-	m_refBuffers	= new sglr::ReferenceContextBuffers(m_renderCtx.getRenderTarget().getPixelFormat(), 0, 0, renderTargetWidth, renderTargetHeight, renderTargetSamples);
-	m_refContext	= new sglr::ReferenceContext(limits, m_refBuffers->getColorbuffer(), m_refBuffers->getDepthbuffer(), m_refBuffers->getStencilbuffer());
-
 	m_glArrayPack	= new AttributePack(m_testCtx, m_renderCtx, *m_glesContext, tcu::UVec2(renderTargetWidth, renderTargetHeight), useVao, true);
-	m_rrArrayPack	= new AttributePack(m_testCtx, m_renderCtx, *m_refContext,  tcu::UVec2(renderTargetWidth, renderTargetHeight), useVao, false);
+
+	// Reference images of all iterations are rendered in the background while the GL side is drawing
+	{
+		const ReferenceRenderPool::TargetParams		targetParams	(limits, m_renderCtx.getRenderTarget().getPixelFormat(), tcu::UVec2(renderTargetWidth, renderTargetHeight), renderTargetSamples, useVao);
+		std::vector<de::SharedPtr<ReferenceRenderPool::Job> >	jobs;
+
+		for (int specNdx = 0; specNdx < (int)m_specs.size(); ++specNdx)
+			jobs.push_back(de::SharedPtr<ReferenceRenderPool::Job>(new ReferenceRenderPool::Job(m_specs[specNdx], getCoordScale(m_specs[specNdx]), getColorScale(m_specs[specNdx]))));
+
+		m_refRenderPool = new ReferenceRenderPool(m_testCtx, m_renderCtx, targetParams, jobs);
+	}
 
 	m_maxDiffRed	= deCeilFloatToInt32(256.0f * (6.0f / (float)(1 << m_renderCtx.getRenderTarget().getPixelFormat().redBits)));
 	m_maxDiffGreen	= deCeilFloatToInt32(256.0f * (6.0f / (float)(1 << m_renderCtx.getRenderTarget().getPixelFormat().greenBits)));
@@ -3158,17 +3082,13 @@ void DrawTest::init (void)
 
 void DrawTest::deinit (void)
 {
+	delete m_refRenderPool;
 	delete m_glArrayPack;
-	delete m_rrArrayPack;
-	delete m_refBuffers;
-	delete m_refContext;
 	delete m_glesContext;
 	delete m_contextInfo;
 
+	m_refRenderPool	= DE_NULL;
 	m_glArrayPack	= DE_NULL;
-	m_rrArrayPack	= DE_NULL;
-	m_refBuffers	= DE_NULL;
-	m_refContext	= DE_NULL;
 	m_glesContext	= DE_NULL;
 	m_contextInfo	= DE_NULL;
 }
@@ -3195,129 +3115,26 @@ DrawTest::IterateResult DrawTest::iterate (void)
 
 	if (drawStep)
 	{
-		const MethodInfo	methodInfo				= getMethodInfo(spec.drawMethod);
-		const bool			indexed					= methodInfo.indexed;
-		const bool			instanced				= methodInfo.instanced;
-		const bool			ranged					= methodInfo.ranged;
-		const bool			hasFirst				= methodInfo.first;
-		const bool			hasBaseVtx				= methodInfo.baseVertex;
-
-		const size_t		primitiveElementCount	= getElementCount(spec.primitive, spec.primitiveCount);						// !< elements to be drawn
-		const int			indexMin				= (ranged) ? (spec.indexMin) : (0);
-		const int			firstAddition			= (hasFirst) ? (spec.first) : (0);
-		const int			baseVertexAddition		= (hasBaseVtx && spec.baseVertex > 0) ? ( spec.baseVertex) : (0);			// spec.baseVertex > 0 => Create bigger attribute buffer
-		const int			indexBase				= (hasBaseVtx && spec.baseVertex < 0) ? (-spec.baseVertex) : (0);			// spec.baseVertex < 0 => Create bigger indices
-		const size_t		elementCount			= primitiveElementCount + indexMin + firstAddition + baseVertexAddition;	// !< elements in buffer (buffer should have at least primitiveElementCount ACCESSIBLE (index range, first) elements)
-		const int			maxElementIndex			= (int)primitiveElementCount + indexMin + firstAddition - 1;
-		const int			indexMax				= de::max(0, (ranged) ? (de::clamp<int>(spec.indexMax, 0, maxElementIndex)) : (maxElementIndex));
-		float				coordScale				= getCoordScale(spec);
-		float				colorScale				= getColorScale(spec);
-
-		rr::GenericVec4		nullAttribValue;
+		const DrawParameters	params		= getDrawParameters(spec);
+		const float				coordScale	= getCoordScale(spec);
+		const float				colorScale	= getColorScale(spec);
 
 		// Log info
 		m_testCtx.getLog() << TestLog::Message << spec.getMultilineDesc() << TestLog::EndMessage;
 		m_testCtx.getLog() << TestLog::Message << TestLog::EndMessage; // extra line for clarity
 
 		// Data
-
-		m_glArrayPack->clearArrays();
-		m_rrArrayPack->clearArrays();
-
-		for (int attribNdx = 0; attribNdx < (int)spec.attribs.size(); attribNdx++)
-		{
-			DrawTestSpec::AttributeSpec attribSpec		= spec.attribs[attribNdx];
-			const bool					isPositionAttr	= (attribNdx == 0) || (attribSpec.additionalPositionAttribute);
-
-			if (attribSpec.useDefaultAttribute)
-			{
-				const int		seed		= 10 * attribSpec.hash() + 100 * spec.hash() + attribNdx;
-				rr::GenericVec4 attribValue = RandomArrayGenerator::generateAttributeValue(seed, attribSpec.inputType);
-
-				m_glArrayPack->newArray(DrawTestSpec::STORAGE_USER);
-				m_rrArrayPack->newArray(DrawTestSpec::STORAGE_USER);
-
-				m_glArrayPack->getArray(attribNdx)->setupArray(false, 0, attribSpec.componentCount, attribSpec.inputType, attribSpec.outputType, false, 0, 0, attribValue, isPositionAttr, false);
-				m_rrArrayPack->getArray(attribNdx)->setupArray(false, 0, attribSpec.componentCount, attribSpec.inputType, attribSpec.outputType, false, 0, 0, attribValue, isPositionAttr, false);
-			}
-			else
-			{
-				const int					seed					= attribSpec.hash() + 100 * spec.hash() + attribNdx;
-				const size_t				elementSize				= attribSpec.componentCount * DrawTestSpec::inputTypeSize(attribSpec.inputType);
-				const size_t				stride					= (attribSpec.stride == 0) ? (elementSize) : (attribSpec.stride);
-				const size_t				evaluatedElementCount	= (instanced && attribSpec.instanceDivisor > 0) ? (spec.instanceCount / attribSpec.instanceDivisor + 1) : (elementCount);
-				const size_t				referencedElementCount	= (ranged) ? (de::max<size_t>(evaluatedElementCount, spec.indexMax + 1)) : (evaluatedElementCount);
-				const size_t				bufferSize				= attribSpec.offset + stride * (referencedElementCount - 1) + elementSize;
-				const char*					data					= RandomArrayGenerator::generateArray(seed, (int)referencedElementCount, attribSpec.componentCount, attribSpec.offset, (int)stride, attribSpec.inputType);
-
-				try
-				{
-					m_glArrayPack->newArray(attribSpec.storage);
-					m_rrArrayPack->newArray(attribSpec.storage);
-
-					m_glArrayPack->getArray(attribNdx)->data(DrawTestSpec::TARGET_ARRAY, bufferSize, data, attribSpec.usage);
-					m_rrArrayPack->getArray(attribNdx)->data(DrawTestSpec::TARGET_ARRAY, bufferSize, data, attribSpec.usage);
-
-					m_glArrayPack->getArray(attribNdx)->setupArray(true, attribSpec.offset, attribSpec.componentCount, attribSpec.inputType, attribSpec.outputType, attribSpec.normalize, attribSpec.stride, attribSpec.instanceDivisor, nullAttribValue, isPositionAttr, attribSpec.bgraComponentOrder);
-					m_rrArrayPack->getArray(attribNdx)->setupArray(true, attribSpec.offset, attribSpec.componentCount, attribSpec.inputType, attribSpec.outputType, attribSpec.normalize, attribSpec.stride, attribSpec.instanceDivisor, nullAttribValue, isPositionAttr, attribSpec.bgraComponentOrder);
-
-					delete [] data;
-					data = NULL;
-				}
-				catch (...)
-				{
-					delete [] data;
-					throw;
-				}
-			}
-		}
+		setupAttributeArrays(*m_glArrayPack, spec, params);
 
 		// Shader program
 		if (updateProgram)
-		{
 			m_glArrayPack->updateProgram();
-			m_rrArrayPack->updateProgram();
-		}
 
 		// Draw
 		try
 		{
-			// indices
-			if (indexed)
-			{
-				const int		seed				= spec.hash();
-				const size_t	indexElementSize	= DrawTestSpec::indexTypeSize(spec.indexType);
-				const size_t	indexArraySize		= spec.indexPointerOffset + indexElementSize * elementCount;
-				const char*		indexArray			= RandomArrayGenerator::generateIndices(seed, (int)elementCount, spec.indexType, spec.indexPointerOffset, indexMin, indexMax, indexBase);
-				const char*		indexPointerBase	= (spec.indexStorage == DrawTestSpec::STORAGE_USER) ? (indexArray) : ((char*)DE_NULL);
-				const char*		indexPointer		= indexPointerBase + spec.indexPointerOffset;
-
-				de::UniquePtr<AttributeArray> glArray	(new AttributeArray(spec.indexStorage, *m_glesContext));
-				de::UniquePtr<AttributeArray> rrArray	(new AttributeArray(spec.indexStorage, *m_refContext));
-
-				try
-				{
-					glArray->data(DrawTestSpec::TARGET_ELEMENT_ARRAY, indexArraySize, indexArray, DrawTestSpec::USAGE_STATIC_DRAW);
-					rrArray->data(DrawTestSpec::TARGET_ELEMENT_ARRAY, indexArraySize, indexArray, DrawTestSpec::USAGE_STATIC_DRAW);
-
-					m_glArrayPack->render(spec.primitive, spec.drawMethod, 0, (int)primitiveElementCount, spec.indexType, indexPointer, spec.indexMin, spec.indexMax, spec.instanceCount, spec.indirectOffset, spec.baseVertex, coordScale, colorScale, glArray.get());
-					m_rrArrayPack->render(spec.primitive, spec.drawMethod, 0, (int)primitiveElementCount, spec.indexType, indexPointer, spec.indexMin, spec.indexMax, spec.instanceCount, spec.indirectOffset, spec.baseVertex, coordScale, colorScale, rrArray.get());
-
-					delete [] indexArray;
-					indexArray = NULL;
-				}
-				catch (...)
-				{
-					delete [] indexArray;
-					throw;
-				}
-			}
-			else
-			{
-				m_glArrayPack->render(spec.primitive, spec.drawMethod, spec.first, (int)primitiveElementCount, DrawTestSpec::INDEXTYPE_LAST, DE_NULL, 0, 0, spec.instanceCount, spec.indirectOffset, 0, coordScale, colorScale, DE_NULL);
-				m_testCtx.touchWatchdog();
-				m_rrArrayPack->render(spec.primitive, spec.drawMethod, spec.first, (int)primitiveElementCount, DrawTestSpec::INDEXTYPE_LAST, DE_NULL, 0, 0, spec.instanceCount, spec.indirectOffset, 0, coordScale, colorScale, DE_NULL);
-			}
+			drawAttributePack(*m_glArrayPack, *m_glesContext, spec, params, coordScale, colorScale);
+			m_testCtx.touchWatchdog();
 		}
 		catch (glu::Error& err)
 		{
@@ -3337,7 +3154,23 @@ DrawTest::IterateResult DrawTest::iterate (void)
 	}
 	else if (compareStep)
 	{
-		if (!compare(spec.primitive))
+		const ReferenceRenderPool::Job& reference = m_refRenderPool->waitResult(specNdx);
+
+		if (!reference.error.empty())
+		{
+			// Reference context reports misaligned data the same way as GL
+			const DrawTestSpec::CompatibilityTestType ctype = spec.isCompatibilityTest();
+
+			m_testCtx.getLog() << TestLog::Message << "Got error from reference renderer: " << reference.error << TestLog::EndMessage;
+
+			if (reference.isGLError && ctype == DrawTestSpec::COMPATIBILITY_UNALIGNED_OFFSET)
+				m_result.addResult(QP_TEST_RESULT_COMPATIBILITY_WARNING, "Failed to draw with unaligned buffers.");
+			else if (reference.isGLError && ctype == DrawTestSpec::COMPATIBILITY_UNALIGNED_STRIDE)
+				m_result.addResult(QP_TEST_RESULT_COMPATIBILITY_WARNING, "Failed to draw with unaligned stride.");
+			else
+				throw tcu::TestError("Reference rendering failed: " + reference.error);
+		}
+		else if (!compare(reference.result, spec.primitive))
 		{
 			const DrawTestSpec::CompatibilityTestType ctype = spec.isCompatibilityTest();
 
@@ -3348,6 +3181,8 @@ DrawTest::IterateResult DrawTest::iterate (void)
 			else
 				m_result.addResult(QP_TEST_RESULT_FAIL, "Image comparison failed.");
 		}
+
+		m_refRenderPool->releaseResult(specNdx);
 	}
 	else
 	{
@@ -3709,9 +3544,8 @@ static bool intersectionRelaxedLineImageCompare (tcu::TestLog& log, const char*
 	}
 }
 
-bool DrawTest::compare (gls::DrawTestSpec::Primitive primitiveType)
+bool DrawTest::compare (const tcu::Surface& ref, gls::DrawTestSpec::Primitive primitiveType)
 {
-	const tcu::Surface&	ref		= m_rrArrayPack->getSurface();
 	const tcu::Surface&	screen	= m_glArrayPack->getSurface();
 
 	if (m_renderCtx.getRenderTarget().getNumSamples() > 1)
@@ -3813,7 +3647,7 @@ float DrawTest::getCoordScale (const DrawTestSpec& spec) const
 		}
 		else
 		{
-			const float max = GLValue::getMaxValue(attribSpec.inputType).toFloat();
+			const float max = getInputTypeMaxValue(attribSpec.inputType);
 
 			attrMaxValue += (attribSpec.normalize && !inputTypeIsFloatType(attribSpec.inputType)) ? (1.0f) : (max * 1.1f);
 		}
@@ -3853,7 +3687,7 @@ float DrawTest::getColorScale (const DrawTestSpec& spec) const
 		}
 		else
 		{
-			const float max = GLValue::getMaxValue(attribSpec.inputType).toFloat();
+			const float max = getInputTypeMaxValue(attribSpec.inputType);
 
 			colorScale *= (attribSpec.normalize && !inputTypeIsFloatType(attribSpec.inputType) ? 1.0f : float(1.0 / double(max)));
 			if (attribSpec.outputType == DrawTestSpec::OUTPUTTYPE_VEC4 ||
@@ -35,18 +35,22 @@ class ContextInfo;
 namespace sglr
 {
 
-class ReferenceContextBuffers;
-class ReferenceContext;
 class Context;
 
 } // sglr
 
+namespace tcu
+{
+class Surface;
+}
+
 namespace deqp
 {
 namespace gls
 {
 
 class AttributePack;
+class ReferenceRenderPool;
 
 struct DrawTestSpec
 {
@@ -258,19 +262,17 @@ private:
 	void							deinit					(void);
 	IterateResult					iterate					(void);
 
-	bool							compare					(gls::DrawTestSpec::Primitive primitiveType);
+	bool							compare					(const tcu::Surface& ref, gls::DrawTestSpec::Primitive primitiveType);
 	float							getCoordScale			(const DrawTestSpec& spec) const;
 	float							getColorScale			(const DrawTestSpec& spec) const;
 
 	glu::RenderContext&				m_renderCtx;
 
 	glu::ContextInfo*				m_contextInfo;
-	sglr::ReferenceContextBuffers*	m_refBuffers;
-	sglr::ReferenceContext*			m_refContext;
 	sglr::Context*					m_glesContext;
 
 	AttributePack*					m_glArrayPack;
-	AttributePack*					m_rrArrayPack;
+	ReferenceRenderPool*			m_refRenderPool;
 
 	int								m_maxDiffRed;
 	int								m_maxDiffGreen;
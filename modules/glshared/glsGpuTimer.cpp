@@ -0,0 +1,164 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL (ES) Module
+ * -----------------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief GPU elapsed time measurement with timer queries.
+ *//*--------------------------------------------------------------------*/
+
+#include "glsGpuTimer.hpp"
+#include "gluDefs.hpp"
+#include "gluContextInfo.hpp"
+#include "deUniquePtr.hpp"
+
+#include "glwEnums.hpp"
+
+// From GL_EXT_disjoint_timer_query, not in generated enums.
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+
+namespace deqp
+{
+namespace gls
+{
+
+using namespace glw; // GL types
+
+template <typename FuncT>
+static FuncT getTimerFunc (const glu::RenderContext& renderCtx, FuncT coreFunc, const char* extName)
+{
+	return coreFunc ? coreFunc : (FuncT)renderCtx.getProcAddress(extName);
+}
+
+GpuTimer::GpuTimer (const glu::RenderContext& renderCtx)
+	: m_gl					(renderCtx.getFunctions())
+	, m_isES				(glu::isContextTypeES(renderCtx.getType()))
+	, m_genQueries			(getTimerFunc(renderCtx, m_gl.genQueries,			"glGenQueriesEXT"))
+	, m_deleteQueries		(getTimerFunc(renderCtx, m_gl.deleteQueries,		"glDeleteQueriesEXT"))
+	, m_beginQuery			(getTimerFunc(renderCtx, m_gl.beginQuery,			"glBeginQueryEXT"))
+	, m_endQuery			(getTimerFunc(renderCtx, m_gl.endQuery,				"glEndQueryEXT"))
+	, m_getQueryObjectuiv	(getTimerFunc(renderCtx, m_gl.getQueryObjectuiv,	"glGetQueryObjectuivEXT"))
+	, m_getQueryObjectui64v	(getTimerFunc(renderCtx, m_gl.getQueryObjectui64v,	"glGetQueryObjectui64vEXT"))
+	, m_numIntervals		(0)
+	, m_disjointBarrier		(0)
+{
+	if (!m_genQueries || !m_deleteQueries || !m_beginQuery || !m_endQuery || !m_getQueryObjectuiv || !m_getQueryObjectui64v)
+		throw tcu::NotSupportedError("Timer query entry points not found");
+
+	m_genQueries(MAX_INTERVALS_IN_FLIGHT, &m_queries[0]);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGenQueries()");
+
+	// Clear stale disjoint state.
+	checkDisjoint();
+}
+
+GpuTimer::~GpuTimer (void)
+{
+	m_deleteQueries(MAX_INTERVALS_IN_FLIGHT, &m_queries[0]);
+}
+
+bool GpuTimer::isSupported (const glu::RenderContext& renderCtx)
+{
+	const glu::ContextType					type		= renderCtx.getType();
+	const de::UniquePtr<glu::ContextInfo>	ctxInfo		(glu::ContextInfo::create(renderCtx));
+
+	if (glu::isContextTypeES(type))
+		return ctxInfo->isExtensionSupported("GL_EXT_disjoint_timer_query");
+	else
+		return glu::contextSupports(type, glu::ApiType::core(3, 3)) || ctxInfo->isExtensionSupported("GL_ARB_timer_query");
+}
+
+bool GpuTimer::checkDisjoint (void)
+{
+	GLint disjoint = GL_FALSE;
+
+	// Desktop timer queries have no disjoint state.
+	if (!m_isES)
+		return false;
+
+	m_gl.getIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGetIntegerv(GL_GPU_DISJOINT_EXT)");
+
+	return disjoint != GL_FALSE;
+}
+
+int GpuTimer::begin (void)
+{
+	const int intervalId = m_numIntervals++;
+
+	m_beginQuery(GL_TIME_ELAPSED, m_queries[intervalId % MAX_INTERVALS_IN_FLIGHT]);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glBeginQuery(GL_TIME_ELAPSED)");
+
+	return intervalId;
+}
+
+void GpuTimer::end (void)
+{
+	m_endQuery(GL_TIME_ELAPSED);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glEndQuery(GL_TIME_ELAPSED)");
+}
+
+GpuTimer::ResultStatus GpuTimer::getResult (int intervalId, bool wait, deUint64* elapsedUs)
+{
+	const GLuint	query		= m_queries[intervalId % MAX_INTERVALS_IN_FLIGHT];
+	GLuint64		elapsedNs	= 0;
+
+	DE_ASSERT(de::inBounds(intervalId, m_numIntervals - (int)MAX_INTERVALS_IN_FLIGHT, m_numIntervals));
+
+	if (intervalId < m_disjointBarrier)
+		return RESULT_DISJOINT;
+
+	if (!wait)
+	{
+		GLuint available = GL_FALSE;
+
+		m_getQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+		GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGetQueryObjectuiv(GL_QUERY_RESULT_AVAILABLE)");
+
+		if (available == GL_FALSE)
+			return RESULT_PENDING;
+	}
+
+	m_getQueryObjectui64v(query, GL_QUERY_RESULT, &elapsedNs);
+	GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGetQueryObjectui64v(GL_QUERY_RESULT)");
+
+	// \note Disjoint state must be checked after reading the result. It invalidates everything in flight.
+	if (checkDisjoint())
+	{
+		m_disjointBarrier = m_numIntervals;
+		return RESULT_DISJOINT;
+	}
+
+	*elapsedUs = (deUint64)(elapsedNs / 1000u);
+	return RESULT_OK;
+}
+
+bool GpuPerfTimer::getDurationUs (double& durationUs)
+{
+	deUint64 elapsedUs = 0;
+
+	DE_ASSERT(m_intervalId >= 0);
+
+	if (m_timer.getResult(m_intervalId, true, &elapsedUs) != GpuTimer::RESULT_OK)
+		return false;
+
+	durationUs = (double)elapsedUs;
+	return true;
+}
+
+} // gls
+} // deqp
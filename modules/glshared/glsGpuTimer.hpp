@@ -0,0 +1,124 @@
+#ifndef _GLSGPUTIMER_HPP
+#define _GLSGPUTIMER_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL (ES) Module
+ * -----------------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief GPU elapsed time measurement with timer queries.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuPerfMeasurement.hpp"
+#include "gluRenderContext.hpp"
+#include "glwFunctions.hpp"
+
+namespace deqp
+{
+namespace gls
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief GL_TIME_ELAPSED query wrapper
+ *
+ * Uses GL_EXT_disjoint_timer_query on ES and GL_ARB_timer_query (core in
+ * GL 3.3) on desktop GL. A small ring of query objects lets the result of
+ * a previous interval be read while the next one is being recorded.
+ *
+ * On ES a disjoint event (for example GPU frequency change) makes all
+ * in-flight results unreliable. Such results are reported as
+ * RESULT_DISJOINT and should be discarded.
+ *//*--------------------------------------------------------------------*/
+class GpuTimer
+{
+public:
+	enum
+	{
+		MAX_INTERVALS_IN_FLIGHT	= 4
+	};
+
+	enum ResultStatus
+	{
+		RESULT_PENDING = 0,
+		RESULT_OK,
+		RESULT_DISJOINT,
+
+		RESULT_LAST
+	};
+
+	explicit					GpuTimer		(const glu::RenderContext& renderCtx);
+								~GpuTimer		(void);
+
+	static bool					isSupported		(const glu::RenderContext& renderCtx);
+
+	//! Start timed interval, returns interval id. At most MAX_INTERVALS_IN_FLIGHT intervals may be unread.
+	int							begin			(void);
+	void						end				(void);
+
+	//! Get elapsed time of interval in microseconds. Blocks until the result is available if wait is set.
+	ResultStatus				getResult		(int intervalId, bool wait, deUint64* elapsedUs);
+
+	const char*					getExtensionName(void) const { return m_isES ? "GL_EXT_disjoint_timer_query" : "GL_ARB_timer_query"; }
+
+private:
+								GpuTimer		(const GpuTimer&);
+	GpuTimer&					operator=		(const GpuTimer&);
+
+	bool						checkDisjoint	(void);
+
+	const glw::Functions&		m_gl;
+	const bool					m_isES;
+
+	glw::glGenQueriesFunc				m_genQueries;
+	glw::glDeleteQueriesFunc			m_deleteQueries;
+	glw::glBeginQueryFunc				m_beginQuery;
+	glw::glEndQueryFunc					m_endQuery;
+	glw::glGetQueryObjectuivFunc		m_getQueryObjectuiv;
+	glw::glGetQueryObjectui64vFunc		m_getQueryObjectui64v;
+
+	glw::GLuint					m_queries[MAX_INTERVALS_IN_FLIGHT];
+	int							m_numIntervals;
+	int							m_disjointBarrier;	//!< Intervals started before this id are invalidated by a disjoint event.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief GpuTimer as tcu::PerfTimer backend
+ *
+ * Result of each interval is waited for in getDurationUs(). Intervals hit
+ * by a disjoint event are reported as unreliable.
+ *//*--------------------------------------------------------------------*/
+class GpuPerfTimer : public tcu::PerfTimer
+{
+public:
+	explicit					GpuPerfTimer	(const glu::RenderContext& renderCtx) : m_timer(renderCtx), m_intervalId(-1) {}
+
+	const char*					getName			(void) const	{ return m_timer.getExtensionName();	}
+
+	void						begin			(void)			{ m_intervalId = m_timer.begin();		}
+	void						end				(void)			{ m_timer.end();						}
+	bool						getDurationUs	(double& durationUs);
+
+private:
+	GpuTimer					m_timer;
+	int							m_intervalId;
+};
+
+} // gls
+} // deqp
+
+#endif // _GLSGPUTIMER_HPP
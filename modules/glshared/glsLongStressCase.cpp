@@ -42,11 +42,19 @@
 #include "deString.h"
 #include "deSharedPtr.hpp"
 #include "deClock.h"
+#include "deInt32.h"
+#include "deMutex.hpp"
+#include "deThread.hpp"
+#include "deUniquePtr.hpp"
+#include "gluRenderConfig.hpp"
+#include "gluRenderContext.hpp"
+#include "glwWrapper.hpp"
 
 #include "glw.h"
 
 #include <limits>
 #include <vector>
+#include <algorithm>
 #include <iomanip>
 #include <map>
 #include <iomanip>
@@ -684,7 +692,7 @@ public:
 						~Program				(void);
 
 	void				setSources				(const string& vertSource, const string& fragSource);
-	void				build					(TestLog& log);
+	void				build					(TestLog* log);
 	void				use						(void) const { DE_ASSERT(m_isBuilt); glUseProgram(m_programGL); }
 	void				setRandomUniforms		(const vector<VarSpec>& uniforms, const string& shaderNameManglingSuffix, Random& rnd) const;
 	void				setAttribute			(const Buffer& attrBuf, int attrBufOffset, const VarSpec& attrSpec, const string& shaderNameManglingSuffix) const;
@@ -738,7 +746,7 @@ void Program::setSources (const string& vertSource, const string& fragSource)
 	m_hasSources = true;
 }
 
-void Program::build (TestLog& log)
+void Program::build (TestLog* const log)
 {
 	DE_ASSERT(m_hasSources);
 
@@ -749,10 +757,12 @@ void Program::build (TestLog& log)
 
 	if (!(vertCompileOk && fragCompileOk && linkOk))
 	{
-		log << TestLog::ShaderProgram(linkOk, attemptLink ? getProgramInfoLog(m_programGL) : string(""))
-			<< TestLog::Shader(QP_SHADER_TYPE_VERTEX, m_vertSource, vertCompileOk, getShaderInfoLog(m_vertShaderGL))
-			<< TestLog::Shader(QP_SHADER_TYPE_FRAGMENT, m_fragSource, fragCompileOk, getShaderInfoLog(m_fragShaderGL))
-			<< TestLog::EndShaderProgram;
+		// \note Only the test thread writes to the log.
+		if (log)
+			*log << TestLog::ShaderProgram(linkOk, attemptLink ? getProgramInfoLog(m_programGL) : string(""))
+				 << TestLog::Shader(QP_SHADER_TYPE_VERTEX, m_vertSource, vertCompileOk, getShaderInfoLog(m_vertShaderGL))
+				 << TestLog::Shader(QP_SHADER_TYPE_FRAGMENT, m_fragSource, fragCompileOk, getShaderInfoLog(m_fragShaderGL))
+				 << TestLog::EndShaderProgram;
 
 		throw tcu::TestError("Program build failed");
 	}
@@ -984,6 +994,118 @@ void GLObjectManager<T>::removeGarbageUntilUnder (const int limit, Random& rnd)
 	}
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Throughput and latency statistics of a shard
+ *
+ * Written by the thread running the shard, and collected periodically by
+ * the test thread.
+ *//*--------------------------------------------------------------------*/
+class ShardStats
+{
+public:
+						ShardStats			(void) : m_numIterations(0), m_isNotSupported(false) {}
+
+	void				addIteration		(deUint64 latencyUs);
+	deUint64			collect				(vector<deUint64>& latenciesUsDst);
+	void				setError			(const string& error, bool isNotSupported);
+	bool				getError			(string& errorDst, bool& isNotSupportedDst) const;
+
+private:
+	mutable de::Mutex	m_lock;
+	deUint64			m_numIterations;
+	vector<deUint64>	m_latenciesUs;		//!< Iteration latencies since last collect().
+	string				m_error;
+	bool				m_isNotSupported;
+};
+
+void ShardStats::addIteration (const deUint64 latencyUs)
+{
+	const de::ScopedLock lock (m_lock);
+
+	m_numIterations += 1;
+	m_latenciesUs.push_back(latencyUs);
+}
+
+deUint64 ShardStats::collect (vector<deUint64>& latenciesUsDst)
+{
+	const de::ScopedLock lock (m_lock);
+
+	latenciesUsDst.insert(latenciesUsDst.end(), m_latenciesUs.begin(), m_latenciesUs.end());
+	m_latenciesUs.clear();
+
+	return m_numIterations;
+}
+
+void ShardStats::setError (const string& error, const bool isNotSupported)
+{
+	const de::ScopedLock lock (m_lock);
+
+	m_error				= error;
+	m_isNotSupported	= isNotSupported;
+}
+
+bool ShardStats::getError (string& errorDst, bool& isNotSupportedDst) const
+{
+	const de::ScopedLock lock (m_lock);
+
+	errorDst			= m_error;
+	isNotSupportedDst	= m_isNotSupported;
+
+	return !m_error.empty();
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief GL objects and random state operated on by a single thread
+ *
+ * Each thread owns its shard exclusively, so the object managers need no
+ * locking. The memory usage limits of the case are divided evenly between
+ * the shards. With multiple threads the shards live in different, shared
+ * GL contexts, so the GL still sees concurrent use of its object tables.
+ *//*--------------------------------------------------------------------*/
+class Shard
+{
+public:
+	struct ProgramResources
+	{
+		vector<deUint8>				attrDataBuf;
+		vector<int>					attrDataOffsets;
+		vector<int>					attrDataSizes;
+		string						shaderNameManglingSuffix;
+	};
+
+									Shard						(int shardNdx, const Random& rnd, int maxTexMemoryUsageBytes, int maxBufMemoryUsageBytes, int numProgramContexts, const vector<deUint16>& vertexIndices, ShardStats& stats);
+
+	const int						shardNdx;
+	const int						maxTexMemoryUsageBytes;
+	const int						maxBufMemoryUsageBytes;
+
+	Random							rnd;
+	GLObjectManager<Program>		programs;
+	GLObjectManager<Buffer>			buffers;
+	GLObjectManager<Texture>		textures;
+	vector<deUint16>				vertexIndices;
+	vector<ProgramResources>		programResources;
+	int								numIterations;
+
+	ShardStats&						stats;
+
+private:
+									Shard						(const Shard&); // Not allowed.
+	Shard&							operator=					(const Shard&); // Not allowed.
+};
+
+Shard::Shard (const int shardNdx_, const Random& rnd_, const int maxTexMemoryUsageBytes_, const int maxBufMemoryUsageBytes_, const int numProgramContexts, const vector<deUint16>& vertexIndices_, ShardStats& stats_)
+	: shardNdx					(shardNdx_)
+	, maxTexMemoryUsageBytes	(maxTexMemoryUsageBytes_)
+	, maxBufMemoryUsageBytes	(maxBufMemoryUsageBytes_)
+	, rnd						(rnd_)
+	, vertexIndices				(vertexIndices_)
+	, programResources			(numProgramContexts)
+	, numIterations				(0)
+	, stats						(stats_)
+{
+}
+
 } // LongStressCaseInternal
 
 using namespace LongStressCaseInternal;
@@ -1075,6 +1197,88 @@ static void generateAttribs (vector<deUint8>& attrDataBuf, vector<int>& attrData
 	}
 }
 
+namespace LongStressCaseInternal
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Thread running stress iterations on its own shard
+ *
+ * The thread creates an offscreen context sharing objects with the case's
+ * render context, and runs iterations until stopped.
+ *//*--------------------------------------------------------------------*/
+class ShardThread : public de::Thread
+{
+public:
+							ShardThread		(const LongStressCase& stressCase, int shardNdx, const Random& rnd, ShardStats& stats);
+
+	void					run				(void);
+	void					requestStop		(void) { m_stopRequested = 1; }
+
+private:
+	const LongStressCase&	m_case;
+	const int				m_shardNdx;
+	const Random			m_rnd;
+	ShardStats&				m_stats;
+	volatile deUint32		m_stopRequested;
+};
+
+ShardThread::ShardThread (const LongStressCase& stressCase, const int shardNdx, const Random& rnd, ShardStats& stats)
+	: m_case			(stressCase)
+	, m_shardNdx		(shardNdx)
+	, m_rnd				(rnd)
+	, m_stats			(stats)
+	, m_stopRequested	(0)
+{
+}
+
+void ShardThread::run (void)
+{
+	try
+	{
+		const tcu::RenderTarget&	mainTarget	= m_case.m_renderCtx.getRenderTarget();
+		glu::RenderConfig			config		(m_case.m_renderCtx.getType());
+
+		config.surfaceType	= glu::RenderConfig::SURFACETYPE_OFFSCREEN_GENERIC;
+		config.width		= mainTarget.getWidth();
+		config.height		= mainTarget.getHeight();
+
+		{
+			const de::UniquePtr<glu::RenderContext>	renderCtx	(glu::createRenderContext(m_case.m_testCtx.getPlatform(), m_case.m_testCtx.getCommandLine(), config, &m_case.m_renderCtx));
+			const int								numThreads	= m_case.m_numThreads;
+
+			// \note createRenderContext() leaves the new context current on this thread.
+			glw::setCurrentThreadFunctions(&renderCtx->getFunctions());
+
+			{
+				Shard shard (m_shardNdx, m_rnd, m_case.m_maxTexMemoryUsageBytes / numThreads, m_case.m_maxBufMemoryUsageBytes / numThreads, (int)m_case.m_programContexts.size(), m_case.m_vertexIndices, m_stats);
+
+				while (!m_stopRequested)
+				{
+					const deUint64 iterStartUs = deGetMicroseconds();
+
+					m_case.runIteration(shard, renderCtx->getRenderTarget().getWidth(), renderCtx->getRenderTarget().getHeight(), DE_NULL);
+					renderCtx->postIterate();
+					m_stats.addIteration(deGetMicroseconds() - iterStartUs);
+				}
+			}
+
+			glw::setCurrentThreadFunctions(DE_NULL);
+		}
+	}
+	catch (const tcu::NotSupportedError& e)
+	{
+		m_stats.setError(e.what(), true);
+	}
+	catch (const std::exception& e)
+	{
+		m_stats.setError(e.what(), false);
+	}
+
+	glw::setCurrentThreadFunctions(DE_NULL);
+}
+
+} // LongStressCaseInternal
+
 LongStressCase::LongStressCase (tcu::TestContext&				testCtx,
 								const glu::RenderContext&		renderCtx,
 								const char* const				name,
@@ -1088,7 +1292,8 @@ LongStressCase::LongStressCase (tcu::TestContext&				testCtx,
 								const deUint32					indexBufferUsage,
 								const deUint32					attrBufferUsage,
 								const int						redundantBufferFactor,
-								const bool						showDebugInfo)
+								const bool						showDebugInfo,
+								const int						numThreads)
 	: tcu::TestCase					(testCtx, name, desc)
 	, m_renderCtx					(renderCtx)
 	, m_maxTexMemoryUsageBytes		(maxTexMemoryUsageBytes)
@@ -1102,6 +1307,7 @@ LongStressCase::LongStressCase (tcu::TestContext&				testCtx,
 	, m_attrBufferUsage				(attrBufferUsage)
 	, m_redundantBufferFactor		(redundantBufferFactor)
 	, m_showDebugInfo				(showDebugInfo)
+	, m_numThreads					(numThreads)
 	, m_numIterations				(getNumIterations(testCtx, 5))
 	, m_isGLES3						(contextSupports(renderCtx.getType(), glu::ApiType::es(3,0)))
 	, m_currentIteration			(0)
@@ -1109,14 +1315,15 @@ LongStressCase::LongStressCase (tcu::TestContext&				testCtx,
 	, m_lastLogTime					((deUint64)-1)
 	, m_lastLogIteration			(0)
 	, m_currentLogEntryNdx			(0)
+	, m_statsStartTimeUs			(0)
+	, m_lastStatsTimeUs				(0)
 	, m_rnd							(deStringHash(getName()) ^ testCtx.getCommandLine().getBaseSeed())
-	, m_programs					(DE_NULL)
-	, m_buffers						(DE_NULL)
-	, m_textures					(DE_NULL)
+	, m_mainShard					(DE_NULL)
 	, m_debugInfoRenderer			(DE_NULL)
 {
 	DE_ASSERT(m_numVerticesPerDrawCall <= (int)std::numeric_limits<deUint16>::max()+1); // \note Vertices are referred to with 16-bit indices.
 	DE_ASSERT(m_redundantBufferFactor > 0);
+	DE_ASSERT(m_numThreads > 0);
 }
 
 LongStressCase::~LongStressCase (void)
@@ -1178,10 +1385,12 @@ void LongStressCase::init (void)
 		m_vertexIndices.push_back((deUint16)i);
 	m_rnd.shuffle(m_vertexIndices.begin(), m_vertexIndices.end());
 
-	DE_ASSERT(!m_programs && !m_buffers && !m_textures);
-	m_programs = new GLObjectManager<Program>;
-	m_buffers = new GLObjectManager<Buffer>;
-	m_textures = new GLObjectManager<Texture>;
+	DE_ASSERT(!m_mainShard && m_shardStats.empty());
+	for (int shardNdx = 0; shardNdx < m_numThreads; shardNdx++)
+		m_shardStats.push_back(SharedPtr<ShardStats>(new ShardStats));
+
+	// \note Main shard continues with the case's random state, so single-threaded cases are unaffected by sharding.
+	m_mainShard = new Shard(0, m_rnd, m_maxTexMemoryUsageBytes / m_numThreads, m_maxBufMemoryUsageBytes / m_numThreads, (int)m_programContexts.size(), m_vertexIndices, *m_shardStats[0]);
 
 	m_currentIteration = 0;
 
@@ -1189,6 +1398,7 @@ void LongStressCase::init (void)
 		TestLog& log = m_testCtx.getLog();
 
 		log << TestLog::Message << "Number of iterations: "										<< (m_numIterations > 0 ? toString(m_numIterations) : "infinite")				<< TestLog::EndMessage
+			<< TestLog::Message << "Number of threads (each with its own shared context): "		<< m_numThreads																	<< TestLog::EndMessage
 			<< TestLog::Message << "Number of draw calls per iteration: "						<< m_numDrawCallsPerIteration													<< TestLog::EndMessage
 			<< TestLog::Message << "Number of triangles per draw call: "						<< m_numTrianglesPerDrawCall													<< TestLog::EndMessage
 			<< TestLog::Message << "Using triangle strips"																														<< TestLog::EndMessage
@@ -1237,53 +1447,47 @@ void LongStressCase::init (void)
 
 void LongStressCase::deinit (void)
 {
-	m_programResources.clear();
+	stopThreads();
 
-	delete m_programs;
-	m_programs = DE_NULL;
+	m_programResources.clear();
 
-	delete m_buffers;
-	m_buffers = DE_NULL;
+	delete m_mainShard;
+	m_mainShard = DE_NULL;
 
-	delete m_textures;
-	m_textures = DE_NULL;
+	m_shardStats.clear();
 
 	delete m_debugInfoRenderer;
 	m_debugInfoRenderer = DE_NULL;
 }
 
-LongStressCase::IterateResult LongStressCase::iterate (void)
-{
-	TestLog&					log							= m_testCtx.getLog();
-	const int					renderWidth					= m_renderCtx.getRenderTarget().getWidth();
-	const int					renderHeight				= m_renderCtx.getRenderTarget().getHeight();
-	const bool					useClientMemoryIndexData	= m_rnd.getFloat() < m_probabilities.clientMemoryIndexData;
-	const bool					useDrawArrays				= m_rnd.getFloat() < m_probabilities.useDrawArrays;
-	const bool					separateAttributeBuffers	= m_rnd.getFloat() < m_probabilities.separateAttributeBuffers;
-	const int					progContextNdx				= m_rnd.getInt(0, (int)m_programContexts.size()-1);
-	const ProgramContext&		programContext				= m_programContexts[progContextNdx];
-	ProgramResources&			programResources			= m_programResources[progContextNdx];
-	const string				programName					= "prog" + toString(progContextNdx);
-	const string				textureNamePrefix			= "tex" + toString(progContextNdx) + "_";
-	const string				unitedAttrBufferNamePrefix	= "attrBuf" + toString(progContextNdx) + "_";
-	const string				indexBufferName				= "indexBuf" + toString(progContextNdx);
-	const string				separateAttrBufNamePrefix	= "attrBuf" + toString(progContextNdx) + "_";
-
-	if (m_currentIteration == 0)
-		m_lastLogTime = m_startTimeSeconds = deGetTime();
+void LongStressCase::runIteration (Shard& shard, const int renderWidth, const int renderHeight, TestLog* const log) const
+{
+	Random&							rnd							= shard.rnd;
+	const bool						useClientMemoryIndexData	= rnd.getFloat() < m_probabilities.clientMemoryIndexData;
+	const bool						useDrawArrays				= rnd.getFloat() < m_probabilities.useDrawArrays;
+	const bool						separateAttributeBuffers	= rnd.getFloat() < m_probabilities.separateAttributeBuffers;
+	const int						progContextNdx				= rnd.getInt(0, (int)m_programContexts.size()-1);
+	const ProgramContext&			programContext				= m_programContexts[progContextNdx];
+	const ProgramResources&			sharedResources				= m_programResources[progContextNdx];
+	Shard::ProgramResources&		programResources			= shard.programResources[progContextNdx];
+	const string					programName					= "prog" + toString(progContextNdx);
+	const string					textureNamePrefix			= "tex" + toString(progContextNdx) + "_";
+	const string					unitedAttrBufferNamePrefix	= "attrBuf" + toString(progContextNdx) + "_";
+	const string					indexBufferName				= "indexBuf" + toString(progContextNdx);
+	const string					separateAttrBufNamePrefix	= "attrBuf" + toString(progContextNdx) + "_";
 
 	// Make or re-compile programs.
 	{
-		const bool hadProgram = m_programs->has(programName);
+		const bool hadProgram = shard.programs.has(programName);
 
 		if (!hadProgram)
-			m_programs->make(programName);
+			shard.programs.make(programName);
 
-		Program& prog = m_programs->get(programName);
+		Program& prog = shard.programs.get(programName);
 
-		if (!hadProgram || m_rnd.getFloat() < m_probabilities.rebuildProgram)
+		if (!hadProgram || rnd.getFloat() < m_probabilities.rebuildProgram)
 		{
-			programResources.shaderNameManglingSuffix = toString((deUint16)deUint64Hash((deUint64)m_currentIteration ^ deGetTime()));
+			programResources.shaderNameManglingSuffix = toString((deUint16)deUint64Hash(((deUint64)shard.shardNdx << 32) ^ (deUint64)shard.numIterations ^ deGetTime()));
 
 			prog.setSources(mangleShaderNames(programContext.vertexSource, programResources.shaderNameManglingSuffix),
 							mangleShaderNames(programContext.fragmentSource, programResources.shaderNameManglingSuffix));
@@ -1294,29 +1498,29 @@ LongStressCase::IterateResult LongStressCase::iterate (void)
 		prog.use();
 	}
 
-	Program& program = m_programs->get(programName);
+	Program& program = shard.programs.get(programName);
 
 	// Make or re-upload textures.
 
 	for (int texNdx = 0; texNdx < (int)programContext.textureSpecs.size(); texNdx++)
 	{
 		const string		texName		= textureNamePrefix + toString(texNdx);
-		const bool			hadTexture	= m_textures->has(texName);
+		const bool			hadTexture	= shard.textures.has(texName);
 		const TextureSpec&	spec		= programContext.textureSpecs[texNdx];
 
 		if (!hadTexture)
-			m_textures->make(texName, spec.textureType);
+			shard.textures.make(texName, spec.textureType);
 
-		if (!hadTexture || m_rnd.getFloat() < m_probabilities.reuploadTexture)
+		if (!hadTexture || rnd.getFloat() < m_probabilities.reuploadTexture)
 		{
-			Texture& texture = m_textures->get(texName);
+			Texture& texture = shard.textures.get(texName);
 
-			m_textures->removeGarbageUntilUnder(m_maxTexMemoryUsageBytes - texture.getApproxMemUsageDiff(spec.width, spec.height, spec.internalFormat, spec.useMipmap), m_rnd);
+			shard.textures.removeGarbageUntilUnder(shard.maxTexMemoryUsageBytes - texture.getApproxMemUsageDiff(spec.width, spec.height, spec.internalFormat, spec.useMipmap), rnd);
 
-			if (!hadTexture || m_rnd.getFloat() < m_probabilities.reuploadWithTexImage)
-				texture.setData(programResources.unusedTextures[texNdx]->getAccess(), spec.width, spec.height, spec.internalFormat, spec.useMipmap);
+			if (!hadTexture || rnd.getFloat() < m_probabilities.reuploadWithTexImage)
+				texture.setData(sharedResources.unusedTextures[texNdx]->getAccess(), spec.width, spec.height, spec.internalFormat, spec.useMipmap);
 			else
-				texture.setSubData(programResources.unusedTextures[texNdx]->getAccess(), 0, 0, spec.width, spec.height);
+				texture.setSubData(sharedResources.unusedTextures[texNdx]->getAccess(), 0, 0, spec.width, spec.height);
 
 			texture.toUnit(0);
 			texture.setWrap(spec.sWrap, spec.tWrap);
@@ -1330,35 +1534,35 @@ LongStressCase::IterateResult LongStressCase::iterate (void)
 		vector<int> texSpecIndices(programContext.textureSpecs.size());
 		for (int i = 0; i < (int)texSpecIndices.size(); i++)
 			texSpecIndices[i] = i;
-		m_rnd.shuffle(texSpecIndices.begin(), texSpecIndices.end());
+		rnd.shuffle(texSpecIndices.begin(), texSpecIndices.end());
 		for (int i = 0; i < (int)texSpecIndices.size(); i++)
-			m_textures->get(textureNamePrefix + toString(texSpecIndices[i])).toUnit(programContext.textureSpecs[i].textureUnit);
+			shard.textures.get(textureNamePrefix + toString(texSpecIndices[i])).toUnit(programContext.textureSpecs[i].textureUnit);
 	}
 
 	// Make or re-upload index buffer.
 
 	if (!useDrawArrays)
 	{
-		m_rnd.shuffle(m_vertexIndices.begin(), m_vertexIndices.end());
+		rnd.shuffle(shard.vertexIndices.begin(), shard.vertexIndices.end());
 
 		if (!useClientMemoryIndexData)
 		{
-			const bool hadIndexBuffer = m_buffers->has(indexBufferName);
+			const bool hadIndexBuffer = shard.buffers.has(indexBufferName);
 
 			if (!hadIndexBuffer)
-				m_buffers->make(indexBufferName);
+				shard.buffers.make(indexBufferName);
 
-			Buffer& indexBuf = m_buffers->get(indexBufferName);
+			Buffer& indexBuf = shard.buffers.get(indexBufferName);
 
-			if (!hadIndexBuffer || m_rnd.getFloat() < m_probabilities.reuploadBuffer)
+			if (!hadIndexBuffer || rnd.getFloat() < m_probabilities.reuploadBuffer)
 			{
-				m_buffers->removeGarbageUntilUnder(m_maxBufMemoryUsageBytes - indexBuf.getApproxMemUsageDiff(m_vertexIndices), m_rnd);
-				const deUint32 target = m_rnd.getFloat() < m_probabilities.randomBufferUploadTarget ? randomBufferTarget(m_rnd, m_isGLES3) : GL_ELEMENT_ARRAY_BUFFER;
+				shard.buffers.removeGarbageUntilUnder(shard.maxBufMemoryUsageBytes - indexBuf.getApproxMemUsageDiff(shard.vertexIndices), rnd);
+				const deUint32 target = rnd.getFloat() < m_probabilities.randomBufferUploadTarget ? randomBufferTarget(rnd, m_isGLES3) : GL_ELEMENT_ARRAY_BUFFER;
 
-				if (!hadIndexBuffer || m_rnd.getFloat() < m_probabilities.reuploadWithBufferData)
-					indexBuf.setData(m_vertexIndices, target, m_rnd.getFloat() < m_probabilities.randomBufferUsage ? randomBufferUsage(m_rnd, m_isGLES3) : m_indexBufferUsage);
+				if (!hadIndexBuffer || rnd.getFloat() < m_probabilities.reuploadWithBufferData)
+					indexBuf.setData(shard.vertexIndices, target, rnd.getFloat() < m_probabilities.randomBufferUsage ? randomBufferUsage(rnd, m_isGLES3) : m_indexBufferUsage);
 				else
-					indexBuf.setSubData(m_vertexIndices, 0, m_numVerticesPerDrawCall, target);
+					indexBuf.setSubData(shard.vertexIndices, 0, m_numVerticesPerDrawCall, target);
 			}
 		}
 	}
@@ -1366,34 +1570,34 @@ LongStressCase::IterateResult LongStressCase::iterate (void)
 	// Set vertex attributes. If not using client-memory data, make or re-upload attribute buffers.
 
 	generateAttribs(programResources.attrDataBuf, programResources.attrDataOffsets, programResources.attrDataSizes,
-					programContext.attributes, programContext.positionAttrName, m_numVerticesPerDrawCall, m_rnd);
+					programContext.attributes, programContext.positionAttrName, m_numVerticesPerDrawCall, rnd);
 
-	if (!(m_rnd.getFloat() < m_probabilities.clientMemoryAttributeData))
+	if (!(rnd.getFloat() < m_probabilities.clientMemoryAttributeData))
 	{
 		if (separateAttributeBuffers)
 		{
 			for (int attrNdx = 0; attrNdx < (int)programContext.attributes.size(); attrNdx++)
 			{
-				const int usedRedundantBufferNdx = m_rnd.getInt(0, m_redundantBufferFactor-1);
+				const int usedRedundantBufferNdx = rnd.getInt(0, m_redundantBufferFactor-1);
 
 				for (int redundantBufferNdx = 0; redundantBufferNdx < m_redundantBufferFactor; redundantBufferNdx++)
 				{
 					const string	curAttrBufName		= separateAttrBufNamePrefix + toString(attrNdx) + "_" + toString(redundantBufferNdx);
-					const bool		hadCurAttrBuffer	= m_buffers->has(curAttrBufName);
+					const bool		hadCurAttrBuffer	= shard.buffers.has(curAttrBufName);
 
 					if (!hadCurAttrBuffer)
-						m_buffers->make(curAttrBufName);
+						shard.buffers.make(curAttrBufName);
 
-					Buffer& curAttrBuf = m_buffers->get(curAttrBufName);
+					Buffer& curAttrBuf = shard.buffers.get(curAttrBufName);
 
-					if (!hadCurAttrBuffer || m_rnd.getFloat() < m_probabilities.reuploadBuffer)
+					if (!hadCurAttrBuffer || rnd.getFloat() < m_probabilities.reuploadBuffer)
 					{
-						m_buffers->removeGarbageUntilUnder(m_maxBufMemoryUsageBytes - curAttrBuf.getApproxMemUsageDiff(programResources.attrDataSizes[attrNdx]), m_rnd);
-						const deUint32 target = m_rnd.getFloat() < m_probabilities.randomBufferUploadTarget ? randomBufferTarget(m_rnd, m_isGLES3) : GL_ARRAY_BUFFER;
+						shard.buffers.removeGarbageUntilUnder(shard.maxBufMemoryUsageBytes - curAttrBuf.getApproxMemUsageDiff(programResources.attrDataSizes[attrNdx]), rnd);
+						const deUint32 target = rnd.getFloat() < m_probabilities.randomBufferUploadTarget ? randomBufferTarget(rnd, m_isGLES3) : GL_ARRAY_BUFFER;
 
-						if (!hadCurAttrBuffer || m_rnd.getFloat() < m_probabilities.reuploadWithBufferData)
+						if (!hadCurAttrBuffer || rnd.getFloat() < m_probabilities.reuploadWithBufferData)
 							curAttrBuf.setData(&programResources.attrDataBuf[programResources.attrDataOffsets[attrNdx]], programResources.attrDataSizes[attrNdx], target,
-											   m_rnd.getFloat() < m_probabilities.randomBufferUsage ? randomBufferUsage(m_rnd, m_isGLES3) : m_attrBufferUsage);
+											   rnd.getFloat() < m_probabilities.randomBufferUsage ? randomBufferUsage(rnd, m_isGLES3) : m_attrBufferUsage);
 						else
 							curAttrBuf.setSubData(&programResources.attrDataBuf[programResources.attrDataOffsets[attrNdx]], 0, programResources.attrDataSizes[attrNdx], target);
 					}
@@ -1405,25 +1609,25 @@ LongStressCase::IterateResult LongStressCase::iterate (void)
 		}
 		else
 		{
-			const int usedRedundantBufferNdx = m_rnd.getInt(0, m_redundantBufferFactor-1);
+			const int usedRedundantBufferNdx = rnd.getInt(0, m_redundantBufferFactor-1);
 
 			for (int redundantBufferNdx = 0; redundantBufferNdx < m_redundantBufferFactor; redundantBufferNdx++)
 			{
 				const string	attrBufName		= unitedAttrBufferNamePrefix + toString(redundantBufferNdx);
-				const bool		hadAttrBuffer	= m_buffers->has(attrBufName);
+				const bool		hadAttrBuffer	= shard.buffers.has(attrBufName);
 
 				if (!hadAttrBuffer)
-					m_buffers->make(attrBufName);
+					shard.buffers.make(attrBufName);
 
-				Buffer& attrBuf = m_buffers->get(attrBufName);
+				Buffer& attrBuf = shard.buffers.get(attrBufName);
 
-				if (!hadAttrBuffer || m_rnd.getFloat() < m_probabilities.reuploadBuffer)
+				if (!hadAttrBuffer || rnd.getFloat() < m_probabilities.reuploadBuffer)
 				{
-					m_buffers->removeGarbageUntilUnder(m_maxBufMemoryUsageBytes - attrBuf.getApproxMemUsageDiff(programResources.attrDataBuf), m_rnd);
-					const deUint32 target = m_rnd.getFloat() < m_probabilities.randomBufferUploadTarget ? randomBufferTarget(m_rnd, m_isGLES3) : GL_ARRAY_BUFFER;
+					shard.buffers.removeGarbageUntilUnder(shard.maxBufMemoryUsageBytes - attrBuf.getApproxMemUsageDiff(programResources.attrDataBuf), rnd);
+					const deUint32 target = rnd.getFloat() < m_probabilities.randomBufferUploadTarget ? randomBufferTarget(rnd, m_isGLES3) : GL_ARRAY_BUFFER;
 
-					if (!hadAttrBuffer || m_rnd.getFloat() < m_probabilities.reuploadWithBufferData)
-						attrBuf.setData(programResources.attrDataBuf, target, m_rnd.getFloat() < m_probabilities.randomBufferUsage ? randomBufferUsage(m_rnd, m_isGLES3) : m_attrBufferUsage);
+					if (!hadAttrBuffer || rnd.getFloat() < m_probabilities.reuploadWithBufferData)
+						attrBuf.setData(programResources.attrDataBuf, target, rnd.getFloat() < m_probabilities.randomBufferUsage ? randomBufferUsage(rnd, m_isGLES3) : m_attrBufferUsage);
 					else
 						attrBuf.setSubData(programResources.attrDataBuf, 0, (int)programResources.attrDataBuf.size(), target);
 				}
@@ -1453,7 +1657,7 @@ LongStressCase::IterateResult LongStressCase::iterate (void)
 	for (int i = 0; i < m_numDrawCallsPerIteration; i++)
 	{
 		program.use();
-		program.setRandomUniforms(programContext.uniforms, programResources.shaderNameManglingSuffix, m_rnd);
+		program.setRandomUniforms(programContext.uniforms, programResources.shaderNameManglingSuffix, rnd);
 
 		if (useDrawArrays)
 			glDrawArrays(GL_TRIANGLE_STRIP, 0, m_numVerticesPerDrawCall);
@@ -1462,11 +1666,11 @@ LongStressCase::IterateResult LongStressCase::iterate (void)
 			if (useClientMemoryIndexData)
 			{
 				glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-				glDrawElements(GL_TRIANGLE_STRIP, m_numVerticesPerDrawCall, GL_UNSIGNED_SHORT, &m_vertexIndices[0]);
+				glDrawElements(GL_TRIANGLE_STRIP, m_numVerticesPerDrawCall, GL_UNSIGNED_SHORT, &shard.vertexIndices[0]);
 			}
 			else
 			{
-				m_buffers->get(indexBufferName).bind(GL_ELEMENT_ARRAY_BUFFER);
+				shard.buffers.get(indexBufferName).bind(GL_ELEMENT_ARRAY_BUFFER);
 				glDrawElements(GL_TRIANGLE_STRIP, m_numVerticesPerDrawCall, GL_UNSIGNED_SHORT, DE_NULL);
 			}
 		}
@@ -1475,60 +1679,24 @@ LongStressCase::IterateResult LongStressCase::iterate (void)
 	for(int i = 0; i < (int)programContext.attributes.size(); i++)
 		program.disableAttributeArray(programContext.attributes[i], programResources.shaderNameManglingSuffix);
 
-	if (m_showDebugInfo)
-		m_debugInfoRenderer->drawInfo(deGetTime()-m_startTimeSeconds, m_textures->computeApproxMemUsage(), m_maxTexMemoryUsageBytes, m_buffers->computeApproxMemUsage(), m_maxBufMemoryUsageBytes, m_currentIteration);
-
-	if (m_currentIteration > 0)
-	{
-		// Log if a certain amount of time has passed since last log entry (or if this is the last iteration).
-
-		const deUint64	loggingIntervalSeconds	= 10;
-		const deUint64	time					= deGetTime();
-		const deUint64	timeDiff				= time - m_lastLogTime;
-		const int		iterDiff				= m_currentIteration - m_lastLogIteration;
-
-		if (timeDiff >= loggingIntervalSeconds || m_currentIteration == m_numIterations-1)
-		{
-			log << TestLog::Section("LogEntry" + toString(m_currentLogEntryNdx), "Log entry " + toString(m_currentLogEntryNdx))
-				<< TestLog::Message << "Time elapsed: " << getTimeStr(time - m_startTimeSeconds) << TestLog::EndMessage
-				<< TestLog::Message << "Frame number: " << m_currentIteration << TestLog::EndMessage
-				<< TestLog::Message << "Time since last log entry: " << timeDiff << "s" << TestLog::EndMessage
-				<< TestLog::Message << "Frames since last log entry: " << iterDiff << TestLog::EndMessage
-				<< TestLog::Message << "Average frame time since last log entry: " << de::floatToString((float)timeDiff / (float)iterDiff, 2) << "s" << TestLog::EndMessage
-				<< TestLog::Message << "Approximate texture memory usage: "
-									<< de::floatToString((float)m_textures->computeApproxMemUsage() / Mi, 2) << " MiB / "
-									<< de::floatToString((float)m_maxTexMemoryUsageBytes / Mi, 2) << " MiB"
-									<< TestLog::EndMessage
-				<< TestLog::Message << "Approximate buffer memory usage: "
-										<< de::floatToString((float)m_buffers->computeApproxMemUsage() / Mi, 2) << " MiB / "
-										<< de::floatToString((float)m_maxBufMemoryUsageBytes / Mi, 2) << " MiB"
-										<< TestLog::EndMessage
-				<< TestLog::EndSection;
-
-			m_lastLogTime		= time;
-			m_lastLogIteration	= m_currentIteration;
-			m_currentLogEntryNdx++;
-		}
-	}
-
 	// Possibly remove or set-as-garbage some objects, depending on given probabilities.
 
 	for (int texNdx = 0; texNdx < (int)programContext.textureSpecs.size(); texNdx++)
 	{
 		const string texName = textureNamePrefix + toString(texNdx);
-		if (m_rnd.getFloat() < m_probabilities.deleteTexture)
-			m_textures->remove(texName);
-		else if (m_rnd.getFloat() < m_probabilities.wastefulTextureMemoryUsage)
-			m_textures->markAsGarbage(texName);
+		if (rnd.getFloat() < m_probabilities.deleteTexture)
+			shard.textures.remove(texName);
+		else if (rnd.getFloat() < m_probabilities.wastefulTextureMemoryUsage)
+			shard.textures.markAsGarbage(texName);
 
 	}
 
-	if (m_buffers->has(indexBufferName))
+	if (shard.buffers.has(indexBufferName))
 	{
-		if (m_rnd.getFloat() < m_probabilities.deleteBuffer)
-			m_buffers->remove(indexBufferName);
-		else if (m_rnd.getFloat() < m_probabilities.wastefulBufferMemoryUsage)
-			m_buffers->markAsGarbage(indexBufferName);
+		if (rnd.getFloat() < m_probabilities.deleteBuffer)
+			shard.buffers.remove(indexBufferName);
+		else if (rnd.getFloat() < m_probabilities.wastefulBufferMemoryUsage)
+			shard.buffers.markAsGarbage(indexBufferName);
 
 	}
 
@@ -1538,43 +1706,195 @@ LongStressCase::IterateResult LongStressCase::iterate (void)
 		{
 			const string curAttrBufNamePrefix = separateAttrBufNamePrefix + toString(attrNdx) + "_";
 
-			if (m_buffers->has(curAttrBufNamePrefix + "0"))
+			if (shard.buffers.has(curAttrBufNamePrefix + "0"))
 			{
-				if (m_rnd.getFloat() < m_probabilities.deleteBuffer)
+				if (rnd.getFloat() < m_probabilities.deleteBuffer)
 				{
 					for (int i = 0; i < m_redundantBufferFactor; i++)
-						m_buffers->remove(curAttrBufNamePrefix + toString(i));
+						shard.buffers.remove(curAttrBufNamePrefix + toString(i));
 				}
-				else if (m_rnd.getFloat() < m_probabilities.wastefulBufferMemoryUsage)
+				else if (rnd.getFloat() < m_probabilities.wastefulBufferMemoryUsage)
 				{
 					for (int i = 0; i < m_redundantBufferFactor; i++)
-						m_buffers->markAsGarbage(curAttrBufNamePrefix + toString(i));
+						shard.buffers.markAsGarbage(curAttrBufNamePrefix + toString(i));
 				}
 			}
 		}
 	}
 	else
 	{
-		if (m_buffers->has(unitedAttrBufferNamePrefix + "0"))
+		if (shard.buffers.has(unitedAttrBufferNamePrefix + "0"))
 		{
-			if (m_rnd.getFloat() < m_probabilities.deleteBuffer)
+			if (rnd.getFloat() < m_probabilities.deleteBuffer)
 			{
 				for (int i = 0; i < m_redundantBufferFactor; i++)
-					m_buffers->remove(unitedAttrBufferNamePrefix + toString(i));
+					shard.buffers.remove(unitedAttrBufferNamePrefix + toString(i));
 			}
-			else if (m_rnd.getFloat() < m_probabilities.wastefulBufferMemoryUsage)
+			else if (rnd.getFloat() < m_probabilities.wastefulBufferMemoryUsage)
 			{
 				for (int i = 0; i < m_redundantBufferFactor; i++)
-					m_buffers->markAsGarbage(unitedAttrBufferNamePrefix + toString(i));
+					shard.buffers.markAsGarbage(unitedAttrBufferNamePrefix + toString(i));
 			}
 		}
 	}
 
-	GLU_CHECK_MSG("End of LongStressCase::iterate()");
+	GLU_CHECK_MSG("End of LongStressCase::runIteration()");
+
+	shard.numIterations++;
+}
+
+void LongStressCase::startThreads (void)
+{
+	DE_ASSERT(m_threads.empty());
+
+	for (int shardNdx = 1; shardNdx < m_numThreads; shardNdx++)
+	{
+		const Random rnd (deStringHash(getName()) ^ m_testCtx.getCommandLine().getBaseSeed() ^ deInt32Hash(shardNdx));
+
+		m_threads.push_back(SharedPtr<ShardThread>(new ShardThread(*this, shardNdx, rnd, *m_shardStats[shardNdx])));
+		m_threads.back()->start();
+	}
+}
+
+void LongStressCase::stopThreads (void)
+{
+	for (int threadNdx = 0; threadNdx < (int)m_threads.size(); threadNdx++)
+		m_threads[threadNdx]->requestStop();
+
+	for (int threadNdx = 0; threadNdx < (int)m_threads.size(); threadNdx++)
+		m_threads[threadNdx]->join();
+
+	m_threads.clear();
+}
+
+void LongStressCase::checkThreads (void) const
+{
+	for (int shardNdx = 1; shardNdx < (int)m_shardStats.size(); shardNdx++)
+	{
+		string	error;
+		bool	isNotSupported	= false;
+
+		if (m_shardStats[shardNdx]->getError(error, isNotSupported))
+		{
+			if (isNotSupported)
+				throw tcu::NotSupportedError("Stress thread " + toString(shardNdx) + ": " + error);
+			else
+				throw tcu::TestError("Stress thread " + toString(shardNdx) + " failed: " + error);
+		}
+	}
+}
+
+static deUint64 getPercentile (const vector<deUint64>& sortedValues, const float percentile)
+{
+	DE_ASSERT(!sortedValues.empty());
+	return sortedValues[de::clamp((int)((float)sortedValues.size() * percentile), 0, (int)sortedValues.size()-1)];
+}
+
+void LongStressCase::logStatistics (const bool isFinal)
+{
+	TestLog&			log				= m_testCtx.getLog();
+	const deUint64		timeUs			= deGetMicroseconds();
+	const deUint64		intervalUs		= de::max<deUint64>(1, timeUs - (isFinal ? m_statsStartTimeUs : m_lastStatsTimeUs));
+	deUint64			numIterations	= 0;
+	vector<deUint64>	latenciesUs;
+
+	for (int shardNdx = 0; shardNdx < (int)m_shardStats.size(); shardNdx++)
+		numIterations += m_shardStats[shardNdx]->collect(latenciesUs);
+
+	std::sort(latenciesUs.begin(), latenciesUs.end());
+	m_lastStatsTimeUs = timeUs;
+
+	if (isFinal)
+	{
+		const float opsPerSecond = (float)numIterations * 1e6f / (float)intervalUs;
+
+		log << TestLog::Float("IterationsPerSecond",	"Iterations per second, all threads",	"1/s",	QP_KEY_TAG_PERFORMANCE,	opsPerSecond)
+			<< TestLog::Float("DrawCallsPerSecond",		"Draw calls per second, all threads",	"1/s",	QP_KEY_TAG_PERFORMANCE,	opsPerSecond * (float)m_numDrawCallsPerIteration);
+	}
+	else if (!latenciesUs.empty())
+	{
+		log << TestLog::Message << "Iterations per second since last log entry, all threads: "
+								<< de::floatToString((float)latenciesUs.size() * 1e6f / (float)intervalUs, 2)
+			<< TestLog::EndMessage
+			<< TestLog::Message << "Iteration latency since last log entry: "
+								<< "p50 " << getPercentile(latenciesUs, 0.5f) << "us, "
+								<< "p90 " << getPercentile(latenciesUs, 0.9f) << "us, "
+								<< "p99 " << getPercentile(latenciesUs, 0.99f) << "us, "
+								<< "max " << latenciesUs.back() << "us"
+			<< TestLog::EndMessage;
+	}
+}
+
+LongStressCase::IterateResult LongStressCase::iterate (void)
+{
+	const int		renderWidth		= m_renderCtx.getRenderTarget().getWidth();
+	const int		renderHeight	= m_renderCtx.getRenderTarget().getHeight();
+
+	if (m_currentIteration == 0)
+	{
+		m_lastLogTime = m_startTimeSeconds = deGetTime();
+		m_lastStatsTimeUs = m_statsStartTimeUs = deGetMicroseconds();
+
+		startThreads();
+	}
+
+	checkThreads();
+
+	{
+		const deUint64 iterStartUs = deGetMicroseconds();
+
+		runIteration(*m_mainShard, renderWidth, renderHeight, &m_testCtx.getLog());
+		m_mainShard->stats.addIteration(deGetMicroseconds() - iterStartUs);
+	}
+
+	if (m_showDebugInfo)
+		m_debugInfoRenderer->drawInfo(deGetTime()-m_startTimeSeconds, m_mainShard->textures.computeApproxMemUsage(), m_mainShard->maxTexMemoryUsageBytes, m_mainShard->buffers.computeApproxMemUsage(), m_mainShard->maxBufMemoryUsageBytes, m_currentIteration);
+
+	if (m_currentIteration > 0)
+	{
+		// Log if a certain amount of time has passed since last log entry (or if this is the last iteration).
+
+		const deUint64	loggingIntervalSeconds	= 10;
+		const deUint64	time					= deGetTime();
+		const deUint64	timeDiff				= time - m_lastLogTime;
+		const int		iterDiff				= m_currentIteration - m_lastLogIteration;
+
+		if (timeDiff >= loggingIntervalSeconds || m_currentIteration == m_numIterations-1)
+		{
+			TestLog& log = m_testCtx.getLog();
+
+			log << TestLog::Section("LogEntry" + toString(m_currentLogEntryNdx), "Log entry " + toString(m_currentLogEntryNdx))
+				<< TestLog::Message << "Time elapsed: " << getTimeStr(time - m_startTimeSeconds) << TestLog::EndMessage
+				<< TestLog::Message << "Frame number: " << m_currentIteration << TestLog::EndMessage
+				<< TestLog::Message << "Time since last log entry: " << timeDiff << "s" << TestLog::EndMessage
+				<< TestLog::Message << "Frames since last log entry: " << iterDiff << TestLog::EndMessage
+				<< TestLog::Message << "Average frame time since last log entry: " << de::floatToString((float)timeDiff / (float)iterDiff, 2) << "s" << TestLog::EndMessage
+				<< TestLog::Message << "Approximate texture memory usage: "
+									<< de::floatToString((float)m_mainShard->textures.computeApproxMemUsage() / Mi, 2) << " MiB / "
+									<< de::floatToString((float)m_mainShard->maxTexMemoryUsageBytes / Mi, 2) << " MiB"
+									<< TestLog::EndMessage
+				<< TestLog::Message << "Approximate buffer memory usage: "
+										<< de::floatToString((float)m_mainShard->buffers.computeApproxMemUsage() / Mi, 2) << " MiB / "
+										<< de::floatToString((float)m_mainShard->maxBufMemoryUsageBytes / Mi, 2) << " MiB"
+										<< TestLog::EndMessage;
+
+			logStatistics(false);
+
+			log << TestLog::EndSection;
+
+			m_lastLogTime		= time;
+			m_lastLogIteration	= m_currentIteration;
+			m_currentLogEntryNdx++;
+		}
+	}
 
 	m_currentIteration++;
 	if (m_currentIteration == m_numIterations)
 	{
+		stopThreads();
+		checkThreads();
+		logStatistics(true);
+
 		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Passed");
 		return STOP;
 	}
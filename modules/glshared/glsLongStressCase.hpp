@@ -50,6 +50,9 @@ class Program;
 class Buffer;
 class Texture;
 class DebugInfoRenderer;
+class Shard;
+class ShardStats;
+class ShardThread;
 
 }
 
@@ -282,7 +285,8 @@ public:
 																								 deUint32								indexBufferUsage,
 																								 deUint32								attrBufferUsage,
 																								 int									redundantBufferFactor = 1,
-																								 bool									showDebugInfo = false);
+																								 bool									showDebugInfo = false,
+																								 int									numThreads = 1); //!< Number of threads, each with its own shared GL context and objects.
 
 															~LongStressCase						(void);
 
@@ -292,9 +296,17 @@ public:
 	IterateResult											iterate								(void);
 
 private:
+	friend class LongStressCaseInternal::ShardThread;
+
 															LongStressCase						(const LongStressCase&);
 	LongStressCase&											operator=							(const LongStressCase&);
 
+	void													runIteration						(LongStressCaseInternal::Shard& shard, int renderWidth, int renderHeight, tcu::TestLog* log) const;
+	void													startThreads						(void);
+	void													stopThreads							(void);
+	void													checkThreads						(void) const;
+	void													logStatistics						(bool isFinal);
+
 	const glu::RenderContext&								m_renderCtx;
 	const int												m_maxTexMemoryUsageBytes;
 	const int												m_maxBufMemoryUsageBytes;
@@ -307,6 +319,7 @@ private:
 	const deUint32											m_attrBufferUsage;
 	const int												m_redundantBufferFactor; //!< By what factor we allocate redundant buffers. Default is 1, i.e. no redundancy.
 	const bool												m_showDebugInfo;
+	const int												m_numThreads;
 
 	const int												m_numIterations;
 	const bool												m_isGLES3;
@@ -317,26 +330,25 @@ private:
 	int														m_lastLogIteration;
 	int														m_currentLogEntryNdx;
 
+	deUint64												m_statsStartTimeUs;
+	deUint64												m_lastStatsTimeUs;
+
 	de::Random												m_rnd;
-	LongStressCaseInternal::GLObjectManager<
-		LongStressCaseInternal::Program>*					m_programs;
-	LongStressCaseInternal::GLObjectManager<
-		LongStressCaseInternal::Buffer>*					m_buffers;
-	LongStressCaseInternal::GLObjectManager<
-		LongStressCaseInternal::Texture>*					m_textures;
 	std::vector<deUint16>									m_vertexIndices;
 
 	struct ProgramResources
 	{
-		std::vector<deUint8>							attrDataBuf;
-		std::vector<int>								attrDataOffsets;
-		std::vector<int>								attrDataSizes;
-		std::vector<de::SharedPtr<tcu::TextureLevel> >	unusedTextures;
-		std::string										shaderNameManglingSuffix;
+		std::vector<de::SharedPtr<tcu::TextureLevel> >	unusedTextures; //!< \note Read-only during iterations, shared by all shards.
 	};
 
 	std::vector<ProgramResources>							m_programResources;
 
+	LongStressCaseInternal::Shard*							m_mainShard;		//!< Shard of the test thread, using the case's render context.
+	std::vector<de::SharedPtr<
+		LongStressCaseInternal::ShardStats> >				m_shardStats;		//!< Statistics of all shards, main shard first.
+	std::vector<de::SharedPtr<
+		LongStressCaseInternal::ShardThread> >				m_threads;
+
 	LongStressCaseInternal::DebugInfoRenderer*				m_debugInfoRenderer;
 };
 
@@ -1035,10 +1035,17 @@ bool ShaderLibraryCase::execute (void)
 	}
 	else
 	{
-		// Separate programs
+		// Separate programs, compiled and linked together
+		glu::ShaderProgramBatch	batch	(m_renderCtx);
+
+		for (size_t programNdx = 0; programNdx < m_spec.programs.size(); ++programNdx)
+			batch.add(specializedSources[programNdx]);
+
+		batch.build();
+
 		for (size_t programNdx = 0; programNdx < m_spec.programs.size(); ++programNdx)
 		{
-			de::SharedPtr<glu::ShaderProgram> program(new glu::ShaderProgram(m_renderCtx, specializedSources[programNdx]));
+			de::SharedPtr<glu::ShaderProgram> program(batch.release((int)programNdx));
 
 			if (m_spec.programs[programNdx].activeStages & (1u << glu::SHADERTYPE_VERTEX))
 				vertexProgramID = program->getProgram();
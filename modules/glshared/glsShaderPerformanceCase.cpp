@@ -23,6 +23,7 @@
 
 #include "glsShaderPerformanceCase.hpp"
 #include "tcuRenderTarget.hpp"
+#include "tcuCommandLine.hpp"
 #include "deStringUtil.hpp"
 #include "deMath.h"
 
@@ -44,6 +45,7 @@ ShaderPerformanceCase::ShaderPerformanceCase (tcu::TestContext& testCtx, glu::Re
 	, m_caseType		(caseType)
 	, m_program			(DE_NULL)
 	, m_measurer		(renderCtx, caseType)
+	, m_environment		(DE_NULL)
 {
 }
 
@@ -140,12 +142,14 @@ void ShaderPerformanceCase::init (void)
 {
 	tcu::TestLog& log = m_testCtx.getLog();
 
-	m_program = new glu::ShaderProgram(m_renderCtx, glu::makeVtxFragSources(m_vertShaderSource, m_fragShaderSource));
+	m_environment	= new tcu::MeasurementEnvironment(m_testCtx.getCommandLine().getPerfCPUAffinity());
+	m_program		= new glu::ShaderProgram(m_renderCtx, glu::makeVtxFragSources(m_vertShaderSource, m_fragShaderSource));
 
 	if (m_program->isOk())
 	{
 		const int initialCallCount = m_initialCalibration ? m_initialCalibration->initialNumCalls : 1;
 		logRenderTargetInfo(log, m_renderCtx.getRenderTarget());
+		m_measurer.setUseGpuTimer(m_testCtx.getCommandLine().isPerfGPUTimerEnabled());
 		m_measurer.init(m_program->getProgram(), m_attributes, initialCallCount);
 		m_measurer.logParameters(log);
 		log << *m_program;
@@ -167,6 +171,9 @@ void ShaderPerformanceCase::deinit (void)
 	m_program = DE_NULL;
 
 	m_measurer.deinit();
+
+	delete m_environment;
+	m_environment = DE_NULL;
 }
 
 void ShaderPerformanceCase::setupProgram (deUint32 program)
@@ -190,6 +197,7 @@ ShaderPerformanceCase::IterateResult ShaderPerformanceCase::iterate (void)
 	if (m_measurer.isFinished())
 	{
 		m_measurer.logMeasurementInfo(m_testCtx.getLog());
+		m_environment->logReport(m_testCtx.getLog());
 
 		if (m_initialCalibration)
 			m_initialCalibration->initialNumCalls = de::max(1, m_measurer.getFinalCallCount());
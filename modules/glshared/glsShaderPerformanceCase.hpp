@@ -28,6 +28,7 @@
 #include "gluRenderContext.hpp"
 #include "gluShaderProgram.hpp"
 #include "glsShaderPerformanceMeasurer.hpp"
+#include "tcuCPUWarmup.hpp"
 #include "deSharedPtr.hpp"
 
 namespace deqp
@@ -80,6 +81,7 @@ protected:
 private:
 	glu::ShaderProgram*					m_program;
 	ShaderPerformanceMeasurer			m_measurer;
+	tcu::MeasurementEnvironment*		m_environment;
 
 	de::SharedPtr<InitialCalibration>	m_initialCalibration;
 };
@@ -22,6 +22,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "glsShaderPerformanceMeasurer.hpp"
+#include "glsGpuTimer.hpp"
 #include "gluDefs.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuRenderTarget.hpp"
@@ -45,6 +46,11 @@ namespace deqp
 namespace gls
 {
 
+enum
+{
+	MAX_DISJOINT_FRAMES	= 16	//!< Give up on GPU timer after this many frames lost to disjoint events.
+};
+
 static inline float triangleInterpolate (float v0, float v1, float v2, float x, float y)
 {
 	return v0 + (v2-v0)*x + (v1-v0)*y;
@@ -130,6 +136,11 @@ ShaderPerformanceMeasurer::ShaderPerformanceMeasurer (const glu::RenderContext&
 	, m_result				(-1.0f, -1.0f)
 	, m_indexBuffer			(0)
 	, m_vao					(0)
+	, m_useGpuTimer			(false)
+	, m_gpuTimer			(DE_NULL)
+	, m_prevGpuInterval		(-1)
+	, m_numDisjointFrames	(0)
+	, m_gpuTimerFailed		(false)
 {
 }
 
@@ -225,6 +236,14 @@ void ShaderPerformanceMeasurer::init (deUint32 program, const vector<AttribSpec>
 	gl.useProgram(program);
 	GLU_EXPECT_NO_ERROR(gl.getError(), "glUseProgram()");
 
+	if (m_useGpuTimer && GpuTimer::isSupported(m_renderCtx))
+		m_gpuTimer = new GpuTimer(m_renderCtx);
+
+	m_prevGpuInterval	= -1;
+	m_numDisjointFrames	= 0;
+	m_gpuTimerFailed	= false;
+	m_cpuFrameTimes.clear();
+
 	m_state = STATE_MEASURING;
 	m_isFirstIteration = true;
 
@@ -254,9 +273,42 @@ void ShaderPerformanceMeasurer::deinit (void)
 		m_attribBuffers.clear();
 	}
 
+	delete m_gpuTimer;
+	m_gpuTimer = DE_NULL;
+
 	m_state = STATE_UNINITIALIZED;
 }
 
+void ShaderPerformanceMeasurer::fallbackToCpuTimer (void)
+{
+	delete m_gpuTimer;
+	m_gpuTimer			= DE_NULL;
+	m_gpuTimerFailed	= true;
+
+	// Samples recorded so far were GPU times, start over.
+	m_calibrator.clear(m_calibrator.getParameters());
+	m_isFirstIteration = true;
+}
+
+bool ShaderPerformanceMeasurer::getGpuFrameTime (deUint64* frameTime)
+{
+	const int interval = m_prevGpuInterval;
+
+	if (interval < 0)
+		return false;
+
+	m_prevGpuInterval = -1;
+
+	// \note Waits for previous frame only; current frame stays in flight.
+	if (m_gpuTimer->getResult(interval, true, frameTime) == GpuTimer::RESULT_OK)
+		return true;
+
+	if (++m_numDisjointFrames >= MAX_DISJOINT_FRAMES)
+		fallbackToCpuTimer();
+
+	return false;
+}
+
 void ShaderPerformanceMeasurer::render (int numDrawCalls)
 {
 	const glw::Functions&	gl			= m_renderCtx.getFunctions();
@@ -272,9 +324,14 @@ void ShaderPerformanceMeasurer::iterate (void)
 {
 	DE_ASSERT(m_state == STATE_MEASURING);
 
-	deUint64 renderStartTime = deGetMicroseconds();
+	deUint64	renderStartTime	= deGetMicroseconds();
+	const int	gpuInterval		= m_gpuTimer ? m_gpuTimer->begin() : -1;
+
 	render(m_calibrator.getCallCount()); // Always render. This gives more stable performance behavior.
 
+	if (m_gpuTimer)
+		m_gpuTimer->end();
+
 	TheilSenCalibrator::State calibratorState = m_calibrator.getState();
 
 	if (calibratorState == TheilSenCalibrator::STATE_RECOMPUTE_PARAMS)
@@ -283,10 +340,24 @@ void ShaderPerformanceMeasurer::iterate (void)
 
 		m_isFirstIteration = true;
 		m_prevRenderStartTime = renderStartTime;
+		m_prevGpuInterval = -1; // Rendered with old call count.
 	}
 	else if (calibratorState == TheilSenCalibrator::STATE_MEASURE)
 	{
-		if (!m_isFirstIteration)
+		if (m_gpuTimer)
+		{
+			deUint64 gpuFrameTime = 0;
+
+			// Record previous frame GPU time, and CPU time for the same frame for comparison.
+			if (getGpuFrameTime(&gpuFrameTime) && !m_isFirstIteration)
+			{
+				m_calibrator.recordIteration(gpuFrameTime);
+				m_cpuFrameTimes.push_back(renderStartTime - m_prevRenderStartTime);
+			}
+
+			m_prevGpuInterval = m_gpuTimer ? gpuInterval : -1;
+		}
+		else if (!m_isFirstIteration)
 			m_calibrator.recordIteration(renderStartTime - m_prevRenderStartTime);
 
 		m_isFirstIteration = false;
@@ -336,6 +407,31 @@ void ShaderPerformanceMeasurer::logMeasurementInfo (TestLog& log) const
 		<< TestLog::Float("FragmentsPerVertices",	"Vertex-fragment ratio",			"Fragments/Vertices",	QP_KEY_TAG_NONE,		(float)numPixels / (float)numVertices)
 		<< TestLog::Float("FragmentPerf",			"Fragment performance",				"MPix/s",				QP_KEY_TAG_PERFORMANCE, (float)mfragPerSecond)
 		<< TestLog::Float("VertexPerf",				"Vertex performance",				"MVert/s",				QP_KEY_TAG_PERFORMANCE, (float)mvertPerSecond);
+
+	if (m_gpuTimer)
+	{
+		deUint64 cpuTotalTime = 0;
+
+		for (size_t ndx = 0; ndx < m_cpuFrameTimes.size(); ++ndx)
+			cpuTotalTime += m_cpuFrameTimes[ndx];
+
+		log << TestLog::Message << "Frame times measured with " << m_gpuTimer->getExtensionName() << ", "
+								<< m_numDisjointFrames << " frame(s) discarded due to disjoint operation" << TestLog::EndMessage;
+
+		if (cpuTotalTime > 0)
+			log << TestLog::Float("CPUFramesPerSecond", "Frames per second in measurement, CPU time", "Frames/s", QP_KEY_TAG_NONE,
+								  (float)((double)m_cpuFrameTimes.size() / ((double)cpuTotalTime / 1000000.0)));
+	}
+	else if (m_gpuTimerFailed)
+		log << TestLog::Message << "Too many frames lost to disjoint operation, frame times measured on CPU" << TestLog::EndMessage;
+	else if (m_useGpuTimer)
+		log << TestLog::Message << "GPU timer queries not supported, frame times measured on CPU" << TestLog::EndMessage;
+}
+
+void ShaderPerformanceMeasurer::setUseGpuTimer (bool useGpuTimer)
+{
+	DE_ASSERT(m_state == STATE_UNINITIALIZED);
+	m_useGpuTimer = useGpuTimer;
 }
 
 void ShaderPerformanceMeasurer::setGridSize (int gridW, int gridH)
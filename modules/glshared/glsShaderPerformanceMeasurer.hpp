@@ -29,11 +29,15 @@
 #include "gluRenderContext.hpp"
 #include "glsCalibration.hpp"
 
+#include <vector>
+
 namespace deqp
 {
 namespace gls
 {
 
+class GpuTimer;
+
 enum PerfCaseType
 {
 	CASETYPE_VERTEX = 0,
@@ -89,6 +93,10 @@ public:
 	void								setGridSize					(int gridW, int gridH);
 	void								setViewportSize				(int width, int height);
 
+	//! Calibrate and measure with GPU timer queries instead of CPU frame times, if supported. Call before init().
+	void								setUseGpuTimer				(bool useGpuTimer);
+	bool								isUsingGpuTimer				(void) const { return m_gpuTimer != DE_NULL; }
+
 	int									getGridWidth				(void) const { return m_gridSizeX;		}
 	int									getGridHeight				(void) const { return m_gridSizeY;		}
 	int									getViewportWidth			(void) const { return m_viewportWidth;	}
@@ -107,6 +115,8 @@ private:
 	};
 
 	void								render						(int numDrawCalls);
+	bool								getGpuFrameTime				(deUint64* frameTime);
+	void								fallbackToCpuTimer			(void);
 
 	const glu::RenderContext&			m_renderCtx;
 	int									m_gridSizeX;
@@ -123,6 +133,14 @@ private:
 	std::vector<AttribSpec>				m_attributes;
 	std::vector<deUint32>				m_attribBuffers;
 	deUint32							m_vao;
+
+	// GPU timing. Calibrator is fed GPU times of previous frame, CPU frame times are kept for logging.
+	bool								m_useGpuTimer;
+	GpuTimer*							m_gpuTimer;
+	int									m_prevGpuInterval;		//!< Interval of previous frame, -1 if none.
+	int									m_numDisjointFrames;
+	bool								m_gpuTimerFailed;		//!< Fell back to CPU timing due to disjoint events.
+	std::vector<deUint64>				m_cpuFrameTimes;
 };
 
 } // gls
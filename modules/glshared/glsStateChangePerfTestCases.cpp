@@ -22,8 +22,10 @@
  *//*--------------------------------------------------------------------*/
 
 #include "glsStateChangePerfTestCases.hpp"
+#include "glsGpuTimer.hpp"
 
 #include "tcuTestLog.hpp"
+#include "tcuCommandLine.hpp"
 
 #include "gluDefs.hpp"
 #include "gluRenderContext.hpp"
@@ -52,6 +54,11 @@ namespace gls
 namespace
 {
 
+enum
+{
+	MAX_DISJOINT_SAMPLES	= 16	//!< Stop using GPU timer after this many samples lost to disjoint events.
+};
+
 struct ResultStats
 {
 	double		median;
@@ -209,12 +216,14 @@ deUint64 findMedian (const vector<deUint64>& v)
 } // anonymous
 
 StateChangePerformanceCase::StateChangePerformanceCase (tcu::TestContext& testCtx, glu::RenderContext& renderCtx, const char* name, const char* description, DrawType drawType, int drawCallCount, int triangleCount)
-	: tcu::TestCase		(testCtx, tcu::NODETYPE_PERFORMANCE, name, description)
-	, m_renderCtx		(renderCtx)
-	, m_drawType		(drawType)
-	, m_iterationCount	(100)
-	, m_callCount		(drawCallCount)
-	, m_triangleCount	(triangleCount)
+	: tcu::TestCase			(testCtx, tcu::NODETYPE_PERFORMANCE, name, description)
+	, m_renderCtx			(renderCtx)
+	, m_drawType			(drawType)
+	, m_iterationCount		(100)
+	, m_callCount			(drawCallCount)
+	, m_triangleCount		(triangleCount)
+	, m_gpuTimer			(DE_NULL)
+	, m_numDisjointSamples	(0)
 {
 }
 
@@ -227,6 +236,16 @@ void StateChangePerformanceCase::init (void)
 {
 	if (m_drawType == DRAWTYPE_INDEXED_USER_PTR)
 		genIndices(m_indices, m_triangleCount);
+
+	if (m_testCtx.getCommandLine().isPerfGPUTimerEnabled())
+	{
+		if (GpuTimer::isSupported(m_renderCtx))
+			m_gpuTimer = new GpuTimer(m_renderCtx);
+		else
+			m_testCtx.getLog() << TestLog::Message << "GPU timer queries not supported, using CPU time only" << TestLog::EndMessage;
+	}
+
+	m_numDisjointSamples = 0;
 }
 
 void StateChangePerformanceCase::requireIndexBuffers (int count)
@@ -481,6 +500,11 @@ void StateChangePerformanceCase::deinit (void)
 	m_indices.clear();
 	m_interleavedResults.clear();
 	m_batchedResults.clear();
+	m_interleavedGpuResults.clear();
+	m_batchedGpuResults.clear();
+
+	delete m_gpuTimer;
+	m_gpuTimer = DE_NULL;
 
 	{
 		const glw::Functions& gl = m_renderCtx.getFunctions();
@@ -558,7 +582,64 @@ void StateChangePerformanceCase::logAndSetTestResult (void)
 	log << TestLog::Message << "Batched/Interleaved mean ratio: "	<< (interleaved.mean/batched.mean)		<< TestLog::EndMessage;
 	log << TestLog::Message << "Batched/Interleaved median ratio: "	<< (interleaved.median/batched.median)	<< TestLog::EndMessage;
 
-	m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString((float)(((double)interleaved.median) / batched.median), 2).c_str());
+	if (!m_interleavedGpuResults.empty())
+	{
+		const ResultStats interleavedGpu	= calculateStats(m_interleavedGpuResults);
+		const ResultStats batchedGpu		= calculateStats(m_batchedGpuResults);
+
+		log << TestLog::Message << "GPU times measured with " << m_gpuTimer->getExtensionName() << ", "
+								<< m_numDisjointSamples << " sample(s) discarded due to disjoint operation"	<< TestLog::EndMessage;
+
+		log << TestLog::Message << "Interleaved GPU mean: "					<< interleavedGpu.mean						<< TestLog::EndMessage;
+		log << TestLog::Message << "Interleaved GPU median: "				<< interleavedGpu.median					<< TestLog::EndMessage;
+		log << TestLog::Message << "Interleaved GPU variance: "				<< interleavedGpu.variance					<< TestLog::EndMessage;
+		log << TestLog::Message << "Interleaved GPU min: "					<< interleavedGpu.min						<< TestLog::EndMessage;
+		log << TestLog::Message << "Interleaved GPU max: "					<< interleavedGpu.max						<< TestLog::EndMessage;
+
+		log << TestLog::Message << "Batched GPU mean: "						<< batchedGpu.mean							<< TestLog::EndMessage;
+		log << TestLog::Message << "Batched GPU median: "					<< batchedGpu.median						<< TestLog::EndMessage;
+		log << TestLog::Message << "Batched GPU variance: "					<< batchedGpu.variance						<< TestLog::EndMessage;
+		log << TestLog::Message << "Batched GPU min: "						<< batchedGpu.min							<< TestLog::EndMessage;
+		log << TestLog::Message << "Batched GPU max: "						<< batchedGpu.max							<< TestLog::EndMessage;
+
+		log << TestLog::Message << "Batched/Interleaved GPU mean ratio: "	<< (interleavedGpu.mean/batchedGpu.mean)		<< TestLog::EndMessage;
+		log << TestLog::Message << "Batched/Interleaved GPU median ratio: "	<< (interleavedGpu.median/batchedGpu.median)	<< TestLog::EndMessage;
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString((float)(((double)interleavedGpu.median) / batchedGpu.median), 2).c_str());
+	}
+	else
+	{
+		if (m_numDisjointSamples >= MAX_DISJOINT_SAMPLES)
+			log << TestLog::Message << "Too many samples lost to disjoint operation, GPU times not used" << TestLog::EndMessage;
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString((float)(((double)interleaved.median) / batched.median), 2).c_str());
+	}
+}
+
+int StateChangePerformanceCase::beginGpuTimer (void)
+{
+	return m_gpuTimer ? m_gpuTimer->begin() : -1;
+}
+
+bool StateChangePerformanceCase::readGpuTime (int intervalId, deUint64* elapsedUs)
+{
+	if (!m_gpuTimer)
+		return true;
+
+	if (m_gpuTimer->getResult(intervalId, true, elapsedUs) == GpuTimer::RESULT_OK)
+		return true;
+
+	// Sample is retried. If disjoint events keep occurring, fall back to CPU time only.
+	if (++m_numDisjointSamples >= MAX_DISJOINT_SAMPLES)
+	{
+		delete m_gpuTimer;
+		m_gpuTimer = DE_NULL;
+
+		m_interleavedGpuResults.clear();
+		m_batchedGpuResults.clear();
+	}
+
+	return false;
 }
 
 tcu::TestCase::IterateResult StateChangePerformanceCase::iterate (void)
@@ -577,6 +658,8 @@ tcu::TestCase::IterateResult StateChangePerformanceCase::iterate (void)
 		const glw::Functions&	gl			= m_renderCtx.getFunctions();
 		deUint64				resBeginUs	= 0;
 		deUint64				resEndUs	= 0;
+		deUint64				resGpuUs	= 0;
+		int						gpuInterval	= -1;
 
 		setupInitialState(gl);
 		gl.finish();
@@ -584,15 +667,25 @@ tcu::TestCase::IterateResult StateChangePerformanceCase::iterate (void)
 
 		// Render result
 		resBeginUs = deGetMicroseconds();
+		gpuInterval = beginGpuTimer();
 
 		renderTest(gl);
 
+		if (m_gpuTimer)
+			m_gpuTimer->end();
+
 		gl.finish();
 		resEndUs = deGetMicroseconds();
 		GLU_EXPECT_NO_ERROR(gl.getError(), "glFinish()");
 
+		if (!readGpuTime(gpuInterval, &resGpuUs))
+			return CONTINUE;
+
 		m_interleavedResults.push_back(resEndUs - resBeginUs);
 
+		if (m_gpuTimer)
+			m_interleavedGpuResults.push_back(resGpuUs);
+
 		return CONTINUE;
 	}
 	else if ((int)m_batchedResults.size() < m_iterationCount)
@@ -600,6 +693,8 @@ tcu::TestCase::IterateResult StateChangePerformanceCase::iterate (void)
 		const glw::Functions&	gl			= m_renderCtx.getFunctions();
 		deUint64				refBeginUs	= 0;
 		deUint64				refEndUs	= 0;
+		deUint64				refGpuUs	= 0;
+		int						gpuInterval	= -1;
 
 		setupInitialState(gl);
 		gl.finish();
@@ -607,15 +702,25 @@ tcu::TestCase::IterateResult StateChangePerformanceCase::iterate (void)
 
 		// Render reference
 		refBeginUs = deGetMicroseconds();
+		gpuInterval = beginGpuTimer();
 
 		renderReference(gl);
 
+		if (m_gpuTimer)
+			m_gpuTimer->end();
+
 		gl.finish();
 		refEndUs = deGetMicroseconds();
 		GLU_EXPECT_NO_ERROR(gl.getError(), "glFinish()");
 
+		if (!readGpuTime(gpuInterval, &refGpuUs))
+			return CONTINUE;
+
 		m_batchedResults.push_back(refEndUs - refBeginUs);
 
+		if (m_gpuTimer)
+			m_batchedGpuResults.push_back(refGpuUs);
+
 		return CONTINUE;
 	}
 	else
@@ -42,6 +42,8 @@ namespace deqp
 namespace gls
 {
 
+class GpuTimer;
+
 class StateChangePerformanceCase : public tcu::TestCase
 {
 public:
@@ -78,6 +80,9 @@ protected:
 
 	void								logAndSetTestResult				(void);
 
+	int									beginGpuTimer					(void);
+	bool								readGpuTime						(int intervalId, deUint64* elapsedUs);
+
 protected:
 	glu::RenderContext&					m_renderCtx;
 
@@ -103,6 +108,12 @@ private:
 
 	std::vector<deUint64>				m_interleavedResults;
 	std::vector<deUint64>				m_batchedResults;
+
+	// GPU times of same samples, empty if GPU timer is not used.
+	GpuTimer*							m_gpuTimer;
+	int									m_numDisjointSamples;
+	std::vector<deUint64>				m_interleavedGpuResults;
+	std::vector<deUint64>				m_batchedGpuResults;
 };
 
 class StateChangeCallPerformanceCase : public tcu::TestCase
@@ -46,6 +46,7 @@
 #include "deFloat16.h"
 #include "deMath.h"
 #include "deSha1.h"
+#include "deHash128.h"
 #include "deMemory.h"
 
 // decpp
@@ -164,6 +165,7 @@ public:
 		addChild(new SelfCheckCase(m_testCtx, "float16",	"deFloat16_selfTest()",	deFloat16_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "math",		"deMath_selfTest()",	deMath_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "sha1",		"deSha1_selfTest()",	deSha1_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "hash128",	"deHash128_selfTest()",	deHash128_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "memory",		"deMemory_selfTest()",	deMemory_selfTest));
 	}
 };
@@ -35,11 +35,14 @@
 #include "tcuTextureUtil.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuFloat.hpp"
+#include "tcuHarnessProfile.hpp"
 
 #include "deRandom.hpp"
 #include "deArrayUtil.hpp"
+#include "deFile.h"
 
 #include <stdexcept>
+#include <fstream>
 
 namespace dit
 {
@@ -881,6 +884,139 @@ protected:
 	vector<SubCase>::const_iterator	m_caseIter;
 };
 
+const char* const s_harnessProfileTestFile = "harness-profile-selftest.txt";
+
+//! Profile with given per case CPU time for the Case and Logging phases, other phases empty.
+tcu::HarnessProfile makeHarnessProfile (int numCases, deUint64 caseUsPerCase, deUint64 loggingUsPerCase, deUint64 caseAllocsPerCase)
+{
+	tcu::HarnessProfile profile;
+
+	profile.numCases											= numCases;
+	profile.hasAllocationCounts									= true;
+	profile.phases[tcu::HARNESS_PHASE_CASE].cpuTimeUs			= caseUsPerCase * numCases;
+	profile.phases[tcu::HARNESS_PHASE_CASE].wallTimeUs			= caseUsPerCase * numCases;
+	profile.phases[tcu::HARNESS_PHASE_CASE].numAllocations		= caseAllocsPerCase * numCases;
+	profile.phases[tcu::HARNESS_PHASE_CASE].numEntries			= numCases;
+	profile.phases[tcu::HARNESS_PHASE_LOGGING].cpuTimeUs		= loggingUsPerCase * numCases;
+	profile.phases[tcu::HARNESS_PHASE_LOGGING].wallTimeUs		= loggingUsPerCase * numCases;
+	profile.phases[tcu::HARNESS_PHASE_LOGGING].numEntries		= numCases;
+
+	return profile;
+}
+
+bool isHarnessProfileReadError (const char* contents)
+{
+	{
+		std::ofstream file (s_harnessProfileTestFile, std::ios_base::out | std::ios_base::trunc);
+		file << contents;
+	}
+
+	try
+	{
+		tcu::readHarnessProfile(s_harnessProfileTestFile);
+		deDeleteFile(s_harnessProfileTestFile);
+		return false;
+	}
+	catch (const tcu::ResourceError&)
+	{
+		deDeleteFile(s_harnessProfileTestFile);
+		return true;
+	}
+}
+
+void harnessProfileFileTest (void)
+{
+	tcu::HarnessProfile profile;
+
+	profile.numCases			= 42;
+	profile.hasAllocationCounts	= true;
+
+	for (int phaseNdx = 0; phaseNdx < tcu::HARNESS_PHASE_LAST; ++phaseNdx)
+	{
+		profile.phases[phaseNdx].cpuTimeUs		= 1000u * phaseNdx + 1u;
+		profile.phases[phaseNdx].wallTimeUs		= 1000u * phaseNdx + 2u;
+		profile.phases[phaseNdx].numAllocations	= 1000u * phaseNdx + 3u;
+		profile.phases[phaseNdx].numEntries		= 1000u * phaseNdx + 4u;
+	}
+
+	tcu::writeHarnessProfile(s_harnessProfileTestFile, profile);
+
+	{
+		const tcu::HarnessProfile readProfile = tcu::readHarnessProfile(s_harnessProfileTestFile);
+
+		deDeleteFile(s_harnessProfileTestFile);
+
+		TCU_CHECK(readProfile.numCases == profile.numCases);
+		TCU_CHECK(readProfile.hasAllocationCounts == profile.hasAllocationCounts);
+
+		for (int phaseNdx = 0; phaseNdx < tcu::HARNESS_PHASE_LAST; ++phaseNdx)
+		{
+			TCU_CHECK(readProfile.phases[phaseNdx].cpuTimeUs == profile.phases[phaseNdx].cpuTimeUs);
+			TCU_CHECK(readProfile.phases[phaseNdx].wallTimeUs == profile.phases[phaseNdx].wallTimeUs);
+			TCU_CHECK(readProfile.phases[phaseNdx].numAllocations == profile.phases[phaseNdx].numAllocations);
+			TCU_CHECK(readProfile.phases[phaseNdx].numEntries == profile.phases[phaseNdx].numEntries);
+		}
+	}
+
+	// Phases unknown to this version are skipped
+	TCU_CHECK(!isHarnessProfileReadError("#HarnessProfile 1\nCases 1\nAllocationCounts 0\nNewPhase 1 2 3 4\n"));
+}
+
+void harnessProfileMalformedFileTest (void)
+{
+	TCU_CHECK(isHarnessProfileReadError(""));
+	TCU_CHECK(isHarnessProfileReadError("Cases 1\n"));
+	TCU_CHECK(isHarnessProfileReadError("#HarnessProfile 2\nCases 1\n"));
+	TCU_CHECK(isHarnessProfileReadError("#HarnessProfile 1\nCases many\n"));
+	TCU_CHECK(isHarnessProfileReadError("#HarnessProfile 1\nCases 1\nLogging 1 2\n"));
+	TCU_CHECK(isHarnessProfileReadError("#HarnessProfile 1\nCases 1\nCase 1 2 x 4\n"));
+
+	deDeleteFile(s_harnessProfileTestFile);
+
+	try
+	{
+		tcu::readHarnessProfile(s_harnessProfileTestFile);
+		TCU_FAIL("Reading missing harness profile did not fail");
+	}
+	catch (const tcu::ResourceError&)
+	{
+	}
+}
+
+void harnessProfileRegressionTest (void)
+{
+	// Baseline total is 1010 us per case, so the noise floor is 10.1 us per case
+	const tcu::HarnessProfile	baseline		= makeHarnessProfile(100, 1000u, 10u, 50u);
+	const int					threshold		= 10;
+	tcu::HarnessProfile			noAllocations	= makeHarnessProfile(100, 1000u, 10u, 100u);
+
+	noAllocations.hasAllocationCounts = false;
+
+	TCU_CHECK(!tcu::printHarnessProfileSummary(baseline, &baseline, threshold));
+
+	// Within threshold
+	TCU_CHECK(!tcu::printHarnessProfileSummary(makeHarnessProfile(100, 1050u, 10u, 50u), &baseline, threshold));
+
+	// Over threshold
+	TCU_CHECK(tcu::printHarnessProfileSummary(makeHarnessProfile(100, 1200u, 10u, 50u), &baseline, threshold));
+
+	// Same per case cost with more cases
+	TCU_CHECK(!tcu::printHarnessProfileSummary(makeHarnessProfile(300, 1000u, 10u, 50u), &baseline, threshold));
+
+	// Small phase grows over threshold, but by less than the noise floor
+	TCU_CHECK(!tcu::printHarnessProfileSummary(makeHarnessProfile(100, 1000u, 18u, 50u), &baseline, threshold));
+
+	// Small phase grows by more than the noise floor
+	TCU_CHECK(tcu::printHarnessProfileSummary(makeHarnessProfile(100, 1000u, 30u, 50u), &baseline, threshold));
+
+	// Allocation counts are compared only if both profiles have them
+	TCU_CHECK(tcu::printHarnessProfileSummary(makeHarnessProfile(100, 1000u, 10u, 100u), &baseline, threshold));
+	TCU_CHECK(!tcu::printHarnessProfileSummary(noAllocations, &baseline, threshold));
+
+	// Nothing regresses without baseline
+	TCU_CHECK(!tcu::printHarnessProfileSummary(makeHarnessProfile(100, 5000u, 500u, 500u), DE_NULL, threshold));
+}
+
 class CommonFrameworkTests : public tcu::TestCaseGroup
 {
 public:
@@ -895,6 +1031,12 @@ public:
 								   tcu::FloatFormat_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "either","tcu::Either_selfTest()",
 								   tcu::Either_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "harness_profile_file", "Harness profile write and read",
+								   harnessProfileFileTest));
+		addChild(new SelfCheckCase(m_testCtx, "harness_profile_malformed_file", "Harness profile read errors",
+								   harnessProfileMalformedFileTest));
+		addChild(new SelfCheckCase(m_testCtx, "harness_profile_regression", "Harness profile regression detection",
+								   harnessProfileRegressionTest));
 	}
 };
 